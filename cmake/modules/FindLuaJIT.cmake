@@ -34,6 +34,10 @@ if(NOT TARGET lua::lua)
     set_target_properties(lua::lua PROPERTIES
         INTERFACE_INCLUDE_DIRECTORIES "${LUAJIT_INCLUDE_DIR}"
         IMPORTED_LOCATION "${LUAJIT_LIBRARY}")
+    if(UNIX)
+        # needed when linking the static libluajit archive
+        set_property(TARGET lua::lua APPEND PROPERTY INTERFACE_LINK_LIBRARIES ${CMAKE_DL_LIBS} m)
+    endif()
 endif()
 
 mark_as_advanced(LUAJIT_INCLUDE_DIR LUAJIT_LIBRARY)
@@ -140,6 +140,24 @@ namespace ramses
         */
         [[nodiscard]] uint32_t getInstanceCount() const;
 
+        /**
+        * @brief Allows or forbids the renderer to skip this mesh when it is outside of the camera frustum.
+        *
+        * Frustum culling has effect only if enabled on the display (see #ramses::DisplayConfig::setFrustumCullingEnabled).
+        * The renderer computes bounding volumes from the mesh vertex positions, it cannot know about vertices
+        * displaced in the vertex shader - disable culling for such meshes to avoid them being wrongly skipped.
+        *
+        * @param[in] enabled false to always render this mesh regardless of its bounding volume (default: true)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setFrustumCullingEnabled(bool enabled);
+
+        /**
+        * @brief Checks if the renderer may skip this mesh when it is outside of the camera frustum.
+        * @return true if frustum culling is allowed for this mesh (default), false otherwise.
+        */
+        [[nodiscard]] bool isFrustumCullingEnabled() const;
+
         /**
          * Get the internal data for implementation specifics of MeshNode.
          */
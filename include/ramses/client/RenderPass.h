@@ -221,6 +221,30 @@ namespace ramses
         */
         bool retriggerRenderOnce();
 
+        /**
+        * @brief Set whether the renderer may reorder meshes with equal render order to minimize state changes.
+        * @details Meshes within a render group are rendered in order given by their render order (see #ramses::RenderGroup::addMeshNode).
+        *          The renderer always orders meshes which have equal render order by effect and geometry.
+        *          With state sorting enabled, meshes with equal render order are in addition grouped by their appearance
+        *          (uniform values and textures), so that the number of shader, texture, vertex array and render state
+        *          changes between consecutive draw calls is minimized. Order of effects has highest priority,
+        *          followed by appearance, geometry and finally render state.
+        *
+        *          Meshes with different render order are never reordered, use distinct render orders for meshes
+        *          which rely on a specific drawing order (e.g. blended meshes).
+        *
+        * @param enable The flag which indicates if meshes with equal render order are sorted by state (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setStateSortingEnabled(bool enable);
+
+        /**
+        * @brief Get the state sorting mode of the render pass
+        *
+        * @return Indicates if meshes with equal render order are sorted by state
+        */
+        [[nodiscard]] bool isStateSortingEnabled() const;
+
         /**
          * Get the internal data for implementation specifics of RenderPass.
          */
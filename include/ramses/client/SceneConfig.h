@@ -12,6 +12,7 @@
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/EScenePublicationMode.h"
 #include "ramses/framework/ERenderBackendCompatibility.h"
+#include "ramses/framework/ETransmissionPriority.h"
 
 #include <memory>
 
@@ -85,6 +86,24 @@ namespace ramses
          */
         void setRenderBackendCompatibility(ERenderBackendCompatibility renderBackendCompatibility);
 
+        /**
+         * Set priority of sending scene data to remote renderers, see #ramses::ETransmissionPriority for details.
+         * Has no effect on local renderers.
+         *
+         * @param priority Transmission priority of scene. #ramses::ETransmissionPriority::Normal is default.
+         */
+        void setTransmissionPriority(ETransmissionPriority priority);
+
+        /**
+         * Enables sending updates of data buffers and texture buffers to remote renderers as delta to their previous content.
+         * When enabled, an update which changes only a small part of the updated range is sent as the changed bytes only,
+         * otherwise the full updated range is sent.
+         * Has no effect on local renderers.
+         *
+         * @param enabled flag to enable/disable delta encoding of buffer updates. Disabled by default.
+         */
+        void setBufferDeltaEncodingEnabled(bool enabled);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -460,6 +460,20 @@ namespace ramses
         */
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
 
+        /**
+        * Returns the Ramses scene objects (e.g. nodes, appearances, cameras) bound to all binding nodes which were executed
+        * during last call to #update, i.e. objects whose state may have been modified by the logic.
+        * Every object is listed only once, in the order of execution of the bindings.
+        * This allows the application to track which scene objects were changed by the logic without
+        * inspecting every binding. Bindings are only executed if their inputs changed, so in a steady state
+        * with few changing inputs the list stays short.
+        * The list is only relevant for the last #update and is overwritten during next #update.
+        * Note that if #update fails the list contains only objects of bindings executed before the failure.
+        *
+        * @return scene objects bound to bindings executed during last #update
+        */
+        [[nodiscard]] const std::vector<const SceneObject*>& getSceneObjectsUpdatedByBindings() const;
+
         /**
         * Set the logging rate, i.e. how often statistics will be logged. Logging rate of \c N means
         * every \c Nth call to #update statistics will be logged.
@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace ramses
+{
+    /**
+    * @ingroup CoreAPI
+    * Specifies how urgently data of a scene is sent to remote renderers.
+    *
+    * Each priority is sent in its own lane per connection. Data of a scene is only sent when there is no pending data
+    * of a scene with higher priority, large scene updates are interleaved in chunks so that they do not block
+    * small updates of a scene with higher priority. Messages needed to keep the connection alive are always sent first.
+    * The bandwidth used by each lane can be limited with #ramses::RamsesFrameworkConfig::setTransmissionBandwidthLimit.
+    */
+    enum class ETransmissionPriority : uint8_t
+    {
+        High,    ///< for scenes with time critical content which must not wait for other scenes
+        Normal,  ///< default priority
+        Low,     ///< for scenes which can tolerate delays, e.g. background content with large resources
+    };
+}
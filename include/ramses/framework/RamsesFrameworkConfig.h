@@ -12,6 +12,7 @@
 #include "ramses/framework/APIExport.h"
 #include "ramses/framework/EFeatureLevel.h"
 #include "ramses/framework/RamsesFrameworkTypes.h"
+#include "ramses/framework/ETransmissionPriority.h"
 #include <memory>
 #include <chrono>
 #include <string_view>
@@ -256,6 +257,62 @@ namespace ramses
         */
         bool setConnectionKeepaliveSettings(std::chrono::milliseconds interval, std::chrono::milliseconds timeout);
 
+        /**
+        * @brief Limits the bandwidth used for sending scenes of given priority to each remote participant
+        *
+        * Scene data above the limit stays queued until the average rate falls below the limit again,
+        * so that scenes with lower priority cannot saturate the network. Messages needed to keep the connection alive are never limited.
+        * See #ramses::ETransmissionPriority and #ramses::SceneConfig::setTransmissionPriority.
+        *
+        * @param priority transmission priority to limit
+        * @param bytesPerSecond maximum average bandwidth in bytes per second, 0 for no limit (default)
+        */
+        void setTransmissionBandwidthLimit(ETransmissionPriority priority, uint64_t bytesPerSecond);
+
+        /**
+        * @brief Sets the number of threads handling messages received from remote participants
+        *
+        * Messages of one remote participant are always handled in order on one thread at a time, messages of
+        * different remote participants are handled in parallel. Increasing the count helps a renderer receiving
+        * scenes from many clients. Socket reads and writes stay on a single connection thread.
+        *
+        * @param threadCount number of threads, must be at least 1 (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setConnectionThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables unix domain sockets for connections between participants on the same host
+        *
+        * Each participant additionally listens on a unix domain socket in the given directory, the socket file
+        * is named after the TCP port of the participant. Participants on the same host connect via this socket
+        * instead of TCP which avoids the TCP overhead for frequent small messages. Message framing and keepalive
+        * are the same as for TCP. Connections to participants on other hosts or to participants without unix
+        * domain sockets enabled fall back to TCP. The directory must exist and be the same for all participants
+        * of the host, including the daemon. Has no effect on platforms without unix domain socket support.
+        *
+        * @param directory directory for socket files, empty disables unix domain sockets (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setUnixSocketDirectoryForTCPCommunication(std::string_view directory);
+
+        /**
+        * @brief Enables tracing of scene flushes from client to renderer and sets the file to write the traces to
+        *
+        * Every flush is traced with timestamps of the stages it passes in this process: flush call, serialization
+        * and sending on client side, receiving, deserialization, pending, resources ready, applied and first
+        * rendered frame on renderer side. A flush is identified by its scene id and flush index in both processes.
+        * The traces are written as Chrome trace event JSON when the framework is destroyed, the file can be opened
+        * in Perfetto or chrome://tracing. To see the whole path of flushes enable tracing in client and renderer
+        * process and combine the traceEvents of both files. Timestamps are taken from the synchronized clock,
+        * so traces of different hosts only line up if their clocks are synchronized.
+        *
+        * Tracing has a small overhead per flush and is meant for analyzing latency, it is disabled by default.
+        *
+        * @param traceFile path of the JSON file to write, empty disables tracing (default)
+        */
+        void setFlushTraceFile(std::string_view traceFile);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -259,6 +259,7 @@ namespace ramses
     enum class EConnectionSystem : uint32_t
     {
         TCP,
-        Off
+        Off,
+        SharedMemory ///< Participants on same Linux host exchange scene updates through shared memory, TCP is used for discovery and everything else
     };
 }
@@ -359,6 +359,60 @@ namespace ramses
         */
         bool setAsyncEffectUploadEnabled(bool enabled);
 
+        /**
+        * @brief   Sets whether the renderer skips meshes which are outside of the frustum of the render pass camera.
+        *          By default frustum culling is disabled.
+        * @details When enabled, the renderer computes a bounding sphere for every vertex array resource when it is uploaded
+        *          and skips draw calls of meshes whose transformed bounding sphere lies fully outside of the camera frustum.
+        *          The bounding volume of a mesh encloses all of its vec3/vec4 float vertex attributes, so it contains
+        *          the positions regardless of which attribute holds them. It is transformed by the world matrix of the mesh node,
+        *          so only meshes whose effect uses a model matrix semantic (#ramses::EEffectUniformSemantic::ModelMatrix,
+        *          ModelViewMatrix, ModelViewProjectionMatrix, ModelBlock or ModelCameraBlock) are culled.
+        *          Meshes with vec2 vertex attributes, vec4 vertex attributes whose w is not 1, instancing, data buffers
+        *          or interleaved vertex data are never culled.
+        *          Vertex shaders which displace vertices beyond their original bounds can make meshes disappear wrongly,
+        *          such meshes can opt out using #ramses::MeshNode::setFrustumCullingEnabled.
+        *
+        * @param[in] enabled Set to true to enable frustum culling, false to disable it.
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setFrustumCullingEnabled(bool enabled);
+
+        /**
+        * @brief   Sets whether the renderer draws consecutive identical meshes with a single instanced draw call.
+        *          By default automatic instancing is disabled.
+        * @details When enabled, meshes which are rendered right after each other within a render pass and use the same effect,
+        *          geometry, uniform inputs and render state are drawn as instances of a single draw call. Only the model dependent
+        *          semantic uniforms (#ramses::EEffectUniformSemantic::ModelMatrix, ModelViewMatrix, ModelViewMatrix33,
+        *          ModelViewProjectionMatrix and NormalMatrix) can differ per instance, the renderer provides them as per-instance
+        *          vertex attributes of an automatically derived variant of the effect.
+        *          Effects which use these uniforms outside of the vertex shader, declare them in a way the renderer cannot rewrite
+        *          or use gl_InstanceID are always drawn without automatic instancing.
+        *          Supported only with OpenGL based devices, otherwise this setting has no effect.
+        *
+        * @param[in] enabled Set to true to enable automatic instancing, false to disable it.
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAutoInstancingEnabled(bool enabled);
+
+        /**
+        * @brief   Sets number of worker threads which prepare rendering of scenes in parallel.
+        *          By default there are no worker threads and scenes are prepared and rendered by the display thread.
+        * @details When set to non-zero, rendering of scenes into the display framebuffer and into offscreen buffers is split in two stages:
+        *          the worker threads (together with the display thread) execute scenes into device independent rendering command lists,
+        *          one scene per thread at a time, afterwards the display thread submits the command lists to the device in order.
+        *          This is beneficial for displays showing multiple scenes with many meshes each.
+        *          Interruptible offscreen buffers are always rendered by the display thread.
+        *          Meshes of scenes prepared by worker threads are rendered without automatic instancing (see #setAutoInstancingEnabled).
+        *
+        * @param[in] threadCount Number of worker threads, 0 disables parallel preparation.
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setRenderPreparationThreadCount(uint32_t threadCount);
+
         /**
          * @brief      Set the name to be used for the embedded compositing
          *             display socket name.
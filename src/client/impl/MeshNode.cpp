@@ -110,6 +110,18 @@ namespace ramses
         return m_impl.getInstanceCount();
     }
 
+    bool MeshNode::setFrustumCullingEnabled(bool enabled)
+    {
+        const bool status = m_impl.setFrustumCullingEnabled(enabled);
+        LOG_HL_CLIENT_API1(status, enabled);
+        return status;
+    }
+
+    bool MeshNode::isFrustumCullingEnabled() const
+    {
+        return m_impl.isFrustumCullingEnabled();
+    }
+
     internal::MeshNodeImpl& MeshNode::impl()
     {
         return m_impl;
@@ -221,6 +221,13 @@ namespace ramses::internal
         return true;
     }
 
+    bool MeshNodeImpl::setFrustumCullingEnabled(bool enabled)
+    {
+        if (enabled != isFrustumCullingEnabled())
+            getIScene().setRenderableFrustumCulling(m_renderableHandle, enabled);
+        return true;
+    }
+
     ramses::internal::RenderableHandle MeshNodeImpl::getRenderableHandle() const
     {
         return m_renderableHandle;
@@ -297,4 +304,9 @@ namespace ramses::internal
     {
         return getIScene().getRenderable(m_renderableHandle).startVertex;
     }
+
+    bool MeshNodeImpl::isFrustumCullingEnabled() const
+    {
+        return getIScene().getRenderable(m_renderableHandle).frustumCulling;
+    }
 }
@@ -55,6 +55,8 @@ namespace ramses::internal
         [[nodiscard]] uint32_t getInstanceCount() const;
         bool setStartVertex(uint32_t startVertex);
         [[nodiscard]] uint32_t getStartVertex() const;
+        bool setFrustumCullingEnabled(bool enabled);
+        [[nodiscard]] bool isFrustumCullingEnabled() const;
 
         [[nodiscard]] ramses::internal::RenderableHandle   getRenderableHandle() const;
 
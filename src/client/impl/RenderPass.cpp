@@ -151,6 +151,18 @@ namespace ramses
         return status;
     }
 
+    bool RenderPass::setStateSortingEnabled(bool enable)
+    {
+        const bool status = m_impl.setStateSortingEnabled(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isStateSortingEnabled() const
+    {
+        return m_impl.isStateSortingEnabled();
+    }
+
     internal::RenderPassImpl& RenderPass::impl()
     {
         return m_impl;
@@ -394,4 +394,16 @@ namespace ramses::internal
         getIScene().retriggerRenderPassRenderOnce(m_renderPassHandle);
         return true;
     }
+
+    bool RenderPassImpl::setStateSortingEnabled(bool enable)
+    {
+        if (enable != isStateSortingEnabled())
+            getIScene().setRenderPassStateSorting(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::isStateSortingEnabled() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).stateSorting;
+    }
 }
@@ -12,6 +12,7 @@
 // internal
 #include "impl/SceneConfigImpl.h"
 #include "impl/APILoggingMacros.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
 
 namespace ramses
 {
@@ -78,4 +79,16 @@ namespace ramses
         m_impl->setRenderBackendCompatibility(renderBackendCompatibility);
         LOG_HL_CLIENT_API1(true, renderBackendCompatibility);
     }
+
+    void SceneConfig::setTransmissionPriority(ETransmissionPriority priority)
+    {
+        m_impl->setTransmissionPriority(priority);
+        LOG_HL_CLIENT_API1(true, priority);
+    }
+
+    void SceneConfig::setBufferDeltaEncodingEnabled(bool enabled)
+    {
+        m_impl->setBufferDeltaEncodingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
 }
@@ -49,4 +49,24 @@ namespace ramses::internal
     {
         return m_renderBackendCompatibility;
     }
+
+    void SceneConfigImpl::setTransmissionPriority(ETransmissionPriority priority)
+    {
+        m_transmissionPriority = priority;
+    }
+
+    ETransmissionPriority SceneConfigImpl::getTransmissionPriority() const
+    {
+        return m_transmissionPriority;
+    }
+
+    void SceneConfigImpl::setBufferDeltaEncodingEnabled(bool enabled)
+    {
+        m_bufferDeltaEncodingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getBufferDeltaEncodingEnabled() const
+    {
+        return m_bufferDeltaEncodingEnabled;
+    }
 }
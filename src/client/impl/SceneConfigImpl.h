@@ -11,6 +11,7 @@
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/EScenePublicationMode.h"
 #include "ramses/framework/ERenderBackendCompatibility.h"
+#include "ramses/framework/ETransmissionPriority.h"
 
 namespace ramses::internal
 {
@@ -21,16 +22,22 @@ namespace ramses::internal
         void setMemoryVerificationEnabled(bool enabled);
         void setSceneId(sceneId_t sceneId);
         void setRenderBackendCompatibility(ERenderBackendCompatibility renderBackendCompatibility);
+        void setTransmissionPriority(ETransmissionPriority priority);
+        void setBufferDeltaEncodingEnabled(bool enabled);
 
         [[nodiscard]] EScenePublicationMode getPublicationMode() const;
         [[nodiscard]] bool getMemoryVerificationEnabled() const;
         [[nodiscard]] sceneId_t getSceneId() const;
         [[nodiscard]] ERenderBackendCompatibility getRenderBackendCompatibility() const;
+        [[nodiscard]] ETransmissionPriority getTransmissionPriority() const;
+        [[nodiscard]] bool getBufferDeltaEncodingEnabled() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode::LocalOnly;
         sceneId_t m_sceneId;
         bool m_memoryVerificationEnabled = true;
         ERenderBackendCompatibility m_renderBackendCompatibility = ERenderBackendCompatibility::OpenGL;
+        ETransmissionPriority m_transmissionPriority = ETransmissionPriority::Normal;
+        bool m_bufferDeltaEncodingEnabled = false;
     };
 }
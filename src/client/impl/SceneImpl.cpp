@@ -135,6 +135,8 @@ namespace ramses::internal
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
         const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly;
         getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        getClientImpl().getClientApplication().setSceneTransmissionPriority(m_scene.getSceneId(), sceneConfig.getTransmissionPriority());
+        m_scene.setBufferDeltaEncodingEnabled(sceneConfig.getBufferDeltaEncodingEnabled());
     }
 
     SceneImpl::~SceneImpl()
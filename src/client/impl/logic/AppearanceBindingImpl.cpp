@@ -235,10 +235,10 @@ namespace ramses::internal
                         }
                         else
                         {
-                            std::vector<ValueType> values;
-                            values.reserve(inputProperty.getChildCount());
-                            for (size_t i = 0u; i < inputProperty.getChildCount(); ++i)
-                                values.push_back(ValueType{ *inputProperty.getChild(i)->get<ValueType>() });
+                            auto& values = std::get<std::vector<ValueType>>(m_arrayUniformValues);
+                            values.resize(arraySize);
+                            for (size_t i = 0u; i < arraySize; ++i)
+                                values[i] = inputProperty.getChild(i)->impl().getValueAs<ValueType>();
 
                             m_ramsesAppearance.get().setInputValue(m_uniforms[inputIndex], values.size(), values.data());
                         }
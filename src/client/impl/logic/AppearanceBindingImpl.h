@@ -17,7 +17,9 @@
 
 #include <optional>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace ramses
 {
@@ -68,6 +70,16 @@ namespace ramses::internal
     private:
         std::reference_wrapper<ramses::Appearance> m_ramsesAppearance;
         std::vector<ramses::UniformInput> m_uniforms;
+        // Reused contiguous buffers for array uniforms, one per element type, to avoid allocations on each update
+        std::tuple<
+            std::vector<int32_t>,
+            std::vector<float>,
+            std::vector<vec2f>,
+            std::vector<vec3f>,
+            std::vector<vec4f>,
+            std::vector<vec2i>,
+            std::vector<vec3i>,
+            std::vector<vec4i>> m_arrayUniformValues;
 
         void setInputValueToUniform(size_t inputIndex);
 
@@ -200,6 +200,11 @@ namespace ramses
         return m_impl.getLastUpdateReport();
     }
 
+    const std::vector<const SceneObject*>& LogicEngine::getSceneObjectsUpdatedByBindings() const
+    {
+        return m_impl.getSceneObjectsUpdatedByBindings();
+    }
+
     void LogicEngine::setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode)
     {
         m_impl.setStatisticsLoggingRate(loggingRate, mode);
@@ -34,6 +34,7 @@
 #include "impl/SaveFileConfigImpl.h"
 #include "impl/logic/TimerNodeImpl.h"
 #include "impl/logic/SkinBindingImpl.h"
+#include "impl/logic/RamsesBindingImpl.h"
 #include "impl/logic/LogicEngineReportImpl.h"
 #include "impl/logic/RenderGroupBindingElementsImpl.h"
 #include "impl/SceneImpl.h"
@@ -436,7 +437,21 @@ namespace ramses::internal
         // force dirty all timer nodes, anchor points and skinbindings
         setNodeToBeAlwaysUpdatedDirty();
 
-        bool success = updateNodes(*sortedNodes);
+        m_updatedSceneObjects.clear();
+        m_updatedSceneObjectsSet.clear();
+
+        bool success = false;
+        // update report lists also skipped nodes, this requires visiting all of them
+        if (m_nodeDirtyMechanismEnabled && !m_updateReportEnabled)
+        {
+            success = updateDirtyNodes();
+        }
+        else
+        {
+            success = updateNodes(*sortedNodes);
+            if (success)
+                m_apiObjects->getLogicNodeDependencies().resetDirtyNodes();
+        }
 
         // update skin bindings only if updating the other nodes succeeded
         if (success)
@@ -476,6 +491,30 @@ namespace ramses::internal
         return true;
     }
 
+    bool LogicEngineImpl::updateDirtyNodes()
+    {
+        LogicNodeDependencies& dependencies = m_apiObjects->getLogicNodeDependencies();
+
+        bool success = true;
+        while (LogicNodeImpl* node = dependencies.popNextDirtyNode())
+        {
+            // skip processing of SkinBindings, since they will be processed after updating everything else
+            if (dynamic_cast<SkinBindingImpl*>(node))
+                continue;
+
+            if (!updateNode(*node))
+            {
+                // node stays dirty, make sure it is picked up again in next update
+                dependencies.markDirty(*node);
+                success = false;
+                break;
+            }
+        }
+        dependencies.finishDirtyNodesUpdate();
+
+        return success;
+    }
+
     bool LogicEngineImpl::updateSkinBindings()
     {
         for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>()) {
@@ -500,6 +539,13 @@ namespace ramses::internal
             return false;
         }
 
+        if (const auto* binding = dynamic_cast<const RamsesBindingImpl*>(&node))
+        {
+            const SceneObject* boundObject = &binding->getBoundObject();
+            if (m_updatedSceneObjectsSet.insert(boundObject).second)
+                m_updatedSceneObjects.push_back(boundObject);
+        }
+
         Property* outputs = node.getOutputs();
         if (outputs != nullptr)
         {
@@ -660,6 +706,11 @@ namespace ramses::internal
         return LogicEngineReport{ std::make_unique<LogicEngineReportImpl>(m_updateReport) };
     }
 
+    const std::vector<const SceneObject*>& LogicEngineImpl::getSceneObjectsUpdatedByBindings() const
+    {
+        return m_updatedSceneObjects;
+    }
+
     void LogicEngineImpl::setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode)
     {
         m_statistics.setLoggingRate(loggingRate);
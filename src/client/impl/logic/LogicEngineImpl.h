@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <vector>
+#include <unordered_set>
 #include <string>
 #include <string_view>
 
@@ -123,6 +124,7 @@ namespace ramses::internal
 
         void enableUpdateReport(bool enable);
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
+        [[nodiscard]] const std::vector<const SceneObject*>& getSceneObjectsUpdatedByBindings() const;
 
         void setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode = EStatisticsLogMode::Compact);
 
@@ -142,6 +144,7 @@ namespace ramses::internal
         void setNodeToBeAlwaysUpdatedDirty();
 
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateDirtyNodes();
 
         [[nodiscard]] bool updateSkinBindings();
         [[nodiscard]] bool updateNode(LogicNodeImpl& node);
@@ -158,6 +161,10 @@ namespace ramses::internal
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
         std::vector<char>         m_byteBuffer;
+
+        // objects bound to bindings executed during last update, in order of execution
+        std::vector<const SceneObject*> m_updatedSceneObjects;
+        std::unordered_set<const SceneObject*> m_updatedSceneObjectsSet;
     };
 
     template<typename T>
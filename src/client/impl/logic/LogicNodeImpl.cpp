@@ -11,6 +11,7 @@
 #include "ramses/client/logic/Property.h"
 
 #include "impl/logic/PropertyImpl.h"
+#include "internal/logic/LogicNodeDependencies.h"
 
 namespace ramses::internal
 {
@@ -43,6 +44,8 @@ namespace ramses::internal
 
     void LogicNodeImpl::setDirty(bool dirty)
     {
+        if (dirty && !m_dirty && m_dependencies)
+            m_dependencies->markDirty(*this);
         m_dirty = dirty;
     }
 
@@ -51,6 +54,11 @@ namespace ramses::internal
         return m_dirty;
     }
 
+    void LogicNodeImpl::setDependencies(LogicNodeDependencies* dependencies)
+    {
+        m_dependencies = dependencies;
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
     {
         assert(!m_inputs);
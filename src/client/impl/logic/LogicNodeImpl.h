@@ -20,6 +20,8 @@ namespace ramses::internal
 {
     struct LogicNodeRuntimeError { std::string message; };
 
+    class LogicNodeDependencies;
+
     class LogicNodeImpl : public LogicObjectImpl
     {
     public:
@@ -39,6 +41,9 @@ namespace ramses::internal
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Set by LogicNodeDependencies which node belongs to, is notified whenever node becomes dirty
+        void setDependencies(LogicNodeDependencies* dependencies);
+
     protected:
         void setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
 
@@ -48,5 +53,6 @@ namespace ramses::internal
 
         // Dirty after creation (every node gets executed at least once after creation)
         bool m_dirty = true;
+        LogicNodeDependencies* m_dependencies = nullptr;
     };
 }
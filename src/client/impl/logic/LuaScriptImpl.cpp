@@ -38,6 +38,9 @@ namespace ramses::internal
         , m_hasDebugLogFunctions{ compiledScript.source.hasDebugLogFunctions }
     {
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
+
+        m_wrappedRootInput.bindFieldNames(m_runFunction.lua_state());
+        m_wrappedRootOutput.bindFieldNames(m_runFunction.lua_state());
     }
 
     void LuaScriptImpl::createRootProperties()
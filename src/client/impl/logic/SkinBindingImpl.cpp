@@ -14,6 +14,7 @@
 #include "ramses/client/Effect.h"
 #include "impl/ErrorReporting.h"
 #include "internal/logic/DeserializationMap.h"
+#include "internal/logic/MatrixBatch.h"
 #include "internal/logic/flatbuffers/generated/SkinBindingGen.h"
 #include "fmt/format.h"
 #include "glm/gtc/type_ptr.hpp"
@@ -152,17 +153,14 @@ namespace ramses::internal
 
     std::optional<LogicNodeRuntimeError> SkinBindingImpl::update()
     {
-        m_jointMatricesArray.clear();
+        // gather world matrices first (scene access), then compute all joint matrices in one batch in-place
+        m_jointMatricesArray.resize(m_joints.size());
         for (size_t i = 0u; i < m_joints.size(); ++i)
         {
-            matrix44f jointNodeWorld;
-            if (!m_joints[i]->getRamsesNode().getModelMatrix(jointNodeWorld))
+            if (!m_joints[i]->getRamsesNode().getModelMatrix(m_jointMatricesArray[i]))
                 return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
-            const auto& inverseBindMatForJoint = m_inverseBindMatrices[i];
-            const auto jointMat = jointNodeWorld * inverseBindMatForJoint;
-
-            m_jointMatricesArray.emplace_back(jointMat);
         }
+        MatrixBatch::Multiply(m_jointMatricesArray.data(), m_inverseBindMatrices.data(), m_jointMatricesArray.data(), m_jointMatricesArray.size());
 
         if (!m_appearanceBinding.getRamsesAppearance().setInputValue(m_jointMatInput, uint32_t(m_jointMatricesArray.size()), m_jointMatricesArray.data()))
             return LogicNodeRuntimeError{ "Failed to set matrix array uniform to Ramses appearance!" };
@@ -10,6 +10,7 @@
 #include "internal/Components/IResourceProviderComponent.h"
 #include "internal/Components/ISceneGraphProviderComponent.h"
 #include "internal/Components/ResourceTableOfContents.h"
+#include "internal/Components/ResourceAvailabilityEvent.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "impl/RamsesFrameworkImpl.h"
 #include "internal/Core/Utils/LogMacros.h"
@@ -47,6 +48,12 @@ namespace ramses::internal
         m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, *this);
     }
 
+    void ClientApplicationLogic::setSceneTransmissionPriority(SceneId sceneId, ETransmissionPriority priority)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_scenegraphProviderComponent->handleSetSceneTransmissionPriority(sceneId, priority);
+    }
+
     void ClientApplicationLogic::publishScene(SceneId sceneId, EScenePublicationMode publicationMode)
     {
         PlatformGuard guard(m_frameworkLock);
@@ -140,9 +147,10 @@ namespace ramses::internal
         return ret;
     }
 
-    void ClientApplicationLogic::handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& /*event*/, const Guid& /*rendererId*/)
+    void ClientApplicationLogic::handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& event, const Guid& rendererId)
     {
-        LOG_WARN(CONTEXT_FRAMEWORK, "ClientApplicationLogic::handleResourceAvailabilityEvent: is not implemented yet.");
+        // nothing to do here, resource availability is consumed by scene logic when sending scene to renderer
+        LOG_TRACE(CONTEXT_FRAMEWORK, "ClientApplicationLogic::handleResourceAvailabilityEvent: {} resources available for scene {} at {}", event.availableResources.size(), event.sceneid, rendererId);
     }
 
     ManagedResource ClientApplicationLogic::loadResource(const ResourceContentHash& hash) const
@@ -16,6 +16,7 @@
 
 #include "internal/SceneGraph/SceneAPI/SceneVersionTag.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/Guid.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
@@ -42,6 +43,7 @@ namespace ramses::internal
 
         // Scene handling
         void createScene(ClientScene& scene, bool enableLocalOnlyOptimization);
+        void setSceneTransmissionPriority(SceneId sceneId, ETransmissionPriority priority);
         void publishScene(SceneId sceneId, EScenePublicationMode publicationMode);
         void unpublishScene(SceneId sceneId);
         [[nodiscard]] bool isScenePublished(SceneId sceneId) const;
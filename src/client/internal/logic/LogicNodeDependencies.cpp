@@ -18,6 +18,8 @@
 #include "internal/logic/TypeUtils.h"
 
 #include <cassert>
+#include <algorithm>
+#include <functional>
 #include "fmt/format.h"
 
 namespace ramses::internal
@@ -28,6 +30,10 @@ namespace ramses::internal
         assert(!m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.addNode(node);
         m_nodeTopologyChanged = true;
+
+        node.setDependencies(this);
+        if (node.isDirty())
+            markDirty(node);
     }
 
     void LogicNodeDependencies::removeNode(LogicNodeImpl& node)
@@ -43,6 +49,13 @@ namespace ramses::internal
             NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
             cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
         }
+
+        node.setDependencies(nullptr);
+        m_newDirtyNodes.erase(std::remove(m_newDirtyNodes.begin(), m_newDirtyNodes.end(), &node), m_newDirtyNodes.end());
+        m_deferredDirtyNodes.erase(std::remove(m_deferredDirtyNodes.begin(), m_deferredDirtyNodes.end(), &node), m_deferredDirtyNodes.end());
+        m_dirtyNodesQueue.erase(std::remove_if(m_dirtyNodesQueue.begin(), m_dirtyNodesQueue.end(), [&node](const IndexedNode& n) { return n.second == &node; }), m_dirtyNodesQueue.end());
+        std::make_heap(m_dirtyNodesQueue.begin(), m_dirtyNodesQueue.end(), std::greater<>());
+        m_topologicalIndicesValid = false;
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -93,6 +106,7 @@ namespace ramses::internal
         {
             m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
             m_nodeTopologyChanged = false;
+            m_topologicalIndicesValid = false;
         }
 
         return m_cachedTopologicallySortedNodes;
@@ -224,4 +238,86 @@ namespace ramses::internal
 
         m_logicNodeDAG.removeEdge(binding, node);
     }
+
+    void LogicNodeDependencies::markDirty(LogicNodeImpl& node)
+    {
+        m_newDirtyNodes.push_back(&node);
+    }
+
+    LogicNodeImpl* LogicNodeDependencies::popNextDirtyNode()
+    {
+        updateTopologicalIndices();
+
+        for (LogicNodeImpl* node : m_newDirtyNodes)
+        {
+            const auto it = m_topologicalIndices.find(node);
+            assert(it != m_topologicalIndices.cend());
+            if (m_lastPoppedIndex && it->second <= *m_lastPoppedIndex)
+            {
+                m_deferredDirtyNodes.push_back(node);
+            }
+            else
+            {
+                m_dirtyNodesQueue.emplace_back(it->second, node);
+                std::push_heap(m_dirtyNodesQueue.begin(), m_dirtyNodesQueue.end(), std::greater<>());
+            }
+        }
+        m_newDirtyNodes.clear();
+
+        // same node can be queued more than once (if it was marked dirty again after being cleaned) or not be dirty anymore
+        while (!m_dirtyNodesQueue.empty())
+        {
+            std::pop_heap(m_dirtyNodesQueue.begin(), m_dirtyNodesQueue.end(), std::greater<>());
+            const IndexedNode next = m_dirtyNodesQueue.back();
+            m_dirtyNodesQueue.pop_back();
+            if (next.second->isDirty() && next.first != m_lastPoppedIndex)
+            {
+                m_lastPoppedIndex = next.first;
+                return next.second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void LogicNodeDependencies::finishDirtyNodesUpdate()
+    {
+        m_lastPoppedIndex.reset();
+        m_newDirtyNodes.insert(m_newDirtyNodes.end(), m_deferredDirtyNodes.cbegin(), m_deferredDirtyNodes.cend());
+        m_deferredDirtyNodes.clear();
+    }
+
+    void LogicNodeDependencies::resetDirtyNodes()
+    {
+        assert(m_cachedTopologicallySortedNodes && !m_nodeTopologyChanged);
+        m_newDirtyNodes.clear();
+        m_deferredDirtyNodes.clear();
+        m_dirtyNodesQueue.clear();
+        m_lastPoppedIndex.reset();
+        for (LogicNodeImpl* node : *m_cachedTopologicallySortedNodes)
+        {
+            if (node->isDirty())
+                m_newDirtyNodes.push_back(node);
+        }
+    }
+
+    void LogicNodeDependencies::updateTopologicalIndices()
+    {
+        if (m_topologicalIndicesValid)
+            return;
+
+        assert(m_cachedTopologicallySortedNodes && !m_nodeTopologyChanged);
+        const NodeVector& sortedNodes = *m_cachedTopologicallySortedNodes;
+        m_topologicalIndices.clear();
+        m_topologicalIndices.reserve(sortedNodes.size());
+        for (size_t i = 0u; i < sortedNodes.size(); ++i)
+            m_topologicalIndices.emplace(sortedNodes[i], i);
+
+        // queued nodes are keyed by previous indices, sort them in again
+        for (const IndexedNode& queued : m_dirtyNodesQueue)
+            m_newDirtyNodes.push_back(queued.second);
+        m_dirtyNodesQueue.clear();
+
+        m_topologicalIndicesValid = true;
+    }
 }
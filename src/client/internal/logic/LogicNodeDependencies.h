@@ -11,6 +11,7 @@
 #include "internal/logic/DirectedAcyclicGraph.h"
 
 #include <unordered_set>
+#include <unordered_map>
 
 namespace ramses::internal
 {
@@ -42,6 +43,17 @@ namespace ramses::internal
         void addBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
         void removeBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
 
+        // Dirty nodes worklist, allows to update only dirty nodes (and nodes they dirty via links)
+        // without visiting every node. Nodes are popped in topological order, nodes which become dirty
+        // after a node with higher or equal topological index was popped (e.g. targets of weak links)
+        // are kept for the next update - same as if all sorted nodes were traversed.
+        // Topological sorting must be up to date (getTopologicallySortedNodes) before popping nodes.
+        void markDirty(LogicNodeImpl& node);
+        [[nodiscard]] LogicNodeImpl* popNextDirtyNode();
+        void finishDirtyNodesUpdate();
+        // Rebuilds the worklist from the dirty flags of all nodes, needed after updating without the worklist
+        void resetDirtyNodes();
+
     private:
         DirectedAcyclicGraph m_logicNodeDAG;
 
@@ -50,5 +62,18 @@ namespace ramses::internal
         // Initial state: no nodes and no need to re-compute node topology
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
         bool m_nodeTopologyChanged = false;
+
+        void updateTopologicalIndices();
+
+        using IndexedNode = std::pair<size_t, LogicNodeImpl*>;
+        // Nodes marked dirty but not yet queued
+        NodeVector m_newDirtyNodes;
+        // Min-heap of dirty nodes by their index in topologically sorted nodes
+        std::vector<IndexedNode> m_dirtyNodesQueue;
+        // Nodes which became dirty 'behind' the last popped node, queued in next update
+        NodeVector m_deferredDirtyNodes;
+        std::optional<size_t> m_lastPoppedIndex;
+        std::unordered_map<const LogicNodeImpl*, size_t> m_topologicalIndices;
+        bool m_topologicalIndicesValid = false;
     };
 }
@@ -47,19 +47,32 @@ namespace ramses::internal
 
         if (!byteCodeFromPrecompiledScript.empty())
         {
-            ScopedEnvironmentProtection p(env, EEnvProtectionFlag::LoadScript);
-            main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledScript.as_string_view(), debuggingName, env);
-            if (!main_result.valid())
+            std::string byteCodeError;
+            if (SolState::IsCompatibleByteCode(byteCodeFromPrecompiledScript.as_string_view()))
+            {
+                ScopedEnvironmentProtection p(env, EEnvProtectionFlag::LoadScript);
+                main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledScript.as_string_view(), debuggingName, env);
+                if (!main_result.valid())
+                {
+                    sol::error error = main_result;
+                    byteCodeError = error.what();
+                }
+            }
+            else
+            {
+                byteCodeError = fmt::format("byte code was not generated by the Lua runtime in use ({})", SolState::GetRuntimeName());
+            }
+
+            if (!byteCodeError.empty())
             {
-                sol::error error = main_result;
                 if (source.empty())
                 {
-                    errorReporting.set(fmt::format("Fatal error during loading of LuaScript '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, error.what()),
+                    errorReporting.set(fmt::format("Fatal error during loading of LuaScript '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, byteCodeError),
                         nullptr);
                     return std::nullopt;
                 }
 
-                LOG_WARN(CONTEXT_CLIENT, "Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, error.what());
+                LOG_WARN(CONTEXT_CLIENT, "Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, byteCodeError);
                 byteCodeFromPrecompiledScript.clear();
             }
         }
@@ -313,20 +326,32 @@ namespace ramses::internal
         const std::string debuggingName = "RL_lua_module";
         if (!byteCodeFromPrecompiledModule.empty())
         {
-            ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
-            main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledModule.as_string_view(), debuggingName, env);
+            std::string byteCodeError;
+            if (SolState::IsCompatibleByteCode(byteCodeFromPrecompiledModule.as_string_view()))
+            {
+                ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
+                main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledModule.as_string_view(), debuggingName, env);
+                if (!main_result.valid())
+                {
+                    sol::error error = main_result;
+                    byteCodeError = error.what();
+                }
+            }
+            else
+            {
+                byteCodeError = fmt::format("byte code was not generated by the Lua runtime in use ({})", SolState::GetRuntimeName());
+            }
 
-            if (!main_result.valid())
+            if (!byteCodeError.empty())
             {
-                sol::error error = main_result;
                 if (source.empty())
                 {
-                    errorReporting.set(fmt::format("Fatal error during loading of LuaModule '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, error.what()),
+                    errorReporting.set(fmt::format("Fatal error during loading of LuaModule '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, byteCodeError),
                         nullptr);
                     return std::nullopt;
                 }
 
-                LOG_WARN(CONTEXT_CLIENT, "Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, error.what());
+                LOG_WARN(CONTEXT_CLIENT, "Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, byteCodeError);
                 byteCodeFromPrecompiledModule.clear();
             }
         }
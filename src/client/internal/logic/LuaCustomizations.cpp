@@ -27,6 +27,8 @@ namespace ramses::internal
         state["rl_next"] = rl_next;
         state["rl_pairs"] = rl_pairs;
         state["rl_ipairs"] = rl_ipairs;
+        state["rl_setFlat"] = rl_setFlat;
+        state["rl_getFlat"] = rl_getFlat;
     }
 
     void LuaCustomizations::MapToEnvironment(sol::state& state, sol::environment& env)
@@ -35,6 +37,8 @@ namespace ramses::internal
         env["rl_next"] = state["rl_next"];
         env["rl_pairs"] = state["rl_pairs"];
         env["rl_ipairs"] = state["rl_ipairs"];
+        env["rl_setFlat"] = state["rl_setFlat"];
+        env["rl_getFlat"] = state["rl_getFlat"];
     }
 
     void LuaCustomizations::MapDebugLogFunctions(sol::environment& env)
@@ -92,6 +96,26 @@ namespace ramses::internal
         return 0u;
     }
 
+    WrappedLuaProperty& LuaCustomizations::ExtractWrappedProperty(const sol::object& obj, std::string_view functionName)
+    {
+        if (!obj.is<WrappedLuaProperty>())
+        {
+            sol_helper::throwSolException("{}() called on an unsupported type '{}', expected an array property", functionName, sol_helper::GetSolTypeName(obj.get_type()));
+        }
+
+        return obj.as<WrappedLuaProperty>();
+    }
+
+    void LuaCustomizations::rl_setFlat(const sol::object& target, const sol::object& values)
+    {
+        ExtractWrappedProperty(target, "rl_setFlat").setFlatValues(values);
+    }
+
+    sol::object LuaCustomizations::rl_getFlat(sol::this_state s, const sol::object& source)
+    {
+        return ExtractWrappedProperty(source, "rl_getFlat").getFlatValues(s);
+    }
+
     std::tuple<sol::object, sol::object> LuaCustomizations::rl_next(sol::this_state state, const sol::object& container, const sol::object& indexObject)
     {
         // Runtime property (checked first because performance-wise highest priority)
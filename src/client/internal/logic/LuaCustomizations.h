@@ -35,6 +35,10 @@ namespace ramses::internal
         [[nodiscard]] static std::tuple<sol::object, sol::object, sol::object> rl_pairs(sol::this_state s, sol::object iterableObject);
         [[nodiscard]] static std::tuple<sol::object, sol::object, sol::object> rl_ipairs(sol::this_state s, sol::object iterableObject);
 
+        static void rl_setFlat(const sol::object& target, const sol::object& values);
+        [[nodiscard]] static sol::object rl_getFlat(sol::this_state s, const sol::object& source);
+        [[nodiscard]] static WrappedLuaProperty& ExtractWrappedProperty(const sol::object& obj, std::string_view functionName);
+
         [[nodiscard]] static std::tuple<sol::object, sol::object> ResolveExtractorField(sol::this_state s, const PropertyTypeExtractor& typeExtractor, size_t fieldId);
     };
 }
@@ -77,6 +77,17 @@ namespace ramses::internal
         return 0;
     }
 
+    template <> DataOrError<float> LuaTypeConversions::ConvertNumber<float>(double number)
+    {
+        // Integral part out of range of float type
+        if (number > std::numeric_limits<float>::max() || number < std::numeric_limits<float>::lowest())
+        {
+            return DataOrError<float>(fmt::format("Error while extracting floating point number: value would cause overflow in float ('{}')", number));
+        }
+
+        return DataOrError<float>(static_cast<float>(number));
+    }
+
     template <> DataOrError<float> LuaTypeConversions::ExtractSpecificType<float>(const sol::object& solObject)
     {
         if (!solObject.valid() || solObject.get_type() != sol::type::number)
@@ -87,34 +98,17 @@ namespace ramses::internal
         }
 
         // Extract Lua number (==double)
-        const double asDouble = solObject.as<double>();
-
-        // Integral part out of range of float type
-        if (asDouble > std::numeric_limits<float>::max() || asDouble < std::numeric_limits<float>::lowest())
-        {
-            return DataOrError<float>(fmt::format("Error while extracting floating point number: value would cause overflow in float ('{}')", asDouble));
-        }
-
-        return DataOrError<float>(static_cast<float>(asDouble));
+        return ConvertNumber<float>(solObject.as<double>());
     }
 
     template <>
-    DataOrError<int32_t> LuaTypeConversions::ExtractSpecificType<int32_t>(const sol::object& solObject)
+    DataOrError<int32_t> LuaTypeConversions::ConvertNumber<int32_t>(double number)
     {
-        if (!solObject.valid() || solObject.get_type() != sol::type::number)
-        {
-            return DataOrError<int32_t>(
-                fmt::format("Error while extracting integer: expected a number, received '{}'",
-                sol_helper::GetSolTypeName(solObject.get_type())));
-        }
-
-        // Get Lua number as double (internal format of Lua)
-        const double asDouble = solObject.as<double>();
         // Rounds to closest signed integer
-        const double rounded = std::round(asDouble);
+        const double rounded = std::round(number);
 
         // fractional part too large -> rounding error
-        const double fractPart = std::abs(asDouble - rounded);
+        const double fractPart = std::abs(number - rounded);
         if (fractPart > std::numeric_limits<double>::epsilon())
         {
             return DataOrError<int32_t>(
@@ -134,22 +128,27 @@ namespace ramses::internal
     }
 
     template <>
-    DataOrError<int64_t> LuaTypeConversions::ExtractSpecificType<int64_t>(const sol::object& solObject)
+    DataOrError<int32_t> LuaTypeConversions::ExtractSpecificType<int32_t>(const sol::object& solObject)
     {
         if (!solObject.valid() || solObject.get_type() != sol::type::number)
         {
-            return DataOrError<int64_t>(
+            return DataOrError<int32_t>(
                 fmt::format("Error while extracting integer: expected a number, received '{}'",
-                    sol_helper::GetSolTypeName(solObject.get_type())));
+                sol_helper::GetSolTypeName(solObject.get_type())));
         }
 
         // Get Lua number as double (internal format of Lua)
-        const double asDouble = solObject.as<double>();
+        return ConvertNumber<int32_t>(solObject.as<double>());
+    }
+
+    template <>
+    DataOrError<int64_t> LuaTypeConversions::ConvertNumber<int64_t>(double number)
+    {
         // Rounds to closest signed integer
-        const double rounded = std::round(asDouble);
+        const double rounded = std::round(number);
 
         // fractional part too large -> rounding error
-        const double fractPart = std::abs(asDouble - rounded);
+        const double fractPart = std::abs(number - rounded);
         if (fractPart > std::numeric_limits<double>::epsilon())
         {
             return DataOrError<int64_t>(
@@ -169,6 +168,20 @@ namespace ramses::internal
         return DataOrError<int64_t>(static_cast<int64_t>(rounded));
     }
 
+    template <>
+    DataOrError<int64_t> LuaTypeConversions::ExtractSpecificType<int64_t>(const sol::object& solObject)
+    {
+        if (!solObject.valid() || solObject.get_type() != sol::type::number)
+        {
+            return DataOrError<int64_t>(
+                fmt::format("Error while extracting integer: expected a number, received '{}'",
+                    sol_helper::GetSolTypeName(solObject.get_type())));
+        }
+
+        // Get Lua number as double (internal format of Lua)
+        return ConvertNumber<int64_t>(solObject.as<double>());
+    }
+
 
     template <>
     DataOrError<size_t> LuaTypeConversions::ExtractSpecificType<size_t>(const sol::object& solObject)
@@ -226,6 +239,36 @@ namespace ramses::internal
         return DataOrError<std::string_view>(solObject.as<std::string_view>());
     }
 
+    std::optional<std::string> LuaTypeConversions::ExtractNumbers(const sol::object& solObject, std::vector<double>& numbers)
+    {
+        const std::optional<sol::lua_table> potentialLuaTable = ExtractLuaTable(solObject);
+        if (!potentialLuaTable)
+        {
+            return fmt::format("Expected a Lua table with numbers but got object of type {} instead!", sol_helper::GetSolTypeName(solObject.get_type()));
+        }
+
+        // Raw Lua API: avoids creating a sol object (registry reference) per table entry
+        lua_State* state = potentialLuaTable->lua_state();
+        potentialLuaTable->push();
+        const size_t count = lua_objlen(state, -1);
+        numbers.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            lua_rawgeti(state, -1, static_cast<int>(i + 1));
+            if (lua_type(state, -1) != LUA_TNUMBER)
+            {
+                const sol::type entryType = sol::type_of(state, -1);
+                lua_pop(state, 2);
+                return fmt::format("Error while extracting numbers: unexpected value (type: '{}') at table element # {}!", sol_helper::GetSolTypeName(entryType), i + 1);
+            }
+            numbers[i] = lua_tonumber(state, -1);
+            lua_pop(state, 1);
+        }
+        lua_pop(state, 1);
+
+        return std::nullopt;
+    }
+
     template <typename T, size_t size >
     DataOrError< std::array<T, size> > LuaTypeConversions::ExtractArray(const sol::object& solObject)
     {
@@ -13,6 +13,8 @@
 
 #include <variant>
 #include <array>
+#include <optional>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -66,6 +68,13 @@ namespace ramses::internal
         template <typename T>
         [[nodiscard]] static DataOrError<T> ExtractSpecificType(const sol::object& solObject);
 
+        // Applies the same range and rounding checks as ExtractSpecificType to a raw Lua number (float, int32_t, int64_t)
+        template <typename T>
+        [[nodiscard]] static DataOrError<T> ConvertNumber(double number);
+
+        // Reads a plain Lua table of numbers into a contiguous buffer, returns an error message on failure
+        [[nodiscard]] static std::optional<std::string> ExtractNumbers(const sol::object& solObject, std::vector<double>& numbers);
+
         [[nodiscard]] static size_t         GetMaxIndexForVectorType(EPropertyType type);
 
         template <typename T, size_t size>
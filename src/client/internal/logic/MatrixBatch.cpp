@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/MatrixBatch.h"
+#include "glm/gtc/type_ptr.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAMSES_MATRIX_BATCH_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RAMSES_MATRIX_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace ramses::internal
+{
+    static_assert(sizeof(matrix44f) == 16u * sizeof(float), "matrix44f is expected to be tightly packed column-major data");
+
+    void MatrixBatch::Multiply(const matrix44f* lhs, const matrix44f* rhs, matrix44f* result, size_t count)
+    {
+        for (size_t i = 0u; i < count; ++i)
+        {
+#if defined(RAMSES_MATRIX_BATCH_SSE) || defined(RAMSES_MATRIX_BATCH_NEON)
+            const float* a = glm::value_ptr(lhs[i]);
+            const float* b = glm::value_ptr(rhs[i]);
+            float* r = glm::value_ptr(result[i]);
+#endif
+
+            // every column of the result is a linear combination of the lhs columns, weighted by the matching rhs column;
+            // all inputs are loaded before the first store, so result may alias lhs or rhs
+#if defined(RAMSES_MATRIX_BATCH_SSE)
+            const __m128 a0 = _mm_loadu_ps(a);
+            const __m128 a1 = _mm_loadu_ps(a + 4);
+            const __m128 a2 = _mm_loadu_ps(a + 8);
+            const __m128 a3 = _mm_loadu_ps(a + 12);
+            __m128 columns[4];
+            for (int c = 0; c < 4; ++c)
+            {
+                const float* bc = b + 4 * c;
+                __m128 col = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+                col = _mm_add_ps(col, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+                col = _mm_add_ps(col, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+                col = _mm_add_ps(col, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+                columns[c] = col;
+            }
+            for (int c = 0; c < 4; ++c)
+                _mm_storeu_ps(r + 4 * c, columns[c]);
+#elif defined(RAMSES_MATRIX_BATCH_NEON)
+            const float32x4_t a0 = vld1q_f32(a);
+            const float32x4_t a1 = vld1q_f32(a + 4);
+            const float32x4_t a2 = vld1q_f32(a + 8);
+            const float32x4_t a3 = vld1q_f32(a + 12);
+            const float32x4_t b0 = vld1q_f32(b);
+            const float32x4_t b1 = vld1q_f32(b + 4);
+            const float32x4_t b2 = vld1q_f32(b + 8);
+            const float32x4_t b3 = vld1q_f32(b + 12);
+            const float32x4_t bColumns[4] = { b0, b1, b2, b3 };
+            float32x4_t columns[4];
+            for (int c = 0; c < 4; ++c)
+            {
+                float32x4_t col = vmulq_lane_f32(a0, vget_low_f32(bColumns[c]), 0);
+                col = vmlaq_lane_f32(col, a1, vget_low_f32(bColumns[c]), 1);
+                col = vmlaq_lane_f32(col, a2, vget_high_f32(bColumns[c]), 0);
+                col = vmlaq_lane_f32(col, a3, vget_high_f32(bColumns[c]), 1);
+                columns[c] = col;
+            }
+            for (int c = 0; c < 4; ++c)
+                vst1q_f32(r + 4 * c, columns[c]);
+#else
+            result[i] = lhs[i] * rhs[i];
+#endif
+        }
+    }
+
+    const char* MatrixBatch::GetImplementationName()
+    {
+#if defined(RAMSES_MATRIX_BATCH_SSE)
+        return "SSE";
+#elif defined(RAMSES_MATRIX_BATCH_NEON)
+        return "NEON";
+#else
+        return "scalar";
+#endif
+    }
+}
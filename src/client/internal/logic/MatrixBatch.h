@@ -0,0 +1,26 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/DataTypes.h"
+#include <cstddef>
+
+namespace ramses::internal
+{
+    class MatrixBatch
+    {
+    public:
+        // Computes result[i] = lhs[i] * rhs[i] for all i < count using SSE or NEON when available.
+        // Result may alias lhs or rhs (in-place multiplication), partial overlaps are not allowed.
+        static void Multiply(const matrix44f* lhs, const matrix44f* rhs, matrix44f* result, size_t count);
+
+        // Name of the instruction set used by Multiply, shown as label in benchmark results
+        [[nodiscard]] static const char* GetImplementationName();
+    };
+}
@@ -63,6 +63,12 @@ namespace ramses::internal
             m_solState.open_libraries(solLib);
         }
 
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        // LuaJIT enables its trace compiler only when the 'jit' library is opened. It is opened in the global
+        // state only, the 'jit' table (and 'ffi') is never mapped into the sandboxed script environments
+        m_solState.open_libraries(sol::lib::jit);
+#endif
+
         m_solState.set_exception_handler(&solExceptionHandler);
 
         // TODO Violin only register wrappers to runtime environments, not in the global environment
@@ -180,6 +186,27 @@ namespace ramses::internal
         return false;
     }
 
+    bool SolState::IsCompatibleByteCode(std::string_view byteCode)
+    {
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        // LuaJIT dump header: ESC 'L' 'J' <version>
+        constexpr std::string_view signature{ "\x1bLJ" };
+#else
+        // Lua 5.1 dump header: ESC 'L' 'u' 'a' <version 5.1>
+        constexpr std::string_view signature{ "\x1bLua\x51" };
+#endif
+        return byteCode.substr(0u, signature.size()) == signature;
+    }
+
+    std::string_view SolState::GetRuntimeName()
+    {
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        return LUAJIT_VERSION;
+#else
+        return LUA_RELEASE;
+#endif
+    }
+
     sol::table SolState::createTable()
     {
         return m_solState.create_table();
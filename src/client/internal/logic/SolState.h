@@ -59,6 +59,10 @@ namespace ramses::internal
 
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
 
+        // Byte code is only portable between identical Lua runtimes (Lua 5.1 or LuaJIT), checks the header signature
+        [[nodiscard]] static bool IsCompatibleByteCode(std::string_view byteCode);
+        [[nodiscard]] static std::string_view GetRuntimeName();
+
     private:
         sol::state m_solState;
         // Cached to avoid unnecessary heap allocations
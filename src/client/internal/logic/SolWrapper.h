@@ -86,7 +86,7 @@ __pragma(warning(pop))
 #endif
 
 #if SOL_IS_ON(SOL_USE_CXX_LUAJIT_I_)
-#error "LuaJIT is not tested yet, thus we expect that SOL_USE_CXX_LUAJIT is off currently"
+#error "LuaJIT is only supported as platform-provided C library (ramses-sdk_USE_PLATFORM_LUAJIT), thus we expect that SOL_USE_CXX_LUAJIT is off"
 #endif
 
 // Configured with SOL_EXCEPTIONS_ALWAYS_UNSAFE=1
@@ -39,7 +39,77 @@ namespace ramses::internal
         }
     }
 
-    sol::object WrappedLuaProperty::index(sol::this_state solState, const sol::object& index) const
+    void WrappedLuaProperty::bindFieldNames(lua_State* state)
+    {
+        static_assert(LUA_VERSION_NUM == 501, "Lua 5.1 interns all strings, later versions don't intern long strings");
+
+        m_boundFieldNames.clear();
+        m_boundFieldNameAddresses.clear();
+
+        if (m_wrappedProperty.get().getType() == EPropertyType::Struct)
+        {
+            m_boundFieldNames.reserve(m_wrappedChildProperties.size());
+            m_boundFieldNameAddresses.reserve(m_wrappedChildProperties.size());
+            for (const auto& child : m_wrappedChildProperties)
+            {
+                sol::object fieldName = sol::make_object(state, child.m_wrappedProperty.get().getName());
+                fieldName.push();
+                m_boundFieldNameAddresses.push_back(lua_tostring(state, -1));
+                lua_pop(state, 1);
+                m_boundFieldNames.push_back(std::move(fieldName));
+            }
+        }
+
+        for (auto& child : m_wrappedChildProperties)
+        {
+            child.bindFieldNames(state);
+        }
+    }
+
+    std::optional<size_t> WrappedLuaProperty::findBoundField(const char* fieldName) const
+    {
+        for (size_t i = 0; i < m_boundFieldNameAddresses.size(); ++i)
+        {
+            if (m_boundFieldNameAddresses[i] == fieldName)
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    size_t WrappedLuaProperty::resolveChildSlot(const sol::stack_object& index) const
+    {
+        lua_State* state = index.lua_state();
+        const int stackIndex = index.stack_index();
+        const EPropertyType propertyType = m_wrappedProperty.get().getType();
+
+        if (propertyType == EPropertyType::Struct && lua_type(state, stackIndex) == LUA_TSTRING)
+        {
+            const std::optional<size_t> boundField = findBoundField(lua_tostring(state, stackIndex));
+            if (boundField)
+            {
+                return *boundField;
+            }
+        }
+        else if (propertyType == EPropertyType::Array && lua_type(state, stackIndex) == LUA_TNUMBER)
+        {
+            const lua_Number number = lua_tonumber(state, stackIndex);
+            if (number >= 1 && number <= static_cast<lua_Number>(m_wrappedChildProperties.size()))
+            {
+                const auto elementIndex = static_cast<size_t>(number);
+                if (static_cast<lua_Number>(elementIndex) == number)
+                {
+                    return elementIndex - 1;
+                }
+            }
+        }
+
+        // dynamic access (not bound field names) and all error handling
+        return resolvePropertyIndex(sol::object(state, stackIndex));
+    }
+
+    sol::object WrappedLuaProperty::index(sol::this_state solState, const sol::stack_object& index) const
     {
         switch (m_wrappedProperty.get().getType())
         {
@@ -53,20 +123,20 @@ namespace ramses::internal
             sol_helper::throwSolException("Implementation error!");
             break;
         case EPropertyType::Vec2f:
-            return extractVectorComponent<vec2f>(solState, index);
+            return extractVectorComponent<vec2f>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Vec3f:
-            return extractVectorComponent<vec3f>(solState, index);
+            return extractVectorComponent<vec3f>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Vec4f:
-            return extractVectorComponent<vec4f>(solState, index);
+            return extractVectorComponent<vec4f>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Vec2i:
-            return extractVectorComponent<vec2i>(solState, index);
+            return extractVectorComponent<vec2i>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Vec3i:
-            return extractVectorComponent<vec3i>(solState, index);
+            return extractVectorComponent<vec3i>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Vec4i:
-            return extractVectorComponent<vec4i>(solState, index);
+            return extractVectorComponent<vec4i>(solState, sol::object(index.lua_state(), index.stack_index()));
         case EPropertyType::Array:
         case EPropertyType::Struct:
-            return resolveChild(solState, resolvePropertyIndex(index));
+            return resolveChild(solState, resolveChildSlot(index));
         }
 
         assert(false && "Missing type implementation!");
@@ -132,21 +202,90 @@ namespace ramses::internal
         }
     }
 
-    void WrappedLuaProperty::newIndex(const sol::object& index, const sol::object& rhs)
+    void WrappedLuaProperty::newIndex(const sol::stack_object& index, const sol::stack_object& rhs)
     {
         if (TypeUtils::IsPrimitiveVectorType(m_wrappedProperty.get().getType()))
         {
             sol_helper::throwSolException("Error while writing to '{}'. Can't assign individual components of vector types, must assign the whole vector!", m_wrappedProperty.get().getName());
         }
 
-        const size_t childIndex = resolvePropertyIndex(index);
+        const size_t childIndex = resolveChildSlot(index);
 
         if (m_wrappedProperty.get().getPropertySemantics() != EPropertySemantics::ScriptOutput)
         {
             sol_helper::throwSolException("Error while writing to '{}'. Writing input values is not allowed, only outputs!", getChildDebugName(childIndex));
         }
 
-        setChildValue(childIndex, rhs);
+        if (!m_wrappedChildProperties[childIndex].setPrimitiveFromStack(rhs))
+        {
+            setChildValue(childIndex, sol::object(rhs.lua_state(), rhs.stack_index()));
+        }
+    }
+
+    // Handles only values which convert without loss, everything else (incl. errors) takes the generic conversion path
+    bool WrappedLuaProperty::setPrimitiveFromStack(const sol::stack_object& rhs)
+    {
+        lua_State* state = rhs.lua_state();
+        const int stackIndex = rhs.stack_index();
+        PropertyImpl& property = m_wrappedProperty.get();
+
+        switch (property.getType())
+        {
+        case EPropertyType::Float:
+            if (lua_type(state, stackIndex) == LUA_TNUMBER)
+            {
+                const lua_Number value = lua_tonumber(state, stackIndex);
+                if (value <= std::numeric_limits<float>::max() && value >= std::numeric_limits<float>::lowest())
+                {
+                    property.setValue(static_cast<float>(value));
+                    return true;
+                }
+            }
+            return false;
+        case EPropertyType::Int32:
+            if (lua_type(state, stackIndex) == LUA_TNUMBER)
+            {
+                const lua_Number value = lua_tonumber(state, stackIndex);
+                if (value <= std::numeric_limits<int32_t>::max() && value >= std::numeric_limits<int32_t>::lowest() && value == static_cast<lua_Number>(static_cast<int32_t>(value)))
+                {
+                    property.setValue(static_cast<int32_t>(value));
+                    return true;
+                }
+            }
+            return false;
+        case EPropertyType::Int64:
+            if (lua_type(state, stackIndex) == LUA_TNUMBER)
+            {
+                // upper bound is exclusive, int64 max is not representable as double
+                const lua_Number value = lua_tonumber(state, stackIndex);
+                if (value < static_cast<lua_Number>(std::numeric_limits<int64_t>::max()) && value >= static_cast<lua_Number>(std::numeric_limits<int64_t>::lowest()) &&
+                    value == static_cast<lua_Number>(static_cast<int64_t>(value)))
+                {
+                    property.setValue(static_cast<int64_t>(value));
+                    return true;
+                }
+            }
+            return false;
+        case EPropertyType::Bool:
+            if (lua_type(state, stackIndex) == LUA_TBOOLEAN)
+            {
+                property.setValue(lua_toboolean(state, stackIndex) != 0);
+                return true;
+            }
+            return false;
+        case EPropertyType::String:
+        case EPropertyType::Vec2f:
+        case EPropertyType::Vec3f:
+        case EPropertyType::Vec4f:
+        case EPropertyType::Vec2i:
+        case EPropertyType::Vec3i:
+        case EPropertyType::Vec4i:
+        case EPropertyType::Array:
+        case EPropertyType::Struct:
+            break;
+        }
+
+        return false;
     }
 
     void WrappedLuaProperty::setChildValue(size_t index, const sol::object& rhs)
@@ -218,6 +357,18 @@ namespace ramses::internal
         const EPropertyType propertyType = m_wrappedProperty.get().getType();
         if (propertyType == EPropertyType::Struct)
         {
+            if (!m_boundFieldNames.empty() && propertyIndex.get_type() == sol::type::string)
+            {
+                lua_State* state = propertyIndex.lua_state();
+                propertyIndex.push();
+                const std::optional<size_t> boundField = findBoundField(lua_tostring(state, -1));
+                lua_pop(state, 1);
+                if (boundField)
+                {
+                    return *boundField;
+                }
+            }
+
             const DataOrError<std::string_view> structFieldName = LuaTypeConversions::ExtractSpecificType<std::string_view>(propertyIndex);
 
             if (structFieldName.hasError())
@@ -538,6 +689,193 @@ namespace ramses::internal
 
     }
 
+    EPropertyType WrappedLuaProperty::getFlatArrayElementType(std::string_view functionName) const
+    {
+        const PropertyImpl& arrayProperty = m_wrappedProperty.get();
+        if (arrayProperty.getType() == EPropertyType::Array && !m_wrappedChildProperties.empty())
+        {
+            const EPropertyType elementType = m_wrappedChildProperties.front().m_wrappedProperty.get().getType();
+            if (elementType == EPropertyType::Float || elementType == EPropertyType::Int32 || elementType == EPropertyType::Int64 || TypeUtils::IsPrimitiveVectorType(elementType))
+            {
+                return elementType;
+            }
+        }
+
+        sol_helper::throwSolException("{}() called on property '{}' which is not an array of numbers or vectors!", functionName, arrayProperty.getName());
+        return EPropertyType::Float;
+    }
+
+    void WrappedLuaProperty::setFlatValues(const sol::object& values)
+    {
+        const EPropertyType elementType = getFlatArrayElementType("rl_setFlat");
+
+        if (m_wrappedProperty.get().getPropertySemantics() != EPropertySemantics::ScriptOutput)
+        {
+            sol_helper::throwSolException("Error while writing to '{}'. Writing input values is not allowed, only outputs!", m_wrappedProperty.get().getName());
+        }
+
+        std::vector<double> flatValues;
+        const std::optional<std::string> extractionError = LuaTypeConversions::ExtractNumbers(values, flatValues);
+        if (extractionError)
+        {
+            sol_helper::throwSolException("Error while assigning flat values to array property '{}'! {}", m_wrappedProperty.get().getName(), *extractionError);
+        }
+
+        const size_t expectedValues = m_wrappedChildProperties.size() * TypeUtils::ComponentsSizeForPropertyType(elementType);
+        if (flatValues.size() != expectedValues)
+        {
+            sol_helper::throwSolException("Element size mismatch when assigning flat values to array property '{}'! Expected {} numbers but got {}",
+                m_wrappedProperty.get().getName(), expectedValues, flatValues.size());
+        }
+
+        switch (elementType)
+        {
+        case EPropertyType::Float:
+            setFlatValuesOfType<float>(flatValues);
+            break;
+        case EPropertyType::Int32:
+            setFlatValuesOfType<int32_t>(flatValues);
+            break;
+        case EPropertyType::Int64:
+            setFlatValuesOfType<int64_t>(flatValues);
+            break;
+        case EPropertyType::Vec2f:
+            setFlatValuesOfType<vec2f>(flatValues);
+            break;
+        case EPropertyType::Vec3f:
+            setFlatValuesOfType<vec3f>(flatValues);
+            break;
+        case EPropertyType::Vec4f:
+            setFlatValuesOfType<vec4f>(flatValues);
+            break;
+        case EPropertyType::Vec2i:
+            setFlatValuesOfType<vec2i>(flatValues);
+            break;
+        case EPropertyType::Vec3i:
+            setFlatValuesOfType<vec3i>(flatValues);
+            break;
+        case EPropertyType::Vec4i:
+            setFlatValuesOfType<vec4i>(flatValues);
+            break;
+        case EPropertyType::Bool:
+        case EPropertyType::String:
+        case EPropertyType::Array:
+        case EPropertyType::Struct:
+            assert(false && "Unreachable code!");
+            break;
+        }
+    }
+
+    template <typename T>
+    void WrappedLuaProperty::setFlatValuesOfType(const std::vector<double>& flatValues)
+    {
+        constexpr bool isVector = !std::is_arithmetic_v<T>;
+        using ComponentType = typename std::conditional_t<isVector, T, glm::vec<1, T>>::value_type;
+        constexpr size_t components = isVector ? static_cast<size_t>(T::length()) : 1u;
+
+        // convert all values first, so that an invalid value does not leave the array partially assigned
+        std::vector<T> converted(m_wrappedChildProperties.size());
+        for (size_t i = 0; i < flatValues.size(); ++i)
+        {
+            const DataOrError<ComponentType> component = LuaTypeConversions::ConvertNumber<ComponentType>(flatValues[i]);
+            if (component.hasError())
+            {
+                sol_helper::throwSolException("Error while assigning flat values to array property '{}'! Unexpected value at table element # {}! Reason: {}",
+                    m_wrappedProperty.get().getName(), i + 1, component.getError());
+            }
+
+            if constexpr (isVector)
+            {
+                converted[i / components][static_cast<glm::length_t>(i % components)] = component.getData();
+            }
+            else
+            {
+                converted[i] = component.getData();
+            }
+        }
+
+        for (size_t i = 0; i < converted.size(); ++i)
+        {
+            m_wrappedChildProperties[i].m_wrappedProperty.get().setValue(converted[i]);
+        }
+    }
+
+    sol::object WrappedLuaProperty::getFlatValues(sol::this_state solState) const
+    {
+        const EPropertyType elementType = getFlatArrayElementType("rl_getFlat");
+
+        lua_State* state = solState;
+        switch (elementType)
+        {
+        case EPropertyType::Float:
+            pushFlatValuesOfType<float>(state);
+            break;
+        case EPropertyType::Int32:
+            pushFlatValuesOfType<int32_t>(state);
+            break;
+        case EPropertyType::Int64:
+            pushFlatValuesOfType<int64_t>(state);
+            break;
+        case EPropertyType::Vec2f:
+            pushFlatValuesOfType<vec2f>(state);
+            break;
+        case EPropertyType::Vec3f:
+            pushFlatValuesOfType<vec3f>(state);
+            break;
+        case EPropertyType::Vec4f:
+            pushFlatValuesOfType<vec4f>(state);
+            break;
+        case EPropertyType::Vec2i:
+            pushFlatValuesOfType<vec2i>(state);
+            break;
+        case EPropertyType::Vec3i:
+            pushFlatValuesOfType<vec3i>(state);
+            break;
+        case EPropertyType::Vec4i:
+            pushFlatValuesOfType<vec4i>(state);
+            break;
+        case EPropertyType::Bool:
+        case EPropertyType::String:
+        case EPropertyType::Array:
+        case EPropertyType::Struct:
+            assert(false && "Unreachable code!");
+            lua_pushnil(state);
+            break;
+        }
+
+        sol::object result(state, -1);
+        lua_pop(state, 1);
+        return result;
+    }
+
+    template <typename T>
+    void WrappedLuaProperty::pushFlatValuesOfType(lua_State* state) const
+    {
+        constexpr bool isVector = !std::is_arithmetic_v<T>;
+        constexpr int components = isVector ? static_cast<int>(T::length()) : 1;
+
+        const auto elementCount = static_cast<int>(m_wrappedChildProperties.size());
+        lua_createtable(state, elementCount * components, 0);
+        int tableIndex = 1;
+        for (const auto& element : m_wrappedChildProperties)
+        {
+            const T& value = element.m_wrappedProperty.get().getValueAs<T>();
+            if constexpr (isVector)
+            {
+                for (glm::length_t c = 0; c < T::length(); ++c)
+                {
+                    lua_pushnumber(state, static_cast<lua_Number>(value[c]));
+                    lua_rawseti(state, -2, tableIndex++);
+                }
+            }
+            else
+            {
+                lua_pushnumber(state, static_cast<lua_Number>(value));
+                lua_rawseti(state, -2, tableIndex++);
+            }
+        }
+    }
+
     void WrappedLuaProperty::RegisterTypes(sol::state& state)
     {
         state.new_usertype<WrappedLuaProperty>("WrappedLuaProperty",
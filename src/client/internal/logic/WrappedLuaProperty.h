@@ -33,11 +33,17 @@ namespace ramses::internal
         WrappedLuaProperty(const WrappedLuaProperty& other) = delete;
         WrappedLuaProperty& operator=(const WrappedLuaProperty& other) = delete;
 
+        // Binds struct field names to child slots, done once when the owning script is loaded.
+        // Lua interns strings, thus a field name used in a script resolves to the very same string object
+        // and can be found by its address instead of comparing names. Unbound keys use name-based lookup.
+        void bindFieldNames(lua_State* state);
+
         // Interface metamethods used by Lua
+        // Arguments are taken directly from the Lua stack to avoid creating registry references on each access
         // Called on 'obj.index = rhs'
-        void        newIndex(const sol::object& index, const sol::object& rhs);
+        void        newIndex(const sol::stack_object& index, const sol::stack_object& rhs);
         // Called on 'X = obj.index'
-        [[nodiscard]] sol::object index(sol::this_state solState, const sol::object& index) const;
+        [[nodiscard]] sol::object index(sol::this_state solState, const sol::stack_object& index) const;
         // Called on '#obj'
         [[nodiscard]] size_t size() const;
         [[nodiscard]] sol::object resolveChild(sol::this_state solState, size_t childIndex) const;
@@ -46,18 +52,36 @@ namespace ramses::internal
 
         [[nodiscard]] const PropertyImpl& getWrappedProperty() const;
 
+        // Bulk transfer of numeric arrays (arrays of float, int and vector types) as flat number tables,
+        // i.e. {x1, y1, x2, y2, ...} for an array of vec2. Used by rl_setFlat/rl_getFlat
+        void setFlatValues(const sol::object& values);
+        [[nodiscard]] sol::object getFlatValues(sol::this_state solState) const;
+
         // Register symbols for type extraction to sol state globally
         static void RegisterTypes(sol::state& state);
 
     private:
         std::reference_wrapper<PropertyImpl> m_wrappedProperty;
         std::vector<WrappedLuaProperty> m_wrappedChildProperties;
+        // Interned Lua strings of struct field names (kept alive) and their addresses, same order as children
+        std::vector<sol::object> m_boundFieldNames;
+        std::vector<const char*> m_boundFieldNameAddresses;
+
+        [[nodiscard]] size_t resolveChildSlot(const sol::stack_object& index) const;
+        [[nodiscard]] std::optional<size_t> findBoundField(const char* fieldName) const;
+        [[nodiscard]] bool setPrimitiveFromStack(const sol::stack_object& rhs);
 
         template <typename T>
         [[nodiscard]] sol::object extractVectorComponent(sol::this_state solState, const sol::object& index) const;
         template <typename T>
         void setVectorComponents(const sol::object& rhs);
 
+        template <typename T>
+        void setFlatValuesOfType(const std::vector<double>& flatValues);
+        template <typename T>
+        void pushFlatValuesOfType(lua_State* state) const;
+        [[nodiscard]] EPropertyType getFlatArrayElementType(std::string_view functionName) const;
+
         void setChildValue(size_t index, const sol::object& rhs);
         void setComplex(const WrappedLuaProperty& other);
 
@@ -153,6 +153,26 @@ namespace ramses
         return true;
     }
 
+    void RamsesFrameworkConfig::setTransmissionBandwidthLimit(ETransmissionPriority priority, uint64_t bytesPerSecond)
+    {
+        m_impl->m_tcpConfig.setBandwidthLimit(priority, bytesPerSecond);
+    }
+
+    bool RamsesFrameworkConfig::setConnectionThreadCount(uint32_t threadCount)
+    {
+        return m_impl->setConnectionThreadCount(threadCount);
+    }
+
+    bool RamsesFrameworkConfig::setUnixSocketDirectoryForTCPCommunication(std::string_view directory)
+    {
+        return m_impl->setUnixSocketDirectory(directory);
+    }
+
+    void RamsesFrameworkConfig::setFlushTraceFile(std::string_view traceFile)
+    {
+        m_impl->setFlushTraceFile(traceFile);
+    }
+
     internal::RamsesFrameworkConfigImpl& RamsesFrameworkConfig::impl()
     {
         return *m_impl;
@@ -200,10 +200,52 @@ namespace ramses::internal
         case EConnectionSystem::Off:
             m_usedProtocol = EConnectionProtocol::Off;
             break;
+        case EConnectionSystem::SharedMemory:
+#if defined(HAS_SHM_COMM)
+            m_usedProtocol = EConnectionProtocol::SharedMemory;
+            break;
+#else
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesFrameworkConfig::setConnectionSystem: shared memory connection system is not supported on this platform");
+            return false;
+#endif
+        }
+        return true;
+    }
+
+    bool RamsesFrameworkConfigImpl::setConnectionThreadCount(uint32_t threadCount)
+    {
+        if (threadCount == 0u)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesFrameworkConfig::setConnectionThreadCount: thread count must be at least 1");
+            return false;
+        }
+        m_tcpConfig.setThreadCount(threadCount);
+        return true;
+    }
+
+    bool RamsesFrameworkConfigImpl::setUnixSocketDirectory(std::string_view directory)
+    {
+        // socket path has to fit into sockaddr_un, leave space for file name with port
+        constexpr size_t MaxDirectoryLength = 80u;
+        if (directory.size() > MaxDirectoryLength)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesFrameworkConfig::setUnixSocketDirectoryForTCPCommunication: directory must not be longer than {} characters", MaxDirectoryLength);
+            return false;
         }
+        m_tcpConfig.setUnixSocketDirectory(directory);
         return true;
     }
 
+    void RamsesFrameworkConfigImpl::setFlushTraceFile(std::string_view traceFile)
+    {
+        m_flushTraceFile = traceFile;
+    }
+
+    const std::string& RamsesFrameworkConfigImpl::getFlushTraceFile() const
+    {
+        return m_flushTraceFile;
+    }
+
     Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
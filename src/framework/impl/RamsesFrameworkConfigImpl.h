@@ -64,6 +64,11 @@ namespace ramses::internal
         [[nodiscard]] const std::string& getParticipantName() const;
 
         [[nodiscard]] bool setConnectionSystem(EConnectionSystem connectionSystem);
+        [[nodiscard]] bool setConnectionThreadCount(uint32_t threadCount);
+        [[nodiscard]] bool setUnixSocketDirectory(std::string_view directory);
+
+        void setFlushTraceFile(std::string_view traceFile);
+        [[nodiscard]] const std::string& getFlushTraceFile() const;
 
         TCPConfig        m_tcpConfig;
         ERamsesShellType m_shellType;
@@ -83,5 +88,6 @@ namespace ramses::internal
         bool m_enableDltApplicationRegistration = true;
         Guid m_userProvidedGuid;
         std::string m_loggingInstanceName = "R";
+        std::string m_flushTraceFile;
     };
 }
@@ -28,6 +28,8 @@ namespace ramses::internal
 {
     RamsesFrameworkImpl::RamsesFrameworkImpl(const RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantAddress)
         : m_ramsh(new RamshStandardSetup(config.m_shellType))
+        , m_flushTracer(config.getFlushTraceFile().empty() ? nullptr :
+            std::make_unique<FlushTracer>(config.getFlushTraceFile(), static_cast<uint32_t>(participantAddress.getParticipantId().get()), participantAddress.getParticipantName()))
         , m_participantAddress(participantAddress)
         // NOTE: if you add something here consider using m_frameworkLock for all locking purposes inside this new class
         , m_connectionProtocol(config.getUsedProtocol())
@@ -52,6 +54,11 @@ namespace ramses::internal
         m_ramsh->start();
         m_ramsh->add(m_ramshCommandLogConnectionInformation);
         m_periodicLogger.registerPeriodicLogSupplier(m_communicationSystem.get());
+        if (m_flushTracer)
+        {
+            LOG_INFO(CONTEXT_FRAMEWORK, "RamsesFramework: flush tracing enabled, traces are written to {}", config.getFlushTraceFile());
+            m_scenegraphComponent.setFlushTracer(m_flushTracer.get());
+        }
     }
 
     RamsesFrameworkImpl::~RamsesFrameworkImpl()
@@ -68,6 +75,9 @@ namespace ramses::internal
         m_ramsesRenderer.reset();
 
         m_periodicLogger.removePeriodicLogSupplier(m_communicationSystem.get());
+
+        if (m_flushTracer)
+            m_flushTracer->writeTraceFile();
     }
 
     RamsesRenderer* RamsesFrameworkImpl::createRenderer(const RendererConfig& config)
@@ -238,6 +248,11 @@ namespace ramses::internal
         return m_statisticCollection;
     }
 
+    FlushTracer* RamsesFrameworkImpl::getFlushTracer()
+    {
+        return m_flushTracer.get();
+    }
+
     bool RamsesFrameworkImpl::addRamshCommand(const std::shared_ptr<IRamshCommand>& command)
     {
         if (!command)
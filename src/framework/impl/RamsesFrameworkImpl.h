@@ -11,6 +11,7 @@
 #include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
 #include "internal/Components/ResourceComponent.h"
 #include "internal/Components/SceneGraphComponent.h"
+#include "internal/Components/FlushTracer.h"
 #include "internal/Core/Common/ParticipantIdentifier.h"
 #include "internal/Core/Utils/PeriodicLogger.h"
 #include "internal/Core/Utils/StatisticCollection.h"
@@ -76,6 +77,8 @@ namespace ramses::internal
         ITaskQueue& getTaskQueue();
         PeriodicLogger& getPeriodicLogger();
         StatisticCollectionFramework& getStatisticCollection();
+        // nullptr if flush tracing not enabled in config
+        FlushTracer* getFlushTracer();
         static void SetLogHandler(const LogHandlerFunc& logHandlerFunc);
         bool addRamshCommand(const std::shared_ptr<IRamshCommand>& command);
         bool executeRamshCommand(const std::string& input);
@@ -95,6 +98,7 @@ namespace ramses::internal
         std::unique_ptr<RamshStandardSetup> m_ramsh;
         std::vector<std::shared_ptr<PublicRamshCommand>> m_publicRamshCommands;
         StatisticCollectionFramework m_statisticCollection;
+        std::unique_ptr<FlushTracer> m_flushTracer;
         ParticipantIdentifier m_participantAddress;
         EConnectionProtocol m_connectionProtocol;
         std::unique_ptr<ICommunicationSystem> m_communicationSystem;
@@ -84,4 +84,34 @@ namespace ramses::internal
     {
         m_aliveTimeout = timeout;
     }
+
+    const TransmissionBandwidthLimits& TCPConfig::getBandwidthLimits() const
+    {
+        return m_bandwidthLimits;
+    }
+
+    void TCPConfig::setBandwidthLimit(ETransmissionPriority priority, uint64_t bytesPerSecond)
+    {
+        m_bandwidthLimits[static_cast<size_t>(priority)] = bytesPerSecond;
+    }
+
+    uint32_t TCPConfig::getThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    void TCPConfig::setThreadCount(uint32_t threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
+    const std::string& TCPConfig::getUnixSocketDirectory() const
+    {
+        return m_unixSocketDirectory;
+    }
+
+    void TCPConfig::setUnixSocketDirectory(std::string_view directory)
+    {
+        m_unixSocketDirectory = directory;
+    }
 }
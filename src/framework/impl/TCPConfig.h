@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ramses/framework/RamsesFrameworkTypes.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
 
 #include <string>
 #include <chrono>
@@ -35,6 +36,16 @@ namespace ramses::internal
         void setAliveInterval(std::chrono::milliseconds interval);
         void setAliveTimeout(std::chrono::milliseconds timeout);
 
+        [[nodiscard]] const TransmissionBandwidthLimits& getBandwidthLimits() const;
+        void setBandwidthLimit(ETransmissionPriority priority, uint64_t bytesPerSecond);
+
+        [[nodiscard]] uint32_t getThreadCount() const;
+        void setThreadCount(uint32_t threadCount);
+
+        // empty to use only tcp
+        [[nodiscard]] const std::string& getUnixSocketDirectory() const;
+        void setUnixSocketDirectory(std::string_view directory);
+
     private:
         static const uint16_t DefaultPort;
         static const uint16_t DefaultDaemonPort;
@@ -46,5 +57,8 @@ namespace ramses::internal
         std::string m_daemonIP;
         std::chrono::milliseconds m_aliveInterval;
         std::chrono::milliseconds m_aliveTimeout;
+        TransmissionBandwidthLimits m_bandwidthLimits{};
+        uint32_t m_threadCount{1u};
+        std::string m_unixSocketDirectory;
     };
 }
@@ -21,6 +21,10 @@
 #include "internal/Communication/TransportTCP/TcpDiscoveryDaemon.h"
 #endif
 
+#if defined(HAS_SHM_COMM)
+#include "internal/Communication/TransportSHM/SharedMemoryConnectionSystem.h"
+#endif
+
 #include "impl/RamsesFrameworkConfigImpl.h"
 #include "ramses/framework/RamsesFrameworkConfig.h"
 #include <memory>
@@ -49,7 +53,21 @@ namespace ramses::internal
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Daemon Address: {}:{}", daemonNetworkAddress.getIp(), daemonNetworkAddress.getPort());
 
             // allocate
-            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(),
+                config.m_tcpConfig.getBandwidthLimits(), config.m_tcpConfig.getThreadCount(), config.m_tcpConfig.getUnixSocketDirectory());
+        }
+#endif
+
+#if defined(HAS_SHM_COMM)
+        // Construct SharedMemoryConnectionSystem, uses TCPConnectionSystem for discovery and control messages
+        auto ConstructSharedMemoryConnectionManager(const RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantIdentifier,
+            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection)
+        {
+            LOG_INFO(CONTEXT_COMMUNICATION, "Use SharedMemoryConnectionSystem");
+
+            // writing to a ring of an unresponsive receiver gives up when it would be considered disconnected anyway
+            return std::make_unique<SharedMemoryConnectionSystem>(ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection),
+                participantIdentifier.getParticipantId(), participantIdentifier.getParticipantName(), frameworkLock, config.m_tcpConfig.getAliveTimeout());
         }
 #endif
     }
@@ -63,6 +81,7 @@ namespace ramses::internal
         switch(config.getUsedProtocol())
         {
             case EConnectionProtocol::TCP:
+            case EConnectionProtocol::SharedMemory:
             {
 #if defined(HAS_TCP_COMM)
                 constructedDaemon = std::make_unique<TcpDiscoveryDaemon>(config, frameworkLock, statisticCollection, optionalRamsh);
@@ -92,6 +111,12 @@ namespace ramses::internal
         {
             return ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
         }
+#endif
+#if defined(HAS_SHM_COMM)
+        case EConnectionProtocol::SharedMemory:
+        {
+            return ConstructSharedMemoryConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
+        }
 #endif
         case EConnectionProtocol::Off:
         {
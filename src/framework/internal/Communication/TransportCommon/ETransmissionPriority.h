@@ -0,0 +1,36 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/Utils/LoggingUtils.h"
+#include "ramses/framework/ETransmissionPriority.h"
+
+#include <array>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    using ramses::ETransmissionPriority;
+
+    const std::array ETransmissionPriorityNames = {
+        "High",
+        "Normal",
+        "Low",
+    };
+
+    constexpr size_t TransmissionPriorityCount = ETransmissionPriorityNames.size();
+
+    // bytes per second per priority, 0 means unlimited
+    using TransmissionBandwidthLimits = std::array<uint64_t, TransmissionPriorityCount>;
+}
+
+MAKE_ENUM_CLASS_PRINTABLE(ramses::ETransmissionPriority,
+                                        "ETransmissionPriority",
+                                        ramses::internal::ETransmissionPriorityNames,
+                                        ramses::ETransmissionPriority::Low);
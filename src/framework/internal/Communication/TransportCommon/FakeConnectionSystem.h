@@ -65,7 +65,7 @@ namespace ramses::internal
             return true;
         }
 
-        bool sendSceneUpdate(const Guid& /*to*/, const SceneId& /*sceneId*/, const ISceneUpdateSerializer& /*serializer*/) override
+        bool sendSceneUpdate(const std::vector<Guid>& /*to*/, const SceneId& /*sceneId*/, const ISceneUpdateSerializer& /*serializer*/) override
         {
             return true;
         }
@@ -75,6 +75,10 @@ namespace ramses::internal
             return true;
         }
 
+        void setSceneTransmissionPriority(const SceneId& /*sceneId*/, ETransmissionPriority /*priority*/) override
+        {
+        }
+
         void setSceneProviderServiceHandler(ISceneProviderServiceHandler* /*handler*/) override
         {
         }
@@ -9,12 +9,15 @@
 #pragma once
 
 #include "internal/Communication/TransportCommon/ServiceHandlerInterfaces.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 #include "internal/Components/ManagedResource.h"
 #include "internal/Core/Utils/IPeriodicLogSupplier.h"
 #include "ramses/framework/EFeatureLevel.h"
 
+#include <vector>
+
 namespace ramses::internal
 {
     class Guid;
@@ -42,10 +45,14 @@ namespace ramses::internal
         virtual bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) = 0;
 
         virtual bool sendInitializeScene(const Guid& to, const SceneId& sceneId) = 0;
-        virtual bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
+        // scene update is serialized once and sent to all given participants
+        virtual bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) = 0;
 
+        // to be set before scene is published, all initializations and updates of scene are sent with it
+        virtual void setSceneTransmissionPriority(const SceneId& sceneId, ETransmissionPriority priority) = 0;
+
         // set service handlers
         virtual void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) = 0;
         virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) = 0;
@@ -8,4 +8,4 @@
 
 #pragma once
 
-#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 137
+#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 139
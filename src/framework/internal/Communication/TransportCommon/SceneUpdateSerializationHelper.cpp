@@ -13,6 +13,7 @@
 #include "internal/Core/Utils/BinaryInputStream.h"
 #include "internal/Components/ResourceSerializationHelper.h"
 #include "internal/Components/FlushInformation.h"
+#include "internal/PlatformAbstraction/PlatformMemory.h"
 
 
 namespace
@@ -68,14 +69,22 @@ namespace ramses::internal
         }
 
         SceneActionCollection Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data)
+        {
+            SceneActionCollection actions = DeserializeDescription(description, data.size());
+            if (!data.empty())
+                PlatformMemory::Copy(actions.getRawDataForDirectWriting().data(), data.data(), data.size());
+            return actions;
+        }
+
+        SceneActionCollection DeserializeDescription(absl::Span<const std::byte> description, size_t dataSize)
         {
             BinaryInputStream is(description.data());
             uint32_t numActions = 0;
             is >> numActions;
             assert(description.size() == numActions*2*sizeof(uint32_t) + sizeof(uint32_t));
 
-            SceneActionCollection actions(data.size(), numActions);
-            actions.appendRawData(data.data(), data.size());
+            SceneActionCollection actions(dataSize, numActions);
+            actions.getRawDataForDirectWriting().resize(dataSize);
             for (uint32_t i = 0; i < numActions; ++i)
             {
                 uint32_t type = 0;
@@ -256,38 +265,72 @@ namespace ramses::internal
         }
 
         std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data, EFeatureLevel featureLevel)
+        {
+            PendingResource pendingResource = DeserializeDescription(description, data.size(), featureLevel);
+            if (!data.empty())
+            {
+                const absl::Span<std::byte> target = pendingResource.getDataForDirectWriting();
+                if (target.size() == data.size())
+                    PlatformMemory::Copy(target.data(), data.data(), data.size());
+            }
+            return FinalizeDeserialization(std::move(pendingResource));
+        }
+
+        absl::Span<std::byte> PendingResource::getDataForDirectWriting()
+        {
+            if (!resource)
+                return {};
+            return compressed ? absl::Span<std::byte>(compressedData.data(), compressedData.size()) : absl::Span<std::byte>(data.data(), data.size());
+        }
+
+        PendingResource DeserializeDescription(absl::Span<const std::byte> description, size_t dataSize, EFeatureLevel featureLevel)
         {
             BinaryInputStream is(description.data());
-            ResourceContentHash hash;
-            is >> hash;
+            PendingResource pendingResource;
+            is >> pendingResource.hash;
             ResourceSerializationHelper::DeserializedResourceHeader header =
                 ResourceSerializationHelper::ResourceFromMetadataStream(is, featureLevel);
+            if (!header.resource)
+                return pendingResource;
 
             const size_t expectedDataSize = header.compressionStatus == EResourceCompressionStatus::Compressed ?
                 header.compressedSize : header.decompressedSize;
 
-            if (data.size() != expectedDataSize)
+            if (dataSize != expectedDataSize)
             {
                 LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceSerialization::Deserialize: Expected resource size {} but got {}, compression state {}",
-                            expectedDataSize, data.size(), header.compressionStatus);
+                            expectedDataSize, dataSize, header.compressionStatus);
+                return pendingResource;
+            }
+
+            pendingResource.resource = std::move(header.resource);
+            pendingResource.compressed = (header.compressionStatus == EResourceCompressionStatus::Compressed);
+            pendingResource.decompressedSize = header.decompressedSize;
+            if (pendingResource.compressed)
+                pendingResource.compressedData = CompressedResourceBlob(dataSize);
+            else
+                pendingResource.data = ResourceBlob(dataSize);
+            return pendingResource;
+        }
+
+        std::unique_ptr<IResource> FinalizeDeserialization(PendingResource&& pendingResource)
+        {
+            if (!pendingResource.resource)
                 return nullptr;
+
+            // TODO(Carsten): We need to set a compression level here, but we simply don't know which one it is.
+            // We just set offline for now to avoid any potential recompressing, but there shouldn't be
+            // any compressing on renderer side anyway.To implement correctly, we need to break network/file
+            // compatibility by serializing the IResource::CompressionLevel instead of EResourceCompressionStatus
+            if (pendingResource.compressed && pendingResource.compressedData.size() != 0u)
+            {
+                pendingResource.resource->setCompressedResourceData(std::move(pendingResource.compressedData), IResource::CompressionLevel::Offline, pendingResource.decompressedSize, pendingResource.hash);
             }
-            if (!data.empty())
+            else if (!pendingResource.compressed && pendingResource.data.size() != 0u)
             {
-                // TODO(Carsten): We need to set a compression level here, but we simply don't know which one it is.
-                // We just set offline for now to avoid any potential recompressing, but there shouldn't be
-                // any compressing on renderer side anyway.To implement correctly, we need to break network/file
-                // compatibility by serializing the IResource::CompressionLevel instead of EResourceCompressionStatus
-                if (header.compressionStatus == EResourceCompressionStatus::Compressed)
-                {
-                    header.resource->setCompressedResourceData(CompressedResourceBlob(data.size(), data.data()), IResource::CompressionLevel::Offline, header.decompressedSize, hash);
-                }
-                else
-                {
-                    header.resource->setResourceData(ResourceBlob(data.size(), data.data()), hash);
-                }
+                pendingResource.resource->setResourceData(std::move(pendingResource.data), pendingResource.hash);
             }
-            return std::move(header.resource);
+            return std::move(pendingResource.resource);
         }
     }
 }
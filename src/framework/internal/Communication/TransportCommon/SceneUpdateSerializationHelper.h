@@ -9,6 +9,8 @@
 #pragma once
 
 #include "ramses/framework/EFeatureLevel.h"
+#include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 #include "absl/types/span.h"
 #include <cstdint>
 #include <vector>
@@ -26,6 +28,8 @@ namespace ramses::internal
         absl::Span<const std::byte> SerializeData(const SceneActionCollection& actions);
 
         SceneActionCollection Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data);
+        // actions of description with data of given size allocated, data is to be written directly into collection's raw data
+        SceneActionCollection DeserializeDescription(absl::Span<const std::byte> description, size_t dataSize);
     };
 
     namespace ResourceSerialization
@@ -34,6 +38,23 @@ namespace ramses::internal
         absl::Span<const std::byte> SerializeData(const IResource& resource);
 
         std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data, EFeatureLevel featureLevel);
+
+        // resource created from description with its data blob allocated, data is written directly into blob before finalizing
+        struct PendingResource
+        {
+            std::unique_ptr<IResource> resource;
+            ResourceContentHash hash;
+            bool compressed = false;
+            uint32_t decompressedSize = 0u;
+            ResourceBlob data;
+            CompressedResourceBlob compressedData;
+
+            [[nodiscard]] absl::Span<std::byte> getDataForDirectWriting();
+        };
+
+        // resource is nullptr if description is invalid or does not match data size
+        PendingResource DeserializeDescription(absl::Span<const std::byte> description, size_t dataSize, EFeatureLevel featureLevel);
+        std::unique_ptr<IResource> FinalizeDeserialization(PendingResource&& pendingResource);
     }
 
     namespace FlushInformationSerialization
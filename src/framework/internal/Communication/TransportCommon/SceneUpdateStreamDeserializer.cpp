@@ -11,6 +11,7 @@
 #include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/PlatformAbstraction/PlatformMemory.h"
 
 namespace ramses::internal
 {
@@ -19,6 +20,12 @@ namespace ramses::internal
     {
     }
 
+    void SceneUpdateStreamDeserializer::enableFlushTracing()
+    {
+        m_flushTracingEnabled = true;
+        m_currentResult.trace.enabled = true;
+    }
+
     SceneUpdateStreamDeserializer::Result SceneUpdateStreamDeserializer::processData(absl::Span<const std::byte> data)
     {
         // check state + input
@@ -47,6 +54,9 @@ namespace ramses::internal
             return fail();
         }
 
+        if (packetNum == 1u)
+            m_currentResult.trace.mark(EFlushTraceStage::Receive);
+
         if (hasMorePackets == SingleSceneUpdateWriter::hasMorePacketsFlag)
         {
             ++m_nextExpectedPacketNum;
@@ -66,7 +76,8 @@ namespace ramses::internal
         {
             if (m_currentBlockSize != 0)
             {
-                continueReadingBlock(is, data.size());
+                if (!continueReadingBlock(is, data.size()))
+                    return fail();
             }
             else
             {
@@ -75,7 +86,7 @@ namespace ramses::internal
             }
 
             // check if read full block
-            if (m_currentBlock.size() == m_currentBlockSize)
+            if (m_currentBlockReadBytes == m_currentBlockSize)
             {
                 if (!finalizeBlock())
                     return fail();
@@ -92,25 +103,48 @@ namespace ramses::internal
                 return fail();
             }
 
+            m_currentResult.trace.mark(EFlushTraceStage::Deserialize);
             Result toReturn = std::move(m_currentResult);
             toReturn.result = ResultType::HasData;
-            m_currentResult = Result{ResultType::Empty, SceneActionCollection(), {}, {}};
+            m_currentResult = Result{ResultType::Empty, SceneActionCollection(), {}, {}, {}};
+            m_currentResult.trace.enabled = m_flushTracingEnabled;
             return toReturn;
         }
 
-        return Result{ResultType::Empty, SceneActionCollection(), {}, {}};
+        return Result{ResultType::Empty, SceneActionCollection(), {}, {}, {}};
     }
 
-    void SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
+    bool SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
     {
-        assert(m_currentBlockSize > m_currentBlock.size());
+        assert(m_currentBlockSize > m_currentBlockReadBytes);
 
         const size_t remainingDatInPacket = dataSize - is.getCurrentReadBytes();
-        const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlock.size();
-        const size_t readBytes = std::min(remainingDatInPacket, remainingBytesToReadForBlock);
+        if (m_currentBlock.size() < m_currentBlockHeaderSize)
+        {
+            const size_t readBytes = std::min(remainingDatInPacket, m_currentBlockHeaderSize - m_currentBlock.size());
+            m_currentBlock.insert(m_currentBlock.end(), is.readPosition(), is.readPosition() + readBytes);
+            is.skip(static_cast<int64_t>(readBytes));
+            m_currentBlockReadBytes += static_cast<uint32_t>(readBytes);
 
-        m_currentBlock.insert(m_currentBlock.end(), is.readPosition(), is.readPosition() + readBytes);
-        is.skip(static_cast<int64_t>(readBytes));
+            if (m_blockHasData && m_currentBlock.size() == m_currentBlockHeaderSize)
+                return finishReadingBlockHeader();
+        }
+        else
+        {
+            const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlockReadBytes;
+            const size_t readBytes = std::min(remainingDatInPacket, remainingBytesToReadForBlock);
+
+            // data of invalid resource has no storage and is skipped
+            if (!m_currentBlockData.empty())
+            {
+                const size_t dataOffset = m_currentBlockReadBytes - m_currentBlockHeaderSize;
+                PlatformMemory::Copy(m_currentBlockData.data() + dataOffset, is.readPosition(), readBytes);
+            }
+            is.skip(static_cast<int64_t>(readBytes));
+            m_currentBlockReadBytes += static_cast<uint32_t>(readBytes);
+        }
+
+        return true;
     }
 
     bool SceneUpdateStreamDeserializer::startReadingNewBlock(BinaryInputStream& is, size_t dataSize)
@@ -126,6 +160,56 @@ namespace ramses::internal
 
         is >> m_blockType
            >> m_currentBlockSize;
+        m_currentBlockReadBytes = 0;
+
+        const auto blockType = static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType);
+        m_blockHasData = (blockType == SingleSceneUpdateWriter::BlockType::SceneActionCollection || blockType == SingleSceneUpdateWriter::BlockType::Resource)
+            && m_currentBlockSize >= sizeof(uint32_t) * 2;
+        // header size is extended by description size once its size was read
+        m_currentBlockHeaderSize = m_blockHasData ? sizeof(uint32_t) * 2 : m_currentBlockSize;
+
+        return true;
+    }
+
+    bool SceneUpdateStreamDeserializer::finishReadingBlockHeader()
+    {
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        is >> descSize
+           >> dataSize;
+
+        if (m_currentBlockHeaderSize == sizeof(uint32_t) * 2)
+        {
+            if (uint64_t{ sizeof(uint32_t) * 2 } + descSize + dataSize != m_currentBlockSize)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::finishReadingBlockHeader: Block size {} does not match description size {} and data size {}",
+                            m_currentBlockSize, descSize, dataSize);
+                return false;
+            }
+
+            // continue reading description
+            m_currentBlockHeaderSize += descSize;
+            if (m_currentBlock.size() < m_currentBlockHeaderSize)
+                return true;
+        }
+
+        const absl::Span<const std::byte> description(is.readPosition(), descSize);
+        if (static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+        {
+            if (m_currentResult.actions.numberOfActions() != 0)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: More than one SceneActionCollection in packet");
+                return false;
+            }
+            m_currentResult.actions = SceneActionSerialization::DeserializeDescription(description, dataSize);
+            m_currentBlockData = absl::MakeSpan(m_currentResult.actions.getRawDataForDirectWriting());
+        }
+        else
+        {
+            m_pendingResource = ResourceSerialization::DeserializeDescription(description, dataSize, m_featureLevel);
+            m_currentBlockData = m_pendingResource.getDataForDirectWriting();
+        }
 
         return true;
     }
@@ -156,58 +240,40 @@ namespace ramses::internal
         }
 
         m_currentBlock.clear();
+        m_currentBlockData = {};
         m_currentBlockSize = 0;
+        m_currentBlockReadBytes = 0;
         return true;
     }
 
     SceneUpdateStreamDeserializer::Result SceneUpdateStreamDeserializer::fail()
     {
         m_hasFailed = true;
-        return Result{ResultType::Failed, SceneActionCollection(), {}, {}};
+        return Result{ResultType::Failed, SceneActionCollection(), {}, {}, {}};
     }
 
     bool SceneUpdateStreamDeserializer::handleSceneActionCollection()
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
-        {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlock.size());
-            return false;
-        }
-        if (m_currentResult.actions.numberOfActions() != 0)
+        // actions were deserialized when block header was read
+        if (!m_blockHasData)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: More than one SceneActionCollection in packet");
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlockSize);
             return false;
         }
-
-        BinaryInputStream is(m_currentBlock.data());
-        uint32_t descSize = 0;
-        uint32_t dataSize = 0;
-        is >> descSize
-           >> dataSize;
-
-        m_currentResult.actions = SceneActionSerialization::Deserialize(absl::Span<const std::byte>(is.readPosition(), descSize),
-                                                                        absl::Span<const std::byte>(is.readPosition() + descSize, dataSize));
         return true;
     }
 
     bool SceneUpdateStreamDeserializer::handleResource()
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (!m_blockHasData)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlockSize);
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
-        uint32_t descSize = 0;
-        uint32_t dataSize = 0;
-        is >> descSize
-           >> dataSize;
-
-        m_currentResult.resources.push_back(ResourceSerialization::Deserialize(absl::Span<const std::byte>(is.readPosition(), descSize),
-                                                                               absl::Span<const std::byte>(is.readPosition() + descSize, dataSize), m_featureLevel));
+        m_currentResult.resources.push_back(ResourceSerialization::FinalizeDeserialization(std::move(m_pendingResource)));
+        m_pendingResource = {};
         return true;
-
     }
 
     bool SceneUpdateStreamDeserializer::handleFlushInfos()
@@ -9,7 +9,9 @@
 #pragma once
 
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
+#include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
 #include "internal/Components/FlushInformation.h"
+#include "internal/Components/FlushTrace.h"
 #include "ramses/framework/EFeatureLevel.h"
 #include "absl/types/span.h"
 
@@ -43,13 +45,17 @@ namespace ramses::internal
             SceneActionCollection                   actions;
             FlushInformation                        flushInfos;
             std::vector<std::unique_ptr<IResource>> resources;
+            FlushTrace                              trace;
         };
 
+        // records receive and deserialize stage timestamps into result
+        void enableFlushTracing();
         Result processData(absl::Span<const std::byte> data);
 
     private:
-        void continueReadingBlock(BinaryInputStream& is, size_t dataSize);
+        bool continueReadingBlock(BinaryInputStream& is, size_t dataSize);
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
+        bool finishReadingBlockHeader();
         Result fail();
 
         bool finalizeBlock();
@@ -60,10 +66,20 @@ namespace ramses::internal
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
         uint32_t m_currentBlockSize = 0;
+        uint32_t m_currentBlockReadBytes = 0;
         uint32_t m_blockType = 0;
+
+        // Scene action and resource blocks consist of a header (description and data sizes, description) and data.
+        // Only the header is buffered, data is read from packets directly into storage of the deserialized actions or resource.
+        // Blocks of other types are buffered completely.
+        bool m_blockHasData = false;
+        size_t m_currentBlockHeaderSize = 0;
         std::vector<std::byte> m_currentBlock;
+        absl::Span<std::byte> m_currentBlockData;
+        ResourceSerialization::PendingResource m_pendingResource;
         Result m_currentResult;
 
         EFeatureLevel m_featureLevel = EFeatureLevel_Latest;
+        bool m_flushTracingEnabled = false;
     };
 }
@@ -42,6 +42,7 @@ namespace ramses::internal
         virtual void handleSceneNotAvailable(const SceneId& sceneId, const Guid& providerID) = 0;
 
         virtual void handleInitializeScene(const SceneId& sceneId, const Guid& providerID) = 0;
+        // may be called without framework lock held, updates of one scene are never passed concurrently
         virtual void handleSceneUpdate(const SceneId& sceneId, absl::Span<const std::byte> actionData, const Guid& providerID) = 0;
     };
 }
@@ -0,0 +1,554 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryConnectionSystem.h"
+#include "internal/Communication/TransportCommon/IConnectionStatusUpdateNotifier.h"
+#include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // prepended to every message in ring, payload of scene update follows directly
+        struct MessageHeader
+        {
+            EMessageId messageType;
+            uint32_t reserved;
+            uint64_t sceneId;
+        };
+        static_assert(std::is_trivially_copyable_v<MessageHeader> && sizeof(MessageHeader) == 16u);
+
+        // interval in which receiving thread checks for being stopped
+        constexpr std::chrono::milliseconds ReceivePollInterval{ 100 };
+
+        // data waiting for free space in ring of a receiver which does not keep up, sending to it fails beyond that
+        constexpr size_t MaxQueuedBytes = 4u * SharedMemoryConnectionSystem::RingCapacity;
+    }
+
+    class SharedMemoryConnectionSystem::InboundChannel final : public Runnable
+    {
+    public:
+        InboundChannel(SharedMemoryConnectionSystem& system, const Guid& sender, std::unique_ptr<SharedMemoryRingBuffer> ring)
+            : m_system(system)
+            , m_sender(sender)
+            , m_ring(std::move(ring))
+        {
+            m_thread.start(*this);
+        }
+
+        ~InboundChannel() override
+        {
+            stop();
+            m_thread.join();
+        }
+
+        InboundChannel(const InboundChannel&) = delete;
+        InboundChannel& operator=(const InboundChannel&) = delete;
+
+        void run() override
+        {
+            while (!isCancelRequested())
+            {
+                const auto message = m_ring->peek(ReceivePollInterval);
+                if (!message.empty())
+                {
+                    m_system.handleMessage(*this, message);
+                    m_ring->release();
+                }
+            }
+        }
+
+        // sender's writes fail from now on, thread finishes within poll interval
+        void stop()
+        {
+            cancel();
+            m_ring->detachConsumer();
+        }
+
+        [[nodiscard]] bool isFinished() const
+        {
+            return !m_thread.isRunning();
+        }
+
+        [[nodiscard]] const Guid& getSender() const
+        {
+            return m_sender;
+        }
+
+    private:
+        SharedMemoryConnectionSystem& m_system;
+        const Guid m_sender;
+        std::unique_ptr<SharedMemoryRingBuffer> m_ring;
+        PlatformThread m_thread{ "ShmReceive" };
+    };
+
+    class SharedMemoryConnectionSystem::RingWriter final : public Runnable
+    {
+    public:
+        RingWriter(const SharedMemoryConnectionSystem& system, const Guid& receiver, std::unique_ptr<SharedMemoryRingBuffer> ring)
+            : m_system(system)
+            , m_receiver(receiver)
+            , m_ring(std::move(ring))
+        {
+            m_thread.start(*this);
+        }
+
+        ~RingWriter() override
+        {
+            stop();
+            m_thread.join();
+        }
+
+        RingWriter(const RingWriter&) = delete;
+        RingWriter& operator=(const RingWriter&) = delete;
+
+        void run() override
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!isCancelRequested())
+            {
+                if (m_queue.empty())
+                {
+                    m_queueChanged.wait(lock);
+                    continue;
+                }
+
+                // waits for consumer without lock, messages sent meanwhile are queued behind
+                const std::vector<std::byte> message = std::move(m_queue.front());
+                m_queue.pop_front();
+                m_queuedBytes -= message.size();
+                m_writing = true;
+                lock.unlock();
+                const bool written = m_ring->write({ { message.data(), message.size() } }, m_system.m_sendTimeout);
+                lock.lock();
+                m_writing = false;
+                if (!written)
+                    fail("failed to write to");
+            }
+        }
+
+        // never waits for consumer: writes directly if there is enough free space and nothing queued, queues otherwise
+        bool write(EMessageId messageType, const SceneId& sceneId, absl::Span<const std::byte> data)
+        {
+            const MessageHeader header{ messageType, 0u, sceneId.getValue() };
+            const absl::Span<const std::byte> headerData{ reinterpret_cast<const std::byte*>(&header), sizeof(header) };
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_failed)
+                return false;
+
+            if (m_queue.empty() && !m_writing && m_ring->write({ headerData, data }, std::chrono::milliseconds{ 0 }))
+                return true;
+
+            const size_t messageSize = headerData.size() + data.size();
+            if (m_queuedBytes + messageSize > MaxQueuedBytes)
+            {
+                fail("too much data queued for");
+                return false;
+            }
+
+            std::vector<std::byte> message;
+            message.reserve(messageSize);
+            message.insert(message.end(), headerData.begin(), headerData.end());
+            message.insert(message.end(), data.begin(), data.end());
+            m_queue.push_back(std::move(message));
+            m_queuedBytes += messageSize;
+            m_queueChanged.notify_one();
+            return true;
+        }
+
+        [[nodiscard]] bool hasFailed() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_failed;
+        }
+
+        // thread finishes when pending write completes or times out
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                cancel();
+            }
+            m_queueChanged.notify_all();
+        }
+
+        [[nodiscard]] bool isFinished() const
+        {
+            return !m_thread.isRunning();
+        }
+
+        [[nodiscard]] const std::string& getRingName() const
+        {
+            return m_ring->getName();
+        }
+
+    private:
+        // called with m_mutex held
+        void fail(std::string_view reason)
+        {
+            if (m_failed)
+                return;
+
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::RingWriter: {} {} through {}, dropping scene updates until scene is initialized again",
+                m_system.m_participantName, reason, m_receiver, m_ring->getName());
+            m_failed = true;
+            m_queue.clear();
+            m_queuedBytes = 0u;
+        }
+
+        const SharedMemoryConnectionSystem& m_system;
+        const Guid m_receiver;
+        const std::unique_ptr<SharedMemoryRingBuffer> m_ring;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_queueChanged;
+        std::deque<std::vector<std::byte>> m_queue;
+        size_t m_queuedBytes = 0u;
+        bool m_writing = false;
+        bool m_failed = false;
+
+        PlatformThread m_thread{ "ShmSend" };
+    };
+
+    SharedMemoryConnectionSystem::SharedMemoryConnectionSystem(std::unique_ptr<ICommunicationSystem> controlSystem, const Guid& participantId, std::string participantName,
+        PlatformLock& frameworkLock, std::chrono::milliseconds sendTimeout)
+        : m_controlSystem(std::move(controlSystem))
+        , m_participantId(participantId)
+        , m_participantName(std::move(participantName))
+        , m_sendTimeout(sendTimeout)
+        , m_frameworkLock(frameworkLock)
+    {
+        assert(m_controlSystem);
+        m_controlSystem->getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(this);
+    }
+
+    SharedMemoryConnectionSystem::~SharedMemoryConnectionSystem()
+    {
+        m_controlSystem->getRamsesConnectionStatusUpdateNotifier().unregisterForConnectionUpdates(this);
+        // joins receiving and sending threads
+        m_inboundChannels.clear();
+        m_retiredInboundChannels.clear();
+        m_outboundChannels.clear();
+        m_retiredRingWriters.clear();
+    }
+
+    std::string SharedMemoryConnectionSystem::GetRingName(const Guid& producer, const Guid& consumer)
+    {
+        return fmt::format("/ramses-{:016x}-{:016x}", producer.get(), consumer.get());
+    }
+
+    bool SharedMemoryConnectionSystem::connectServices()
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::connectServices: {}, ring capacity {} bytes, send timeout {}ms",
+            m_participantName, m_participantId, RingCapacity, m_sendTimeout.count());
+        return m_controlSystem->connectServices();
+    }
+
+    bool SharedMemoryConnectionSystem::disconnectServices()
+    {
+        PlatformGuard guard(m_frameworkLock);
+        const bool result = m_controlSystem->disconnectServices();
+
+        // control system reports disconnection of all participants, remove any leftovers in case it did not
+        for (auto& channel : m_inboundChannels)
+        {
+            channel.second->stop();
+            m_retiredInboundChannels.push_back(std::move(channel.second));
+        }
+        m_inboundChannels.clear();
+        for (auto& channel : m_outboundChannels)
+        {
+            if (channel.second.writer)
+                m_retiredRingWriters.push_back(std::move(channel.second.writer));
+        }
+        m_outboundChannels.clear();
+        m_connectedParticipants.clear();
+        joinRetiredChannels(true);
+
+        return result;
+    }
+
+    IConnectionStatusUpdateNotifier& SharedMemoryConnectionSystem::getRamsesConnectionStatusUpdateNotifier()
+    {
+        return m_controlSystem->getRamsesConnectionStatusUpdateNotifier();
+    }
+
+    bool SharedMemoryConnectionSystem::broadcastNewScenesAvailable(const SceneInfoVector& newScenes, EFeatureLevel featureLevel)
+    {
+        return m_controlSystem->broadcastNewScenesAvailable(newScenes, featureLevel);
+    }
+
+    bool SharedMemoryConnectionSystem::broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes)
+    {
+        return m_controlSystem->broadcastScenesBecameUnavailable(unavailableScenes);
+    }
+
+    bool SharedMemoryConnectionSystem::sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes, EFeatureLevel featureLevel)
+    {
+        return m_controlSystem->sendScenesAvailable(to, availableScenes, featureLevel);
+    }
+
+    bool SharedMemoryConnectionSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        // ring must exist before provider receives subscription and initializes the scene
+        if (m_connectedParticipants.contains(to) && m_inboundChannels.count(to) == 0u)
+        {
+            joinRetiredChannels(false);
+            auto ring = SharedMemoryRingBuffer::Create(GetRingName(to, m_participantId), RingCapacity);
+            if (ring)
+            {
+                LOG_INFO(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::sendSubscribeScene: receiving from {} through {}", m_participantName, to, ring->getName());
+                m_inboundChannels.emplace(to, std::make_unique<InboundChannel>(*this, to, std::move(ring)));
+            }
+        }
+        return m_controlSystem->sendSubscribeScene(to, sceneId);
+    }
+
+    bool SharedMemoryConnectionSystem::sendUnsubscribeScene(const Guid& to, const SceneId& sceneId)
+    {
+        return m_controlSystem->sendUnsubscribeScene(to, sceneId);
+    }
+
+    bool SharedMemoryConnectionSystem::sendInitializeScene(const Guid& to, const SceneId& sceneId)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        if (m_connectedParticipants.contains(to))
+        {
+            // decided per scene stream, initialization and all following updates must take same path to keep them ordered
+            auto& channel = m_outboundChannels[to];
+            if (channel.writer && channel.writer->hasFailed())
+            {
+                // thread might still wait for consumer, joined later
+                channel.writer->stop();
+                m_retiredRingWriters.push_back(std::move(channel.writer));
+            }
+            joinRetiredChannels(false);
+            if (!channel.writer)
+            {
+                auto ring = SharedMemoryRingBuffer::Open(GetRingName(m_participantId, to));
+                if (ring)
+                    channel.writer = std::make_unique<RingWriter>(*this, to, std::move(ring));
+            }
+            if (channel.writer)
+            {
+                LOG_DEBUG(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::sendInitializeScene: to {}, sceneId {} through {}", m_participantName, to, sceneId, channel.writer->getRingName());
+                channel.scenes.put(sceneId);
+                return writeMessage(channel, EMessageId::CreateScene, sceneId, {});
+            }
+            channel.scenes.remove(sceneId);
+        }
+        return m_controlSystem->sendInitializeScene(to, sceneId);
+    }
+
+    bool SharedMemoryConnectionSystem::sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        std::vector<Guid> controlRecipients;
+        std::vector<std::pair<Guid, OutboundChannel*>> ringRecipients;
+        for (const auto& recipient : to)
+        {
+            const auto it = m_outboundChannels.find(recipient);
+            if (it != m_outboundChannels.end() && it->second.scenes.contains(sceneId))
+                ringRecipients.emplace_back(recipient, &it->second);
+            else
+                controlRecipients.push_back(recipient);
+        }
+
+        bool result = true;
+        if (!controlRecipients.empty())
+            result = m_controlSystem->sendSceneUpdate(controlRecipients, sceneId, serializer);
+
+        if (!ringRecipients.empty())
+        {
+            LOG_TRACE(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::sendSceneUpdate: to {} participants through shared memory", m_participantName, ringRecipients.size());
+
+            // serialized once, every packet is copied directly into rings of all recipients (or queued if ring is full)
+            std::vector<std::byte> packet(SceneUpdatePacketSize);
+            bool allSent = true;
+            const bool serialized = serializer.writeToPackets({ packet.data(), packet.size() }, [&](size_t size) {
+                bool anySent = false;
+                for (auto& recipient : ringRecipients)
+                {
+                    if (writeMessage(*recipient.second, EMessageId::SendSceneUpdate, sceneId, { packet.data(), size }))
+                        anySent = true;
+                    else
+                        allSent = false;
+                }
+                return anySent;
+            });
+            result = result && serialized && allSent;
+        }
+
+        return result;
+    }
+
+    bool SharedMemoryConnectionSystem::sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data)
+    {
+        return m_controlSystem->sendRendererEvent(to, sceneId, data);
+    }
+
+    void SharedMemoryConnectionSystem::setSceneTransmissionPriority(const SceneId& sceneId, ETransmissionPriority priority)
+    {
+        // rings are per sender/receiver pair and not shared with other traffic, priority only matters for scenes sent through control system
+        m_controlSystem->setSceneTransmissionPriority(sceneId, priority);
+    }
+
+    void SharedMemoryConnectionSystem::setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler)
+    {
+        m_controlSystem->setSceneProviderServiceHandler(handler);
+    }
+
+    void SharedMemoryConnectionSystem::setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_sceneRendererHandler = handler;
+        m_controlSystem->setSceneRendererServiceHandler(handler);
+    }
+
+    void SharedMemoryConnectionSystem::logConnectionInfo()
+    {
+        m_controlSystem->logConnectionInfo();
+
+        PlatformGuard guard(m_frameworkLock);
+        LOG_INFO_F(CONTEXT_PERIODIC, ([&](StringOutputStream& sos) {
+            sos << "SharedMemoryConnectionSystem:\n";
+            sos << "  Receiving through shared memory from:";
+            for (const auto& channel : m_inboundChannels)
+                sos << " " << channel.first;
+            sos << "\n  Sending through shared memory to:";
+            for (const auto& channel : m_outboundChannels)
+            {
+                if (channel.second.writer && !channel.second.writer->hasFailed())
+                    sos << " " << channel.first << " (" << channel.second.scenes.size() << " scenes)";
+            }
+            sos << "\n";
+        }));
+    }
+
+    void SharedMemoryConnectionSystem::triggerLogMessageForPeriodicLog()
+    {
+        m_controlSystem->triggerLogMessageForPeriodicLog();
+    }
+
+    void SharedMemoryConnectionSystem::newParticipantHasConnected(const Guid& guid)
+    {
+        // called with framework lock held
+        m_connectedParticipants.put(guid);
+    }
+
+    void SharedMemoryConnectionSystem::participantHasDisconnected(const Guid& guid)
+    {
+        // called with framework lock held
+        m_connectedParticipants.remove(guid);
+        retireOutboundChannel(guid);
+        retireInboundChannel(guid);
+    }
+
+    void SharedMemoryConnectionSystem::handleMessage(InboundChannel& channel, absl::Span<const std::byte> message)
+    {
+        MessageHeader header{};
+        if (message.size() < sizeof(header))
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::handleMessage: from {}, message size {} too small", m_participantName, channel.getSender(), message.size());
+            return;
+        }
+        std::memcpy(&header, message.data(), sizeof(header));
+        const SceneId sceneId{ header.sceneId };
+
+        PlatformGuard guard(m_frameworkLock);
+        // channel might have been retired while waiting for lock
+        if (channel.isCancelRequested() || !m_sceneRendererHandler)
+            return;
+
+        switch (header.messageType)
+        {
+        case EMessageId::CreateScene:
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::handleInitializeScene: from {}, sceneId {}", m_participantName, channel.getSender(), sceneId);
+            m_sceneRendererHandler->handleInitializeScene(sceneId, channel.getSender());
+            break;
+        case EMessageId::SendSceneUpdate:
+            LOG_TRACE(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::handleSceneUpdate: from {}, sceneId {}", m_participantName, channel.getSender(), sceneId);
+            // handled synchronously, data is passed without copy directly from shared memory which is released afterwards
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, message.subspan(sizeof(header)), channel.getSender());
+            break;
+        default:
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryConnectionSystem({})::handleMessage: from {}, unexpected message type {}", m_participantName, channel.getSender(), header.messageType);
+            break;
+        }
+    }
+
+    bool SharedMemoryConnectionSystem::writeMessage(OutboundChannel& channel, EMessageId messageType, const SceneId& sceneId, absl::Span<const std::byte> data)
+    {
+        return channel.writer && channel.writer->write(messageType, sceneId, data);
+    }
+
+    void SharedMemoryConnectionSystem::retireInboundChannel(const Guid& from)
+    {
+        const auto it = m_inboundChannels.find(from);
+        if (it == m_inboundChannels.end())
+            return;
+
+        // cannot join here, receiving thread might wait for framework lock
+        it->second->stop();
+        m_retiredInboundChannels.push_back(std::move(it->second));
+        m_inboundChannels.erase(it);
+    }
+
+    void SharedMemoryConnectionSystem::retireOutboundChannel(const Guid& to)
+    {
+        const auto it = m_outboundChannels.find(to);
+        if (it == m_outboundChannels.end())
+            return;
+
+        // cannot join here, sending thread might wait for consumer up to send timeout
+        if (it->second.writer)
+        {
+            it->second.writer->stop();
+            m_retiredRingWriters.push_back(std::move(it->second.writer));
+        }
+        m_outboundChannels.erase(it);
+    }
+
+    void SharedMemoryConnectionSystem::joinRetiredChannels(bool waitForRunning)
+    {
+        if (!waitForRunning)
+        {
+            m_retiredInboundChannels.erase(std::remove_if(m_retiredInboundChannels.begin(), m_retiredInboundChannels.end(),
+                [](const auto& channel) { return channel->isFinished(); }), m_retiredInboundChannels.end());
+            m_retiredRingWriters.erase(std::remove_if(m_retiredRingWriters.begin(), m_retiredRingWriters.end(),
+                [](const auto& writer) { return writer->isFinished(); }), m_retiredRingWriters.end());
+            return;
+        }
+
+        auto channels = std::move(m_retiredInboundChannels);
+        m_retiredInboundChannels.clear();
+        auto writers = std::move(m_retiredRingWriters);
+        m_retiredRingWriters.clear();
+        {
+            // must release lock to let receiving threads finish
+            m_frameworkLock.unlock();
+            channels.clear();
+            writers.clear();
+            m_frameworkLock.lock();
+        }
+    }
+}
@@ -0,0 +1,110 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Communication/TransportCommon/ICommunicationSystem.h"
+#include "internal/Communication/TransportCommon/IConnectionStatusListener.h"
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "internal/Communication/TransportTCP/EMessageId.h"
+#include "internal/PlatformAbstraction/PlatformLock.h"
+#include "internal/PlatformAbstraction/Collections/Guid.h"
+#include "internal/PlatformAbstraction/Collections/HashSet.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Communication system for participants running on the same host.
+    // Discovery and all control messages go through the wrapped control system (TCP, compatible with TcpDiscoveryDaemon),
+    // scene initialization and scene updates are passed through one shared memory ring per sender/receiver pair.
+    //
+    // The receiver creates the ring before it subscribes to a scene of a provider, so when the provider initializes the scene it
+    // either finds the ring (same host, same protocol) or falls back to the control system for the whole lifetime of that scene stream.
+    //
+    // Messages are sent while framework lock is held, so they are never waited for there: a message is written directly if it fits
+    // into the ring, otherwise it is queued and written by a sending thread per ring, which waits for free space without the lock.
+    class SharedMemoryConnectionSystem final : public ICommunicationSystem, private IConnectionStatusListener
+    {
+    public:
+        static constexpr uint32_t RingCapacity = 8u * 1024u * 1024u;
+        static constexpr uint32_t SceneUpdatePacketSize = 1024u * 1024u;
+
+        SharedMemoryConnectionSystem(std::unique_ptr<ICommunicationSystem> controlSystem, const Guid& participantId, std::string participantName,
+            PlatformLock& frameworkLock, std::chrono::milliseconds sendTimeout);
+        ~SharedMemoryConnectionSystem() override;
+
+        static std::string GetRingName(const Guid& producer, const Guid& consumer);
+
+        bool connectServices() override;
+        bool disconnectServices() override;
+
+        IConnectionStatusUpdateNotifier& getRamsesConnectionStatusUpdateNotifier() override;
+
+        // scene
+        bool broadcastNewScenesAvailable(const SceneInfoVector& newScenes, EFeatureLevel featureLevel) override;
+        bool broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes) override;
+        bool sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes, EFeatureLevel featureLevel) override;
+
+        bool sendSubscribeScene(const Guid& to, const SceneId& sceneId) override;
+        bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
+
+        bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
+        bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+
+        bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) override;
+
+        void setSceneTransmissionPriority(const SceneId& sceneId, ETransmissionPriority priority) override;
+
+        // set service handlers
+        void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) override;
+        void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) override;
+
+        // log triggers
+        void logConnectionInfo() override;
+        void triggerLogMessageForPeriodicLog() override;
+
+    private:
+        class InboundChannel;
+        class RingWriter;
+
+        struct OutboundChannel
+        {
+            // fails when writing failed, scenes stay assigned to channel and are dropped until initialized again
+            std::unique_ptr<RingWriter> writer;
+            HashSet<SceneId> scenes;
+        };
+
+        void newParticipantHasConnected(const Guid& guid) override;
+        void participantHasDisconnected(const Guid& guid) override;
+
+        void handleMessage(InboundChannel& channel, absl::Span<const std::byte> message);
+        bool writeMessage(OutboundChannel& channel, EMessageId messageType, const SceneId& sceneId, absl::Span<const std::byte> data);
+        void retireInboundChannel(const Guid& from);
+        void retireOutboundChannel(const Guid& to);
+        void joinRetiredChannels(bool waitForRunning);
+
+        const std::unique_ptr<ICommunicationSystem> m_controlSystem;
+        const Guid m_participantId;
+        const std::string m_participantName;
+        const std::chrono::milliseconds m_sendTimeout;
+
+        PlatformLock& m_frameworkLock;
+        ISceneRendererServiceHandler* m_sceneRendererHandler = nullptr;
+
+        HashSet<Guid> m_connectedParticipants;
+        std::unordered_map<Guid, std::unique_ptr<InboundChannel>> m_inboundChannels;
+        std::vector<std::unique_ptr<InboundChannel>> m_retiredInboundChannels;
+        std::unordered_map<Guid, OutboundChannel> m_outboundChannels;
+        std::vector<std::unique_ptr<RingWriter>> m_retiredRingWriters;
+    };
+}
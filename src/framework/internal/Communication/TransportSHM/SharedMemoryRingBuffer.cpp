@@ -0,0 +1,357 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        constexpr uint32_t RingMagic = 0x52414d53u;
+        constexpr uint32_t RingVersion = 1u;
+
+        // every record starts with 32bit message size followed by padding, records are aligned to 8 bytes
+        constexpr uint32_t RecordHeaderSize = 8u;
+        constexpr uint64_t RecordAlignment = 8u;
+        // record size marking that rest of ring until its end is unused and next record starts at beginning
+        constexpr uint32_t WrapMarker = std::numeric_limits<uint32_t>::max();
+
+        constexpr uint64_t AlignRecordSize(uint64_t size)
+        {
+            return (size + RecordAlignment - 1u) & ~(RecordAlignment - 1u);
+        }
+
+        // futexes are not process private, they work for all processes mapping the shared memory
+        void FutexWait(std::atomic<uint32_t>& word, uint32_t expectedValue, std::chrono::nanoseconds timeout)
+        {
+            timespec relativeTimeout{};
+            relativeTimeout.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+            relativeTimeout.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+            // returns immediately if word changed meanwhile, callers re-check their condition after timeouts and spurious wakeups
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expectedValue, &relativeTimeout, nullptr, 0);
+        }
+
+        void FutexWakeAll(std::atomic<uint32_t>& word)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+
+        bool IsProcessAlive(pid_t pid)
+        {
+            return kill(pid, 0) == 0 || errno == EPERM;
+        }
+    }
+
+    struct SharedMemoryRingBuffer::ControlBlock
+    {
+        uint32_t magic = 0u;
+        uint32_t version = 0u;
+        uint32_t capacity = 0u;
+        pid_t consumerPid = 0;
+        std::atomic<uint32_t> consumerAttached{ 0u };
+        std::atomic<uint32_t> producerAttached{ 0u };
+
+        // written by producer only, separate cache line from consumer's data
+        alignas(64) std::atomic<uint64_t> writePosition{ 0u };
+        std::atomic<uint32_t> writeSignal{ 0u };
+        std::atomic<uint32_t> consumerWaiting{ 0u };
+
+        // written by consumer only
+        alignas(64) std::atomic<uint64_t> readPosition{ 0u };
+        std::atomic<uint32_t> readSignal{ 0u };
+        std::atomic<uint32_t> producerWaiting{ 0u };
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free, "atomics in shared memory must be lock free");
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be plain 32bit integer");
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(const std::string& name, uint32_t capacity)
+    {
+        const auto alignedCapacity = static_cast<uint32_t>(AlignRecordSize(std::max(capacity, RecordHeaderSize)));
+        const size_t mappingSize = sizeof(ControlBlock) + alignedCapacity;
+
+        // remove leftover of crashed process which used same name, a producer still mapping it keeps its own copy
+        shm_unlink(name.c_str());
+        const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: shm_open of {} failed with error: {}", name, strerror(errno));
+            return nullptr;
+        }
+        if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: resizing {} to {} bytes failed with error: {}", name, mappingSize, strerror(errno));
+            close(fd);
+            shm_unlink(name.c_str());
+            return nullptr;
+        }
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: mmap of {} failed with error: {}", name, strerror(errno));
+            shm_unlink(name.c_str());
+            return nullptr;
+        }
+
+        auto* control = new (mapping) ControlBlock;
+        control->magic = RingMagic;
+        control->version = RingVersion;
+        control->capacity = alignedCapacity;
+        control->consumerPid = getpid();
+        control->consumerAttached.store(1u, std::memory_order_release);
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(name, true, mapping, mappingSize));
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Open(const std::string& name)
+    {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(ControlBlock)))
+        {
+            close(fd);
+            return nullptr;
+        }
+        const auto mappingSize = static_cast<size_t>(fileStat.st_size);
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Open: mmap of {} failed with error: {}", name, strerror(errno));
+            return nullptr;
+        }
+
+        auto& control = *static_cast<ControlBlock*>(mapping);
+        const bool isValid = control.consumerAttached.load(std::memory_order_acquire) != 0u &&
+            control.magic == RingMagic &&
+            control.version == RingVersion &&
+            sizeof(ControlBlock) + control.capacity == mappingSize &&
+            IsProcessAlive(control.consumerPid);
+        uint32_t noProducer = 0u;
+        if (!isValid || !control.producerAttached.compare_exchange_strong(noProducer, 1u))
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Open: {} is stale or already has a producer", name);
+            munmap(mapping, mappingSize);
+            return nullptr;
+        }
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(name, false, mapping, mappingSize));
+    }
+
+    SharedMemoryRingBuffer::SharedMemoryRingBuffer(std::string name, bool isConsumer, void* mapping, size_t mappingSize)
+        : m_name(std::move(name))
+        , m_isConsumer(isConsumer)
+        , m_mapping(mapping)
+        , m_mappingSize(mappingSize)
+        , m_control(*static_cast<ControlBlock*>(mapping))
+        , m_data(static_cast<std::byte*>(mapping) + sizeof(ControlBlock))
+        , m_capacity(m_control.capacity)
+    {
+    }
+
+    SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+    {
+        if (m_isConsumer)
+            detachConsumer();
+        else
+            m_control.producerAttached.store(0u, std::memory_order_release);
+        munmap(m_mapping, m_mappingSize);
+    }
+
+    const std::string& SharedMemoryRingBuffer::getName() const
+    {
+        return m_name;
+    }
+
+    uint32_t SharedMemoryRingBuffer::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    uint32_t SharedMemoryRingBuffer::getMaxMessageSize() const
+    {
+        return m_capacity - RecordHeaderSize;
+    }
+
+    bool SharedMemoryRingBuffer::isConsumerAttached() const
+    {
+        return m_control.consumerAttached.load(std::memory_order_acquire) != 0u;
+    }
+
+    bool SharedMemoryRingBuffer::write(std::initializer_list<absl::Span<const std::byte>> parts, std::chrono::milliseconds timeout)
+    {
+        assert(!m_isConsumer);
+
+        size_t messageSize = 0u;
+        for (const auto& part : parts)
+            messageSize += part.size();
+        if (messageSize > getMaxMessageSize())
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::write: message size {} exceeds maximum {} of {}", messageSize, getMaxMessageSize(), m_name);
+            return false;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        const uint64_t recordSize = AlignRecordSize(RecordHeaderSize + messageSize);
+        uint64_t writePosition = m_control.writePosition.load(std::memory_order_relaxed);
+        uint64_t offset = writePosition % m_capacity;
+
+        // records are never split, skip rest of ring if record does not fit before its end
+        if (m_capacity - offset < recordSize)
+        {
+            const uint64_t skippedSize = m_capacity - offset;
+            if (!waitForFreeSpace(skippedSize, deadline))
+                return false;
+            std::memcpy(m_data + offset, &WrapMarker, sizeof(WrapMarker));
+            writePosition += skippedSize;
+            publishWritePosition(writePosition);
+            offset = 0u;
+        }
+
+        if (!waitForFreeSpace(recordSize, deadline))
+            return false;
+
+        const auto messageSize32 = static_cast<uint32_t>(messageSize);
+        std::memcpy(m_data + offset, &messageSize32, sizeof(messageSize32));
+        std::byte* dest = m_data + offset + RecordHeaderSize;
+        for (const auto& part : parts)
+        {
+            if (!part.empty())
+            {
+                std::memcpy(dest, part.data(), part.size());
+                dest += part.size();
+            }
+        }
+        publishWritePosition(writePosition + recordSize);
+
+        return true;
+    }
+
+    absl::Span<const std::byte> SharedMemoryRingBuffer::peek(std::chrono::milliseconds timeout)
+    {
+        assert(m_isConsumer);
+        assert(m_pendingReleaseSize == 0u && "previous message must be released first");
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;)
+        {
+            const uint32_t signal = m_control.writeSignal.load(std::memory_order_acquire);
+            const uint64_t readPosition = m_control.readPosition.load(std::memory_order_relaxed);
+            if (readPosition != m_control.writePosition.load(std::memory_order_acquire))
+            {
+                const uint64_t offset = readPosition % m_capacity;
+                uint32_t messageSize = 0u;
+                std::memcpy(&messageSize, m_data + offset, sizeof(messageSize));
+                if (messageSize == WrapMarker)
+                {
+                    m_pendingReleaseSize = m_capacity - offset;
+                    release();
+                    continue;
+                }
+
+                const uint64_t recordSize = AlignRecordSize(RecordHeaderSize + messageSize);
+                if (offset + recordSize > m_capacity)
+                {
+                    LOG_ERROR(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::peek: corrupted record of size {} at offset {} in {}, detaching", messageSize, offset, m_name);
+                    detachConsumer();
+                    return {};
+                }
+
+                m_pendingReleaseSize = recordSize;
+                return { m_data + offset + RecordHeaderSize, messageSize };
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+                return {};
+
+            m_control.consumerWaiting.fetch_add(1u);
+            FutexWait(m_control.writeSignal, signal, deadline - now);
+            m_control.consumerWaiting.fetch_sub(1u);
+        }
+    }
+
+    void SharedMemoryRingBuffer::release()
+    {
+        assert(m_isConsumer);
+        if (m_pendingReleaseSize == 0u)
+            return;
+
+        const uint64_t readPosition = m_control.readPosition.load(std::memory_order_relaxed);
+        m_control.readPosition.store(readPosition + m_pendingReleaseSize, std::memory_order_release);
+        m_pendingReleaseSize = 0u;
+
+        m_control.readSignal.fetch_add(1u);
+        if (m_control.producerWaiting.load() != 0u)
+            FutexWakeAll(m_control.readSignal);
+    }
+
+    void SharedMemoryRingBuffer::detachConsumer()
+    {
+        assert(m_isConsumer);
+        if (m_control.consumerAttached.exchange(0u) == 0u)
+            return;
+
+        // unlinked immediately so that consumer can create ring with same name again while this one is still mapped
+        shm_unlink(m_name.c_str());
+        m_control.readSignal.fetch_add(1u);
+        FutexWakeAll(m_control.readSignal);
+    }
+
+    bool SharedMemoryRingBuffer::waitForFreeSpace(uint64_t requiredSize, std::chrono::steady_clock::time_point deadline)
+    {
+        for (;;)
+        {
+            const uint32_t signal = m_control.readSignal.load(std::memory_order_acquire);
+            if (m_control.consumerAttached.load(std::memory_order_acquire) == 0u)
+                return false;
+
+            const uint64_t usedSize = m_control.writePosition.load(std::memory_order_relaxed) - m_control.readPosition.load(std::memory_order_acquire);
+            if (m_capacity - usedSize >= requiredSize)
+                return true;
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+                return false;
+
+            m_control.producerWaiting.fetch_add(1u);
+            FutexWait(m_control.readSignal, signal, deadline - now);
+            m_control.producerWaiting.fetch_sub(1u);
+        }
+    }
+
+    void SharedMemoryRingBuffer::publishWritePosition(uint64_t writePosition)
+    {
+        m_control.writePosition.store(writePosition, std::memory_order_release);
+        m_control.writeSignal.fetch_add(1u);
+        if (m_control.consumerWaiting.load() != 0u)
+            FutexWakeAll(m_control.writeSignal);
+    }
+}
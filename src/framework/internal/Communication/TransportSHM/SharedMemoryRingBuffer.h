@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "absl/types/span.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+namespace ramses::internal
+{
+    // Single producer single consumer queue of variable sized messages in a POSIX shared memory object.
+    // The consumer creates the shared memory object and owns it, the producer (typically in another process) opens it by name.
+    // Both sides block on futexes placed in the shared memory while the ring is empty or full.
+    class SharedMemoryRingBuffer
+    {
+    public:
+        // capacity is rounded up to multiple of 8 bytes, a single message must fit into capacity including its 8 bytes header
+        static std::unique_ptr<SharedMemoryRingBuffer> Create(const std::string& name, uint32_t capacity);
+        // fails without logging if there is no such shared memory object, i.e. consumer does not run on this host
+        static std::unique_ptr<SharedMemoryRingBuffer> Open(const std::string& name);
+
+        ~SharedMemoryRingBuffer();
+
+        SharedMemoryRingBuffer(const SharedMemoryRingBuffer&) = delete;
+        SharedMemoryRingBuffer& operator=(const SharedMemoryRingBuffer&) = delete;
+
+        [[nodiscard]] const std::string& getName() const;
+        [[nodiscard]] uint32_t getCapacity() const;
+        [[nodiscard]] uint32_t getMaxMessageSize() const;
+
+        // producer: writes concatenated parts as one message, waits up to timeout for free space,
+        // fails if message is too big, consumer detached or timeout expired
+        bool write(std::initializer_list<absl::Span<const std::byte>> parts, std::chrono::milliseconds timeout);
+        [[nodiscard]] bool isConsumerAttached() const;
+
+        // consumer: waits up to timeout for next message, returns empty span on timeout.
+        // Returned data points directly into shared memory and stays valid until release is called.
+        absl::Span<const std::byte> peek(std::chrono::milliseconds timeout);
+        void release();
+        // producer fails all following writes, implicitly done when consumer is destroyed
+        void detachConsumer();
+
+    private:
+        struct ControlBlock;
+
+        SharedMemoryRingBuffer(std::string name, bool isConsumer, void* mapping, size_t mappingSize);
+
+        bool waitForFreeSpace(uint64_t requiredSize, std::chrono::steady_clock::time_point deadline);
+        void publishWritePosition(uint64_t writePosition);
+
+        const std::string m_name;
+        const bool m_isConsumer;
+        void* const m_mapping;
+        const size_t m_mappingSize;
+        ControlBlock& m_control;
+        std::byte* const m_data;
+        const uint32_t m_capacity;
+
+        uint64_t m_pendingReleaseSize = 0u;
+    };
+}
@@ -54,9 +54,14 @@ WARNING_DISABLE_CLANG(-Wdeprecated-declarations)
 #define ASIO_DISABLE_STD_INVOKE_RESULT
 
 #include "asio/io_service.hpp"
+#include "asio/io_context_strand.hpp"
+#include "asio/executor_work_guard.hpp"
+#include "asio/post.hpp"
 #include "asio/steady_timer.hpp"
 #include "asio/ip/address.hpp"
 #include "asio/ip/tcp.hpp"
+#include "asio/generic/stream_protocol.hpp"
+#include "asio/local/stream_protocol.hpp"
 #include "asio/connect.hpp"
 #include "asio/read.hpp"
 #include "asio/write.hpp"
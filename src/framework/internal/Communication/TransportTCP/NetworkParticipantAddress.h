@@ -37,6 +37,22 @@ namespace ramses::internal
             return m_port;
         }
 
+        // Unix domain socket participant listens on in addition to tcp when unix sockets are enabled for same host connections.
+        // Path is derived from tcp port, which is unique on the host, so no additional address has to be exchanged.
+        [[nodiscard]] std::string getUnixSocketPath(std::string_view directory) const
+        {
+            return GetUnixSocketPath(directory, m_port);
+        }
+
+        static std::string GetUnixSocketPath(std::string_view directory, uint16_t port)
+        {
+            std::string path(directory);
+            path += "/ramses-";
+            path += std::to_string(port);
+            path += ".sock";
+            return path;
+        }
+
         bool operator==(const NetworkParticipantAddress& other) const
         {
             return ParticipantIdentifier::operator==(other) &&
@@ -0,0 +1,123 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportTCP/SendLanes.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    SendLanes::SendLanes(const TransmissionBandwidthLimits& bandwidthLimits)
+        : m_bandwidthLimits(bandwidthLimits)
+    {
+    }
+
+    void SendLanes::push(size_t lane, OutBuffer buffer)
+    {
+        Lane& sendLane = getLane(lane);
+        sendLane.queuedBytes += buffer.data->size();
+        sendLane.queue.push_back(std::move(buffer));
+    }
+
+    void SendLanes::pushFront(size_t lane, OutBuffer buffer)
+    {
+        Lane& sendLane = getLane(lane);
+        sendLane.queuedBytes += buffer.data->size();
+        sendLane.queue.push_front(std::move(buffer));
+    }
+
+    size_t SendLanes::takeNextWrite(std::chrono::steady_clock::time_point now, std::vector<OutBuffer>& buffers)
+    {
+        size_t fullSize = 0u;
+        while (buffers.size() < MaxBuffersPerWrite && fullSize < MaxBytesPerWrite)
+        {
+            Lane* lane = getNextLaneToSend(now);
+            if (!lane)
+                break;
+
+            OutBuffer& buffer = lane->queue.front();
+            const size_t size = buffer.data->size();
+            lane->queuedBytes -= size;
+            lane->sendCredit -= static_cast<int64_t>(size);
+            lane->sentBytes += size;
+            lane->maxLatency = std::max(lane->maxLatency, now - buffer.queueTime);
+
+            fullSize += size;
+            buffers.push_back(std::move(buffer));
+            lane->queue.pop_front();
+        }
+
+        return fullSize;
+    }
+
+    std::optional<std::chrono::microseconds> SendLanes::getThrottleWait() const
+    {
+        std::optional<std::chrono::microseconds> wait;
+        for (size_t laneIdx = 0u; laneIdx < LaneCount; ++laneIdx)
+        {
+            const Lane& lane = m_lanes[laneIdx];
+            const uint64_t bandwidthLimit = getBandwidthLimit(laneIdx);
+            if (lane.queue.empty() || bandwidthLimit == 0u || lane.sendCredit > 0)
+                continue;
+
+            const auto missingCredit = static_cast<uint64_t>(1 - lane.sendCredit);
+            const std::chrono::microseconds laneWait(missingCredit * 1000000u / bandwidthLimit + 1u);
+            wait = std::min(wait.value_or(laneWait), laneWait);
+        }
+
+        return wait;
+    }
+
+    SendLanes::Lane& SendLanes::getLane(size_t lane)
+    {
+        assert(lane < LaneCount);
+        return m_lanes[lane];
+    }
+
+    const SendLanes::Lane& SendLanes::getLane(size_t lane) const
+    {
+        assert(lane < LaneCount);
+        return m_lanes[lane];
+    }
+
+    uint64_t SendLanes::getBandwidthLimit(size_t lane) const
+    {
+        return (lane == ControlLane ? 0u : m_bandwidthLimits[lane - 1u]);
+    }
+
+    SendLanes::Lane* SendLanes::getNextLaneToSend(std::chrono::steady_clock::time_point now)
+    {
+        for (size_t laneIdx = 0u; laneIdx < LaneCount; ++laneIdx)
+        {
+            Lane& lane = m_lanes[laneIdx];
+            if (lane.queue.empty())
+                continue;
+
+            const uint64_t bandwidthLimit = getBandwidthLimit(laneIdx);
+            if (bandwidthLimit == 0u)
+                return &lane;
+
+            updateSendCredit(lane, bandwidthLimit, now);
+            if (lane.sendCredit > 0)
+                return &lane;
+            // throttled, lanes with lower priority may use the connection meanwhile
+        }
+
+        return nullptr;
+    }
+
+    void SendLanes::updateSendCredit(Lane& lane, uint64_t bandwidthLimit, std::chrono::steady_clock::time_point now) const
+    {
+        // allow short bursts, but at least one full write so that lane can never get stuck
+        const int64_t maxCredit = std::max(static_cast<int64_t>(bandwidthLimit / 10u), static_cast<int64_t>(MaxBytesPerWrite));
+        const auto elapsed = std::min<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - lane.lastCreditUpdate).count(), 1000000);
+        lane.lastCreditUpdate = now;
+        lane.sendCredit = std::min(maxCredit, lane.sendCredit + elapsed * static_cast<int64_t>(bandwidthLimit) / 1000000);
+    }
+}
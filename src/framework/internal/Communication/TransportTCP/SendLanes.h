@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
+#include "internal/Communication/TransportTCP/EMessageId.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace ramses::internal
+{
+    // finalized message data, immutable and shared by out queues of all its recipients
+    struct OutBuffer
+    {
+        EMessageId messageType;
+        std::shared_ptr<const std::vector<std::byte>> data;
+        std::chrono::steady_clock::time_point queueTime;
+    };
+
+    // Outgoing messages of one connection, queued in one lane per transmission priority, lane with lower index goes first.
+    // Control messages are not bound to a scene and are never limited, scene publication and data are sent from lane of scene priority.
+    // A lane with bandwidth limit is throttled by a token bucket and yields the connection to lanes with lower priority meanwhile.
+    class SendLanes
+    {
+    public:
+        static constexpr size_t ControlLane = 0u;
+        static constexpr size_t LaneCount = 1u + TransmissionPriorityCount;
+
+        // queued messages are written to socket together in one gathering write, gathering stops after max bytes
+        // so that a large scene update is interleaved packet by packet with messages of lanes with higher priority
+        static constexpr size_t MaxBuffersPerWrite = 16u;
+        static constexpr size_t MaxBytesPerWrite = 300000u;
+
+        struct Lane
+        {
+            std::deque<OutBuffer> queue;
+            size_t queuedBytes = 0u;
+
+            // bytes lane may send before being throttled when bandwidth is limited, becomes negative when exceeded by last message
+            int64_t sendCredit = 0;
+            std::chrono::steady_clock::time_point lastCreditUpdate;
+
+            // since last periodic log
+            std::chrono::steady_clock::duration maxLatency{ 0 };
+            uint64_t sentBytes = 0u;
+        };
+
+        explicit SendLanes(const TransmissionBandwidthLimits& bandwidthLimits);
+
+        void push(size_t lane, OutBuffer buffer);
+        // for connection internal messages which have to be sent before anything queued
+        void pushFront(size_t lane, OutBuffer buffer);
+
+        // Moves messages for next gathering write to buffers, returns their size in bytes.
+        // Nothing is taken while throttled lanes are the only ones with queued messages.
+        size_t takeNextWrite(std::chrono::steady_clock::time_point now, std::vector<OutBuffer>& buffers);
+
+        // Time until first throttled lane with queued messages regains credit, nothing if no lane waits for credit
+        [[nodiscard]] std::optional<std::chrono::microseconds> getThrottleWait() const;
+
+        [[nodiscard]] Lane& getLane(size_t lane);
+        [[nodiscard]] const Lane& getLane(size_t lane) const;
+
+    private:
+        [[nodiscard]] uint64_t getBandwidthLimit(size_t lane) const;
+        Lane* getNextLaneToSend(std::chrono::steady_clock::time_point now);
+        void updateSendCredit(Lane& lane, uint64_t bandwidthLimit, std::chrono::steady_clock::time_point now) const;
+
+        const TransmissionBandwidthLimits m_bandwidthLimits;
+        std::array<Lane, LaneCount> m_lanes;
+    };
+}
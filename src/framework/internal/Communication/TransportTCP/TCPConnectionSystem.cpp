@@ -13,6 +13,8 @@
 #include "internal/Core/Utils/RawBinaryOutputStream.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include <algorithm>
+#include <cstdio>
 #include <thread>
 #include <utility>
 #include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
@@ -29,7 +31,10 @@ namespace ramses::internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     const TransmissionBandwidthLimits& bandwidthLimits,
+                                                     uint32_t dispatchThreadCount,
+                                                     std::string unixSocketDirectory)
         : m_participantAddress(std::move(participantAddress))
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(std::move(daemonAddress))
@@ -43,6 +48,9 @@ namespace ramses::internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_bandwidthLimits(bandwidthLimits)
+        , m_dispatchThreadCount(dispatchThreadCount)
+        , m_unixSocketDirectory(std::move(unixSocketDirectory))
         , m_frameworkLock(frameworkLock)
         , m_thread("TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -72,6 +80,8 @@ namespace ramses::internal
                                                    << " at " << m_participantAddress.getIp() << ":" << m_participantAddress.getPort()
                                                    << ", type " << EnumToString(m_participantType)
                                                    << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms";
+                                               if (!m_unixSocketDirectory.empty())
+                                                   sos << ", unix sockets in " << m_unixSocketDirectory;
                                                if (m_hasOtherDaemon)
                                                    sos << ", other daemon at " << m_daemonAddress.getIp() << ":" << m_daemonAddress.getPort();
                                            }));
@@ -88,7 +98,9 @@ namespace ramses::internal
             return false;
         }
 
-        m_runState = std::make_unique<RunState>();
+        m_runState = std::make_unique<RunState>(m_dispatchThreadCount);
+        for (auto& dispatchThread : m_runState->m_dispatchThreads)
+            dispatchThread->start(m_runState->m_dispatchRunner);
         m_thread.start(*this);
 
         return true;
@@ -105,12 +117,15 @@ namespace ramses::internal
             return false;
         }
 
-        // Signal context to exit run and join thread
+        // Signal context to exit run and join thread, then let dispatch threads finish pending messages and connection updates
         m_runState->m_io.stop();
         {
             // must release lock to let things finish in thread
             m_frameworkLock.unlock();
             m_thread.join();
+            m_runState->m_dispatchWork.reset();
+            for (auto& dispatchThread : m_runState->m_dispatchThreads)
+                dispatchThread->join();
             m_frameworkLock.lock();
         }
         m_runState.reset();
@@ -140,13 +155,15 @@ namespace ramses::internal
         if (!openAcceptor())
             return;
         doAcceptIncomingConnections();
+        if (!m_unixSocketDirectory.empty() && openUnixAcceptor())
+            doAcceptIncomingUnixConnections();
 
         // initiate connection to daemon (when not self)
         if (m_daemonAddress.getPort() != 0 && m_hasOtherDaemon)
         {
             LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::run: Initiate connection to daemon at {}:{}", m_participantAddress.getParticipantName(), m_daemonAddress.getIp(), m_daemonAddress.getPort());
 
-            auto daemonPp = std::make_shared<Participant>(m_daemonAddress, m_runState->m_io, EParticipantType::Daemon, EParticipantState::Connecting);
+            auto daemonPp = std::make_shared<Participant>(m_daemonAddress, m_runState->m_io, EParticipantType::Daemon, EParticipantState::Connecting, m_bandwidthLimits);
             m_connectingParticipants.put(daemonPp);
             doConnect(daemonPp);
         }
@@ -157,12 +174,13 @@ namespace ramses::internal
         {
             if (pp.value->type != EParticipantType::PureDaemon)
             {
-                triggerConnectionUpdateNotification(pp.value->address.getParticipantId(), EConnectionStatus_NotConnected);
+                postConnectionUpdateNotification(pp.value, EConnectionStatus_NotConnected);
             }
         }
 
         m_runState->m_acceptor.close();
         m_runState->m_acceptorSocket.close();
+        closeUnixAcceptor();
         m_connectingParticipants.clear();
         m_establishedParticipants.clear();
     }
@@ -218,40 +236,149 @@ namespace ramses::internal
                                         LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doAcceptIncomingConnections: Accepted new connection from {}:{}",
                                             m_participantAddress.getParticipantName(), remoteEp.address().to_string().c_str(), remoteEp.port());
 
-                                        // create new participant
-                                        auto pp = std::make_shared<Participant>(NetworkParticipantAddress(), m_runState->m_io, EParticipantType::Client, EParticipantState::WaitingForHello);
-                                        pp->socket = std::move(m_runState->m_acceptorSocket);
-                                        m_connectingParticipants.put(pp);
+                                        addAcceptedParticipant(asio::generic::stream_protocol::socket(std::move(m_runState->m_acceptorSocket)), false);
                                         m_runState->m_acceptorSocket = asio::ip::tcp::socket(m_runState->m_io);
 
-                                        initializeNewlyConnectedParticipant(pp);
-
                                         // accept next connection
                                         doAcceptIncomingConnections();
                                     }
                                 });
     }
 
-    void TCPConnectionSystem::doConnect(const ParticipantPtr& pp)
+    bool TCPConnectionSystem::openUnixAcceptor()
     {
-        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Try connect to participant at {}:{}", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        assert(!m_runState->m_unixAcceptor.is_open());
 
-        // convert localhost to an actual ip, no need for dns resolving here
-        const char* const ipStr = (pp->address.getIp() == "localhost" ? "127.0.0.1" : pp->address.getIp().c_str());
+        // tcp acceptor is bound already, so no other participant on this host uses same path. File might be left over
+        // from a participant that used same port before and did not exit cleanly
+        const auto path = NetworkParticipantAddress::GetUnixSocketPath(m_unixSocketDirectory, m_runState->m_acceptor.local_endpoint().port());
+        std::remove(path.c_str());
 
-        // parse with error checking to prevent exception when ip is invalid format
-        asio::error_code err;
-        const auto asioIp = asio::ip::address::from_string(ipStr, err);
-        if (err)
+        asio::error_code e;
+        m_runState->m_unixAcceptor.open(asio::local::stream_protocol(), e);
+        if (!e)
+            m_runState->m_unixAcceptor.bind(asio::local::stream_protocol::endpoint(path), e);
+        if (!e)
+            m_runState->m_unixAcceptor.listen(asio::socket_base::max_connections, e);
+        if (e)
         {
-            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Failed to parse ip address '{}:{}'", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
+            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openUnixAcceptor: failed for {}, only tcp is used. {}", m_participantAddress.getParticipantName(), path, e.message().c_str());
+            m_runState->m_unixAcceptor.close(e);
+            return false;
+        }
+
+        m_runState->m_unixSocketPath = path;
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openUnixAcceptor: Listening for connections on {}", m_participantAddress.getParticipantName(), path);
+        return true;
+#else
+        LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openUnixAcceptor: unix domain sockets not supported on this platform, only tcp is used", m_participantAddress.getParticipantName());
+        return false;
+#endif
+    }
+
+    void TCPConnectionSystem::doAcceptIncomingUnixConnections()
+    {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        m_runState->m_unixAcceptor.async_accept(m_runState->m_unixAcceptorSocket,
+                                [this](asio::error_code e) {
+                                    if (e)
+                                    {
+                                        LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doAcceptIncomingUnixConnections: accept failed. {}", m_participantAddress.getParticipantName(), e.message().c_str());
+                                        doAcceptIncomingUnixConnections();
+                                    }
+                                    else
+                                    {
+                                        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doAcceptIncomingUnixConnections: Accepted new connection on {}",
+                                            m_participantAddress.getParticipantName(), m_runState->m_unixSocketPath);
+
+                                        addAcceptedParticipant(asio::generic::stream_protocol::socket(std::move(m_runState->m_unixAcceptorSocket)), true);
+                                        m_runState->m_unixAcceptorSocket = asio::local::stream_protocol::socket(m_runState->m_io);
+
+                                        // accept next connection
+                                        doAcceptIncomingUnixConnections();
+                                    }
+                                });
+#endif
+    }
+
+    void TCPConnectionSystem::closeUnixAcceptor()
+    {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        if (!m_runState->m_unixAcceptor.is_open())
             return;
+
+        m_runState->m_unixAcceptor.close();
+        m_runState->m_unixAcceptorSocket.close();
+        std::remove(m_runState->m_unixSocketPath.c_str());
+#endif
+    }
+
+    void TCPConnectionSystem::addAcceptedParticipant(asio::generic::stream_protocol::socket socket, bool viaUnixSocket)
+    {
+        // create new participant
+        auto pp = std::make_shared<Participant>(NetworkParticipantAddress(), m_runState->m_io, EParticipantType::Client, EParticipantState::WaitingForHello, m_bandwidthLimits);
+        pp->socket = std::move(socket);
+        pp->viaUnixSocket = viaUnixSocket;
+        m_connectingParticipants.put(pp);
+
+        initializeNewlyConnectedParticipant(pp);
+    }
+
+    bool TCPConnectionSystem::shouldConnectViaUnixSocket(const Participant& pp) const
+    {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        if (m_unixSocketDirectory.empty() || pp.unixSocketFailed)
+            return false;
+
+        // participant on same host, it still might not listen on unix socket
+        const std::string& ip = pp.address.getIp();
+        return ip == "127.0.0.1" || ip == "localhost" || ip == m_participantAddress.getIp();
+#else
+        return false;
+#endif
+    }
+
+    void TCPConnectionSystem::doConnect(const ParticipantPtr& pp)
+    {
+        std::array<asio::generic::stream_protocol::endpoint, 1> endpointSequence;
+        pp->viaUnixSocket = shouldConnectViaUnixSocket(*pp);
+        if (pp->viaUnixSocket)
+        {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            const auto path = pp->address.getUnixSocketPath(m_unixSocketDirectory);
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Try connect to participant at {}:{} on {}", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort(), path);
+            endpointSequence[0] = asio::local::stream_protocol::endpoint(path);
+#endif
+        }
+        else
+        {
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Try connect to participant at {}:{}", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
+
+            // convert localhost to an actual ip, no need for dns resolving here
+            const char* const ipStr = (pp->address.getIp() == "localhost" ? "127.0.0.1" : pp->address.getIp().c_str());
+
+            // parse with error checking to prevent exception when ip is invalid format
+            asio::error_code err;
+            const auto asioIp = asio::ip::address::from_string(ipStr, err);
+            if (err)
+            {
+                LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Failed to parse ip address '{}:{}'", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
+                return;
+            }
+            endpointSequence[0] = asio::ip::tcp::endpoint(asioIp, pp->address.getPort());
         }
 
-        asio::ip::tcp::endpoint ep(asioIp, pp->address.getPort());
-        std::array<asio::ip::tcp::endpoint, 1> endpointSequence = {ep};
-        asio::async_connect(pp->socket, endpointSequence, [this, pp](asio::error_code e, const asio::ip::tcp::endpoint& usedEndpoint) {
-                if (e)
+        asio::async_connect(pp->socket, endpointSequence, [this, pp](asio::error_code e, const asio::generic::stream_protocol::endpoint& /*usedEndpoint*/) {
+                if (e && pp->viaUnixSocket)
+                {
+                    // participant does not listen on unix socket (not enabled or not on this host), use tcp from now on
+                    LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Connect to {}:{} via unix socket failed, use tcp. {}",
+                        m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort(), e.message().c_str());
+                    pp->unixSocketFailed = true;
+                    doConnect(pp);
+                }
+                else if (e)
                 {
                     // connect failed, try again after timeout
                     LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Connect to {}:{} failed. {}",
@@ -272,7 +399,8 @@ namespace ramses::internal
                 else
                 {
                     // connected
-                    LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Established to {}:{}", m_participantAddress.getParticipantName(), usedEndpoint.address().to_string().c_str(), usedEndpoint.port());
+                    LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Established to {}:{}{}", m_participantAddress.getParticipantName(),
+                        pp->address.getIp(), pp->address.getPort(), pp->viaUnixSocket ? " via unix socket" : "");
                     initializeNewlyConnectedParticipant(pp);
                 }
             });
@@ -287,8 +415,9 @@ namespace ramses::internal
         // is needed to allow high prio data to be sent as fast as possible.
         pp->socket.set_option(asio::socket_base::send_buffer_size{static_cast<int>(ResourceDataSize)});
 
-        // Disable nagle
-        pp->socket.set_option(asio::ip::tcp::no_delay{true});
+        // Disable nagle, only exists for tcp
+        if (!pp->viaUnixSocket)
+            pp->socket.set_option(asio::ip::tcp::no_delay{true});
         pp->state = EParticipantState::WaitingForHello;
         pp->lastReceived = std::chrono::steady_clock::now();
 
@@ -296,23 +425,50 @@ namespace ramses::internal
         sendConnectionDescriptionOnNewConnection(pp);
     }
 
+    OutBuffer TCPConnectionSystem::finalizeMessage(OutMessage& msg) const
+    {
+        auto data = std::make_shared<std::vector<std::byte>>(msg.stream.release());
+        const auto fullSize = static_cast<uint32_t>(data->size());
+
+        RawBinaryOutputStream s(data->data(), data->size());
+        const uint32_t remainingSize = fullSize - sizeof(Participant::lengthReceiveBuffer);
+        s << remainingSize
+          << m_protocolVersion;
+
+        return OutBuffer{ msg.messageType, std::move(data), std::chrono::steady_clock::now() };
+    }
+
     void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
     {
-        assert(pp->currentOutBuffer.empty());
+        assert(pp->currentOutBuffers.empty());
+        assert(msg.lane == SendLanes::ControlLane);
 
-        pp->currentOutBuffer = msg.stream.release();
-        const auto fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        pp->sendLanes.pushFront(SendLanes::ControlLane, finalizeMessage(msg));
+        doSendQueuedMessage(pp);
+    }
+
+    void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
+    {
+        if (!pp->currentOutBuffers.empty())
+            return;
 
-        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgType {}, Size {}",
-            m_participantAddress.getParticipantName(), pp->address.getParticipantId(), msg.messageType, fullSize);
+        // buffers stay referenced until written, they may be queued for other participants as well
+        const size_t fullSize = pp->sendLanes.takeNextWrite(std::chrono::steady_clock::now(), pp->currentOutBuffers);
+        for (const auto& buffer : pp->currentOutBuffers)
+        {
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgType {}, Size {}",
+                m_participantAddress.getParticipantName(), pp->address.getParticipantId(), buffer.messageType, buffer.data->size());
+            pp->currentWriteBuffers.emplace_back(buffer.data->data(), buffer.data->size());
+        }
 
-        RawBinaryOutputStream s(pp->currentOutBuffer.data(), pp->currentOutBuffer.size());
-        const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
-        s << remainingSize
-          << m_protocolVersion;
+        if (pp->currentOutBuffers.empty())
+        {
+            scheduleThrottledSend(pp);
+            return;
+        }
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+        asio::async_write(pp->socket, pp->currentWriteBuffers,
+                          [this, pp, fullSize](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
                                   LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: Send to {}/{} failed. {}. Remove participant",
@@ -322,10 +478,11 @@ namespace ramses::internal
                               }
                               else
                               {
-                                  LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgBytes {}, SentBytes {}",
-                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->currentOutBuffer.size(), sentBytes);
+                                  LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, Messages {}, MsgBytes {}, SentBytes {}",
+                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->currentOutBuffers.size(), fullSize, sentBytes);
 
-                                  pp->currentOutBuffer.clear();
+                                  pp->currentOutBuffers.clear();
+                                  pp->currentWriteBuffers.clear();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -342,22 +499,47 @@ namespace ramses::internal
                           });
     }
 
-    void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
+    void TCPConnectionSystem::scheduleThrottledSend(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
-        {
-            OutMessage msg = std::move(pp->outQueue.front());
-            pp->outQueue.pop_front();
+        // wait until first throttled lane regains credit
+        const auto wait = pp->sendLanes.getThrottleWait();
+        if (!wait)
+            return;
 
-            sendMessageToParticipant(pp, std::move(msg));
-        }
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::scheduleThrottledSend: To {}, wait {}us", m_participantAddress.getParticipantName(), pp->address.getParticipantId(), wait->count());
+        pp->sendThrottleTimer.expires_after(*wait);
+        pp->sendThrottleTimer.async_wait([this, pp](asio::error_code e) {
+                                             if (!e)
+                                             {
+                                                 // when timer not canceled
+                                                 doSendQueuedMessage(pp);
+                                             }
+                                         });
+    }
+
+    size_t TCPConnectionSystem::getSceneLane(const SceneId& sceneId) const
+    {
+        const auto it = m_sceneTransmissionPriorities.find(sceneId);
+        const ETransmissionPriority priority = (it != m_sceneTransmissionPriorities.cend() ? it->second : ETransmissionPriority::Normal);
+        return 1u + static_cast<size_t>(priority);
+    }
+
+    std::array<SceneInfoVector, SendLanes::LaneCount> TCPConnectionSystem::groupScenesByLane(const SceneInfoVector& scenes) const
+    {
+        // publication and unpublication of scene are sent in lane of scene, otherwise they could overtake
+        // scene initialization and updates still queued in lane of throttled or low priority scene
+        std::array<SceneInfoVector, SendLanes::LaneCount> scenesByLane;
+        for (const auto& sceneInfo : scenes)
+            scenesByLane[getSceneLane(sceneInfo.sceneID)].push_back(sceneInfo);
+        return scenesByLane;
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (pp->currentOutBuffers.empty())
         {
-            assert(pp->outQueue.empty());
+            // lanes with scene data might be throttled, control lane never
+            assert(pp->sendLanes.getLane(SendLanes::ControlLane).queue.empty());
 
             sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
         }
@@ -407,7 +589,18 @@ namespace ramses::internal
 
                                  updateLastReceivedTime(pp);
                                  handleReceivedMessage(pp);
-                                 doReadHeader(pp);
+                                 if (pp->pendingDispatchedMessages >= MaxPendingDispatchedMessages)
+                                 {
+                                     // resumed when dispatched messages are handled, remote is not considered dead meanwhile
+                                     LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doReadContent: pause reading from {}, {} messages pending",
+                                         m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->pendingDispatchedMessages);
+                                     pp->readPaused = true;
+                                     pp->checkReceivedAliveTimer.cancel();
+                                 }
+                                 else
+                                 {
+                                     doReadHeader(pp);
+                                 }
                              }
                          });
     }
@@ -444,13 +637,14 @@ namespace ramses::internal
 
         if (pp->state == EParticipantState::Established && pp->type != EParticipantType::PureDaemon)
         {
-            triggerConnectionUpdateNotification(pp->address.getParticipantId(), EConnectionStatus_NotConnected);
+            postConnectionUpdateNotification(pp, EConnectionStatus_NotConnected);
         }
 
         // tear down and cancel everything
         pp->socket.close();
         pp->connectTimer.cancel();
         pp->sendAliveTimer.cancel();
+        pp->sendThrottleTimer.cancel();
         pp->checkReceivedAliveTimer.cancel();
         pp->state = EParticipantState::Invalid;
 
@@ -518,7 +712,7 @@ namespace ramses::internal
             LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::addNewParticipantByAddress: attempt new connection to participant {} / {} based on: otherIsDaemon {}, guid valid {}, guid comparison {}",
                 m_participantAddress.getParticipantName(), address.getParticipantId(), address.getParticipantName(), otherIsDaemon, !address.getParticipantId().isInvalid(), shouldConnectbasedOnGuid ? "will connect" : "wait for connection");
 
-            auto pp = std::make_shared<Participant>(address, m_runState->m_io, otherIsDaemon ? EParticipantType::Daemon : EParticipantType::Client, EParticipantState::Connecting);
+            auto pp = std::make_shared<Participant>(address, m_runState->m_io, otherIsDaemon ? EParticipantType::Daemon : EParticipantType::Client, EParticipantState::Connecting, m_bandwidthLimits);
             m_connectingParticipants.put(pp);
             doConnect(pp);
         }
@@ -544,18 +738,21 @@ namespace ramses::internal
         if (msg.to.empty())
             return true;
 
-        asio::post(m_runState->m_io, [this, msg = std::move(msg)]() mutable {
-                            if (msg.to.size() > 1)
+        // message is finalized once, all recipients share its data
+        std::vector<Guid> to = std::move(msg.to);
+        const size_t lane = msg.lane;
+        OutBuffer buffer = finalizeMessage(msg);
+        asio::post(m_runState->m_io, [this, to = std::move(to), lane, buffer = std::move(buffer)]() {
+                            if (to.size() > 1)
                             {
-                                for (auto& p : msg.to)
+                                for (const auto& p : to)
                                 {
                                     ParticipantPtr pp;
                                     if (m_establishedParticipants.get(p, pp) != EStatus::Ok)
                                         continue; // skip invalid participant in broadcast. might happen due to disconnect race
                                     assert(pp);
 
-                                    // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
+                                    pp->sendLanes.push(lane, buffer);
 
                                     doSendQueuedMessage(pp);
                                 }
@@ -563,15 +760,15 @@ namespace ramses::internal
                             else
                             {
                                 ParticipantPtr pp;
-                                if (m_establishedParticipants.get(msg.to.front(), pp) != EStatus::Ok)
+                                if (m_establishedParticipants.get(to.front(), pp) != EStatus::Ok)
                                 {
                                     LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::postMessageForSending: post message {} to not (fully) connected participant {}",
-                                        m_participantAddress.getParticipantName(), msg.messageType, msg.to.front());
+                                        m_participantAddress.getParticipantName(), buffer.messageType, to.front());
                                     return;
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
+                                pp->sendLanes.push(lane, buffer);
 
                                 doSendQueuedMessage(pp);
                             }
@@ -614,29 +811,96 @@ namespace ramses::internal
             handleConnectorAddressExchange(pp, stream);
             break;
         case EMessageId::PublishScene:
-            handlePublishScene(pp, stream);
+        case EMessageId::UnpublishScene:
+        case EMessageId::SubscribeScene:
+        case EMessageId::UnsubscribeScene:
+        case EMessageId::SendSceneUpdate:
+        case EMessageId::CreateScene:
+        case EMessageId::RendererEvent:
+            dispatchReceivedMessage(pp, messageType);
+            break;
+        default:
+            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleReceivedMessage: Invalid messagetype {} From {}", m_participantAddress.getParticipantName(), messageType, pp->address.getParticipantId());
+            removeParticipant(pp);
+        }
+    }
+
+    void TCPConnectionSystem::dispatchReceivedMessage(const ParticipantPtr& pp, EMessageId messageType)
+    {
+        if (pp->state != EParticipantState::Established)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::dispatchReceivedMessage: Ignore message {} from not established participant in state {}",
+                m_participantAddress.getParticipantName(), messageType, EnumToString(pp->state));
+            return;
+        }
+        assert(pp->dispatchStrand);
+
+        // message is handed over to dispatch thread without copy, next message is read into a pooled buffer
+        std::vector<std::byte> message;
+        message.swap(pp->receiveBuffer);
+        if (!m_runState->m_receiveBufferPool.empty())
+        {
+            pp->receiveBuffer = std::move(m_runState->m_receiveBufferPool.back());
+            m_runState->m_receiveBufferPool.pop_back();
+        }
+
+        ++pp->pendingDispatchedMessages;
+        asio::post(*pp->dispatchStrand, [this, pp, from = pp->address.getParticipantId(), messageType, message = std::move(message)]() mutable {
+            handleDispatchedMessage(from, messageType, message);
+            asio::post(m_runState->m_io, [this, pp, message = std::move(message)]() mutable {
+                finishDispatchedMessage(pp, std::move(message));
+            });
+        });
+    }
+
+    void TCPConnectionSystem::handleDispatchedMessage(const Guid& from, EMessageId messageType, const std::vector<std::byte>& message)
+    {
+        BinaryInputStream stream(message.data());
+        // protocol version and message type were already checked on receive
+        stream.skip(static_cast<int64_t>(2u * sizeof(uint32_t)));
+
+        switch (messageType)
+        {
+        case EMessageId::PublishScene:
+            handlePublishScene(from, stream);
             break;
         case EMessageId::UnpublishScene:
-            handleUnpublishScene(pp, stream);
+            handleUnpublishScene(from, stream);
             break;
         case EMessageId::SubscribeScene:
-            handleSubscribeScene(pp, stream);
+            handleSubscribeScene(from, stream);
             break;
         case EMessageId::UnsubscribeScene:
-            handleUnsubscribeScene(pp, stream);
+            handleUnsubscribeScene(from, stream);
             break;
         case EMessageId::SendSceneUpdate:
-            handleSceneUpdate(pp, stream);
+            handleSceneUpdate(from, stream, message.size());
             break;
         case EMessageId::CreateScene:
-            handleCreateScene(pp, stream);
+            handleCreateScene(from, stream);
             break;
         case EMessageId::RendererEvent:
-            handleRendererEvent(pp, stream);
+            handleRendererEvent(from, stream);
             break;
         default:
-            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleReceivedMessage: Invalid messagetype {} From {}", m_participantAddress.getParticipantName(), messageType, pp->address.getParticipantId());
-            removeParticipant(pp);
+            assert(false && "message type is not dispatched");
+        }
+    }
+
+    void TCPConnectionSystem::finishDispatchedMessage(const ParticipantPtr& pp, std::vector<std::byte> message)
+    {
+        assert(pp->pendingDispatchedMessages > 0u);
+        --pp->pendingDispatchedMessages;
+
+        if (m_runState->m_receiveBufferPool.size() < MaxPooledReceiveBuffers)
+            m_runState->m_receiveBufferPool.push_back(std::move(message));
+
+        if (pp->readPaused && pp->state != EParticipantState::Invalid)
+        {
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::finishDispatchedMessage: resume reading from {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId());
+            pp->readPaused = false;
+            updateLastReceivedTime(pp);
+            doReadHeader(pp);
         }
     }
 
@@ -689,11 +953,16 @@ namespace ramses::internal
         pp->type = participantType;
         pp->state = EParticipantState::Established;
 
+        auto& dispatchStrand = m_runState->m_dispatchStrands[guid];
+        if (!dispatchStrand)
+            dispatchStrand = std::make_shared<DispatchStrand>(m_runState->m_dispatchIo);
+        pp->dispatchStrand = dispatchStrand;
+
         m_connectingParticipants.remove(pp);
         m_establishedParticipants.put(guid, pp);
 
         if (pp->type != EParticipantType::PureDaemon)
-            triggerConnectionUpdateNotification(guid, EConnectionStatus_Connected);
+            postConnectionUpdateNotification(pp, EConnectionStatus_Connected);
 
         sendConnectorAddressExchangeMessagesForNewParticipant(pp);
     }
@@ -833,16 +1102,16 @@ namespace ramses::internal
         return postMessageForSending(std::move(msg));
     }
 
-    void TCPConnectionSystem::handleSubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleSubscribeScene(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneProviderHandler)
         {
             SceneId sceneId;
             stream >> sceneId.getReference();
 
-            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSubscribeScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId(), sceneId);
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSubscribeScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), from, sceneId);
             PlatformGuard guard(m_frameworkLock);
-            m_sceneProviderHandler->handleSubscribeScene(sceneId, pp->address.getParticipantId());
+            m_sceneProviderHandler->handleSubscribeScene(sceneId, from);
         }
     }
 
@@ -855,16 +1124,16 @@ namespace ramses::internal
         return postMessageForSending(std::move(msg));
     }
 
-    void TCPConnectionSystem::handleUnsubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleUnsubscribeScene(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneProviderHandler)
         {
             SceneId sceneId;
             stream >> sceneId.getReference();
 
-            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleUnsubscribeScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId(), sceneId);
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleUnsubscribeScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), from, sceneId);
             PlatformGuard guard(m_frameworkLock);
-            m_sceneProviderHandler->handleUnsubscribeScene(sceneId, pp->address.getParticipantId());
+            m_sceneProviderHandler->handleUnsubscribeScene(sceneId, from);
         }
     }
 
@@ -873,35 +1142,39 @@ namespace ramses::internal
     {
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendInitializeScene: to {}, sceneId {}", m_participantAddress.getParticipantName(), to, sceneId);
         OutMessage msg(to, EMessageId::CreateScene);
+        msg.lane = getSceneLane(sceneId);
         msg.stream << sceneId.getValue();
         return postMessageForSending(std::move(msg));
     }
 
-    void TCPConnectionSystem::handleCreateScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleCreateScene(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneRendererHandler)
         {
             SceneId sceneId;
             stream >> sceneId.getReference();
 
-            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleCreateScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId(), sceneId);
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleCreateScene: from {}, sceneId {}", m_participantAddress.getParticipantName(), from, sceneId);
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleInitializeScene(sceneId, pp->address.getParticipantId());
+            m_sceneRendererHandler->handleInitializeScene(sceneId, from);
         }
     }
 
     // --
-    bool TCPConnectionSystem::sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    bool TCPConnectionSystem::sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
     {
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {}", m_participantAddress.getParticipantName(), to);
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {} participants", m_participantAddress.getParticipantName(), to.size());
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
+        // all packets of scene go through same lane to keep them in order with scene initialization
+        const size_t lane = getSceneLane(sceneId);
         std::vector<std::byte> buffer(SceneActionDataSize);
         return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
 
             const auto usedSize = static_cast<uint32_t>(size);
             OutMessage msg(to, EMessageId::SendSceneUpdate);
+            msg.lane = lane;
             msg.stream << sceneId.getValue()
                        << usedSize;
             msg.stream.write(buffer.data(), usedSize);
@@ -911,7 +1184,13 @@ namespace ramses::internal
     }
 
 
-    void TCPConnectionSystem::handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::setSceneTransmissionPriority(const SceneId& sceneId, ETransmissionPriority priority)
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::setSceneTransmissionPriority: sceneId {}, priority {}", m_participantAddress.getParticipantName(), sceneId, priority);
+        m_sceneTransmissionPriorities[sceneId] = priority;
+    }
+
+    void TCPConnectionSystem::handleSceneUpdate(const Guid& from, BinaryInputStream& stream, size_t messageSize)
     {
         if (m_sceneRendererHandler)
         {
@@ -920,13 +1199,17 @@ namespace ramses::internal
             uint32_t dataSize = 0;
             stream >> dataSize;
 
-            std::vector<std::byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            if (stream.getCurrentReadBytes() + dataSize > messageSize)
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {}, data size {} exceeds message size {}",
+                    m_participantAddress.getParticipantName(), from, dataSize, messageSize);
+                return;
+            }
 
-            LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId());
+            LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {}", m_participantAddress.getParticipantName(), from);
 
-            PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleSceneUpdate(sceneId, data, pp->address.getParticipantId());
+            // data is passed without copy from message buffer, deserialized by handler without framework lock held
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, absl::Span<const std::byte>(stream.readPosition(), dataSize), from);
         }
     }
 
@@ -940,22 +1223,7 @@ namespace ramses::internal
                                                 sos << "]";
                                             }));
 
-        OutMessage msg(m_connectedParticipantsForBroadcasts, EMessageId::PublishScene);
-        msg.stream << static_cast<uint32_t>(newScenes.size());
-        for (const auto& s : newScenes)
-        {
-            msg.stream << s.sceneID.getValue()
-                       << s.friendlyName;
-        }
-        msg.stream << static_cast<uint32_t>(featureLevel);
-
-        if (featureLevel >= EFeatureLevel_02)
-        {
-            for (const auto& sceneInfo : newScenes)
-                msg.stream << sceneInfo.renderBackendCompatibility << sceneInfo.vulkanAPIVersion << sceneInfo.spirvVersion;
-        }
-
-        return postMessageForSending(std::move(msg));
+        return postPublishSceneMessages(m_connectedParticipantsForBroadcasts, newScenes, featureLevel);
     }
 
     bool TCPConnectionSystem::sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes, EFeatureLevel featureLevel)
@@ -967,25 +1235,42 @@ namespace ramses::internal
                                                 sos << "]";
                                             }));
 
-        OutMessage msg(to, EMessageId::PublishScene);
-        msg.stream << static_cast<uint32_t>(availableScenes.size());
-        for (const auto& s : availableScenes)
-        {
-            msg.stream << s.sceneID.getValue()
-                       << s.friendlyName;
-        }
-        msg.stream << static_cast<uint32_t>(featureLevel);
+        return postPublishSceneMessages({ to }, availableScenes, featureLevel);
+    }
 
-        if (featureLevel >= EFeatureLevel_02)
+    bool TCPConnectionSystem::postPublishSceneMessages(const std::vector<Guid>& to, const SceneInfoVector& scenes, EFeatureLevel featureLevel)
+    {
+        bool result = true;
+        const auto scenesByLane = groupScenesByLane(scenes);
+        for (size_t lane = 0u; lane < SendLanes::LaneCount; ++lane)
         {
-            for (const auto& sceneInfo : availableScenes)
-                msg.stream << sceneInfo.renderBackendCompatibility << sceneInfo.vulkanAPIVersion << sceneInfo.spirvVersion;
+            const SceneInfoVector& laneScenes = scenesByLane[lane];
+            if (laneScenes.empty())
+                continue;
+
+            OutMessage msg(to, EMessageId::PublishScene);
+            msg.lane = lane;
+            msg.stream << static_cast<uint32_t>(laneScenes.size());
+            for (const auto& s : laneScenes)
+            {
+                msg.stream << s.sceneID.getValue()
+                           << s.friendlyName;
+            }
+            msg.stream << static_cast<uint32_t>(featureLevel);
+
+            if (featureLevel >= EFeatureLevel_02)
+            {
+                for (const auto& sceneInfo : laneScenes)
+                    msg.stream << sceneInfo.renderBackendCompatibility << sceneInfo.vulkanAPIVersion << sceneInfo.spirvVersion;
+            }
+
+            result = postMessageForSending(std::move(msg)) && result;
         }
 
-        return postMessageForSending(std::move(msg));
+        return result;
     }
 
-    void TCPConnectionSystem::handlePublishScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handlePublishScene(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneRendererHandler)
         {
@@ -1014,14 +1299,14 @@ namespace ramses::internal
             }
 
             LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
-                                                    sos << "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handlePublishScene: from " << pp->address.getParticipantId() << " [";
+                                                    sos << "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handlePublishScene: from " << from << " [";
                                                     for (const auto& s : newScenes)
                                                         sos << s.sceneID << "/" << s.friendlyName << "; ";
                                                     sos << "]";
                                                 }));
 
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleNewScenesAvailable(newScenes, pp->address.getParticipantId(), featureLevel);
+            m_sceneRendererHandler->handleNewScenesAvailable(newScenes, from, featureLevel);
         }
     }
 
@@ -1035,17 +1320,29 @@ namespace ramses::internal
                                                 sos << "]";
                                             }));
 
-        OutMessage msg(m_connectedParticipantsForBroadcasts, EMessageId::UnpublishScene);
-        msg.stream << static_cast<uint32_t>(unavailableScenes.size());
-        for (const auto& s : unavailableScenes)
+        bool result = true;
+        const auto scenesByLane = groupScenesByLane(unavailableScenes);
+        for (size_t lane = 0u; lane < SendLanes::LaneCount; ++lane)
         {
-            msg.stream << s.sceneID.getValue()
-                       << s.friendlyName;
+            const SceneInfoVector& laneScenes = scenesByLane[lane];
+            if (laneScenes.empty())
+                continue;
+
+            OutMessage msg(m_connectedParticipantsForBroadcasts, EMessageId::UnpublishScene);
+            msg.lane = lane;
+            msg.stream << static_cast<uint32_t>(laneScenes.size());
+            for (const auto& s : laneScenes)
+            {
+                msg.stream << s.sceneID.getValue()
+                           << s.friendlyName;
+            }
+            result = postMessageForSending(std::move(msg)) && result;
         }
-        return postMessageForSending(std::move(msg));
+
+        return result;
     }
 
-    void TCPConnectionSystem::handleUnpublishScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleUnpublishScene(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneRendererHandler)
         {
@@ -1064,14 +1361,14 @@ namespace ramses::internal
             }
 
             LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
-                                                    sos << "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleUnpublishScene: from " << pp->address.getParticipantId() << " [";
+                                                    sos << "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleUnpublishScene: from " << from << " [";
                                                     for (const auto& s : unavailableScenes)
                                                         sos << s.sceneID << "/" << s.friendlyName << "; ";
                                                     sos << "]";
                                                 }));
 
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleScenesBecameUnavailable(unavailableScenes,  pp->address.getParticipantId());
+            m_sceneRendererHandler->handleScenesBecameUnavailable(unavailableScenes,  from);
         }
     }
 
@@ -1091,7 +1388,7 @@ namespace ramses::internal
         return postMessageForSending(std::move(msg));
     }
 
-    void TCPConnectionSystem::handleRendererEvent(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleRendererEvent(const Guid& from, BinaryInputStream& stream)
     {
         if (m_sceneProviderHandler)
         {
@@ -1105,9 +1402,9 @@ namespace ramses::internal
 
             stream.read(data.data(), dataSize);
 
-            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleRendererEvent: from {}, size {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId(), dataSize);
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleRendererEvent: from {}, size {}", m_participantAddress.getParticipantName(), from, dataSize);
             PlatformGuard guard(m_frameworkLock);
-            m_sceneProviderHandler->handleRendererEvent(sceneId, data, pp->address.getParticipantId());
+            m_sceneProviderHandler->handleRendererEvent(sceneId, data, from);
         }
     }
 
@@ -1137,6 +1434,8 @@ namespace ramses::internal
                                     sos << "  "  << addr.getParticipantId() << " / " << addr.getParticipantName() << " at " << addr.getIp() << ":" << addr.getPort();
                                     if (m_hasOtherDaemon && addr.getIp() == m_daemonAddress.getIp() && addr.getPort() == m_daemonAddress.getPort())
                                         sos << " (daemon)";
+                                    if (p.value->viaUnixSocket)
+                                        sos << " (unix socket)";
                                     sos << "\n";
                                 }
 
@@ -1183,6 +1482,21 @@ namespace ramses::internal
                                         {
                                             sos << p.key << "; ";
                                         }
+                                        sos << "\nSend lanes [queued msgs/bytes, max latency ms, sent bytes]: ";
+                                        for (const auto& p : m_establishedParticipants)
+                                        {
+                                            sos << p.key << " ";
+                                            for (size_t laneIdx = 0u; laneIdx < SendLanes::LaneCount; ++laneIdx)
+                                            {
+                                                SendLanes::Lane& lane = p.value->sendLanes.getLane(laneIdx);
+                                                sos << (laneIdx == SendLanes::ControlLane ? "Control" : ETransmissionPriorityNames[laneIdx - 1u])
+                                                    << " [" << lane.queue.size() << "/" << lane.queuedBytes << ", "
+                                                    << std::chrono::duration_cast<std::chrono::milliseconds>(lane.maxLatency).count() << ", " << lane.sentBytes << "] ";
+                                                lane.maxLatency = std::chrono::steady_clock::duration{0};
+                                                lane.sentBytes = 0u;
+                                            }
+                                            sos << "; ";
+                                        }
                                     }
                                 }));
                 });
@@ -1193,6 +1507,15 @@ namespace ramses::internal
         }
     }
 
+    void TCPConnectionSystem::postConnectionUpdateNotification(const ParticipantPtr& pp, EConnectionStatus status)
+    {
+        // keep order with messages of participant which are still pending on its strand
+        assert(pp->dispatchStrand);
+        asio::post(*pp->dispatchStrand, [this, participant = pp->address.getParticipantId(), status]() {
+            triggerConnectionUpdateNotification(participant, status);
+        });
+    }
+
     void TCPConnectionSystem::triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status)
     {
         PlatformGuard guard(m_frameworkLock);
@@ -1214,10 +1537,12 @@ namespace ramses::internal
 
     // --- TCPConnectionSystem::Participant ---
     TCPConnectionSystem::Participant::Participant(NetworkParticipantAddress address_, asio::io_service& io_,
-                                                  EParticipantType type_, EParticipantState state_)
+                                                  EParticipantType type_, EParticipantState state_, const TransmissionBandwidthLimits& bandwidthLimits)
         : address(std::move(address_))
         , socket(io_)
         , connectTimer(io_)
+        , sendLanes(bandwidthLimits)
+        , sendThrottleTimer(io_)
         , lengthReceiveBuffer(0)
         , sendAliveTimer(io_)
         , checkReceivedAliveTimer(io_)
@@ -1231,7 +1556,7 @@ namespace ramses::internal
         if (socket.is_open())
         {
             asio::error_code ec;
-            socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+            socket.shutdown(asio::socket_base::shutdown_both, ec);
             if (ec)
                 LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem::~Participant({}): shutdown failed: {}", address.getParticipantName(), ec.message().c_str());
 
@@ -1242,9 +1567,20 @@ namespace ramses::internal
     }
 
     // --- TCPConnectionSystem::RunState ---
-    TCPConnectionSystem::RunState::RunState()
+    TCPConnectionSystem::RunState::RunState(uint32_t dispatchThreadCount)
         : m_io()
         , m_acceptor(m_io)
         , m_acceptorSocket(m_io)
-    {}
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        , m_unixAcceptor(m_io)
+        , m_unixAcceptorSocket(m_io)
+#endif
+        , m_dispatchIo()
+        , m_dispatchWork(asio::make_work_guard(m_dispatchIo))
+        , m_dispatchRunner(m_dispatchIo)
+    {
+        assert(dispatchThreadCount > 0u);
+        for (uint32_t i = 0u; i < dispatchThreadCount; ++i)
+            m_dispatchThreads.push_back(std::make_unique<PlatformThread>("TCP_Dispatch"));
+    }
 }
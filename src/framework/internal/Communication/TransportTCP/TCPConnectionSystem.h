@@ -10,6 +10,8 @@
 
 #include "internal/Communication/TransportCommon/ICommunicationSystem.h"
 #include "internal/Communication/TransportCommon/ConnectionStatusUpdateNotifier.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
+#include "internal/Communication/TransportTCP/SendLanes.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Communication/TransportTCP/NetworkParticipantAddress.h"
 #include "internal/Communication/TransportTCP/EMessageId.h"
@@ -17,7 +19,9 @@
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/Communication/TransportTCP/AsioWrapper.h"
-#include <deque>
+#include <array>
+#include <memory>
+#include <unordered_map>
 #include <utility>
 
 
@@ -29,9 +33,13 @@ namespace ramses::internal
     class TCPConnectionSystem final : public Runnable, public ICommunicationSystem
     {
     public:
+        // when unixSocketDirectory is set, participant additionally listens on a unix domain socket in this directory
+        // and connects to participants on same host via their unix domain socket, falls back to tcp if not available
         TCPConnectionSystem(NetworkParticipantAddress  participantAddress, uint32_t protocolVersion, NetworkParticipantAddress  daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout,
+                            const TransmissionBandwidthLimits& bandwidthLimits = {}, uint32_t dispatchThreadCount = 1u,
+                            std::string unixSocketDirectory = {});
         ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
@@ -50,10 +58,12 @@ namespace ramses::internal
         bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
 
         bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
-        bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+        bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
 
         bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) override;
 
+        void setSceneTransmissionPriority(const SceneId& sceneId, ETransmissionPriority priority) override;
+
         // set service handlers
         void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) override;
         void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) override;
@@ -102,25 +112,59 @@ namespace ramses::internal
 
             std::vector<Guid> to;
             EMessageId messageType;
+            size_t lane = SendLanes::ControlLane;
             BinaryOutputStream stream;
         };
 
+        // received messages of services are handled on dispatch threads to keep connection thread free for socket I/O.
+        // Each remote participant has a strand so its messages and connection updates are handled in order, reading from
+        // a participant pauses while too many of its messages wait to be handled
+        static constexpr uint32_t MaxPendingDispatchedMessages = 8u;
+        static constexpr size_t MaxPooledReceiveBuffers = 16u;
+        using DispatchStrand = asio::io_service::strand;
+
+        class DispatchRunner final : public Runnable
+        {
+        public:
+            explicit DispatchRunner(asio::io_service& io)
+                : m_io(io)
+            {
+            }
+
+            void run() override
+            {
+                m_io.run();
+            }
+
+        private:
+            asio::io_service& m_io;
+        };
+
         struct Participant
         {
             Participant(NetworkParticipantAddress address_, asio::io_service& io_,
-                        EParticipantType type_, EParticipantState state_);
+                        EParticipantType type_, EParticipantState state_, const TransmissionBandwidthLimits& bandwidthLimits);
             ~Participant();
 
             NetworkParticipantAddress address;
-            asio::ip::tcp::socket socket;
+            // tcp or unix domain socket
+            asio::generic::stream_protocol::socket socket;
             asio::steady_timer connectTimer;
+            bool viaUnixSocket = false;
+            bool unixSocketFailed = false;
 
-            std::deque<OutMessage> outQueue;
-            std::vector<std::byte> currentOutBuffer;
+            SendLanes sendLanes;
+            asio::steady_timer sendThrottleTimer;
+            std::vector<OutBuffer> currentOutBuffers;
+            std::vector<asio::const_buffer> currentWriteBuffers;
 
             uint32_t lengthReceiveBuffer;
             std::vector<std::byte> receiveBuffer;
 
+            std::shared_ptr<DispatchStrand> dispatchStrand;
+            uint32_t pendingDispatchedMessages = 0u;
+            bool readPaused = false;
+
             std::chrono::steady_clock::time_point lastSent;
             asio::steady_timer sendAliveTimer;
             std::chrono::steady_clock::time_point lastReceived;
@@ -133,11 +177,25 @@ namespace ramses::internal
 
         struct RunState
         {
-            RunState();
+            explicit RunState(uint32_t dispatchThreadCount);
 
             asio::io_service        m_io;
             asio::ip::tcp::acceptor m_acceptor;
             asio::ip::tcp::socket   m_acceptorSocket;
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            asio::local::stream_protocol::acceptor m_unixAcceptor;
+            asio::local::stream_protocol::socket   m_unixAcceptorSocket;
+            std::string m_unixSocketPath;
+#endif
+
+            // only accessed from connection thread, strands are kept for reconnects of same participant
+            std::unordered_map<Guid, std::shared_ptr<DispatchStrand>> m_dispatchStrands;
+            std::vector<std::vector<std::byte>> m_receiveBufferPool;
+
+            asio::io_service m_dispatchIo;
+            asio::executor_work_guard<asio::io_service::executor_type> m_dispatchWork;
+            DispatchRunner m_dispatchRunner;
+            std::vector<std::unique_ptr<PlatformThread>> m_dispatchThreads;
         };
 
         void run() override;
@@ -145,34 +203,48 @@ namespace ramses::internal
         void doConnect(const ParticipantPtr& pp);
         void sendConnectionDescriptionOnNewConnection(const ParticipantPtr& pp);
         void doSendQueuedMessage(const ParticipantPtr& pp);
+        void scheduleThrottledSend(const ParticipantPtr& pp);
+        [[nodiscard]] size_t getSceneLane(const SceneId& sceneId) const;
+        [[nodiscard]] std::array<SceneInfoVector, SendLanes::LaneCount> groupScenesByLane(const SceneInfoVector& scenes) const;
+        bool postPublishSceneMessages(const std::vector<Guid>& to, const SceneInfoVector& scenes, EFeatureLevel featureLevel);
         void doTrySendAliveMessage(const ParticipantPtr& pp);
         void doReadHeader(const ParticipantPtr& pp);
         void doReadContent(const ParticipantPtr& pp);
 
         bool openAcceptor();
         void doAcceptIncomingConnections();
+        bool openUnixAcceptor();
+        void doAcceptIncomingUnixConnections();
+        void closeUnixAcceptor();
+        void addAcceptedParticipant(asio::generic::stream_protocol::socket socket, bool viaUnixSocket);
+        [[nodiscard]] bool shouldConnectViaUnixSocket(const Participant& pp) const;
 
         void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        [[nodiscard]] OutBuffer finalizeMessage(OutMessage& msg) const;
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
         void handleReceivedMessage(const ParticipantPtr& pp);
+        void dispatchReceivedMessage(const ParticipantPtr& pp, EMessageId messageType);
+        void handleDispatchedMessage(const Guid& from, EMessageId messageType, const std::vector<std::byte>& message);
+        void finishDispatchedMessage(const ParticipantPtr& pp, std::vector<std::byte> message);
         bool postMessageForSending(OutMessage msg);
         void updateLastReceivedTime(const ParticipantPtr& pp);
         void sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp);
+        void postConnectionUpdateNotification(const ParticipantPtr& pp, EConnectionStatus status);
         void triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status);
 
         void handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleConnectorAddressExchange(const ParticipantPtr& pp, BinaryInputStream& stream);
 
-        void handleSubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleUnsubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleCreateScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handlePublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleUnpublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleSceneNotAvailable(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleRendererEvent(const ParticipantPtr& pp, BinaryInputStream& stream);
+        // called on dispatch threads
+        void handleSubscribeScene(const Guid& from, BinaryInputStream& stream);
+        void handleUnsubscribeScene(const Guid& from, BinaryInputStream& stream);
+        void handleCreateScene(const Guid& from, BinaryInputStream& stream);
+        void handleSceneUpdate(const Guid& from, BinaryInputStream& stream, size_t messageSize);
+        void handlePublishScene(const Guid& from, BinaryInputStream& stream);
+        void handleUnpublishScene(const Guid& from, BinaryInputStream& stream);
+        void handleRendererEvent(const Guid& from, BinaryInputStream& stream);
 
         static const char* EnumToString(EParticipantState e);
         static const char* EnumToString(EParticipantType e);
@@ -185,6 +257,9 @@ namespace ramses::internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const TransmissionBandwidthLimits m_bandwidthLimits;
+        const uint32_t m_dispatchThreadCount;
+        const std::string m_unixSocketDirectory;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
@@ -196,6 +271,9 @@ namespace ramses::internal
         ISceneProviderServiceHandler* m_sceneProviderHandler;
         ISceneRendererServiceHandler* m_sceneRendererHandler;
 
+        // accessed with framework lock held
+        std::unordered_map<SceneId, ETransmissionPriority> m_sceneTransmissionPriorities;
+
         std::unique_ptr<RunState>     m_runState;
         HashSet<ParticipantPtr>       m_connectingParticipants;
         HashMap<Guid, ParticipantPtr> m_establishedParticipants;
@@ -30,7 +30,9 @@ namespace ramses::internal
                                                                       daemonNetworkAddress, true,
                                                                       frameworkLock,
                                                                       statisticCollection,
-                                                                      config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+                                                                      config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(),
+                                                                      TransmissionBandwidthLimits{}, 1u,
+                                                                      config.m_tcpConfig.getUnixSocketDirectory());
 
         if (optionalRamsh)
         {
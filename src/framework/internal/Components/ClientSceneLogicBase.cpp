@@ -19,6 +19,9 @@
 #include "internal/Components/IResourceProviderComponent.h"
 #include "internal/Components/SceneUpdate.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace ramses::internal
 {
     ClientSceneLogicBase::ClientSceneLogicBase(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, EFeatureLevel featureLevel)
@@ -61,6 +64,7 @@ namespace ramses::internal
         // reset to initial state
         m_subscribersActive.clear();
         m_subscribersWaitingForScene.clear();
+        m_resourcesAvailableAtSubscribers.clear();
     }
 
     bool ClientSceneLogicBase::isPublished() const
@@ -98,6 +102,20 @@ namespace ramses::internal
                 LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::removeSubscriber: remove waiting subscriber {} from scene {}, numRemaining {}", subscriber, m_sceneId, m_subscribersWaitingForScene.size());
             }
         }
+        m_resourcesAvailableAtSubscribers.erase(subscriber);
+    }
+
+    void ClientSceneLogicBase::setResourcesAvailableAtSubscriber(const Guid& subscriber, ResourceContentHashVector availableResources)
+    {
+        if (contains_c(m_subscribersActive, subscriber))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "ClientSceneLogic::setResourcesAvailableAtSubscriber: ignore available resources of {} for scene {}, scene was already sent", subscriber, m_sceneId);
+            return;
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::setResourcesAvailableAtSubscriber: {} has {} resources available for scene {}", subscriber, availableResources.size(), m_sceneId);
+        std::sort(availableResources.begin(), availableResources.end());
+        m_resourcesAvailableAtSubscribers[subscriber] = std::move(availableResources);
     }
 
     std::vector<Guid> ClientSceneLogicBase::getWaitingAndActiveSubscribers() const
@@ -142,7 +160,39 @@ namespace ramses::internal
             m_scenegraphSender.sendCreateScene(subscriber, sceneInfo);
         }
         m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<uint32_t>(m_subscribersWaitingForScene.size()));
-        m_scenegraphSender.sendSceneUpdate(m_subscribersWaitingForScene, std::move(sceneUpdate), m_sceneId, *m_scenePublicationMode, m_scene.getStatisticCollection());
+
+        // subscribers which already hold some of the resources get own update without their data,
+        // resources stay listed as added so that subscriber keeps them referenced for the scene
+        AddressVector subscribersNeedingAllResources;
+        for (const auto& subscriber : m_subscribersWaitingForScene)
+        {
+            const auto availableIt = m_resourcesAvailableAtSubscribers.find(subscriber);
+            if (availableIt == m_resourcesAvailableAtSubscribers.cend())
+            {
+                subscribersNeedingAllResources.push_back(subscriber);
+                continue;
+            }
+
+            const ResourceContentHashVector& availableResources = availableIt->second;
+            ManagedResourceVector resourcesToSend;
+            resourcesToSend.reserve(sceneUpdate.resources.size());
+            std::copy_if(sceneUpdate.resources.cbegin(), sceneUpdate.resources.cend(), std::back_inserter(resourcesToSend), [&availableResources](const auto& mr) {
+                return !std::binary_search(availableResources.cbegin(), availableResources.cend(), mr->getHash());
+            });
+            m_resourcesAvailableAtSubscribers.erase(availableIt);
+
+            if (resourcesToSend.size() == sceneUpdate.resources.size())
+            {
+                subscribersNeedingAllResources.push_back(subscriber);
+                continue;
+            }
+
+            LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} without data of {} resources it already has", m_sceneId, subscriber, sceneUpdate.resources.size() - resourcesToSend.size());
+            SceneUpdate reducedSceneUpdate{ sceneUpdate.actions.copy(), std::move(resourcesToSend), sceneUpdate.flushInfos.copy() };
+            m_scenegraphSender.sendSceneUpdate({ subscriber }, std::move(reducedSceneUpdate), m_sceneId, *m_scenePublicationMode, m_scene.getStatisticCollection());
+        }
+        if (!subscribersNeedingAllResources.empty())
+            m_scenegraphSender.sendSceneUpdate(subscribersNeedingAllResources, std::move(sceneUpdate), m_sceneId, *m_scenePublicationMode, m_scene.getStatisticCollection());
 
         m_subscribersActive.insert(m_subscribersActive.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         m_subscribersWaitingForScene.clear();
@@ -12,6 +12,7 @@
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/Scene.h"
 #include <optional>
+#include <unordered_map>
 
 namespace ramses::internal
 {
@@ -32,6 +33,8 @@ namespace ramses::internal
         [[nodiscard]] bool isPublished() const;
         void addSubscriber(const Guid& newSubscriber);
         void removeSubscriber(const Guid& subscriber);
+        // resources the subscriber already holds, their data is left out when the scene is sent to it
+        void setResourcesAvailableAtSubscriber(const Guid& subscriber, ResourceContentHashVector availableResources);
 
         [[nodiscard]] std::vector<Guid> getWaitingAndActiveSubscribers() const;
 
@@ -64,6 +67,7 @@ namespace ramses::internal
         using AddressVector = std::vector<Guid>;
         AddressVector  m_subscribersActive;
         AddressVector  m_subscribersWaitingForScene;
+        std::unordered_map<Guid, ResourceContentHashVector> m_resourcesAvailableAtSubscribers;
         std::optional<EScenePublicationMode> m_scenePublicationMode;
 
         uint64_t m_flushCounter = 0u;
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/FlushTimeInformation.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include "internal/Core/Utils/LoggingUtils.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Stages of a flush on its way from client to screen, each stage timestamp marks when the stage starts.
+    // Client side stages are recorded in the client process, all other stages in the renderer process.
+    enum class EFlushTraceStage : uint8_t
+    {
+        Flush,              // flush called on client scene
+        Serialize,          // scene update passed to scene graph sender, resources are compressed and update serialized
+        Send,               // serialized update queued for sending
+        Receive,            // first packet of update received
+        Deserialize,        // last packet of update received and deserialized, update waits for renderer
+        Pending,            // update consolidated into pending flushes of renderer scene
+        ResourcesReady,     // all resources of pending flushes uploaded (or flushes force applied)
+        Applied,            // flush applied to renderer scene
+        Rendered,           // scene rendered for first time after flush was applied
+    };
+
+    const std::array FlushTraceStageNames = {
+        "flush",
+        "serialize",
+        "send",
+        "receive",
+        "deserialize",
+        "pending",
+        "resources ready",
+        "applied",
+        "rendered",
+    };
+
+    ENUM_TO_STRING(EFlushTraceStage, FlushTraceStageNames, EFlushTraceStage::Rendered);
+
+    // Timestamps of single flush, identified by scene and flush index (flush counter of client scene).
+    // Stages not reached in a process stay invalid. Tracing is only enabled when FlushTracer is set up,
+    // marking stages of disabled trace does nothing.
+    struct FlushTrace
+    {
+        void mark(EFlushTraceStage stage)
+        {
+            if (enabled)
+                timestamps[static_cast<size_t>(stage)] = FlushTime::Clock::now();
+        }
+
+        [[nodiscard]] FlushTime::Clock::time_point getTimestamp(EFlushTraceStage stage) const
+        {
+            return timestamps[static_cast<size_t>(stage)];
+        }
+
+        bool enabled = false;
+        SceneId sceneId;
+        uint64_t flushIndex = 0u;
+        std::array<FlushTime::Clock::time_point, FlushTraceStageNames.size()> timestamps{};
+    };
+    using FlushTraces = std::vector<FlushTrace>;
+}
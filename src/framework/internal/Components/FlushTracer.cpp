@@ -0,0 +1,136 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Components/FlushTracer.h"
+#include "internal/Core/Utils/File.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include "fmt/format.h"
+#include <iterator>
+#include <unordered_set>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        std::string EscapeJsonString(std::string_view str)
+        {
+            std::string escaped;
+            escaped.reserve(str.size());
+            for (const char c : str)
+            {
+                if (c == '"' || c == '\\')
+                    escaped.push_back('\\');
+                if (static_cast<unsigned char>(c) >= 0x20u)
+                    escaped.push_back(c);
+            }
+            return escaped;
+        }
+
+        // scene is shown as thread of process in trace viewer
+        uint32_t GetTraceThreadId(SceneId sceneId)
+        {
+            return static_cast<uint32_t>(sceneId.getValue());
+        }
+    }
+
+    FlushTracer::FlushTracer(std::string traceFile, uint32_t processId, std::string processName)
+        : m_traceFile{ std::move(traceFile) }
+        , m_processId{ processId }
+        , m_processName{ std::move(processName) }
+    {
+    }
+
+    void FlushTracer::addTrace(const FlushTrace& trace)
+    {
+        std::lock_guard<std::mutex> guard{ m_lock };
+        if (m_traces.size() >= MaxNumberOfTraces)
+        {
+            ++m_numDroppedTraces;
+            return;
+        }
+        m_traces.push_back(trace);
+    }
+
+    size_t FlushTracer::getNumberOfTraces() const
+    {
+        std::lock_guard<std::mutex> guard{ m_lock };
+        return m_traces.size();
+    }
+
+    std::string FlushTracer::getChromeTraceJson() const
+    {
+        std::lock_guard<std::mutex> guard{ m_lock };
+
+        fmt::memory_buffer buffer;
+        auto out = std::back_inserter(buffer);
+        fmt::format_to(out, "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        fmt::format_to(out, R"({{"name":"process_name","ph":"M","pid":{},"args":{{"name":"{}"}}}})", m_processId, EscapeJsonString(m_processName));
+
+        std::unordered_set<SceneId> scenes;
+        for (const auto& trace : m_traces)
+        {
+            const uint32_t tid = GetTraceThreadId(trace.sceneId);
+            if (scenes.insert(trace.sceneId).second)
+                fmt::format_to(out, ",\n" R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"scene {}"}}}})", m_processId, tid, trace.sceneId.getValue());
+
+            std::vector<EFlushTraceStage> stages;
+            for (size_t i = 0u; i < trace.timestamps.size(); ++i)
+            {
+                if (trace.timestamps[i] != FlushTime::InvalidTimestamp)
+                    stages.push_back(static_cast<EFlushTraceStage>(i));
+            }
+
+            // every stage lasts until next stage reached in this process, last one is shown as instant
+            for (size_t i = 0u; i < stages.size(); ++i)
+            {
+                const EFlushTraceStage stage = stages[i];
+                const uint64_t ts = asMicroseconds(trace.getTimestamp(stage));
+                fmt::format_to(out, ",\n" R"({{"name":"{}","cat":"flush","pid":{},"tid":{},"ts":{},)", EnumToString(stage), m_processId, tid, ts);
+                if (i + 1u < stages.size())
+                {
+                    const uint64_t nextTs = asMicroseconds(trace.getTimestamp(stages[i + 1u]));
+                    fmt::format_to(out, R"("ph":"X","dur":{},)", nextTs > ts ? nextTs - ts : 0u);
+                }
+                else
+                {
+                    fmt::format_to(out, R"("ph":"i","s":"t",)");
+                }
+                fmt::format_to(out, R"("args":{{"scene":{},"flush":{}}}}})", trace.sceneId.getValue(), trace.flushIndex);
+
+                // flow arrow from sending process to receiving process, id is unique per scene and flush
+                if (stage == EFlushTraceStage::Send || stage == EFlushTraceStage::Receive)
+                {
+                    fmt::format_to(out, ",\n" R"({{"name":"flush","cat":"flush","ph":"{}",{}"id":"{}:{}","pid":{},"tid":{},"ts":{}}})",
+                        stage == EFlushTraceStage::Send ? "s" : "f", stage == EFlushTraceStage::Send ? "" : R"("bp":"e",)",
+                        trace.sceneId.getValue(), trace.flushIndex, m_processId, tid, ts);
+                }
+            }
+        }
+
+        fmt::format_to(out, "\n]}}\n");
+        return fmt::to_string(buffer);
+    }
+
+    bool FlushTracer::writeTraceFile() const
+    {
+        const std::string json = getChromeTraceJson();
+
+        File file(m_traceFile);
+        if (!file.open(File::Mode::WriteOverWriteOld) || !file.write(json.data(), json.size()))
+        {
+            LOG_ERROR(CONTEXT_PROFILING, "FlushTracer::writeTraceFile: failed to write flush traces to {}", m_traceFile);
+            return false;
+        }
+        file.close();
+
+        std::lock_guard<std::mutex> guard{ m_lock };
+        LOG_INFO(CONTEXT_PROFILING, "FlushTracer::writeTraceFile: written {} flush traces to {} (dropped {})", m_traces.size(), m_traceFile, m_numDroppedTraces);
+        return true;
+    }
+}
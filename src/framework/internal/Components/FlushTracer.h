@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/FlushTrace.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace ramses::internal
+{
+    // Collects finished flush traces of one process (framework) and exports them as Chrome trace event JSON,
+    // which can be loaded in Perfetto or chrome://tracing. Traces of client and renderer process can be combined
+    // by concatenating the traceEvents arrays, flow events link send on client side to receive on renderer side.
+    // Thread safe, traces are added from client, connection and renderer threads.
+    class FlushTracer
+    {
+    public:
+        FlushTracer(std::string traceFile, uint32_t processId, std::string processName);
+
+        void addTrace(const FlushTrace& trace);
+
+        [[nodiscard]] size_t getNumberOfTraces() const;
+        [[nodiscard]] std::string getChromeTraceJson() const;
+        bool writeTraceFile() const;
+
+        // limits memory used if traces are never written, further traces are dropped
+        static constexpr size_t MaxNumberOfTraces = 100000u;
+
+    private:
+        const std::string m_traceFile;
+        const uint32_t m_processId;
+        const std::string m_processName;
+
+        mutable std::mutex m_lock;
+        FlushTraces m_traces;
+        size_t m_numDroppedTraces = 0u;
+    };
+}
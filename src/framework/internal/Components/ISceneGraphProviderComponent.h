@@ -13,6 +13,7 @@
 #include "internal/SceneGraph/SceneAPI/SceneVersionTag.h"
 #include "internal/SceneGraph/SceneAPI/Handles.h"
 #include "internal/SceneGraph/SceneAPI/SceneTypes.h"
+#include "internal/Communication/TransportCommon/ETransmissionPriority.h"
 
 namespace ramses::internal
 {
@@ -28,6 +29,7 @@ namespace ramses::internal
         virtual ~ISceneGraphProviderComponent() = default;
         virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventInterface) = 0;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) = 0;
+        virtual void handleSetSceneTransmissionPriority(SceneId sceneId, ETransmissionPriority priority) = 0;
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
         virtual bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
         virtual void handleRemoveScene(SceneId sceneId) = 0;
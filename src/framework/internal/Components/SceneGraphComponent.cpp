@@ -21,6 +21,7 @@
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 #include "internal/Components/ResourceAvailabilityEvent.h"
 #include "internal/Components/IResourceProviderComponent.h"
+#include "internal/Components/FlushTracer.h"
 #include "internal/Components/SceneUpdate.h"
 
 namespace ramses::internal
@@ -89,6 +90,12 @@ namespace ramses::internal
         }
     }
 
+    void SceneGraphComponent::setFlushTracer(FlushTracer* flushTracer)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_flushTracer = flushTracer;
+    }
+
     void SceneGraphComponent::sendCreateScene(const Guid& to, const SceneInfo& sceneInfo)
     {
         LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::sendCreateScene: sceneId {}, to {}", sceneInfo.sceneID, to);
@@ -123,32 +130,43 @@ namespace ramses::internal
 
     void SceneGraphComponent::sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode /*mode*/, StatisticCollectionScene& sceneStatistics)
     {
-        // send to network (no ownership transfer)
+        FlushTrace& trace = sceneUpdate.trace;
+        if (m_flushTracer)
+        {
+            trace.enabled = true;
+            trace.sceneId = sceneId;
+            trace.flushIndex = sceneUpdate.flushInfos.flushCounter;
+            trace.timestamps[static_cast<size_t>(EFlushTraceStage::Flush)] = sceneUpdate.flushInfos.flushTimeInfo.internalTimestamp;
+            trace.mark(EFlushTraceStage::Serialize);
+        }
+
+        // send to network (no ownership transfer), serialized once for all remote participants
         bool sendToSelf = false;
-        bool alreadyCompressed = false;
+        std::vector<Guid> remoteRecipients;
+        remoteRecipients.reserve(toVec.size());
         for (const auto& to : toVec)
         {
             if (m_myID == to)
-            {
                 sendToSelf = true;
-            }
             else
+                remoteRecipients.push_back(to);
+        }
+
+        if (!remoteRecipients.empty())
+        {
+            for (auto& resource : sceneUpdate.resources)
             {
-                if (!alreadyCompressed)
-                {
-                    for (auto& resource : sceneUpdate.resources)
-                    {
-                        resource->compress(IResource::CompressionLevel::Realtime);
-                    }
-                    alreadyCompressed = true;
-                }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics, m_featureLevel));
+                resource->compress(IResource::CompressionLevel::Realtime);
             }
+            m_communicationSystem.sendSceneUpdate(remoteRecipients, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics, m_featureLevel));
+            trace.mark(EFlushTraceStage::Send);
         }
 
-        // send to self last to move sceneUpdate to local renderer
+        // send to self last to move sceneUpdate to local renderer, which completes the trace
         if (sendToSelf && m_sceneRendererHandler)
             m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(sceneUpdate), m_myID);
+        else if (trace.enabled)
+            m_flushTracer->addTrace(trace);
     }
 
     void SceneGraphComponent::sendPublishScene(const SceneInfo& sceneInfo)
@@ -318,6 +336,12 @@ namespace ramses::internal
         sceneLogic.publish(publicationMode);
     }
 
+    void SceneGraphComponent::handleSetSceneTransmissionPriority(SceneId sceneId, ETransmissionPriority priority)
+    {
+        LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleSetSceneTransmissionPriority: {} with priority {}", sceneId, priority);
+        m_communicationSystem.setSceneTransmissionPriority(sceneId, priority);
+    }
+
     void SceneGraphComponent::handleUnpublishScene(SceneId sceneId)
     {
         assert(m_clientSceneLogicMap.contains(sceneId));
@@ -423,7 +447,7 @@ namespace ramses::internal
         }
     }
 
-    void SceneGraphComponent::handleRendererEvent(const SceneId& sceneId, const std::vector<std::byte>& data, const Guid& /*rendererID*/)
+    void SceneGraphComponent::handleRendererEvent(const SceneId& sceneId, const std::vector<std::byte>& data, const Guid& rendererID)
     {
         // First extract type of event, it is at the beginning
         // TODO(jonathan): check if we can improve type handling, handle in better framing format e.g.
@@ -448,6 +472,9 @@ namespace ramses::internal
             {
                 ResourceAvailabilityEvent event;
                 event.readFromBlob(data);
+                ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(event.sceneid);
+                if (sceneLogic != nullptr)
+                    (*sceneLogic)->setResourcesAvailableAtSubscriber(rendererID, event.availableResources);
                 forwardToSceneProviderEventConsumer(event);
                 break;
             }
@@ -512,42 +539,24 @@ namespace ramses::internal
 
         // start with fresh deinitializer
         // TODO(tobias) should already be cleared when unsub was sent ou for this scene
-        it->second.sceneUpdateDeserializer = std::make_unique<SceneUpdateStreamDeserializer>(m_featureLevel);
+        it->second.sceneUpdateDeserializer = std::make_shared<SceneUpdateStreamDeserializer>(m_featureLevel);
+        if (m_flushTracer)
+            it->second.sceneUpdateDeserializer->enableFlushTracing();
 
         m_sceneRendererHandler->handleInitializeScene(it->second.info, providerID);
     }
 
     void SceneGraphComponent::handleSceneUpdate(const SceneId& sceneId, absl::Span<const std::byte> actionData, const Guid& providerID)
     {
-        if (!m_sceneRendererHandler)
-        {
-            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: unexpected call because no renderer, scene {} from {}", sceneId, providerID);
-            return;
-        }
-
-        auto it = m_remoteScenes.find(sceneId);
-        if (it == m_remoteScenes.end())
-        {
-            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: received actions for unknown scene {} from {}", sceneId, providerID);
-            return;
-        }
-        if (it->second.provider != providerID)
-        {
-            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: received from unexpected provider, sceneId: {}, by {} but belongs to {}",
-                sceneId, providerID, it->second.provider);
-            return;
-        }
-        if (actionData.empty())
+        // framework lock is only held for lookup and for passing on result, deserialization runs unlocked.
+        // Deserializer is kept alive by shared ownership even if scene is reinitialized or removed meanwhile
+        std::shared_ptr<SceneUpdateStreamDeserializer> deserializer;
         {
-            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: data is empty, sceneId {} from {}", sceneId, providerID);
-            return;
+            PlatformGuard guard(m_frameworkLock);
+            deserializer = getSceneUpdateDeserializer(sceneId, actionData, providerID);
         }
-        SceneUpdateStreamDeserializer* deserializer = it->second.sceneUpdateDeserializer.get();
         if (!deserializer)
-        {
-            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: scene was not initialized before sending actions, sceneId {} from {}", sceneId, providerID);
             return;
-        }
 
         auto result = deserializer->processData(actionData);
         switch (result.result)
@@ -564,12 +573,57 @@ namespace ramses::internal
                 sceneUpdate.actions = std::move(result.actions);
                 sceneUpdate.resources.insert(sceneUpdate.resources.end(), std::make_move_iterator(result.resources.begin()), std::make_move_iterator(result.resources.end()));
                 sceneUpdate.flushInfos = std::move(result.flushInfos);
+                sceneUpdate.trace = result.trace;
+                sceneUpdate.trace.sceneId = sceneId;
+                sceneUpdate.trace.flushIndex = sceneUpdate.flushInfos.flushCounter;
+
+                PlatformGuard guard(m_frameworkLock);
+                // drop update if scene was reinitialized or removed while deserializing
+                auto it = m_remoteScenes.find(sceneId);
+                if (it == m_remoteScenes.end() || it->second.sceneUpdateDeserializer != deserializer || !m_sceneRendererHandler)
+                {
+                    LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: drop update of scene {} from {}, scene changed while receiving", sceneId, providerID);
+                    break;
+                }
                 m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(sceneUpdate), providerID);
                 break;
             }
         }
     }
 
+    std::shared_ptr<SceneUpdateStreamDeserializer> SceneGraphComponent::getSceneUpdateDeserializer(const SceneId& sceneId, absl::Span<const std::byte> actionData, const Guid& providerID) const
+    {
+        if (!m_sceneRendererHandler)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: unexpected call because no renderer, scene {} from {}", sceneId, providerID);
+            return {};
+        }
+
+        auto it = m_remoteScenes.find(sceneId);
+        if (it == m_remoteScenes.end())
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: received actions for unknown scene {} from {}", sceneId, providerID);
+            return {};
+        }
+        if (it->second.provider != providerID)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: received from unexpected provider, sceneId: {}, by {} but belongs to {}",
+                sceneId, providerID, it->second.provider);
+            return {};
+        }
+        if (actionData.empty())
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: data is empty, sceneId {} from {}", sceneId, providerID);
+            return {};
+        }
+        if (!it->second.sceneUpdateDeserializer)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: scene was not initialized before sending actions, sceneId {} from {}", sceneId, providerID);
+            return {};
+        }
+        return it->second.sceneUpdateDeserializer;
+    }
+
     void SceneGraphComponent::handleNewScenesAvailable(const SceneInfoVector& newScenes, const Guid& providerID, EFeatureLevel featureLevel)
     {
         // TODO(tobias) also cross-check with locally published scenes (+ published by someone else?) and warn/ignore if exists
@@ -25,6 +25,7 @@
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/Pair.h"
 #include <unordered_map>
+#include <memory>
 
 namespace ramses::internal
 {
@@ -36,6 +37,7 @@ namespace ramses::internal
     class ISceneRendererHandler;
     class SceneUpdateStreamDeserializer;
     class IResourceProviderComponent;
+    class FlushTracer;
 
     class SceneGraphComponent final : public ISceneGraphProviderComponent,
                                       public ISceneGraphSender,
@@ -56,6 +58,8 @@ namespace ramses::internal
         ~SceneGraphComponent() override;
 
         void setSceneRendererHandler(ISceneRendererHandler* sceneRendererHandler) override;
+        // enables recording of flush traces, must be set before any scene is created or received
+        void setFlushTracer(FlushTracer* flushTracer);
 
         // ISceneGraphSender
         void sendCreateScene(const Guid& to, const SceneInfo& sceneInfo) override;
@@ -76,6 +80,7 @@ namespace ramses::internal
         // ISceneGraphProviderComponent
         void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer) override;
         void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) override;
+        void handleSetSceneTransmissionPriority(SceneId sceneId, ETransmissionPriority priority) override;
         void handleUnpublishScene(SceneId sceneId) override;
         bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
         void handleRemoveScene(SceneId sceneId) override;
@@ -104,6 +109,7 @@ namespace ramses::internal
     private:
         void forwardToSceneProviderEventConsumer(SceneReferenceEvent const& event);
         void forwardToSceneProviderEventConsumer(ResourceAvailabilityEvent const& event);
+        [[nodiscard]] std::shared_ptr<SceneUpdateStreamDeserializer> getSceneUpdateDeserializer(const SceneId& sceneId, absl::Span<const std::byte> actionData, const Guid& providerID) const;
 
         ISceneRendererHandler* m_sceneRendererHandler;
         Guid m_myID;
@@ -123,12 +129,13 @@ namespace ramses::internal
         IResourceProviderComponent& m_resourceComponent;
 
         EFeatureLevel m_featureLevel = EFeatureLevel_Latest;
+        FlushTracer* m_flushTracer = nullptr;
 
         struct ReceivedScene
         {
             SceneInfo info;
             Guid provider;
-            std::unique_ptr<SceneUpdateStreamDeserializer> sceneUpdateDeserializer;
+            std::shared_ptr<SceneUpdateStreamDeserializer> sceneUpdateDeserializer;
         };
 
         std::unordered_map<SceneId, ReceivedScene> m_remoteScenes;
@@ -11,6 +11,7 @@
 #include "internal/Components/ManagedResource.h"
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
 #include "internal/Components/FlushInformation.h"
+#include "internal/Components/FlushTrace.h"
 
 namespace ramses::internal
 {
@@ -19,5 +20,6 @@ namespace ramses::internal
         SceneActionCollection actions;
         ManagedResourceVector resources;
         FlushInformation flushInfos;
+        FlushTrace trace;
     };
 }
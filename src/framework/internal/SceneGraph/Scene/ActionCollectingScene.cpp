@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/SceneGraph/Scene/ActionCollectingScene.h"
+#include "internal/SceneGraph/SceneUtils/BufferDeltaEncoding.h"
 
 namespace ramses::internal
 {
@@ -361,6 +362,12 @@ namespace ramses::internal
         m_creator.setRenderableStartVertex(renderableHandle, startVertex);
     }
 
+    void ActionCollectingScene::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        BaseT::setRenderableFrustumCulling(renderableHandle, enabled);
+        m_creator.setRenderableFrustumCulling(renderableHandle, enabled);
+    }
+
     void ActionCollectingScene::setRenderableUniformsDataInstanceAndState(RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle)
     {
         BaseT::setRenderableDataInstance(renderableHandle, ERenderableDataSlotType_Uniforms, newDataInstance);
@@ -476,6 +483,12 @@ namespace ramses::internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassStateSorting(passHandle, enable);
+        m_creator.setRenderPassStateSorting(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         BaseT::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -649,8 +662,19 @@ namespace ramses::internal
 
     void ActionCollectingScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data)
     {
+        // receivers know previous content only within used range, delta is sent if it halves the data at least
+        const GeometryDataBuffer& dataBuffer = getDataBuffer(handle);
+        if (m_bufferDeltaEncodingEnabled && dataSizeInBytes >= BufferDeltaEncoding::MinDataSize && offsetInBytes + dataSizeInBytes <= dataBuffer.usedSize &&
+            BufferDeltaEncoding::Encode({ dataBuffer.data.data() + offsetInBytes, dataSizeInBytes }, { data, dataSizeInBytes }, dataSizeInBytes / 2u, m_bufferDelta))
+        {
+            m_creator.updateDataBufferDelta(handle, offsetInBytes, dataSizeInBytes, m_bufferDelta.data(), static_cast<uint32_t>(m_bufferDelta.size()));
+        }
+        else
+        {
+            m_creator.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+        }
+
         BaseT::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
-        m_creator.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
     }
 
     UniformBufferHandle ActionCollectingScene::allocateUniformBuffer(uint32_t size, UniformBufferHandle handle)
@@ -688,9 +712,26 @@ namespace ramses::internal
 
     void ActionCollectingScene::updateTextureBuffer(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data)
     {
+        const TextureBuffer& textureBuffer = getTextureBuffer(handle);
+        const uint32_t texelSize = GetTexelSizeFromFormat(textureBuffer.textureFormat);
+        const uint32_t dataSize = width * height * texelSize;
+
+        // receivers know previous content only within used region, delta is sent if it halves the data at least
+        const MipMap& mip = textureBuffer.mipMaps[mipLevel];
+        const Quad region{ int32_t(x), int32_t(y), int32_t(width), int32_t(height) };
+        bool deltaEncoded = false;
+        if (m_bufferDeltaEncodingEnabled && dataSize >= BufferDeltaEncoding::MinDataSize && mip.usedRegion.getBoundingQuad(region) == mip.usedRegion)
+        {
+            BufferDeltaEncoding::ReadTextureRegion(mip, texelSize, region, m_previousBufferData);
+            deltaEncoded = BufferDeltaEncoding::Encode(m_previousBufferData, { data, dataSize }, dataSize / 2u, m_bufferDelta);
+        }
+
+        if (deltaEncoded)
+            m_creator.updateTextureBufferDelta(handle, mipLevel, x, y, width, height, m_bufferDelta.data(), static_cast<uint32_t>(m_bufferDelta.size()));
+        else
+            m_creator.updateTextureBuffer(handle, mipLevel, x, y, width, height, data, dataSize);
+
         BaseT::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
-        const uint32_t dataSize = width * height * GetTexelSizeFromFormat(getTextureBuffer(handle).textureFormat);
-        m_creator.updateTextureBuffer(handle, mipLevel, x, y, width, height, data, dataSize);
     }
 
     SceneReferenceHandle ActionCollectingScene::allocateSceneReference(SceneId sceneId, SceneReferenceHandle handle)
@@ -763,4 +804,14 @@ namespace ramses::internal
     {
         m_sceneReferenceActions.clear();
     }
+
+    void ActionCollectingScene::setBufferDeltaEncodingEnabled(bool enabled)
+    {
+        m_bufferDeltaEncodingEnabled = enabled;
+    }
+
+    bool ActionCollectingScene::isBufferDeltaEncodingEnabled() const
+    {
+        return m_bufferDeltaEncodingEnabled;
+    }
 }
@@ -35,6 +35,7 @@ namespace ramses::internal
         void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableFrustumCulling     (RenderableHandle renderableHandle, bool enabled) override;
         void                        setRenderableUniformsDataInstanceAndState (RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle);
 
         // Render state
@@ -118,6 +119,7 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
 
@@ -175,9 +177,18 @@ namespace ramses::internal
         [[nodiscard]] const SceneReferenceActionVector& getSceneReferenceActions() const;
         void resetSceneReferenceActions();
 
+        // data and texture buffer updates are sent as delta to previous content where it pays off, disabled by default
+        void setBufferDeltaEncodingEnabled(bool enabled);
+        [[nodiscard]] bool isBufferDeltaEncodingEnabled() const;
+
     private:
         SceneActionCollection m_collection;
         SceneActionCollectionCreator m_creator;
         SceneReferenceActionVector m_sceneReferenceActions;
+
+        // reused for delta encoding of buffer updates
+        bool m_bufferDeltaEncodingEnabled = false;
+        std::vector<std::byte> m_previousBufferData;
+        std::vector<std::byte> m_bufferDelta;
     };
 }
@@ -198,6 +198,12 @@ namespace ramses::internal
         UpdateUniformBuffer,
         SetDataUniformBuffer,
 
+        SetRenderableFrustumCulling,
+        SetRenderPassStateSorting,
+
+        UpdateDataBufferDelta,
+        UpdateTextureBufferDelta,
+
         NUMBER_OF_TYPES
     };
 
@@ -251,6 +257,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::AllocateDataBuffer);
             CreateNameForEnumID(ESceneActionId::ReleaseDataBuffer);
             CreateNameForEnumID(ESceneActionId::UpdateDataBuffer);
+            CreateNameForEnumID(ESceneActionId::UpdateDataBufferDelta);
 
             // Uniform buffer
             CreateNameForEnumID(ESceneActionId::AllocateUniformBuffer);
@@ -261,6 +268,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::AllocateTextureBuffer);
             CreateNameForEnumID(ESceneActionId::ReleaseTextureBuffer);
             CreateNameForEnumID(ESceneActionId::UpdateTextureBuffer);
+            CreateNameForEnumID(ESceneActionId::UpdateTextureBufferDelta);
 
             // renderable
             CreateNameForEnumID(ESceneActionId::AllocateRenderable);
@@ -271,6 +279,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetRenderableDataInstance);
             CreateNameForEnumID(ESceneActionId::SetRenderableInstanceCount);
             CreateNameForEnumID(ESceneActionId::SetRenderableStartVertex);
+            CreateNameForEnumID(ESceneActionId::SetRenderableFrustumCulling);
 
             // render states
             CreateNameForEnumID(ESceneActionId::ReleaseState);
@@ -311,6 +320,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetRenderPassEnabled);
             CreateNameForEnumID(ESceneActionId::SetRenderPassRenderOnce);
             CreateNameForEnumID(ESceneActionId::RetriggerRenderPassRenderOnce);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassStateSorting);
             CreateNameForEnumID(ESceneActionId::AddRenderGroupToRenderPass);
             CreateNameForEnumID(ESceneActionId::RemoveRenderGroupFromRenderPass);
 
@@ -140,6 +140,11 @@ namespace ramses::internal
         m_originalScene.setRenderableStartVertex(getMappedHandle(renderableHandle), startVertex);
     }
 
+    void MergeScene::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        m_originalScene.setRenderableFrustumCulling(getMappedHandle(renderableHandle), enabled);
+    }
+
     const Renderable& MergeScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_originalScene.getRenderable(getMappedHandle(renderableHandle));
@@ -1147,6 +1152,11 @@ namespace ramses::internal
         m_originalScene.retriggerRenderPassRenderOnce(getMappedHandle(pass));
     }
 
+    void MergeScene::setRenderPassStateSorting(RenderPassHandle pass, bool enable)
+    {
+        m_originalScene.setRenderPassStateSorting(getMappedHandle(pass), enable);
+    }
+
     void MergeScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         m_originalScene.addRenderGroupToRenderPass(getMappedHandle(passHandle), getMappedHandle(groupHandle), order);
@@ -114,6 +114,12 @@ namespace ramses::internal
         m_renderPasses.getMemory(passHandle)->isRenderOnce = enable;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->stateSorting = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::retriggerRenderPassRenderOnce([[maybe_unused]] RenderPassHandle passHandle)
     {
@@ -707,6 +713,12 @@ namespace ramses::internal
         m_renderables.getMemory(renderableHandle)->startVertex = startVertex;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        m_renderables.getMemory(renderableHandle)->frustumCulling = enabled;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const Renderable& SceneT<MEMORYPOOL>::getRenderable(RenderableHandle renderableHandle) const
     {
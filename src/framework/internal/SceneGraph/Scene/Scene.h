@@ -89,6 +89,7 @@ namespace ramses::internal
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableFrustumCulling     (RenderableHandle renderableHandle, bool enabled) override;
         [[nodiscard]] const Renderable& getRenderable               (RenderableHandle renderableHandle) const final override;
         [[nodiscard]] const RenderableMemoryPool& getRenderables    () const;
 
@@ -254,6 +255,7 @@ namespace ramses::internal
         void                    setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                    setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                    retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                    setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                    addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                    removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         [[nodiscard]] const RenderPass& getRenderPass           (RenderPassHandle passHandle) const final override;
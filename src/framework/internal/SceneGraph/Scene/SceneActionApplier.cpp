@@ -15,11 +15,15 @@
 #include "internal/SceneGraph/SceneAPI/Camera.h"
 #include "internal/SceneGraph/SceneAPI/RenderBuffer.h"
 #include "internal/SceneGraph/SceneAPI/ERotationType.h"
+#include "internal/SceneGraph/SceneAPI/GeometryDataBuffer.h"
+#include "internal/SceneGraph/SceneAPI/TextureBuffer.h"
+#include "internal/SceneGraph/SceneUtils/BufferDeltaEncoding.h"
 #include "internal/Communication/TransportCommon/RamsesTransportProtocolVersion.h"
 #include "internal/Components/SingleResourceSerialization.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/Core/Utils/LogMacros.h"
 #include "glm/gtx/range.hpp"
 
 #include <string>
@@ -426,6 +430,15 @@ namespace ramses::internal
             scene.setRenderableStartVertex(renderable, startVertex);
             break;
         }
+        case ESceneActionId::SetRenderableFrustumCulling:
+        {
+            RenderableHandle renderable;
+            bool enabled = true;
+            action.read(renderable);
+            action.read(enabled);
+            scene.setRenderableFrustumCulling(renderable, enabled);
+            break;
+        }
         case ESceneActionId::AllocateRenderGroup:
         {
             uint32_t renderableCount = 0u;
@@ -739,6 +752,15 @@ namespace ramses::internal
             scene.retriggerRenderPassRenderOnce(passHandle);
             break;
         }
+        case ESceneActionId::SetRenderPassStateSorting:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassStateSorting(passHandle, enabled);
+            break;
+        }
         case ESceneActionId::AddRenderGroupToRenderPass:
         {
             RenderPassHandle passHandle;
@@ -1037,6 +1059,35 @@ namespace ramses::internal
             scene.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
             break;
         }
+        case ESceneActionId::UpdateDataBufferDelta:
+        {
+            DataBufferHandle handle;
+            uint32_t offsetInBytes = 0;
+            uint32_t dataSizeInBytes = 0;
+            uint32_t deltaSize = 0;
+            const std::byte* delta = nullptr;
+
+            action.read(handle.asMemoryHandleReference());
+            action.read(offsetInBytes);
+            action.read(dataSizeInBytes);
+            action.readWithoutCopy(delta, deltaSize);
+
+            // delta applies on previous content of updated range
+            const GeometryDataBuffer& dataBuffer = scene.getDataBuffer(handle);
+            if (offsetInBytes + dataSizeInBytes > dataBuffer.data.size())
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::UpdateDataBufferDelta: update range exceeds data buffer {} in scene {}", handle, scene.getSceneId());
+                break;
+            }
+            std::vector<std::byte> data(dataBuffer.data.cbegin() + offsetInBytes, dataBuffer.data.cbegin() + offsetInBytes + dataSizeInBytes);
+            if (!BufferDeltaEncoding::Apply({ delta, deltaSize }, absl::MakeSpan(data)))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::UpdateDataBufferDelta: invalid delta for data buffer {} in scene {}", handle, scene.getSceneId());
+                break;
+            }
+            scene.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data.data());
+            break;
+        }
         case ESceneActionId::AllocateUniformBuffer:
         {
             UniformBufferHandle handle;
@@ -1118,6 +1169,43 @@ namespace ramses::internal
             scene.updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
             break;
         }
+        case ESceneActionId::UpdateTextureBufferDelta:
+        {
+            TextureBufferHandle handle;
+            uint32_t mipLevel = 0;
+            uint32_t x = 0;
+            uint32_t y = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t deltaSize = 0;
+            const std::byte* delta = nullptr;
+
+            action.read(handle);
+            action.read(mipLevel);
+            action.read(x);
+            action.read(y);
+            action.read(width);
+            action.read(height);
+            action.readWithoutCopy(delta, deltaSize);
+
+            // delta applies on previous content of updated region
+            const TextureBuffer& textureBuffer = scene.getTextureBuffer(handle);
+            if (mipLevel >= textureBuffer.mipMaps.size() || x + width > textureBuffer.mipMaps[mipLevel].width || y + height > textureBuffer.mipMaps[mipLevel].height)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::UpdateTextureBufferDelta: update region exceeds texture buffer {} in scene {}", handle, scene.getSceneId());
+                break;
+            }
+            std::vector<std::byte> data;
+            const Quad region{ int32_t(x), int32_t(y), int32_t(width), int32_t(height) };
+            BufferDeltaEncoding::ReadTextureRegion(textureBuffer.mipMaps[mipLevel], GetTexelSizeFromFormat(textureBuffer.textureFormat), region, data);
+            if (!BufferDeltaEncoding::Apply({ delta, deltaSize }, absl::MakeSpan(data)))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier::UpdateTextureBufferDelta: invalid delta for texture buffer {} in scene {}", handle, scene.getSceneId());
+                break;
+            }
+            scene.updateTextureBuffer(handle, mipLevel, x, y, width, height, data.data());
+            break;
+        }
         case ESceneActionId::AllocateSceneReference:
         {
             SceneReferenceHandle handle;
@@ -286,6 +286,13 @@ namespace ramses::internal
         collection.write(startVertex);
     }
 
+    void SceneActionCollectionCreator::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableFrustumCulling);
+        collection.write(renderableHandle);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         collection.beginWriteSceneAction(ESceneActionId::SetRenderableDataInstance);
@@ -538,6 +545,13 @@ namespace ramses::internal
         collection.write(pass);
     }
 
+    void SceneActionCollectionCreator::setRenderPassStateSorting(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassStateSorting);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         collection.beginWriteSceneAction(ESceneActionId::AddRenderGroupToRenderPass);
@@ -751,6 +765,15 @@ namespace ramses::internal
         collection.write(data, dataSizeInBytes);
     }
 
+    void SceneActionCollectionCreator::updateDataBufferDelta(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* delta, uint32_t deltaSize)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::UpdateDataBufferDelta);
+        collection.write(handle);
+        collection.write(offsetInBytes);
+        collection.write(dataSizeInBytes);
+        collection.write(delta, deltaSize);
+    }
+
     void SceneActionCollectionCreator::allocateUniformBuffer(uint32_t size, UniformBufferHandle handle)
     {
         collection.beginWriteSceneAction(ESceneActionId::AllocateUniformBuffer);
@@ -803,6 +826,18 @@ namespace ramses::internal
         collection.write(data, dataSize);
     }
 
+    void SceneActionCollectionCreator::updateTextureBufferDelta(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* delta, uint32_t deltaSize)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::UpdateTextureBufferDelta);
+        collection.write(handle);
+        collection.write(mipLevel);
+        collection.write(x);
+        collection.write(y);
+        collection.write(width);
+        collection.write(height);
+        collection.write(delta, deltaSize);
+    }
+
     void SceneActionCollectionCreator::allocateDataSlot(const DataSlot& dataSlot, DataSlotHandle handle)
     {
         collection.beginWriteSceneAction(ESceneActionId::AllocateDataSlot);
@@ -62,6 +62,7 @@ namespace ramses::internal
         void setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible);
         void setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount);
         void setRenderableStartVertex(RenderableHandle renderableHandle, uint32_t startVertex);
+        void setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled);
 
         // Render state allocation
         void allocateRenderState(RenderStateHandle stateHandle);
@@ -146,6 +147,7 @@ namespace ramses::internal
         void setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled);
         void setRenderPassRenderOnce(RenderPassHandle pass, bool enabled);
         void retriggerRenderPassRenderOnce(RenderPassHandle pass);
+        void setRenderPassStateSorting(RenderPassHandle pass, bool enabled);
         void addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order);
         void removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle);
 
@@ -177,6 +179,7 @@ namespace ramses::internal
         void allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle);
         void releaseDataBuffer(DataBufferHandle handle);
         void updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data);
+        void updateDataBufferDelta(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* delta, uint32_t deltaSize);
 
         // Uniform buffers
         void allocateUniformBuffer(uint32_t size, UniformBufferHandle handle);
@@ -187,6 +190,7 @@ namespace ramses::internal
         void allocateTextureBuffer(EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle);
         void releaseTextureBuffer(TextureBufferHandle handle);
         void updateTextureBuffer(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data, uint32_t dataSize);
+        void updateTextureBufferDelta(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* delta, uint32_t deltaSize);
 
         void allocateDataSlot(const DataSlot& dataSlot, DataSlotHandle handle);
         void setDataSlotTexture(DataSlotHandle handle, const ResourceContentHash& texture);
@@ -133,7 +133,11 @@ namespace ramses::internal
         {
             if (source.isRenderableAllocated(r))
             {
-                collector.compoundRenderable(r, source.getRenderable(r));
+                const Renderable& renderable = source.getRenderable(r);
+                collector.compoundRenderable(r, renderable);
+                // not part of compound action to keep its layout stable, default (enabled) is not sent
+                if (!renderable.frustumCulling)
+                    collector.setRenderableFrustumCulling(r, false);
             }
         }
     }
@@ -390,6 +394,8 @@ namespace ramses::internal
                 collector.setRenderPassEnabled(renderPass, rp.isEnabled);
                 if (rp.isRenderOnce)
                     collector.setRenderPassRenderOnce(renderPass, true);
+                if (rp.stateSorting)
+                    collector.setRenderPassStateSorting(renderPass, true);
                 for (const auto& rgEntry : rp.renderGroups)
                     collector.addRenderGroupToRenderPass(renderPass, rgEntry.renderGroup, rgEntry.order);
             }
@@ -24,6 +24,20 @@
 namespace ramses::internal
 {
     static const uint32_t gSceneMarker = 0x534d4152;  // {'R', 'A', 'M', 'S'}
+    // scenes using actions unknown to older loaders of the same feature level are marked differently,
+    // older loaders then reject the file as not being a scene instead of failing on the unknown action
+    static const uint32_t gSceneMarkerExtendedActions = 0x584d4152;  // {'R', 'A', 'M', 'X'}
+
+    static bool UsesExtendedActions(const SceneActionCollection& collection)
+    {
+        for (const auto& reader : collection)
+        {
+            if (reader.type() == ESceneActionId::SetRenderableFrustumCulling ||
+                reader.type() == ESceneActionId::SetRenderPassStateSorting)
+                return true;
+        }
+        return false;
+    }
 
     void ScenePersistation::ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo, EFeatureLevel featureLevel)
     {
@@ -101,7 +115,7 @@ namespace ramses::internal
 
         const std::vector<std::byte>& actionData = collection.collectionData();
 
-        outStream << static_cast<uint32_t>(gSceneMarker);
+        outStream << static_cast<uint32_t>(UsesExtendedActions(collection) ? gSceneMarkerExtendedActions : gSceneMarker);
         outStream << static_cast<uint32_t>(collection.numberOfActions());
         outStream << static_cast<uint32_t>(actionData.size());
 
@@ -135,7 +149,7 @@ namespace ramses::internal
     {
         uint32_t sceneMarker = 0;
         inStream >> sceneMarker;
-        if (sceneMarker != gSceneMarker)
+        if (sceneMarker != gSceneMarker && sceneMarker != gSceneMarkerExtendedActions)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
             return;
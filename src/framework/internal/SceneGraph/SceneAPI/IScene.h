@@ -87,6 +87,7 @@ namespace ramses::internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) = 0;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) = 0;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) = 0;
+        virtual void                        setRenderableFrustumCulling     (RenderableHandle renderableHandle, bool enabled) = 0;
         [[nodiscard]] virtual const Renderable& getRenderable               (RenderableHandle renderableHandle) const = 0;
 
         // Render state
@@ -255,6 +256,7 @@ namespace ramses::internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) = 0;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) = 0;
+        virtual void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) = 0;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) = 0;
         [[nodiscard]] virtual const RenderPass&           getRenderPass     (RenderPassHandle passHandle) const = 0;
@@ -23,6 +23,7 @@ namespace ramses::internal
         glm::vec4              clearColor{ 0.f, 0.f, 0.f, 1.f };
         ClearFlags             clearFlags = EClearFlag::All;
         bool                   isRenderOnce = false;
+        bool                   stateSorting = false;
 
         RenderGroupOrderVector renderGroups;
     };
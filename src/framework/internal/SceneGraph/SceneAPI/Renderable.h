@@ -27,6 +27,7 @@ namespace ramses::internal
         uint32_t indexCount = 0u;
         uint32_t instanceCount = 1u;
         uint32_t startVertex = 0u;
+        bool frustumCulling = true;
 
         std::array<DataInstanceHandle, ERenderableDataSlotType_MAX_SLOTS> dataInstances;
         RenderStateHandle renderState;
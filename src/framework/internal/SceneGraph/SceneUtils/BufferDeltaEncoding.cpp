@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/SceneUtils/BufferDeltaEncoding.h"
+#include "internal/SceneGraph/SceneAPI/TextureBuffer.h"
+#include "internal/PlatformAbstraction/PlatformMemory.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace BufferDeltaEncoding
+    {
+        constexpr size_t RunHeaderSize = 2u * sizeof(uint32_t);
+
+        static void AppendUInt32(std::vector<std::byte>& encoded, size_t value)
+        {
+            const auto value32 = static_cast<uint32_t>(value);
+            const size_t pos = encoded.size();
+            encoded.resize(pos + sizeof(uint32_t));
+            PlatformMemory::Copy(encoded.data() + pos, &value32, sizeof(uint32_t));
+        }
+
+        bool Encode(absl::Span<const std::byte> previous, absl::Span<const std::byte> current, size_t maxEncodedSize, std::vector<std::byte>& encoded)
+        {
+            assert(previous.size() == current.size());
+            encoded.clear();
+
+            const size_t size = current.size();
+            size_t pos = 0u;
+            while (pos < size)
+            {
+                const auto mismatch = std::mismatch(previous.begin() + pos, previous.end(), current.begin() + pos);
+                const auto changedStart = static_cast<size_t>(mismatch.first - previous.begin());
+                if (changedStart == size)
+                    break;
+
+                // changed run ends only where enough bytes stay unchanged to pay for header of next run
+                size_t changedEnd = changedStart + 1u;
+                size_t unchanged = 0u;
+                while (changedEnd + unchanged < size && unchanged < RunHeaderSize)
+                {
+                    if (previous[changedEnd + unchanged] == current[changedEnd + unchanged])
+                    {
+                        ++unchanged;
+                    }
+                    else
+                    {
+                        changedEnd += unchanged + 1u;
+                        unchanged = 0u;
+                    }
+                }
+
+                const size_t changedSize = changedEnd - changedStart;
+                if (encoded.size() + RunHeaderSize + changedSize >= maxEncodedSize)
+                    return false;
+
+                AppendUInt32(encoded, changedStart - pos);
+                AppendUInt32(encoded, changedSize);
+                encoded.insert(encoded.end(), current.begin() + changedStart, current.begin() + changedEnd);
+                pos = changedEnd;
+            }
+
+            return true;
+        }
+
+        bool Apply(absl::Span<const std::byte> delta, absl::Span<std::byte> data)
+        {
+            size_t readPos = 0u;
+            size_t writePos = 0u;
+            while (readPos < delta.size())
+            {
+                if (delta.size() - readPos < RunHeaderSize)
+                    return false;
+
+                uint32_t unchangedSize = 0u;
+                uint32_t changedSize = 0u;
+                PlatformMemory::Copy(&unchangedSize, delta.data() + readPos, sizeof(uint32_t));
+                PlatformMemory::Copy(&changedSize, delta.data() + readPos + sizeof(uint32_t), sizeof(uint32_t));
+                readPos += RunHeaderSize;
+
+                if (changedSize > delta.size() - readPos || unchangedSize > data.size() - writePos || changedSize > data.size() - writePos - unchangedSize)
+                    return false;
+
+                writePos += unchangedSize;
+                PlatformMemory::Copy(data.data() + writePos, delta.data() + readPos, changedSize);
+                writePos += changedSize;
+                readPos += changedSize;
+            }
+
+            return true;
+        }
+
+        void ReadTextureRegion(const MipMap& mip, uint32_t texelSize, const Quad& region, std::vector<std::byte>& regionData)
+        {
+            assert(region.x >= 0 && region.y >= 0);
+            assert(static_cast<uint32_t>(region.x + region.width) <= mip.width && static_cast<uint32_t>(region.y + region.height) <= mip.height);
+
+            const uint32_t regionRowSize = region.width * texelSize;
+            const uint32_t mipLevelRowSize = mip.width * texelSize;
+            regionData.resize(static_cast<size_t>(regionRowSize) * region.height);
+
+            const std::byte* sourcePtr = mip.data.data() + region.x * texelSize + region.y * mipLevelRowSize;
+            std::byte* destinationPtr = regionData.data();
+            for (int32_t i = 0; i < region.height; ++i)
+            {
+                PlatformMemory::Copy(destinationPtr, sourcePtr, regionRowSize);
+                sourcePtr += mipLevelRowSize;
+                destinationPtr += regionRowSize;
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "absl/types/span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    struct MipMap;
+    class Quad;
+
+    // Delta of updated data and texture buffer range against its previous content. Sender and receiver
+    // both hold the previous content in their scene, so only the changed bytes need to be sent.
+    // Encoded as sequence of runs [uint32 unchanged size][uint32 changed size][changed bytes],
+    // unchanged bytes at the end of the range are not encoded.
+    namespace BufferDeltaEncoding
+    {
+        // delta is not worth its overhead for smaller updates
+        constexpr size_t MinDataSize = 64u;
+
+        // fails if encoded delta would not be smaller than maxEncodedSize, encoded is undefined then
+        bool Encode(absl::Span<const std::byte> previous, absl::Span<const std::byte> current, size_t maxEncodedSize, std::vector<std::byte>& encoded);
+        // applies delta on data holding previous content, fails if delta does not fit into data
+        bool Apply(absl::Span<const std::byte> delta, absl::Span<std::byte> data);
+
+        // copies region of mip level into continuous memory, same layout as texture buffer update data
+        void ReadTextureRegion(const MipMap& mip, uint32_t texelSize, const Quad& region, std::vector<std::byte>& regionData);
+    }
+}
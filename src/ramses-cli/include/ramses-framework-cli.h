@@ -26,7 +26,7 @@ namespace ramses
         auto* fw = cli.add_option_group("Framework Options");
         auto* logger = cli.add_option_group("Logger Options");
 
-        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"off", EConnectionSystem::Off}};
+        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"off", EConnectionSystem::Off}, {"shm", EConnectionSystem::SharedMemory}};
         fw->add_option_function<EConnectionSystem>(
             "--connection", [&](const EConnectionSystem value) { config.setConnectionSystem(value); }, "Connection system")
             ->transform(CLI::CheckedTransformer(mapConn, CLI::ignore_case));
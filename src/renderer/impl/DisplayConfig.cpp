@@ -141,6 +141,27 @@ namespace ramses
         return status;
     }
 
+    bool DisplayConfig::setFrustumCullingEnabled(bool enabled)
+    {
+        const auto status = m_impl->setFrustumCullingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    bool DisplayConfig::setAutoInstancingEnabled(bool enabled)
+    {
+        const auto status = m_impl->setAutoInstancingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    bool DisplayConfig::setRenderPreparationThreadCount(uint32_t threadCount)
+    {
+        const auto status = m_impl->setRenderPreparationThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
     void* DisplayConfig::getAndroidNativeWindow() const
     {
         return m_impl->getAndroidNativeWindow();
@@ -222,6 +222,24 @@ namespace ramses::internal
         return true;
     }
 
+    bool DisplayConfigImpl::setFrustumCullingEnabled(bool enabled)
+    {
+        m_internalConfig.setFrustumCullingEnabled(enabled);
+        return true;
+    }
+
+    bool DisplayConfigImpl::setAutoInstancingEnabled(bool enabled)
+    {
+        m_internalConfig.setAutoInstancingEnabled(enabled);
+        return true;
+    }
+
+    bool DisplayConfigImpl::setRenderPreparationThreadCount(uint32_t threadCount)
+    {
+        m_internalConfig.setRenderPreparationThreadCount(threadCount);
+        return true;
+    }
+
     bool DisplayConfigImpl::setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname)
     {
         m_internalConfig.setWaylandEmbeddedCompositingSocketGroup(groupname);
@@ -58,6 +58,9 @@ namespace ramses::internal
         [[nodiscard]] bool setWindowsWindowHandle(void* hwnd);
         [[nodiscard]] void*    getWindowsWindowHandle() const;
         [[nodiscard]] bool setAsyncEffectUploadEnabled(bool enabled);
+        [[nodiscard]] bool setFrustumCullingEnabled(bool enabled);
+        [[nodiscard]] bool setAutoInstancingEnabled(bool enabled);
+        [[nodiscard]] bool setRenderPreparationThreadCount(uint32_t threadCount);
 
         [[nodiscard]] bool setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname);
         [[nodiscard]] std::string_view getWaylandSocketEmbeddedGroup() const;
@@ -47,6 +47,7 @@ namespace ramses::internal
         , m_periodicLogSupplier(framework.getPeriodicLogger(), m_rendererCommandBuffer)
     {
         assert(!framework.isConnected());
+        m_displayDispatcher->setFlushTracer(framework.getFlushTracer());
 
         { //Add ramsh commands to ramsh, independent of whether it is enabled or not.
             m_ramshCommands.push_back(std::make_shared<Screenshot>(m_rendererCommandBuffer));
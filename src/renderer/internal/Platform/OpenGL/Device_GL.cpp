@@ -12,11 +12,13 @@
 #include "internal/RendererLib/PlatformBase/RenderBufferGPUResource.h"
 #include "internal/RendererLib/PlatformBase/IndexBufferGPUResource.h"
 #include "internal/RendererLib/PlatformBase/VertexArrayGPUResource.h"
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
 
 #include "internal/Platform/OpenGL/Device_GL_platform.h"
 #include "internal/Platform/OpenGL/ShaderGPUResource_GL.h"
 #include "internal/Platform/OpenGL/ShaderUploader_GL.h"
 #include "internal/Platform/OpenGL/ShaderProgramInfo.h"
+#include "internal/Platform/OpenGL/StreamingBuffer_GL.h"
 #include "internal/Platform/OpenGL/TypesConversion_GL.h"
 
 #include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
@@ -115,6 +117,13 @@ namespace ramses::internal
         for (const auto& it : m_textureSamplerObjectsCache)
             deleteTextureSampler(it.second);
 
+        if (m_instanceDataBuffer != InvalidGLHandle)
+            glDeleteBuffers(1, &m_instanceDataBuffer);
+        if (m_autoUniformBufferHandle != InvalidGLHandle)
+            glDeleteBuffers(1, &m_autoUniformBufferHandle);
+        m_streamingBuffer.reset();
+        m_instancedShaders.clear();
+
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -161,15 +170,19 @@ namespace ramses::internal
             LOG_ERROR(CONTEXT_RENDERER, "Device_GL::drawIndexedTriangles: index buffer access out of bounds "
                 "[drawStartOffset={} drawElementCount={} IndexBufferElementCount={}]",
                 startOffset, elementCount, m_activeIndexArraySizeBytes / m_activeIndexArrayElementSizeBytes);
+            disableInstanceAttributes();
             return;
         }
 
         const size_t startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
         const GLvoid* startOffsetAddress = reinterpret_cast<void*>(startOffsetAddressAsUInt);
 
+        bindAutoUniformBuffer();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         const GLenum elementTypeGL = TypesConversion_GL::GetIndexElementType(m_activeIndexArrayElementSizeBytes);
         glDrawElementsInstanced(drawModeGL, elementCount, elementTypeGL, startOffsetAddress, static_cast<GLsizei>(instanceCount));
+        disableInstanceAttributes();
 
         // For profiling/tests
         Device_Base::drawIndexedTriangles(startOffset, elementCount, instanceCount);
@@ -177,13 +190,24 @@ namespace ramses::internal
 
     void Device_GL::drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount)
     {
+        bindAutoUniformBuffer();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         glDrawArraysInstanced(drawModeGL, startOffset, elementCount, static_cast<GLsizei>(instanceCount));
+        disableInstanceAttributes();
 
         // For profiling/tests
         Device_Base::drawTriangles(startOffset, elementCount, instanceCount);
     }
 
+    void Device_GL::disableInstanceAttributes()
+    {
+        // instance attributes were enabled on vertex array of the renderable which must stay usable with non-instanced shader
+        for (const auto location : m_enabledInstanceAttributes)
+            glDisableVertexAttribArray(location);
+        m_enabledInstanceAttributes.clear();
+    }
+
     void Device_GL::clear(ClearFlags clearFlags)
     {
         GLbitfield deviceClearFlags = 0;
@@ -403,38 +427,53 @@ namespace ramses::internal
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const float* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(float)))
             glUniform1fv(uniformLocation.getValue(), static_cast<GLsizei>(count), value);
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec2* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::vec2)))
             glUniform2fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec3* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::vec3)))
             glUniform3fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec4* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::vec4)))
             glUniform4fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const bool* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         // GL does not provide native bool on its API but it is a common practice to use integer for setting bool uniforms
         m_containerForBoolValues.assign(count, 0);
         for (uint32_t i = 0; i < count; ++i)
@@ -444,67 +483,166 @@ namespace ramses::internal
         }
 
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, m_containerForBoolValues.data(), count * sizeof(GLint)))
             glUniform1iv(uniformLocation.getValue(), static_cast<GLsizei>(count), m_containerForBoolValues.data());
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const int32_t* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(int32_t)))
             glUniform1iv(uniformLocation.getValue(), static_cast<GLsizei>(count), value);
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec2* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::ivec2)))
             glUniform2iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec3* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::ivec3)))
             glUniform3iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec4* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::ivec4)))
             glUniform4iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat2* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::mat2)))
             glUniformMatrix2fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat3* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::mat3)))
             glUniformMatrix3fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat4* value)
     {
+        if (const auto* autoUniformField = m_activeShader->getAutoUniformBufferField(field))
+            return setAutoUniformBufferValues(*autoUniformField, count, value);
+
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && isUniformValueChanged(uniformLocation, value, count * sizeof(glm::mat4)))
             glUniformMatrix4fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
+    bool Device_GL::isUniformValueChanged(GLInputLocation uniformLocation, const void* value, size_t size)
+    {
+        assert(m_activeUniformShadowCache != nullptr);
+        if (m_activeUniformShadowCache->update(uniformLocation.getValue(), value, size))
+        {
+            ++m_uniformUpdatesIssued;
+            return true;
+        }
+
+        ++m_uniformUpdatesSkipped;
+        return false;
+    }
+
+    template <typename T>
+    bool Device_GL::setAutoUniformBufferValues(const AutoUniformBuffer::Field& field, uint32_t count, const T* values)
+    {
+        assert(m_activeAutoUniformBufferState != nullptr);
+        if (AutoUniformBuffer::WriteValues(m_activeAutoUniformBufferState->values.data(), field, count, values))
+        {
+            // values are uploaded with next draw call, possibly to range shared with other programs or renderables using same values
+            m_activeAutoUniformBufferState->dirty = true;
+            ++m_uniformUpdatesIssued;
+        }
+        else
+        {
+            ++m_uniformUpdatesSkipped;
+        }
+        return true;
+    }
+
+    void Device_GL::bindAutoUniformBuffer()
+    {
+        const AutoUniformBuffer::Layout* layout = m_activeShader->getAutoUniformBufferLayout();
+        if (layout == nullptr)
+            return;
+
+        if (!m_autoUniformBufferPool)
+        {
+            GLint offsetAlignment = 0;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+            m_autoUniformBufferPool = std::make_unique<UniformBufferPool>(AutoUniformBufferPoolCapacity, std::max(static_cast<uint32_t>(offsetAlignment), 16u));
+            m_autoUniformBufferHandle = AllocateBufferStorage(AutoUniformBufferPoolCapacity, GL_DYNAMIC_DRAW);
+        }
+
+        // block is only looked up in pool if values changed or pool was reset since, unchanged draws only check the binding
+        auto& state = *m_activeAutoUniformBufferState;
+        if (state.dirty || state.poolGeneration != m_autoUniformBufferPool->getGeneration())
+        {
+            auto range = m_autoUniformBufferPool->allocate(state.values.data(), layout->size);
+            if (!range)
+            {
+                // pool is full, all ranges are released at once and storage is re-specified,
+                // driver can then provide new storage without waiting for pending draw calls reading the old one
+                m_autoUniformBufferPool->reset();
+                glBindBuffer(GL_COPY_WRITE_BUFFER, m_autoUniformBufferHandle);
+                glBufferData(GL_COPY_WRITE_BUFFER, AutoUniformBufferPoolCapacity, nullptr, GL_DYNAMIC_DRAW);
+                m_boundAutoUniformBufferRange.reset();
+
+                range = m_autoUniformBufferPool->allocate(state.values.data(), layout->size);
+                assert(range);
+            }
+
+            if (range->isNew)
+                uploadBufferData(m_autoUniformBufferHandle, state.values.data(), layout->size, range->offset, true);
+            state.dirty = false;
+            state.poolGeneration = m_autoUniformBufferPool->getGeneration();
+            state.poolOffset = range->offset;
+        }
+
+        const BoundUniformBufferRange boundRange{ layout->binding.getValue(), state.poolOffset, layout->size };
+        if (!m_boundAutoUniformBufferRange || m_boundAutoUniformBufferRange->binding != boundRange.binding
+            || m_boundAutoUniformBufferRange->offset != boundRange.offset || m_boundAutoUniformBufferRange->size != boundRange.size)
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, boundRange.binding, m_autoUniformBufferHandle, boundRange.offset, boundRange.size);
+            m_boundAutoUniformBufferRange = boundRange;
+        }
+    }
+
     DeviceResourceHandle Device_GL::allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
         const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_2D);
@@ -1118,9 +1256,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateUniformBuffer(uint32_t totalSizeInBytes)
     {
-        GLHandle glAddress = InvalidGLHandle;
-        glGenBuffers(1, &glAddress);
-        assert(glAddress != InvalidGLHandle);
+        const GLHandle glAddress = AllocateBufferStorage(totalSizeInBytes, GL_DYNAMIC_DRAW);
 
         return m_resourceMapper.registerResource(std::make_unique<GPUResource>(glAddress, totalSizeInBytes));
     }
@@ -1130,8 +1266,7 @@ namespace ramses::internal
         const auto& uniformBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= uniformBuffer.getTotalSizeInBytes());
 
-        glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.getGPUAddress());
-        glBufferData(GL_UNIFORM_BUFFER, dataSize, data, GL_DYNAMIC_DRAW);
+        uploadBufferData(uniformBuffer.getGPUAddress(), data, dataSize, 0u, true);
     }
 
     void Device_GL::activateUniformBuffer(DeviceResourceHandle handle, DataFieldHandle field)
@@ -1139,6 +1274,8 @@ namespace ramses::internal
         const auto& uniformBufferResource = m_resourceMapper.getResourceAs<const GPUResource>(handle);
         const auto uniformBufferBinding = m_activeShader->getUniformBufferBinding(field);
         glBindBufferBase(GL_UNIFORM_BUFFER, uniformBufferBinding.getValue(), uniformBufferResource.getGPUAddress());
+        if (m_boundAutoUniformBufferRange && m_boundAutoUniformBufferRange->binding == uniformBufferBinding.getValue())
+            m_boundAutoUniformBufferRange.reset();
     }
 
     void Device_GL::deleteUniformBuffer(DeviceResourceHandle handle)
@@ -1150,9 +1287,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateVertexBuffer(uint32_t totalSizeInBytes)
     {
-        GLHandle glAddress = InvalidGLHandle;
-        glGenBuffers(1, &glAddress);
-        assert(glAddress != InvalidGLHandle);
+        const GLHandle glAddress = AllocateBufferStorage(totalSizeInBytes, GL_STATIC_DRAW);
 
         return m_resourceMapper.registerResource(std::make_unique<GPUResource>(glAddress, totalSizeInBytes));
     }
@@ -1162,9 +1297,7 @@ namespace ramses::internal
         const auto& vertexBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= vertexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
-        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getGPUAddress());
-        glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
+        uploadBufferData(vertexBuffer.getGPUAddress(), data, dataSize);
     }
 
     void Device_GL::deleteVertexBuffer(DeviceResourceHandle handle)
@@ -1256,10 +1389,8 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes)
     {
-        GLHandle glAddress = InvalidGLHandle;
-        glGenBuffers(1, &glAddress);
-        assert(glAddress != InvalidGLHandle);
         assert(dataType == EDataType::UInt16 || dataType == EDataType::UInt32);
+        const GLHandle glAddress = AllocateBufferStorage(sizeInBytes, GL_STATIC_DRAW);
 
         return m_resourceMapper.registerResource(std::make_unique<IndexBufferGPUResource>(glAddress, sizeInBytes, dataType == EDataType::UInt16 ? 2 : 4));
     }
@@ -1269,9 +1400,7 @@ namespace ramses::internal
         const auto& indexBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= indexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
+        uploadBufferData(indexBuffer.getGPUAddress(), data, dataSize);
     }
 
     void Device_GL::deleteIndexBuffer(DeviceResourceHandle handle)
@@ -1281,10 +1410,66 @@ namespace ramses::internal
         m_resourceMapper.deleteResource(handle);
     }
 
+    GLHandle Device_GL::AllocateBufferStorage(uint32_t sizeInBytes, GLenum usage)
+    {
+        GLHandle glAddress = InvalidGLHandle;
+        glGenBuffers(1, &glAddress);
+        assert(glAddress != InvalidGLHandle);
+
+        // storage is specified only once, data updates do not re-specify it (which would cause implicit synchronization)
+        // copy write binding point is used so that no VAO state is affected
+        glBindBuffer(GL_COPY_WRITE_BUFFER, glAddress);
+        glBufferData(GL_COPY_WRITE_BUFFER, sizeInBytes, nullptr, usage);
+
+        return glAddress;
+    }
+
+    void Device_GL::uploadBufferData(GLHandle buffer, const std::byte* data, uint32_t dataSize, uint32_t offset, bool streaming)
+    {
+        if (dataSize == 0u)
+            return;
+
+        // small updates of rarely changing buffers are cheaper to be copied by driver directly
+        if (streaming || dataSize >= StagingSizeThreshold)
+        {
+            if (!m_streamingBuffer)
+            {
+                StreamingBuffer_GL::BufferStorageFunc bufferStorage = nullptr;
+                if (!m_bufferStorageProcName.empty())
+                    bufferStorage = reinterpret_cast<StreamingBuffer_GL::BufferStorageFunc>(m_context.getGlProcLoadFunc()(m_bufferStorageProcName.data()));
+                m_streamingBuffer = std::make_unique<StreamingBuffer_GL>(StreamingBufferCapacity, bufferStorage);
+            }
+
+            if (m_streamingBuffer->upload(buffer, data, dataSize, offset))
+                return;
+            // staging memory could not be mapped, error was logged already
+        }
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, offset, dataSize, data);
+    }
+
     std::unique_ptr<const GPUResource> Device_GL::uploadShader(const EffectResource& shader)
     {
         ShaderProgramInfo programInfo;
         std::string debugErrorLog;
+
+        // variant with non-semantic uniforms packed into uniform block is preferred if effect qualifies
+        if (const auto autoUniformBufferLayout = AutoUniformBuffer::CreateLayout(shader))
+        {
+            if (const auto packedEffect = AutoUniformBuffer::CreatePackedEffect(shader, *autoUniformBufferLayout))
+            {
+                // resource is created for original effect, packed layout is derived from it again and verified against the program
+                if (ShaderUploader_GL::UploadShaderProgramFromSource(*packedEffect, programInfo, debugErrorLog))
+                    return std::make_unique<const ShaderGPUResource_GL>(shader, programInfo);
+
+                LOG_WARN(CONTEXT_RENDERER, "Device_GL::uploadShader: effect '{}' with uniforms packed in uniform block failed to compile, uniforms will be set individually: {}",
+                    shader.getName(), debugErrorLog);
+                programInfo = {};
+                debugErrorLog.clear();
+            }
+        }
+
         const bool uploadSuccessful = ShaderUploader_GL::UploadShaderProgramFromSource(shader, programInfo, debugErrorLog);
 
         if (uploadSuccessful)
@@ -1327,19 +1512,91 @@ namespace ramses::internal
     void Device_GL::deleteShader(DeviceResourceHandle handle)
     {
         const auto& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
-        if (m_activeShader == &shaderProgramGL)
+        const auto instancedShaderIt = m_instancedShaders.find(&shaderProgramGL);
+        if (instancedShaderIt != m_instancedShaders.end())
         {
-            m_activeShader = nullptr;
+            if (instancedShaderIt->second)
+                dropShaderState(*instancedShaderIt->second);
+            m_instancedShaders.erase(instancedShaderIt);
         }
+        dropShaderState(shaderProgramGL);
 
         m_resourceMapper.deleteResource(handle);
     }
 
     void Device_GL::activateShader(DeviceResourceHandle handle)
+    {
+        setActiveShader(m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle));
+    }
+
+    bool Device_GL::activateInstancedShader(DeviceResourceHandle handle)
     {
         const auto& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
-        glUseProgram(shaderProgramGL.getGPUAddress());
-        m_activeShader = &shaderProgramGL;
+        auto instancedShaderIt = m_instancedShaders.find(&shaderProgramGL);
+        // compiling is not tried again if it failed
+        if (instancedShaderIt == m_instancedShaders.end())
+            instancedShaderIt = m_instancedShaders.emplace(&shaderProgramGL, shaderProgramGL.createInstancedVariant()).first;
+        if (!instancedShaderIt->second)
+            return false;
+
+        setActiveShader(*instancedShaderIt->second);
+        return true;
+    }
+
+    void Device_GL::setActiveShader(const ShaderGPUResource_GL& shader)
+    {
+        glUseProgram(shader.getGPUAddress());
+        m_activeShader = &shader;
+        m_activeUniformShadowCache = &m_uniformShadowCaches[m_activeShader];
+
+        m_activeAutoUniformBufferState = nullptr;
+        if (const AutoUniformBuffer::Layout* layout = shader.getAutoUniformBufferLayout())
+        {
+            m_activeAutoUniformBufferState = &m_autoUniformBufferStates[m_activeShader];
+            m_activeAutoUniformBufferState->values.resize(layout->size);
+        }
+    }
+
+    void Device_GL::dropShaderState(const ShaderGPUResource_GL& shader)
+    {
+        if (m_activeShader == &shader)
+        {
+            m_activeShader = nullptr;
+            m_activeUniformShadowCache = nullptr;
+            m_activeAutoUniformBufferState = nullptr;
+        }
+        m_uniformShadowCaches.erase(&shader);
+        m_autoUniformBufferStates.erase(&shader);
+    }
+
+    void Device_GL::uploadInstanceData(const std::byte* data, uint32_t dataSize)
+    {
+        assert(m_activeShader != nullptr && m_activeShader->getInstanceDataStride() > 0u);
+        if (m_instanceDataBuffer == InvalidGLHandle)
+            glGenBuffers(1, &m_instanceDataBuffer);
+
+        // re-specifying the whole buffer lets driver allocate new storage instead of waiting for previous draw calls using it
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceDataBuffer);
+        glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STREAM_DRAW);
+
+        const auto stride = static_cast<GLsizei>(m_activeShader->getInstanceDataStride());
+        for (const auto& attribute : m_activeShader->getInstanceAttributes())
+        {
+            if (!attribute.location.isValid())
+                continue;
+
+            for (uint32_t column = 0u; column < attribute.numColumns; ++column)
+            {
+                const auto location = static_cast<GLuint>(attribute.location.getValue()) + column;
+                const std::intptr_t offsetInBytes = attribute.offset + column * attribute.numColumns * sizeof(float);
+                glEnableVertexAttribArray(location);
+                glVertexAttribPointer(location, static_cast<GLint>(attribute.numColumns), GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offsetInBytes));
+                glVertexAttribDivisor(location, 1u);
+                m_enabledInstanceAttributes.push_back(location);
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0u);
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
@@ -1523,6 +1780,19 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, fmt::format("Device_GL::queryDeviceDependentFeatures: External textures support = {}", externalTexturesSupported));
 
         m_limits.setExternalTextureExtensionSupported(externalTexturesSupported);
+
+        // immutable buffer storage is not part of loaded GLES 3.2 API, it allows staging memory of buffer updates to stay mapped
+        GLint numExtensions = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+        for (GLint i = 0; i < numExtensions && m_bufferStorageProcName.empty(); ++i)
+        {
+            const std::string_view extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            if (extension == "GL_EXT_buffer_storage")
+                m_bufferStorageProcName = "glBufferStorageEXT";
+            else if (extension == "GL_ARB_buffer_storage")
+                m_bufferStorageProcName = "glBufferStorage";
+        }
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::queryDeviceDependentFeatures: Immutable buffer storage support = {}", !m_bufferStorageProcName.empty());
     }
 
     void Device_GL::readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
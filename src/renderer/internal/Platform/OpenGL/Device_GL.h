@@ -13,14 +13,21 @@
 #include "Types_GL.h"
 #include "DebugOutput.h"
 #include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
+#include "internal/RendererLib/AutoUniformBuffer.h"
+#include "internal/RendererLib/PlatformBase/UniformShadowCache.h"
 
 #include <unordered_map>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <mutex>
+#include <optional>
 
 namespace ramses::internal
 {
     class ShaderGPUResource_GL;
+    class StreamingBuffer_GL;
+    class UniformBufferPool;
     class RenderBufferGPUResource;
     class IDeviceExtension;
     struct GLTextureInfo;
@@ -91,6 +98,8 @@ namespace ramses::internal
         bool                    getBinaryShader     (DeviceResourceHandle handleconst, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         void                    deleteShader        (DeviceResourceHandle handle) override;
         void                    activateShader      (DeviceResourceHandle handle) override;
+        bool                    activateInstancedShader(DeviceResourceHandle handle) override;
+        void                    uploadInstanceData  (const std::byte* data, uint32_t dataSize) override;
 
         DeviceResourceHandle    allocateTexture2D   (uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) override;
         DeviceResourceHandle    allocateTexture3D   (uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes) override;
@@ -152,9 +161,42 @@ namespace ramses::internal
 
         // Active states for upcoming draw call(s)
         const ShaderGPUResource_GL* m_activeShader = nullptr;
+        UniformShadowCache*         m_activeUniformShadowCache = nullptr;
+        struct AutoUniformBufferState;
+        AutoUniformBufferState*     m_activeAutoUniformBufferState = nullptr;
         EDrawMode                   m_activePrimitiveDrawMode = EDrawMode::Points;
         uint32_t                    m_activeIndexArrayElementSizeBytes = 0u;
         uint32_t                    m_activeIndexArraySizeBytes = 0u;
+        std::vector<uint32_t>       m_enabledInstanceAttributes;
+
+        GLHandle                    m_instanceDataBuffer = InvalidGLHandle;
+        // staging memory for buffer data updates, sized to hold several frames of large dynamic data buffers in flight
+        static constexpr uint32_t StreamingBufferCapacity = 8u * 1024u * 1024u;
+        static constexpr uint32_t StagingSizeThreshold = 16u * 1024u;
+        std::unique_ptr<StreamingBuffer_GL> m_streamingBuffer;
+        // name of glBufferStorage function to query from context, empty if immutable buffer storage is not supported
+        std::string_view m_bufferStorageProcName;
+
+        // ranges of automatic uniform buffers (see AutoUniformBuffer) are sub-allocated from single buffer
+        static constexpr uint32_t AutoUniformBufferPoolCapacity = 1024u * 1024u;
+        std::unique_ptr<UniformBufferPool> m_autoUniformBufferPool;
+        GLHandle                    m_autoUniformBufferHandle = InvalidGLHandle;
+        struct BoundUniformBufferRange
+        {
+            uint32_t binding = 0u;
+            uint32_t offset = 0u;
+            uint32_t size = 0u;
+        };
+        std::optional<BoundUniformBufferRange> m_boundAutoUniformBufferRange;
+        // values of packed uniforms are program state as well, one block per program (incl. instanced variants)
+        struct AutoUniformBufferState
+        {
+            std::vector<std::byte> values;  // block data in std140 layout
+            bool dirty = true;              // values changed since they were placed in pool
+            uint32_t poolGeneration = 0u;   // generation of pool holding values at poolOffset
+            uint32_t poolOffset = 0u;
+        };
+        std::unordered_map<const ShaderGPUResource_GL*, AutoUniformBufferState> m_autoUniformBufferStates;
 
         DebugOutput                 m_debugOutput;
         std::vector<GLint>          m_supportedBinaryProgramFormats;
@@ -163,15 +205,29 @@ namespace ramses::internal
         std::vector<GLint>          m_containerForBoolValues;
 
         std::unordered_map<uint64_t, DeviceResourceHandle> m_textureSamplerObjectsCache;
+        // uniform values are program state, one shadow cache per program (incl. instanced variants), dropped when program is deleted
+        std::unordered_map<const ShaderGPUResource_GL*, UniformShadowCache> m_uniformShadowCaches;
+        // instanced variants of programs (see AutoInstancing) are compiled on first use, nullptr if program cannot be instanced
+        std::unordered_map<const ShaderGPUResource_GL*, std::unique_ptr<const ShaderGPUResource_GL>> m_instancedShaders;
 
         static std::mutex s_gladMutex;
 
+        void disableInstanceAttributes();
+        // streaming uploads (buffers updated often, e.g. uniform buffers) and large uploads go through staging memory
+        void uploadBufferData(GLHandle buffer, const std::byte* data, uint32_t dataSize, uint32_t offset = 0u, bool streaming = false);
+        static GLHandle AllocateBufferStorage(uint32_t sizeInBytes, GLenum usage);
         bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
         static void BindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, size_t colorBufferSlot);
         static void BindReadWriteRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle, bool multiSample);
         static void BindWriteOnlyRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle);
         GLHandle createTexture(uint32_t width, uint32_t height, EPixelStorageFormat storageFormat, uint32_t sampleCount) const;
         static GLHandle CreateRenderBuffer(uint32_t width, uint32_t height, EPixelStorageFormat format, uint32_t sampleCount);
+        bool isUniformValueChanged(GLInputLocation uniformLocation, const void* value, size_t size);
+        template <typename T>
+        bool setAutoUniformBufferValues(const AutoUniformBuffer::Field& field, uint32_t count, const T* values);
+        void bindAutoUniformBuffer();
+        void setActiveShader(const ShaderGPUResource_GL& shader);
+        void dropShaderState(const ShaderGPUResource_GL& shader);
 
         DeviceResourceHandle    uploadTextureSampler(const TextureSamplerStates& samplerStates);
         void                    deleteTextureSampler(DeviceResourceHandle handle);
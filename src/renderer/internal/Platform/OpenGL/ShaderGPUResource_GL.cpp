@@ -8,6 +8,8 @@
 
 #include "internal/Platform/OpenGL/ShaderGPUResource_GL.h"
 #include "internal/Platform/OpenGL/Device_GL_platform.h"
+#include "internal/Platform/OpenGL/ShaderUploader_GL.h"
+#include "internal/RendererLib/AutoInstancing.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
 #include "internal/Core/Utils/LogMacros.h"
 
@@ -17,7 +19,21 @@ namespace ramses::internal
         : ShaderGPUResource(shaderProgramInfo.shaderProgramHandle)
         , m_shaderProgramInfo(std::move(shaderProgramInfo))
     {
-        init(effect);
+        init(effect, false);
+
+        // keep only what is needed to compile instanced variant later, most shaders will never need it
+        if (auto instancedVertexShader = AutoInstancing::CreateInstancedVertexShader(effect))
+        {
+            m_instancedEffect = std::make_unique<const EffectResource>(*instancedVertexShader, effect.getFragmentShader(), effect.getGeometryShader(), SPIRVShaders{},
+                effect.getGeometryShaderInputType(), effect.getUniformInputs(), effect.getAttributeInputs(), effect.getName(), EFeatureLevel_Latest);
+        }
+    }
+
+    ShaderGPUResource_GL::ShaderGPUResource_GL(const EffectResource& instancedEffect, ShaderProgramInfo shaderProgramInfo, InstancedVariantTag /*unused*/)
+        : ShaderGPUResource(shaderProgramInfo.shaderProgramHandle)
+        , m_shaderProgramInfo(std::move(shaderProgramInfo))
+    {
+        init(instancedEffect, true);
     }
 
     ShaderGPUResource_GL::~ShaderGPUResource_GL()
@@ -48,6 +64,82 @@ namespace ramses::internal
         return m_uniformLocationMap[field.asMemoryHandle()];
     }
 
+    const AutoUniformBuffer::Layout* ShaderGPUResource_GL::getAutoUniformBufferLayout() const
+    {
+        return m_autoUniformBufferLayout ? &*m_autoUniformBufferLayout : nullptr;
+    }
+
+    const AutoUniformBuffer::Field* ShaderGPUResource_GL::getAutoUniformBufferField(DataFieldHandle field) const
+    {
+        if (!m_autoUniformBufferLayout)
+            return nullptr;
+
+        assert(field.asMemoryHandle() < m_autoUniformBufferLayout->fields.size());
+        const auto& packedField = m_autoUniformBufferLayout->fields[field.asMemoryHandle()];
+        return packedField ? &*packedField : nullptr;
+    }
+
+    const std::vector<InstanceAttribute>& ShaderGPUResource_GL::getInstanceAttributes() const
+    {
+        return m_instanceAttributes;
+    }
+
+    uint32_t ShaderGPUResource_GL::getInstanceDataStride() const
+    {
+        return m_instanceDataStride;
+    }
+
+    std::unique_ptr<const ShaderGPUResource_GL> ShaderGPUResource_GL::createInstancedVariant() const
+    {
+        if (!m_instancedEffect)
+            return nullptr;
+        const EffectResource& instancedEffect = *m_instancedEffect;
+
+        // variant must use same attribute locations so that vertex arrays created for this shader can be used with it,
+        // instance attributes are placed after them
+        ShaderUploader_GL::AttributeLocations attributeLocations;
+        GLint nextFreeLocation = 0;
+        const EffectInputInformationVector& attributeInputs = instancedEffect.getAttributeInputs();
+        for (size_t i = 0u; i < attributeInputs.size(); ++i)
+        {
+            const GLInputLocation location = m_attributeLocationMap[i];
+            if (location.isValid())
+            {
+                attributeLocations.emplace_back(attributeInputs[i].inputName, location.getValue());
+                nextFreeLocation = std::max(nextFreeLocation, location.getValue() + 1);
+            }
+        }
+
+        for (const auto& input : instancedEffect.getUniformInputs())
+        {
+            if (AutoInstancing::IsPerInstanceSemantic(input.semantics) && !EffectInputInformation::IsUniformBufferField(input))
+            {
+                attributeLocations.emplace_back(input.inputName, nextFreeLocation);
+                nextFreeLocation += (input.dataType == EDataType::Matrix44F ? 4 : 3);
+            }
+        }
+
+        GLint maxVertexAttributes = 0;
+        glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxVertexAttributes);
+        if (nextFreeLocation > maxVertexAttributes)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "ShaderGPUResource_GL::createInstancedVariant: effect '{}' cannot be instanced, needs {} vertex attribute locations (max {})",
+                instancedEffect.getName(), nextFreeLocation, maxVertexAttributes);
+            return nullptr;
+        }
+
+        ShaderProgramInfo programInfo;
+        std::string debugErrorLog;
+        if (!ShaderUploader_GL::UploadShaderProgramFromSource(instancedEffect, programInfo, debugErrorLog, attributeLocations))
+        {
+            LOG_WARN(CONTEXT_RENDERER, "ShaderGPUResource_GL::createInstancedVariant: instanced variant of effect '{}' failed to compile, it will be rendered without instancing: {}",
+                instancedEffect.getName(), debugErrorLog);
+            return nullptr;
+        }
+
+        return std::unique_ptr<const ShaderGPUResource_GL>(new ShaderGPUResource_GL(instancedEffect, std::move(programInfo), InstancedVariantTag{}));
+    }
+
     GLInputLocation ShaderGPUResource_GL::getAttributeLocation(DataFieldHandle field) const
     {
         assert(field.asMemoryHandle() < m_attributeLocationMap.size());
@@ -71,7 +163,7 @@ namespace ramses::internal
         return uboBinding;
     }
 
-    void ShaderGPUResource_GL::init(const EffectResource& effect)
+    void ShaderGPUResource_GL::init(const EffectResource& effect, bool instancedVariant)
     {
         const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
         const EffectInputInformationVector& attributeInputs = effect.getAttributeInputs();
@@ -86,6 +178,12 @@ namespace ramses::internal
         for (uint32_t i = 0u; i < vertexInputCount; ++i)
             m_attributeLocationMap.push_back(loadAttributeLocation(effect, attributeInputs[i]));
 
+        // program can be compiled without the block even if effect qualifies (e.g. packed variant failed to compile or binary program
+        // was created by other renderer version), uniforms are then set individually
+        m_autoUniformBufferLayout = AutoUniformBuffer::CreateLayout(effect);
+        if (m_autoUniformBufferLayout && glGetUniformBlockIndex(m_shaderProgramInfo.shaderProgramHandle, AutoUniformBuffer::BlockName.data()) == GL_INVALID_INDEX)
+            m_autoUniformBufferLayout.reset();
+
         TextureSlot slotCounter = 0; // texture unit 0
         for (const auto& input : uniformInputs)
         {
@@ -102,9 +200,20 @@ namespace ramses::internal
                 m_uniformLocationMap.emplace_back(GLInputLocation{});
                 m_uniformBufferBindings.push_back(input.uniformBufferBinding);
             }
+            else if (instancedVariant && AutoInstancing::IsPerInstanceSemantic(input.semantics) && !EffectInputInformation::IsUniformBufferField(input))
+            {
+                // provided per instance as vertex attribute, instance data is packed in order of uniform inputs
+                const uint32_t numColumns = (input.dataType == EDataType::Matrix44F ? 4u : 3u);
+                m_instanceAttributes.push_back({ loadAttributeLocation(effect, input), numColumns, m_instanceDataStride });
+                m_instanceDataStride += numColumns * numColumns * static_cast<uint32_t>(sizeof(float));
+
+                m_uniformLocationMap.emplace_back(GLInputLocation{});
+                m_uniformBufferBindings.emplace_back(UniformBufferBinding{});
+            }
             else if (!EffectInputInformation::IsUniformBufferField(input))
             {
-                m_uniformLocationMap.push_back(loadUniformLocation(effect, input));
+                const bool isPacked = (m_autoUniformBufferLayout && m_autoUniformBufferLayout->fields[m_uniformLocationMap.size()]);
+                m_uniformLocationMap.push_back(isPacked ? GLInputLocation{} : loadUniformLocation(effect, input));
                 m_uniformBufferBindings.emplace_back(UniformBufferBinding{});
             }
         }
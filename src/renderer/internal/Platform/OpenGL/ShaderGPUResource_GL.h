@@ -9,9 +9,12 @@
 #pragma once
 
 #include "internal/RendererLib/PlatformBase/ShaderGPUResource.h"
+#include "internal/RendererLib/AutoUniformBuffer.h"
 #include "internal/Platform/OpenGL/ShaderProgramInfo.h"
 #include "internal/SceneGraph/Resource/EffectInputInformation.h"
 
+#include <memory>
+
 namespace ramses::internal
 {
     class EffectResource;
@@ -27,6 +30,13 @@ namespace ramses::internal
         EEffectInputTextureType textureType{EEffectInputTextureType_Invalid};
     };
 
+    struct InstanceAttribute
+    {
+        GLInputLocation location;
+        uint32_t numColumns = 0u;   // matrix attribute occupies one location per column
+        uint32_t offset = 0u;       // in bytes within data of single instance
+    };
+
     class ShaderGPUResource_GL final : public ShaderGPUResource
     {
     public:
@@ -40,8 +50,22 @@ namespace ramses::internal
 
         [[nodiscard]] bool                getBinaryInfo(std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
+        // uniforms packed into uniform block (see AutoUniformBuffer), their values are program state kept by device,
+        // layout is nullptr and fields are not packed if program was not compiled with the block
+        [[nodiscard]] const AutoUniformBuffer::Layout* getAutoUniformBufferLayout() const;
+        [[nodiscard]] const AutoUniformBuffer::Field*  getAutoUniformBufferField(DataFieldHandle field) const;
+
+        // compiles variant of this shader taking model dependent semantic uniforms as per-instance vertex attributes (see AutoInstancing),
+        // nullptr if effect cannot be instanced automatically or compiling failed, device keeps the variant and compiles it only once
+        [[nodiscard]] std::unique_ptr<const ShaderGPUResource_GL> createInstancedVariant() const;
+        [[nodiscard]] const std::vector<InstanceAttribute>& getInstanceAttributes() const;
+        [[nodiscard]] uint32_t            getInstanceDataStride() const;
+
     private:
-        void                              init(const EffectResource& effect);
+        struct InstancedVariantTag {};
+        ShaderGPUResource_GL(const EffectResource& instancedEffect, ShaderProgramInfo shaderProgramInfo, InstancedVariantTag);
+
+        void                              init(const EffectResource& effect, bool instancedVariant);
         [[nodiscard]] GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         [[nodiscard]] GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
 
@@ -54,5 +78,10 @@ namespace ramses::internal
         InputLocationMap m_uniformLocationMap;
         InputLocationMap m_attributeLocationMap;
         std::vector<UniformBufferBinding> m_uniformBufferBindings;
+        std::optional<AutoUniformBuffer::Layout> m_autoUniformBufferLayout;
+
+        std::unique_ptr<const EffectResource> m_instancedEffect;
+        std::vector<InstanceAttribute> m_instanceAttributes;
+        uint32_t m_instanceDataStride = 0u;
     };
 }
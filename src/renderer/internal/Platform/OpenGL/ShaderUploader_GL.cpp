@@ -39,7 +39,7 @@ namespace ramses::internal
     }
 
 
-    bool ShaderUploader_GL::UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog)
+    bool ShaderUploader_GL::UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog, const AttributeLocations& attributeLocations)
     {
         LOG_INFO(CONTEXT_RENDERER, "ShaderUploader_GL::UploadShaderProgramFromSource:  compiling shaders for effect {}", effect.getName());
 
@@ -95,6 +95,8 @@ namespace ramses::internal
         glAttachShader(shaderProgramHandle, vertexShaderHandle);
         if (hasGeometryShader)
             glAttachShader(shaderProgramHandle, geometryShaderHandle);
+        for (const auto& attributeLocation : attributeLocations)
+            glBindAttribLocation(shaderProgramHandle, static_cast<GLuint>(attributeLocation.second), attributeLocation.first.c_str());
         glLinkProgram(shaderProgramHandle);
 
         if (CheckShaderProgramLinkStatus(shaderProgramHandle, debugErrorLog))
@@ -13,6 +13,8 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -22,7 +24,10 @@ namespace ramses::internal
     class ShaderUploader_GL
     {
     public:
-        static bool UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
+        // explicit locations of vertex attributes by name, bound before linking
+        using AttributeLocations = std::vector<std::pair<std::string, int32_t>>;
+
+        static bool UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog, const AttributeLocations& attributeLocations = {});
         static bool UploadShaderProgramFromBinary(const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
 
     private:
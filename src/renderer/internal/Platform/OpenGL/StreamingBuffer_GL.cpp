@@ -0,0 +1,219 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Platform/OpenGL/StreamingBuffer_GL.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // GL_MAP_PERSISTENT_BIT_EXT and GL_MAP_COHERENT_BIT_EXT of GL_EXT_buffer_storage (same values as core GL 4.4 bits)
+        constexpr GLbitfield MapPersistentBit = 0x0040;
+        constexpr GLbitfield MapCoherentBit = 0x0080;
+        constexpr GLbitfield PersistentMappingFlags = GL_MAP_WRITE_BIT | MapPersistentBit | MapCoherentBit;
+
+        // waiting for oldest fence is done in steps so that failure to signal gets logged
+        constexpr GLuint64 FenceWaitTimeoutNs = 1000u * 1000u * 1000u;
+    }
+
+    StreamingBuffer_GL::StreamingBuffer_GL(uint32_t capacity, BufferStorageFunc bufferStorage)
+        : m_allocator(capacity, Alignment)
+    {
+        glGenBuffers(1, &m_buffer);
+        assert(m_buffer != InvalidGLHandle);
+        glBindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+
+        if (bufferStorage != nullptr)
+        {
+            // coherent mapping makes written data visible to copy commands issued after without explicit flush
+            bufferStorage(GL_COPY_READ_BUFFER, capacity, nullptr, PersistentMappingFlags);
+            m_persistentMemory = static_cast<std::byte*>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, capacity, PersistentMappingFlags));
+            if (m_persistentMemory != nullptr)
+                return;
+
+            // immutable storage cannot be re-specified, use new buffer
+            LOG_WARN(CONTEXT_RENDERER, "StreamingBuffer_GL: failed to map staging memory persistently, falling back to mapping per upload");
+            glDeleteBuffers(1, &m_buffer);
+            glGenBuffers(1, &m_buffer);
+            assert(m_buffer != InvalidGLHandle);
+            glBindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+        }
+
+        glBufferData(GL_COPY_READ_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+    }
+
+    StreamingBuffer_GL::~StreamingBuffer_GL()
+    {
+        deleteFences();
+        if (m_persistentMemory != nullptr)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+            glUnmapBuffer(GL_COPY_READ_BUFFER);
+        }
+        glDeleteBuffers(1, &m_buffer);
+    }
+
+    bool StreamingBuffer_GL::upload(GLHandle destinationBuffer, const std::byte* data, uint32_t dataSize, uint32_t destinationOffset)
+    {
+        retireSignaledFences();
+
+        // data is split into parts not larger than memory guarded by single fence,
+        // so that each part fits once oldest region is released
+        const uint32_t maxChunkSize = m_allocator.getCapacity() / FencesPerRing;
+        for (uint32_t chunkOffset = 0u; chunkOffset < dataSize; chunkOffset += maxChunkSize)
+        {
+            const uint32_t chunkSize = std::min(maxChunkSize, dataSize - chunkOffset);
+            if (!uploadChunk(destinationBuffer, data + chunkOffset, chunkSize, destinationOffset + chunkOffset))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool StreamingBuffer_GL::uploadChunk(GLHandle destinationBuffer, const std::byte* data, uint32_t dataSize, uint32_t destinationOffset)
+    {
+        const uint32_t offset = allocate(dataSize);
+
+        // region is not read by any pending copy, no need for driver to synchronize
+        glBindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+        if (m_persistentMemory != nullptr)
+        {
+            std::memcpy(m_persistentMemory + offset, data, dataSize);
+        }
+        else
+        {
+            void* stagingMemory = glMapBufferRange(GL_COPY_READ_BUFFER, offset, dataSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            if (stagingMemory == nullptr)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "StreamingBuffer_GL::upload: failed to map staging memory of size {}", dataSize);
+                return false;
+            }
+            std::memcpy(stagingMemory, data, dataSize);
+            if (glUnmapBuffer(GL_COPY_READ_BUFFER) != GL_TRUE)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "StreamingBuffer_GL::upload: staging memory got corrupted");
+                return false;
+            }
+        }
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, destinationBuffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, destinationOffset, dataSize);
+
+        if (m_allocator.getUnfencedSize() >= m_allocator.getCapacity() / FencesPerRing)
+            insertFence();
+
+        return true;
+    }
+
+    uint32_t StreamingBuffer_GL::allocate(uint32_t size)
+    {
+        assert(size <= m_allocator.getCapacity() / FencesPerRing);
+        auto offset = m_allocator.allocate(size);
+        while (!offset)
+        {
+            if (m_persistentMemory != nullptr)
+            {
+                // persistent memory cannot be orphaned, CPU has to wait for GPU to finish reading oldest region
+                if (m_allocator.hasUnfencedAllocations())
+                    insertFence();
+                waitForOldestFence();
+            }
+            else
+            {
+                orphan();
+            }
+            offset = m_allocator.allocate(size);
+        }
+
+        return *offset;
+    }
+
+    void StreamingBuffer_GL::insertFence()
+    {
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (fence == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "StreamingBuffer_GL::insertFence: failed to create fence");
+            return;
+        }
+
+        ++m_lastFenceId;
+        m_allocator.fence(m_lastFenceId);
+        m_pendingFences.emplace_back(m_lastFenceId, fence);
+    }
+
+    void StreamingBuffer_GL::retireSignaledFences()
+    {
+        // fences are signaled in order of insertion, poll without blocking
+        while (!m_pendingFences.empty())
+        {
+            const auto& fence = m_pendingFences.front();
+            const GLenum status = glClientWaitSync(fence.second, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break;
+
+            m_allocator.retire(fence.first);
+            glDeleteSync(fence.second);
+            m_pendingFences.pop_front();
+        }
+    }
+
+    void StreamingBuffer_GL::waitForOldestFence()
+    {
+        if (m_pendingFences.empty())
+        {
+            // fence could not be created, only way to know GPU finished reading is to wait for all commands
+            glFinish();
+            m_allocator.reset();
+            return;
+        }
+
+        const auto fence = m_pendingFences.front();
+        m_pendingFences.pop_front();
+        // first wait flushes commands, otherwise fence might never be signaled
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        for (;;)
+        {
+            const GLenum status = glClientWaitSync(fence.second, flags, FenceWaitTimeoutNs);
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+                break;
+            if (status == GL_WAIT_FAILED)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "StreamingBuffer_GL::waitForOldestFence: failed to wait for fence, waiting for all commands instead");
+                glFinish();
+                break;
+            }
+            LOG_WARN(CONTEXT_RENDERER, "StreamingBuffer_GL::waitForOldestFence: staging memory still in use by GPU after {} ms", FenceWaitTimeoutNs / 1000000u);
+            flags = 0;
+        }
+
+        m_allocator.retire(fence.first);
+        glDeleteSync(fence.second);
+    }
+
+    void StreamingBuffer_GL::orphan()
+    {
+        // driver keeps old storage alive until pending copies reading it are finished, whole ring is free right away
+        glBindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+        glBufferData(GL_COPY_READ_BUFFER, m_allocator.getCapacity(), nullptr, GL_STREAM_DRAW);
+        deleteFences();
+        m_allocator.reset();
+    }
+
+    void StreamingBuffer_GL::deleteFences()
+    {
+        for (const auto& fence : m_pendingFences)
+            glDeleteSync(fence.second);
+        m_pendingFences.clear();
+    }
+}
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Platform/OpenGL/Device_GL_platform.h"
+#include "internal/Platform/OpenGL/Types_GL.h"
+#include "internal/RendererLib/PlatformBase/RingBufferAllocator.h"
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+namespace ramses::internal
+{
+    // Streams buffer data to GPU through a ring of staging memory instead of re-specifying or directly updating
+    // the destination buffer's storage, which would force the driver to synchronize with pending draws using it.
+    // Data is written to staging memory and copied to destination on GPU, staging memory is reused once a fence
+    // inserted after the copy is signaled. If immutable buffer storage is supported, staging memory is mapped once
+    // persistently and coherently, otherwise an unsynchronized range is mapped for each upload.
+    // Must be created and destroyed with the owning context current.
+    class StreamingBuffer_GL
+    {
+    public:
+        // glBufferStorage is not part of GLES 3.2, it is provided by extension (GL_EXT_buffer_storage) if supported
+        using BufferStorageFunc = void (GLAD_API_PTR*)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
+        // bufferStorage can be nullptr if immutable buffer storage is not supported
+        StreamingBuffer_GL(uint32_t capacity, BufferStorageFunc bufferStorage);
+        ~StreamingBuffer_GL();
+
+        StreamingBuffer_GL(const StreamingBuffer_GL&) = delete;
+        StreamingBuffer_GL& operator=(const StreamingBuffer_GL&) = delete;
+
+        // Copies data to destination buffer starting at given offset, its storage must be already specified and large enough.
+        // If there is no free staging memory, the oldest region is waited for (persistent memory) or whole memory is orphaned.
+        // Returns false only if staging memory could not be mapped, data must be uploaded by other means then.
+        [[nodiscard]] bool upload(GLHandle destinationBuffer, const std::byte* data, uint32_t dataSize, uint32_t destinationOffset = 0u);
+
+    private:
+        [[nodiscard]] bool uploadChunk(GLHandle destinationBuffer, const std::byte* data, uint32_t dataSize, uint32_t destinationOffset);
+        [[nodiscard]] uint32_t allocate(uint32_t size);
+        void insertFence();
+        void retireSignaledFences();
+        void waitForOldestFence();
+        void orphan();
+        void deleteFences();
+
+        // number of fences used to split the ring, more fences allow earlier reuse of staging memory
+        static constexpr uint32_t FencesPerRing = 4u;
+        static constexpr uint32_t Alignment = 64u;
+
+        GLHandle m_buffer = InvalidGLHandle;
+        std::byte* m_persistentMemory = nullptr;
+        RingBufferAllocator m_allocator;
+        uint64_t m_lastFenceId = 0u;
+        std::deque<std::pair<uint64_t, GLsync>> m_pendingFences;
+    };
+}
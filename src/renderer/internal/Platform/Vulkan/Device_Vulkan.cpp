@@ -276,6 +276,16 @@ namespace ramses::internal
 
     }
 
+    bool Device_Vulkan::activateInstancedShader([[maybe_unused]] DeviceResourceHandle handle)
+    {
+        return false;
+    }
+
+    void Device_Vulkan::uploadInstanceData([[maybe_unused]] const std::byte* data, [[maybe_unused]] uint32_t dataSize)
+    {
+
+    }
+
     DeviceResourceHandle Device_Vulkan::allocateTexture2D([[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height, [[maybe_unused]] EPixelStorageFormat textureFormat, [[maybe_unused]] const TextureSwizzleArray& swizzle, [[maybe_unused]] uint32_t mipLevelCount, [[maybe_unused]] uint32_t totalSizeInBytes)
     {
         return {};
@@ -81,6 +81,8 @@ namespace ramses::internal
         bool                    getBinaryShader(DeviceResourceHandle handleconst, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         void                    deleteShader(DeviceResourceHandle handle) override;
         void                    activateShader(DeviceResourceHandle handle) override;
+        bool                    activateInstancedShader(DeviceResourceHandle handle) override;
+        void                    uploadInstanceData(const std::byte* data, uint32_t dataSize) override;
 
         DeviceResourceHandle    allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) override;
         DeviceResourceHandle    allocateTexture3D(uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes) override;
@@ -0,0 +1,115 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AutoInstancing.h"
+#include "internal/RendererLib/ShaderSourceUtils.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct Replacement
+        {
+            size_t begin = 0u;
+            size_t end = 0u;
+            std::string text;
+        };
+
+        // finds single line declaration '[uniform] [precision] <type> <name>;' and creates replacement declaring it as vertex attribute
+        std::optional<Replacement> CreateAttributeDeclaration(std::string_view vertexShader, const EffectInputInformation& input, std::string_view attributeKeyword)
+        {
+            const std::string_view typeName = (input.dataType == EDataType::Matrix44F ? "mat4" : "mat3");
+
+            std::optional<ShaderSourceUtils::UniformDeclaration> declaration;
+            if (!ShaderSourceUtils::FindUniformDeclaration(vertexShader, input.inputName, typeName, declaration) || !declaration)
+                return std::nullopt;
+
+            std::string text{ attributeKeyword };
+            text += ' ';
+            if (!declaration->precision.empty())
+            {
+                text += declaration->precision;
+                text += ' ';
+            }
+            text += typeName;
+            text += ' ';
+            text += input.inputName;
+            return Replacement{ declaration->begin, declaration->nameEnd, std::move(text) };
+        }
+    }
+
+    bool AutoInstancing::IsPerInstanceSemantic(EFixedSemantics semantics)
+    {
+        switch (semantics)
+        {
+        case EFixedSemantics::ModelMatrix:
+        case EFixedSemantics::ModelViewMatrix:
+        case EFixedSemantics::ModelViewMatrix33:
+        case EFixedSemantics::ModelViewProjectionMatrix:
+        case EFixedSemantics::NormalMatrix:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    std::optional<std::string> AutoInstancing::CreateInstancedVertexShader(const EffectResource& effect)
+    {
+        const std::string_view vertexShader = effect.getVertexShader();
+        const std::string_view fragmentShader = effect.getFragmentShader();
+        const std::string_view geometryShader = effect.getGeometryShader();
+
+        // instance ID of a non-instanced renderable is always 0, it would change when drawn instanced
+        if (!ShaderSourceUtils::FindWholeWord(vertexShader, "gl_InstanceID").empty())
+            return std::nullopt;
+
+        const std::string_view attributeKeyword = (ShaderSourceUtils::GetShaderVersion(vertexShader) >= 130u ? "in" : "attribute");
+
+        std::vector<Replacement> replacements;
+        for (const auto& input : effect.getUniformInputs())
+        {
+            // model dependent uniform buffers are shared by the whole program, they cannot be provided per instance
+            if (input.semantics == EFixedSemantics::ModelBlock || input.semantics == EFixedSemantics::ModelCameraBlock)
+                return std::nullopt;
+
+            if (!IsPerInstanceSemantic(input.semantics) || EffectInputInformation::IsUniformBufferField(input))
+                continue;
+
+            if (input.elementCount != 1u || (input.dataType != EDataType::Matrix44F && input.dataType != EDataType::Matrix33F))
+                return std::nullopt;
+
+            // uniforms used in other stages than vertex shader cannot be turned into vertex attributes
+            if (!ShaderSourceUtils::FindWholeWord(fragmentShader, input.inputName).empty() || !ShaderSourceUtils::FindWholeWord(geometryShader, input.inputName).empty())
+                return std::nullopt;
+
+            // macros could declare, redefine or conditionally use the uniform, rewrite is done only if declaration is certain
+            if (ShaderSourceUtils::IsUsedInPreprocessorDirective(vertexShader, input.inputName))
+                return std::nullopt;
+
+            auto replacement = CreateAttributeDeclaration(vertexShader, input, attributeKeyword);
+            if (!replacement)
+                return std::nullopt;
+            replacements.push_back(std::move(*replacement));
+        }
+
+        if (replacements.empty())
+            return std::nullopt;
+
+        std::sort(replacements.begin(), replacements.end(), [](const auto& r1, const auto& r2) { return r1.begin > r2.begin; });
+        std::string instancedVertexShader{ vertexShader };
+        for (const auto& replacement : replacements)
+            instancedVertexShader.replace(replacement.begin, replacement.end - replacement.begin, replacement.text);
+
+        return instancedVertexShader;
+    }
+}
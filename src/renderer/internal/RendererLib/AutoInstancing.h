@@ -0,0 +1,37 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/EFixedSemantics.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ramses::internal
+{
+    class EffectResource;
+
+    // Automatic instancing draws a run of renderables which differ only in their transformation with a single instanced draw call.
+    // Uniforms with transformation dependent semantics are turned into vertex attributes of same name in an instanced variant
+    // of the vertex shader, their values are provided per instance in an instance buffer.
+    class AutoInstancing
+    {
+    public:
+        static constexpr uint32_t MaxInstancesPerDrawCall = 256u;
+
+        // Semantics whose value depends on the renderable's transformation.
+        // Values of all per-instance uniforms of an instance are tightly packed in order of their data fields (see EnumToSize).
+        static bool IsPerInstanceSemantic(EFixedSemantics semantics);
+
+        // Vertex shader with all per-instance uniforms declared as vertex attributes instead,
+        // returns nullopt if the effect cannot be instanced automatically
+        static std::optional<std::string> CreateInstancedVertexShader(const EffectResource& effect);
+    };
+}
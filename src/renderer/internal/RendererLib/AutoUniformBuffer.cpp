@@ -0,0 +1,203 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AutoUniformBuffer.h"
+#include "internal/RendererLib/ShaderSourceUtils.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+
+#include <cstring>
+#include <string>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct Std140TypeInfo
+        {
+            std::string_view typeName;
+            uint32_t alignment = 0u;
+            uint32_t size = 0u;
+            uint32_t arrayStride = 0u; // array elements are always aligned to vec4
+        };
+
+        std::optional<Std140TypeInfo> GetStd140TypeInfo(EDataType dataType)
+        {
+            switch (dataType)
+            {
+            case EDataType::Bool:      return Std140TypeInfo{ "bool", 4u, 4u, 16u };
+            case EDataType::Int32:     return Std140TypeInfo{ "int", 4u, 4u, 16u };
+            case EDataType::Float:     return Std140TypeInfo{ "float", 4u, 4u, 16u };
+            case EDataType::Vector2I:  return Std140TypeInfo{ "ivec2", 8u, 8u, 16u };
+            case EDataType::Vector2F:  return Std140TypeInfo{ "vec2", 8u, 8u, 16u };
+            case EDataType::Vector3I:  return Std140TypeInfo{ "ivec3", 16u, 12u, 16u };
+            case EDataType::Vector3F:  return Std140TypeInfo{ "vec3", 16u, 12u, 16u };
+            case EDataType::Vector4I:  return Std140TypeInfo{ "ivec4", 16u, 16u, 16u };
+            case EDataType::Vector4F:  return Std140TypeInfo{ "vec4", 16u, 16u, 16u };
+            case EDataType::Matrix22F: return Std140TypeInfo{ "mat2", 16u, 32u, 32u };
+            case EDataType::Matrix33F: return Std140TypeInfo{ "mat3", 16u, 48u, 48u };
+            case EDataType::Matrix44F: return Std140TypeInfo{ "mat4", 16u, 64u, 64u };
+            default:
+                return std::nullopt;
+            }
+        }
+
+        uint32_t Align(uint32_t value, uint32_t alignment)
+        {
+            return (value + alignment - 1u) / alignment * alignment;
+        }
+
+        bool IsPackable(const EffectInputInformation& input)
+        {
+            return input.semantics == EFixedSemantics::Invalid && !EffectInputInformation::IsUniformBuffer(input) && GetStd140TypeInfo(input.dataType).has_value();
+        }
+
+        std::string CreateBlockDeclaration(const EffectResource& effect, const AutoUniformBuffer::Layout& layout)
+        {
+            std::string declaration = "layout(std140, binding = " + std::to_string(layout.binding.getValue()) + ") uniform ";
+            declaration += AutoUniformBuffer::BlockName;
+            declaration += "\n{\n";
+
+            size_t fieldIdx = 0u;
+            for (const auto& input : effect.getUniformInputs())
+            {
+                if (EffectInputInformation::IsUniformBufferField(input))
+                    continue;
+                if (layout.fields[fieldIdx++])
+                {
+                    // members must be declared with same precision in all stages, highp is always available for uniform blocks
+                    declaration += (input.dataType == EDataType::Bool ? "    " : "    highp ");
+                    declaration += GetStd140TypeInfo(input.dataType)->typeName;
+                    declaration += ' ';
+                    declaration += input.inputName;
+                    if (input.elementCount > 1u)
+                        declaration += '[' + std::to_string(input.elementCount) + ']';
+                    declaration += ";\n";
+                }
+            }
+            declaration += "};\n";
+
+            return declaration;
+        }
+
+        // removes declarations of all packed uniforms and inserts block declaration instead, returns nullopt if shader cannot be rewritten
+        std::optional<std::string> CreatePackedShader(std::string_view shader, const EffectResource& effect, const AutoUniformBuffer::Layout& layout, std::string_view blockDeclaration)
+        {
+            std::vector<ShaderSourceUtils::UniformDeclaration> declarations;
+            size_t fieldIdx = 0u;
+            for (const auto& input : effect.getUniformInputs())
+            {
+                if (EffectInputInformation::IsUniformBufferField(input) || !layout.fields[fieldIdx++])
+                    continue;
+
+                std::optional<ShaderSourceUtils::UniformDeclaration> declaration;
+                if (!ShaderSourceUtils::FindUniformDeclaration(shader, input.inputName, GetStd140TypeInfo(input.dataType)->typeName, declaration))
+                    return std::nullopt;
+
+                if (declaration)
+                    declarations.push_back(*declaration);
+                // not declared but used in some other way (e.g. as member of struct), it cannot be moved to block
+                else if (!ShaderSourceUtils::FindWholeWord(shader, input.inputName).empty())
+                    return std::nullopt;
+            }
+
+            std::string packedShader{ shader };
+            if (declarations.empty())
+                return packedShader;
+
+            const size_t insertPos = ShaderSourceUtils::GetDeclarationsInsertPosition(shader);
+            std::sort(declarations.begin(), declarations.end(), [](const auto& d1, const auto& d2) { return d1.begin > d2.begin; });
+            if (declarations.back().begin < insertPos)
+                return std::nullopt;
+
+            // line of removed declaration is kept (empty) so that only the inserted block shifts line numbers in compiler messages
+            for (const auto& declaration : declarations)
+                packedShader.erase(declaration.begin, declaration.end - declaration.begin);
+            packedShader.insert(insertPos, blockDeclaration);
+
+            return packedShader;
+        }
+    }
+
+    std::optional<AutoUniformBuffer::Layout> AutoUniformBuffer::CreateLayout(const EffectResource& effect)
+    {
+        // explicit block binding is available since GLSL ES 3.10 and GLSL 4.20
+        const std::string_view vertexShader = effect.getVertexShader();
+        const uint32_t version = ShaderSourceUtils::GetShaderVersion(vertexShader);
+        if (version < (ShaderSourceUtils::IsESShader(vertexShader) ? 310u : 420u))
+            return std::nullopt;
+
+        if (!ShaderSourceUtils::FindWholeWord(vertexShader, BlockName).empty() || !ShaderSourceUtils::FindWholeWord(effect.getFragmentShader(), BlockName).empty())
+            return std::nullopt;
+
+        Layout layout;
+        uint32_t numPackedUniforms = 0u;
+        uint32_t nextFreeBinding = 0u;
+        for (const auto& input : effect.getUniformInputs())
+        {
+            if (EffectInputInformation::IsUniformBufferField(input))
+                continue;
+
+            if (EffectInputInformation::IsUniformBuffer(input))
+                nextFreeBinding = std::max(nextFreeBinding, input.uniformBufferBinding.getValue() + 1u);
+
+            if (!IsPackable(input))
+            {
+                layout.fields.emplace_back();
+                continue;
+            }
+
+            const auto typeInfo = *GetStd140TypeInfo(input.dataType);
+            Field field;
+            field.elementCount = input.elementCount;
+            if (input.elementCount > 1u)
+            {
+                field.offset = Align(layout.size, 16u);
+                field.elementStride = typeInfo.arrayStride;
+                layout.size = field.offset + input.elementCount * typeInfo.arrayStride;
+            }
+            else
+            {
+                field.offset = Align(layout.size, typeInfo.alignment);
+                field.elementStride = typeInfo.size;
+                layout.size = field.offset + typeInfo.size;
+            }
+            layout.fields.emplace_back(field);
+            ++numPackedUniforms;
+        }
+
+        layout.size = Align(layout.size, 16u);
+        if (numPackedUniforms < MinPackedUniforms || layout.size > MaxBlockSize || nextFreeBinding >= MaxBindings)
+            return std::nullopt;
+
+        layout.binding = UniformBufferBinding{ nextFreeBinding };
+        return layout;
+    }
+
+    std::unique_ptr<const EffectResource> AutoUniformBuffer::CreatePackedEffect(const EffectResource& effect, const Layout& layout)
+    {
+        const std::string blockDeclaration = CreateBlockDeclaration(effect, layout);
+
+        const auto vertexShader = CreatePackedShader(effect.getVertexShader(), effect, layout, blockDeclaration);
+        const auto fragmentShader = CreatePackedShader(effect.getFragmentShader(), effect, layout, blockDeclaration);
+        const auto geometryShader = CreatePackedShader(effect.getGeometryShader(), effect, layout, blockDeclaration);
+        if (!vertexShader || !fragmentShader || !geometryShader)
+            return nullptr;
+
+        return std::make_unique<const EffectResource>(*vertexShader, *fragmentShader, *geometryShader, SPIRVShaders{},
+            effect.getGeometryShaderInputType(), effect.getUniformInputs(), effect.getAttributeInputs(), effect.getName(), EFeatureLevel_Latest);
+    }
+
+    bool AutoUniformBuffer::WriteBytes(std::byte* destination, const void* source, size_t size)
+    {
+        if (std::memcmp(destination, source, size) == 0)
+            return false;
+
+        std::memcpy(destination, source, size);
+        return true;
+    }
+}
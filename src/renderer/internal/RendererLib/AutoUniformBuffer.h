@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/DataTypes.h"
+#include "internal/SceneGraph/SceneAPI/SceneTypes.h"
+#include "glm/mat2x2.hpp"
+#include "glm/mat3x3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ramses::internal
+{
+    class EffectResource;
+
+    // Automatic uniform buffer packs all non-semantic uniforms of an effect which are not texture samplers or part of a uniform block
+    // into a single std140 uniform block declared in a rewritten variant of the effect's shaders.
+    // Values of the packed uniforms are then provided by binding a range of a uniform buffer instead of setting each uniform separately,
+    // renderables using same values can share the same range.
+    class AutoUniformBuffer
+    {
+    public:
+        static constexpr std::string_view BlockName = "ramses_autoUniforms";
+        // packing a single uniform would replace one uniform update with one buffer binding, no gain
+        static constexpr uint32_t MinPackedUniforms = 2u;
+        // minimum values of GL_MAX_UNIFORM_BLOCK_SIZE and GL_MAX_UNIFORM_BUFFER_BINDINGS guaranteed by GLES 3.0
+        static constexpr uint32_t MaxBlockSize = 16384u;
+        static constexpr uint32_t MaxBindings = 24u;
+        // std140 stores every matrix column with vec4 alignment
+        static constexpr uint32_t MatrixColumnStride = 16u;
+
+        struct Field
+        {
+            uint32_t offset = 0u;
+            uint32_t elementCount = 0u;
+            uint32_t elementStride = 0u;
+        };
+
+        struct Layout
+        {
+            UniformBufferBinding binding;
+            uint32_t size = 0u;
+            // indexed by data field of uniform input (same as uniform locations, i.e. uniform buffer fields excluded), nullopt if not packed
+            std::vector<std::optional<Field>> fields;
+        };
+
+        // std140 layout of packed uniforms, nullopt if effect cannot use automatic uniform buffer
+        // (shading language version without explicit block binding, too few or too many uniforms to pack)
+        static std::optional<Layout> CreateLayout(const EffectResource& effect);
+
+        // Effect with declarations of packed uniforms replaced by uniform block declaration in every shader stage using them,
+        // nullptr if declarations of packed uniforms could not be recognized
+        static std::unique_ptr<const EffectResource> CreatePackedEffect(const EffectResource& effect, const Layout& layout);
+
+        // Writes values of packed uniform into block data in std140 layout, returns true if data changed
+        template <typename T>
+        static bool WriteValues(std::byte* blockData, const Field& field, uint32_t count, const T* values);
+
+    private:
+        static bool WriteBytes(std::byte* destination, const void* source, size_t size);
+    };
+
+    template <typename T>
+    bool AutoUniformBuffer::WriteValues(std::byte* blockData, const Field& field, uint32_t count, const T* values)
+    {
+        bool changed = false;
+        const uint32_t elementCount = std::min(count, field.elementCount);
+        for (uint32_t i = 0u; i < elementCount; ++i)
+        {
+            std::byte* element = blockData + field.offset + i * field.elementStride;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                const int32_t value = values[i] ? 1 : 0;
+                changed = WriteBytes(element, &value, sizeof(value)) || changed;
+            }
+            else if constexpr (std::is_same_v<T, glm::mat2> || std::is_same_v<T, glm::mat3> || std::is_same_v<T, glm::mat4>)
+            {
+                for (glm::length_t column = 0; column < T::length(); ++column)
+                    changed = WriteBytes(element + column * MatrixColumnStride, &values[i][column], sizeof(typename T::col_type)) || changed;
+            }
+            else
+            {
+                changed = WriteBytes(element, &values[i], sizeof(T)) || changed;
+            }
+        }
+        return changed;
+    }
+}
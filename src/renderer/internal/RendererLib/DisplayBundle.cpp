@@ -57,6 +57,11 @@ namespace ramses::internal
         finishFrameStatistics(prevFrameSleepTime);
     }
 
+    void DisplayBundle::setFlushTracer(FlushTracer* flushTracer)
+    {
+        m_rendererStatistics.setFlushTracer(flushTracer);
+    }
+
     void DisplayBundle::pushAndConsumeCommands(RendererCommands& cmds)
     {
         m_pendingCommands.addAndConsumeCommandsFrom(cmds);
@@ -95,9 +100,16 @@ namespace ramses::internal
     void DisplayBundle::finishFrameStatistics(std::chrono::microseconds prevFrameSleepTime)
     {
         uint32_t drawCalls = 0u;
+        uint32_t uniformUpdatesIssued = 0u;
+        uint32_t uniformUpdatesSkipped = 0u;
         if (m_renderer.hasDisplayController())
-            drawCalls = m_renderer.getDisplayController().getRenderBackend().getDevice().getAndResetDrawCallCount();
+        {
+            auto& device = m_renderer.getDisplayController().getRenderBackend().getDevice();
+            drawCalls = device.getAndResetDrawCallCount();
+            device.getAndResetUniformUpdateCount(uniformUpdatesIssued, uniformUpdatesSkipped);
+        }
 
+        m_renderer.getStatistics().uniformsUpdated(uniformUpdatesIssued, uniformUpdatesSkipped);
         m_renderer.getStatistics().frameFinished(drawCalls);
         m_renderer.getProfilerStatistics().markFrameFinished(prevFrameSleepTime);
     }
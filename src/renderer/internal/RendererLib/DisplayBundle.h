@@ -30,6 +30,7 @@ namespace ramses::internal
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
     class IThreadAliveNotifier;
+    class FlushTracer;
 
     class IDisplayBundle
     {
@@ -76,6 +77,9 @@ namespace ramses::internal
         // needed for Renderer lifecycle tests...
         [[nodiscard]] bool hasSystemCompositorController() const override;
 
+        // must be set before display loop is started
+        void setFlushTracer(FlushTracer* flushTracer);
+
         // TODO vaclav remove, debugging only
         std::atomic_int& traceId() override { return m_renderer.m_traceId; }
 
@@ -233,6 +233,37 @@ namespace ramses::internal
     {
         return m_asyncEffectUploadEnabled;
     }
+
+    void DisplayConfigData::setFrustumCullingEnabled(bool enabled)
+    {
+        m_frustumCullingEnabled = enabled;
+    }
+
+    bool DisplayConfigData::isFrustumCullingEnabled() const
+    {
+        return m_frustumCullingEnabled;
+    }
+
+    void DisplayConfigData::setAutoInstancingEnabled(bool enabled)
+    {
+        m_autoInstancingEnabled = enabled;
+    }
+
+    bool DisplayConfigData::isAutoInstancingEnabled() const
+    {
+        return m_autoInstancingEnabled;
+    }
+
+    void DisplayConfigData::setRenderPreparationThreadCount(uint32_t threadCount)
+    {
+        m_renderPreparationThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfigData::getRenderPreparationThreadCount() const
+    {
+        return m_renderPreparationThreadCount;
+    }
+
     void DisplayConfigData::setWaylandEmbeddedCompositingSocketName(std::string_view socket)
     {
         m_waylandSocketEmbedded = socket;
@@ -348,6 +379,9 @@ namespace ramses::internal
             m_waylandDisplay             == other.m_waylandDisplay &&
             m_depthStencilBufferType     == other.m_depthStencilBufferType &&
             m_asyncEffectUploadEnabled   == other.m_asyncEffectUploadEnabled &&
+            m_frustumCullingEnabled      == other.m_frustumCullingEnabled &&
+            m_autoInstancingEnabled      == other.m_autoInstancingEnabled &&
+            m_renderPreparationThreadCount == other.m_renderPreparationThreadCount &&
             m_waylandSocketEmbedded      == other.m_waylandSocketEmbedded &&
             m_waylandSocketEmbeddedGroupName    == other.m_waylandSocketEmbeddedGroupName &&
             m_waylandSocketEmbeddedPermissions  == other.m_waylandSocketEmbeddedPermissions &&
@@ -91,6 +91,15 @@ namespace ramses::internal
         void setAsyncEffectUploadEnabled(bool enabled);
         [[nodiscard]] bool isAsyncEffectUploadEnabled() const;
 
+        void setFrustumCullingEnabled(bool enabled);
+        [[nodiscard]] bool isFrustumCullingEnabled() const;
+
+        void setAutoInstancingEnabled(bool enabled);
+        [[nodiscard]] bool isAutoInstancingEnabled() const;
+
+        void setRenderPreparationThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getRenderPreparationThreadCount() const;
+
         void setWaylandEmbeddedCompositingSocketName(std::string_view socket);
         [[nodiscard]] std::string_view getWaylandSocketEmbedded() const;
 
@@ -170,6 +179,9 @@ namespace ramses::internal
         glm::vec4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
         EDepthBufferType m_depthStencilBufferType = EDepthBufferType::DepthStencil;
         bool m_asyncEffectUploadEnabled = true;
+        bool m_frustumCullingEnabled = false;
+        bool m_autoInstancingEnabled = false;
+        uint32_t m_renderPreparationThreadCount = 0u;
 
         std::string m_waylandSocketEmbedded;
         std::string m_waylandSocketEmbeddedGroupName;
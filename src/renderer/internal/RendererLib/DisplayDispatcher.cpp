@@ -191,14 +191,15 @@ namespace ramses::internal
         bundle.platform = m_platformFactory->createPlatform(m_rendererConfig, dispConfig);
 
         LOG_INFO(CONTEXT_RENDERER, "DisplayDispatcher: creating display bundle of components for display {}", displayHandle);
-        bundle.displayBundle = DisplayBundleShared{ std::make_unique<DisplayBundle>(
+        auto displayBundle = std::make_unique<DisplayBundle>(
             displayHandle,
             m_rendererSceneSender,
             *bundle.platform,
             m_notifier,
             m_rendererConfig.getRenderThreadLoopTimingReportingPeriod(),
-            m_featureLevel)
-        };
+            m_featureLevel);
+        displayBundle->setFlushTracer(m_flushTracer);
+        bundle.displayBundle = DisplayBundleShared{ std::move(displayBundle) };
         if (m_threadedDisplays)
         {
             LOG_INFO(CONTEXT_RENDERER, "DisplayDispatcher: creating update/render thread for display {}", displayHandle);
@@ -452,4 +453,9 @@ namespace ramses::internal
     {
         return m_rendererConfig;
     }
+
+    void DisplayDispatcher::setFlushTracer(FlushTracer* flushTracer)
+    {
+        m_flushTracer = flushTracer;
+    }
 }
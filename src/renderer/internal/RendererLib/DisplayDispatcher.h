@@ -25,6 +25,7 @@ namespace ramses::internal
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
     class DisplayConfigData;
+    class FlushTracer;
 
     class DisplayDispatcher
     {
@@ -55,6 +56,9 @@ namespace ramses::internal
 
         [[nodiscard]] const RendererConfigData& getRendererConfig() const;
 
+        // flush traces are recorded by displays created after this call
+        void setFlushTracer(FlushTracer* flushTracer);
+
         // needed for EC tests...
         IEmbeddedCompositingManager& getECManager(DisplayHandle display);
         IEmbeddedCompositor& getEC(DisplayHandle display);
@@ -82,6 +86,7 @@ namespace ramses::internal
         std::unique_ptr<IPlatformFactory> m_platformFactory;
         const RendererConfigData m_rendererConfig;
         IRendererSceneEventSender& m_rendererSceneSender;
+        FlushTracer* m_flushTracer = nullptr;
 
         SceneDisplayTracker m_sceneDisplayTrackerForCommands;
         SceneDisplayTracker m_sceneDisplayTrackerForEvents;
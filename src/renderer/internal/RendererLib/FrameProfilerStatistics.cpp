@@ -17,6 +17,7 @@ namespace ramses::internal
         : m_regionStartTimes(NumberOfRegions)
     {
         m_frameTimings.reserve(NumberOfFrames * NumberOfRegions);
+        m_frameStateChanges.reserve(NumberOfFrames);
         initNextFrameTimings();
     }
 
@@ -41,10 +42,27 @@ namespace ramses::internal
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
     }
 
+    FrameProfilerStatistics::StateChanges& FrameProfilerStatistics::StateChanges::operator+=(const StateChanges& other)
+    {
+        shaders += other.shaders;
+        uniformInstances += other.uniformInstances;
+        vertexArrays += other.vertexArrays;
+        renderStates += other.renderStates;
+        return *this;
+    }
+
+    void FrameProfilerStatistics::addStateChanges(const StateChanges& stateChanges)
+    {
+        m_frameStateChanges.back() += stateChanges;
+    }
+
     void FrameProfilerStatistics::initNextFrameTimings()
     {
         if (m_frameTimings.size() < NumberOfFrames * NumberOfRegions * 2) // sanity check, do not grow tracked times if never consumed
+        {
             m_frameTimings.insert(m_frameTimings.end(), NumberOfRegions, 0u);
+            m_frameStateChanges.emplace_back();
+        }
     }
 
     void FrameProfilerStatistics::markFrameFinished(std::chrono::microseconds prevFrameSleepTime)
@@ -87,6 +105,16 @@ namespace ramses::internal
         {
             for (size_t reg = 0u; reg < NumberOfRegions; ++reg)
             str << " " << EnumToString(ERegion(reg)) << ":" << m_frameTimings[NumberOfRegions * longestFrameID + reg] << " [" << totalRegionTime[reg] / numFramesTracked << "]";
+
+            assert(m_frameStateChanges.size() == numFramesTracked);
+            StateChanges totalStateChanges;
+            for (const auto& stateChanges : m_frameStateChanges)
+                totalStateChanges += stateChanges;
+            const StateChanges& longestFrameStateChanges = m_frameStateChanges[longestFrameID];
+            str << " ShaderChanges:" << longestFrameStateChanges.shaders << " [" << totalStateChanges.shaders / numFramesTracked << "]";
+            str << " UniformInstanceChanges:" << longestFrameStateChanges.uniformInstances << " [" << totalStateChanges.uniformInstances / numFramesTracked << "]";
+            str << " VertexArrayChanges:" << longestFrameStateChanges.vertexArrays << " [" << totalStateChanges.vertexArrays / numFramesTracked << "]";
+            str << " RenderStateChanges:" << longestFrameStateChanges.renderStates << " [" << totalStateChanges.renderStates / numFramesTracked << "]";
         }
         else
         {
@@ -97,6 +125,7 @@ namespace ramses::internal
     void FrameProfilerStatistics::resetFrameTimings()
     {
         m_frameTimings.clear();
+        m_frameStateChanges.clear();
         initNextFrameTimings();
     }
 
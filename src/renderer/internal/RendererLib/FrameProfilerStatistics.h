@@ -57,10 +57,22 @@ namespace ramses::internal
             MaxFramerateSleep, // do not use this directly with startRegion/endRegion, it is handled internally
         };
 
+        // number of state changes between consecutive draw calls
+        struct StateChanges
+        {
+            uint32_t shaders = 0u;
+            uint32_t uniformInstances = 0u;
+            uint32_t vertexArrays = 0u;
+            uint32_t renderStates = 0u;
+
+            StateChanges& operator+=(const StateChanges& other);
+        };
+
         FrameProfilerStatistics();
 
         void startRegion(ERegion region);
         void endRegion(ERegion region);
+        void addStateChanges(const StateChanges& stateChanges);
 
         void markFrameFinished(std::chrono::microseconds prevFrameSleepTime);
 
@@ -77,6 +89,7 @@ namespace ramses::internal
         // region measurements for periodic logging
         // these are reset every period
         std::vector<size_t> m_frameTimings;
+        std::vector<StateChanges> m_frameStateChanges;
 
         size_t m_currentRegionId{0};
 
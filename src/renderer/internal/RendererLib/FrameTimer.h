@@ -12,6 +12,7 @@
 #include <chrono>
 #include <limits>
 #include <array>
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -24,6 +25,14 @@ namespace ramses::internal
         COUNT
     };
 
+    // Costs of work done in a section during one frame, predicted cost is based on cost estimate learned from previous frames
+    struct FrameTimerSectionCosts
+    {
+        std::chrono::microseconds predicted{ 0 };
+        std::chrono::microseconds actual{ 0 };
+        uint64_t numWorkUnits = 0u;
+    };
+
     class FrameTimer
     {
     public:
@@ -38,6 +47,8 @@ namespace ramses::internal
         void startFrame()
         {
             m_frameStartTimeStamp = Clock::now();
+            m_lastFrameSectionCosts = m_currentFrameSectionCosts;
+            m_currentFrameSectionCosts.fill({});
         }
 
         void setSectionTimeBudget(EFrameTimerSectionBudget section, uint64_t timeBudgetInMicrosecs)
@@ -65,10 +76,64 @@ namespace ramses::internal
             return m_frameStartTimeStamp;
         }
 
+        // Cost of given amount of work in section predicted from cost per work unit learned from previous frames,
+        // zero if no work was reported for the section yet.
+        // What a work unit is is up to the section (e.g. one renderable for offscreen buffer rendering).
+        [[nodiscard]] Clock::duration predictSectionWorkCost(EFrameTimerSectionBudget section, uint64_t numWorkUnits) const
+        {
+            return m_sectionUnitCostEstimates[static_cast<size_t>(section)] * static_cast<Clock::rep>(numWorkUnits);
+        }
+
+        // Number of work units predicted to fit into remaining time budget of section, numeric max if there is no prediction yet
+        [[nodiscard]] uint64_t getAffordableWorkUnits(EFrameTimerSectionBudget section) const
+        {
+            const auto remainingBudget = m_sectionBudgets[static_cast<size_t>(section)] - (Clock::now() - m_frameStartTimeStamp);
+            if (remainingBudget <= Clock::duration::zero())
+                return 0u;
+
+            const auto unitCost = m_sectionUnitCostEstimates[static_cast<size_t>(section)];
+            if (unitCost == Clock::duration::zero())
+                return std::numeric_limits<uint64_t>::max();
+
+            return static_cast<uint64_t>(remainingBudget / unitCost);
+        }
+
+        // Sections report their measured work to refine the prediction for next frames and to expose predicted and actual costs.
+        // Sections only get read access to the timer, cost bookkeeping therefore does not count as its state.
+        void reportSectionWork(EFrameTimerSectionBudget section, uint64_t numWorkUnits, Clock::duration actualCost) const
+        {
+            if (numWorkUnits == 0u)
+                return;
+
+            auto& frameCosts = m_currentFrameSectionCosts[static_cast<size_t>(section)];
+            frameCosts.predicted += std::chrono::duration_cast<std::chrono::microseconds>(predictSectionWorkCost(section, numWorkUnits));
+            frameCosts.actual += std::chrono::duration_cast<std::chrono::microseconds>(actualCost);
+            frameCosts.numWorkUnits += numWorkUnits;
+
+            // exponential moving average, adapts to changing content within a few frames but smooths out single spikes
+            const Clock::duration unitCost = actualCost / static_cast<Clock::rep>(numWorkUnits);
+            auto& unitCostEstimate = m_sectionUnitCostEstimates[static_cast<size_t>(section)];
+            if (unitCostEstimate == Clock::duration::zero())
+                unitCostEstimate = unitCost;
+            else
+                unitCostEstimate += (unitCost - unitCostEstimate) / UnitCostEstimateSmoothing;
+        }
+
+        // Costs reported in section during previous frame
+        [[nodiscard]] FrameTimerSectionCosts getLastFrameSectionCosts(EFrameTimerSectionBudget section) const
+        {
+            return m_lastFrameSectionCosts[static_cast<size_t>(section)];
+        }
+
     private:
         using Duration = std::chrono::microseconds;
+        static constexpr Clock::rep UnitCostEstimateSmoothing = 8;
 
         Clock::time_point m_frameStartTimeStamp;
         std::array<Duration, static_cast<size_t>(EFrameTimerSectionBudget::COUNT)> m_sectionBudgets{};
+
+        mutable std::array<Clock::duration, static_cast<size_t>(EFrameTimerSectionBudget::COUNT)> m_sectionUnitCostEstimates{};
+        mutable std::array<FrameTimerSectionCosts, static_cast<size_t>(EFrameTimerSectionBudget::COUNT)> m_currentFrameSectionCosts{};
+        std::array<FrameTimerSectionCosts, static_cast<size_t>(EFrameTimerSectionBudget::COUNT)> m_lastFrameSectionCosts{};
     };
 }
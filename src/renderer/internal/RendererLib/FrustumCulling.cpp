@@ -0,0 +1,146 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FrustumCulling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ramses::internal
+{
+    std::optional<BoundingSphere> FrustumCulling::ComputeBoundingSphere(EDataType elementType, const std::byte* data, uint32_t elementCount)
+    {
+        uint32_t componentCount = 0u;
+        switch (elementType)
+        {
+        case EDataType::Vector3F:
+            componentCount = 3u;
+            break;
+        case EDataType::Vector4F:
+            componentCount = 4u;
+            break;
+        default:
+            return std::nullopt;
+        }
+
+        if (data == nullptr || elementCount == 0u)
+            return std::nullopt;
+
+        // vertex data is a plain float array, it is not guaranteed to be aligned for glm vector types
+        const auto* components = reinterpret_cast<const float*>(data); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto getVertex = [&](uint32_t i) {
+            return components + static_cast<size_t>(i) * componentCount;
+        };
+        const auto getPosition = [&](uint32_t i) {
+            const float* vertex = getVertex(i);
+            return glm::vec3{ vertex[0], vertex[1], vertex[2] };
+        };
+
+        // homogeneous positions with other w are projected by shader (or are no positions at all)
+        if (componentCount == 4u)
+        {
+            for (uint32_t i = 0u; i < elementCount; ++i)
+            {
+                if (getVertex(i)[3] != 1.f)
+                    return std::nullopt;
+            }
+        }
+
+        // sphere around center of AABB is not minimal but good enough for culling and cheap to compute
+        glm::vec3 minPos{ std::numeric_limits<float>::max() };
+        glm::vec3 maxPos{ std::numeric_limits<float>::lowest() };
+        for (uint32_t i = 0u; i < elementCount; ++i)
+        {
+            const glm::vec3 pos = getPosition(i);
+            minPos = glm::min(minPos, pos);
+            maxPos = glm::max(maxPos, pos);
+        }
+
+        BoundingSphere sphere;
+        sphere.center = 0.5f * (minPos + maxPos);
+        float maxDistanceSquared = 0.f;
+        for (uint32_t i = 0u; i < elementCount; ++i)
+        {
+            const glm::vec3 diff = getPosition(i) - sphere.center;
+            maxDistanceSquared = std::max(maxDistanceSquared, glm::dot(diff, diff));
+        }
+        sphere.radius = std::sqrt(maxDistanceSquared);
+
+        if (!std::isfinite(sphere.radius) || !std::isfinite(sphere.center.x) || !std::isfinite(sphere.center.y) || !std::isfinite(sphere.center.z))
+            return std::nullopt;
+
+        return sphere;
+    }
+
+    BoundingSphere FrustumCulling::MergeBoundingSpheres(const BoundingSphere& sphere1, const BoundingSphere& sphere2)
+    {
+        const glm::vec3 diff = sphere2.center - sphere1.center;
+        const float distance = glm::length(diff);
+        if (distance + sphere2.radius <= sphere1.radius)
+            return sphere1;
+        if (distance + sphere1.radius <= sphere2.radius)
+            return sphere2;
+
+        BoundingSphere merged;
+        merged.radius = 0.5f * (distance + sphere1.radius + sphere2.radius);
+        merged.center = sphere1.center + diff * ((merged.radius - sphere1.radius) / distance);
+        return merged;
+    }
+
+    FrustumCulling::FrustumPlanes FrustumCulling::ExtractFrustumPlanes(const glm::mat4& viewProjectionMatrix)
+    {
+        // Gribb/Hartmann: planes are combinations of the matrix rows, glm matrices are column-major
+        const auto row = [&viewProjectionMatrix](glm::length_t r) {
+            return glm::vec4{ viewProjectionMatrix[0][r], viewProjectionMatrix[1][r], viewProjectionMatrix[2][r], viewProjectionMatrix[3][r] };
+        };
+        const glm::vec4 row0 = row(0);
+        const glm::vec4 row1 = row(1);
+        const glm::vec4 row2 = row(2);
+        const glm::vec4 row3 = row(3);
+
+        FrustumPlanes planes{
+            row3 + row0, // left
+            row3 - row0, // right
+            row3 + row1, // bottom
+            row3 - row1, // top
+            row3 + row2, // near
+            row3 - row2  // far
+        };
+
+        for (auto& plane : planes)
+        {
+            const float normalLength = glm::length(glm::vec3(plane));
+            if (normalLength > 0.f)
+                plane /= normalLength;
+        }
+
+        return planes;
+    }
+
+    BoundingSphere FrustumCulling::TransformBoundingSphere(const BoundingSphere& sphere, const glm::mat4& modelMatrix)
+    {
+        BoundingSphere result;
+        result.center = glm::vec3(modelMatrix * glm::vec4(sphere.center, 1.f));
+
+        // conservative for non-uniform scaling: use the largest axis scale
+        const float scaleX = glm::length(glm::vec3(modelMatrix[0]));
+        const float scaleY = glm::length(glm::vec3(modelMatrix[1]));
+        const float scaleZ = glm::length(glm::vec3(modelMatrix[2]));
+        result.radius = sphere.radius * std::max({ scaleX, scaleY, scaleZ });
+
+        return result;
+    }
+
+    bool FrustumCulling::IsOutsideOfFrustum(const BoundingSphere& sphere, const FrustumPlanes& frustumPlanes)
+    {
+        return std::any_of(frustumPlanes.cbegin(), frustumPlanes.cend(), [&sphere](const glm::vec4& plane) {
+            return glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius;
+        });
+    }
+}
@@ -0,0 +1,47 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/EDataType.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ramses::internal
+{
+    struct BoundingSphere
+    {
+        glm::vec3 center{ 0.f };
+        float radius = 0.f;
+
+        bool operator==(const BoundingSphere& other) const
+        {
+            return center == other.center && radius == other.radius;
+        }
+    };
+
+    class FrustumCulling
+    {
+    public:
+        // planes as (normal, distance), pointing inside of the frustum
+        using FrustumPlanes = std::array<glm::vec4, 6u>;
+
+        // Bounding sphere of tightly packed vec3 vertex data or vec4 vertex data with w equal to 1, returns nullopt for
+        // other data because it is not known how shader turns it into a position (vec2 z, vec4 w other than 1)
+        static std::optional<BoundingSphere> ComputeBoundingSphere(EDataType elementType, const std::byte* data, uint32_t elementCount);
+        // Smallest sphere enclosing both spheres
+        static BoundingSphere MergeBoundingSpheres(const BoundingSphere& sphere1, const BoundingSphere& sphere2);
+
+        static FrustumPlanes ExtractFrustumPlanes(const glm::mat4& viewProjectionMatrix);
+        static BoundingSphere TransformBoundingSphere(const BoundingSphere& sphere, const glm::mat4& modelMatrix);
+        static bool IsOutsideOfFrustum(const BoundingSphere& sphere, const FrustumPlanes& frustumPlanes);
+    };
+}
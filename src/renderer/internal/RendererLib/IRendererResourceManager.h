@@ -32,6 +32,8 @@ namespace ramses::internal
         // Immutable resources
         [[nodiscard]] virtual EResourceStatus  getResourceStatus(const ResourceContentHash& hash) const = 0;
         [[nodiscard]] virtual EResourceType    getResourceType(const ResourceContentHash& hash) const = 0;
+        // resources uploaded and ready for rendering, regardless of which scene uses them
+        [[nodiscard]] virtual ResourceContentHashVector getUploadedResources() const = 0;
 
         virtual void             referenceResourcesForScene     (SceneId sceneId, const ResourceContentHashVector& resources) = 0;
         virtual void             unreferenceResourcesForScene   (SceneId sceneId, const ResourceContentHashVector& resources) = 0;
@@ -12,6 +12,7 @@
 #include "internal/SceneGraph/SceneAPI/SceneVersionTag.h"
 #include "internal/SceneGraph/SceneAPI/DataSlot.h"
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 
 namespace ramses::internal
 {
@@ -22,6 +23,8 @@ namespace ramses::internal
 
         virtual void sendSubscribeScene(SceneId sceneId) = 0;
         virtual void sendUnsubscribeScene(SceneId sceneId) = 0;
+        // resources renderer already has, provider does not need to send their data with scene
+        virtual void sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources) = 0;
 
         virtual void sendSceneStateChanged(SceneId masterScene, SceneId referencedScene, RendererSceneState newState) = 0;
         virtual void sendSceneFlushed(SceneId masterScene, SceneId referencedScene, SceneVersionTag tag) = 0;
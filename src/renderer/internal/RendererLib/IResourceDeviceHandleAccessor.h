@@ -13,6 +13,8 @@
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/RendererLib/Types.h"
 #include "internal/RendererLib/SemanticUniformBufferHandle.h"
+#include "internal/RendererLib/FrustumCulling.h"
+#include <optional>
 
 namespace ramses::internal
 {
@@ -22,6 +24,7 @@ namespace ramses::internal
         virtual ~IResourceDeviceHandleAccessor() = default;
 
         [[nodiscard]] virtual DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& resourceHash) const = 0;
+        [[nodiscard]] virtual std::optional<BoundingSphere> getResourceBoundingSphere(const ResourceContentHash& resourceHash) const = 0;
         [[nodiscard]] virtual DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle targetHandle, SceneId sceneId) const = 0;
         [[nodiscard]] virtual DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle bufferHandle, SceneId sceneId) const = 0;
         virtual void                 getBlitPassRenderTargetsDeviceHandle(BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const = 0;
@@ -301,6 +301,17 @@ namespace ramses::internal
         m_logContext << "activate shader [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
+    bool LoggingDevice::activateInstancedShader(DeviceResourceHandle handle)
+    {
+        m_logContext << "activate instanced shader [handle: " << handle << "]" << RendererLogContext::NewLine;
+        return false;
+    }
+
+    void LoggingDevice::uploadInstanceData(const std::byte* /*data*/, uint32_t dataSize)
+    {
+        m_logContext << "upload instance data [size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     DeviceResourceHandle LoggingDevice::allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat format, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
         m_logContext << "allocate texture2d [ (w,h):(" << width << "," << height << ") mipLevelCount:" << mipLevelCount << " format:" << EnumToString(format)
@@ -535,6 +546,12 @@ namespace ramses::internal
         return 0;
     }
 
+    void LoggingDevice::getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped)
+    {
+        numIssued = 0u;
+        numSkipped = 0u;
+    }
+
     void LoggingDevice::flush()
     {
     }
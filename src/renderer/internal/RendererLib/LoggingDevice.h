@@ -68,6 +68,8 @@ namespace ramses::internal
         bool getBinaryShader(DeviceResourceHandle handle, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         void deleteShader(DeviceResourceHandle handle) override;
         void activateShader(DeviceResourceHandle handle) override;
+        bool activateInstancedShader(DeviceResourceHandle handle) override;
+        void uploadInstanceData(const std::byte* data, uint32_t dataSize) override;
         DeviceResourceHandle allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) override;
         DeviceResourceHandle allocateTexture3D(uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t dataSize) override;
         DeviceResourceHandle allocateTextureCube(uint32_t faceSize, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t dataSize) override;
@@ -107,6 +109,7 @@ namespace ramses::internal
 
         [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override;
         uint32_t getAndResetDrawCallCount() override;
+        void getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped) override;
 
         void clearDepth(float d) override;
         void clearStencil(int32_t s) override;
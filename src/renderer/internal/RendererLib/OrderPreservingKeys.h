@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Assigns 32-bit keys to values so that keys compare like the values and equal values share a key.
+    // Values are reference counted. A new value gets the key in the middle between keys of its neighbours,
+    // so keys of other values stay unchanged, only if there is no gap left all keys are spread evenly again.
+    template <typename T>
+    class OrderPreservingKeys
+    {
+    public:
+        // Returns true if keys of other values changed
+        bool add(const T& value)
+        {
+            auto [it, inserted] = m_entries.try_emplace(value);
+            ++it->second.refCount;
+            if (!inserted)
+                return false;
+
+            const int64_t lower = (it == m_entries.begin()) ? -1 : static_cast<int64_t>(std::prev(it)->second.key);
+            const auto next = std::next(it);
+            const int64_t upper = (next == m_entries.end()) ? KeyRange : static_cast<int64_t>(next->second.key);
+            if (upper - lower < 2)
+            {
+                spreadKeys();
+                return true;
+            }
+            it->second.key = static_cast<uint32_t>(lower + (upper - lower) / 2);
+            return false;
+        }
+
+        void remove(const T& value)
+        {
+            const auto it = m_entries.find(value);
+            assert(it != m_entries.end());
+            if (--it->second.refCount == 0u)
+                m_entries.erase(it);
+        }
+
+        // Replaces all values, keys are spread evenly
+        void reset(const std::vector<T>& values)
+        {
+            m_entries.clear();
+            for (const auto& value : values)
+                ++m_entries[value].refCount;
+            spreadKeys();
+        }
+
+        [[nodiscard]] uint32_t getKey(const T& value) const
+        {
+            const auto it = m_entries.find(value);
+            assert(it != m_entries.end());
+            return it->second.key;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_entries.size();
+        }
+
+    private:
+        void spreadKeys()
+        {
+            const int64_t step = KeyRange / static_cast<int64_t>(m_entries.size() + 1u);
+            int64_t key = 0;
+            for (auto& entry : m_entries)
+            {
+                key += step;
+                entry.second.key = static_cast<uint32_t>(key);
+            }
+        }
+
+        static constexpr int64_t KeyRange = int64_t{ 1 } << 32u;
+
+        struct Entry
+        {
+            uint32_t key = 0u;
+            uint32_t refCount = 0u;
+        };
+        std::map<T, Entry> m_entries;
+    };
+}
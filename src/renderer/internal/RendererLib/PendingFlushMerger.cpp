@@ -0,0 +1,172 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PendingFlushMerger.h"
+#include "internal/PlatformAbstraction/PlatformMemory.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        enum class EObjectType
+        {
+            None,
+            Transform,
+            DataField
+        };
+
+        EObjectType GetSupersedableObjectType(ESceneActionId type)
+        {
+            switch (type)
+            {
+            case ESceneActionId::SetTranslation:
+            case ESceneActionId::SetRotation:
+            case ESceneActionId::SetScaling:
+                return EObjectType::Transform;
+            // array setters always write from first element, same action size means same element count
+            case ESceneActionId::SetDataBooleanArray:
+            case ESceneActionId::SetDataIntegerArray:
+            case ESceneActionId::SetDataFloatArray:
+            case ESceneActionId::SetDataVector2fArray:
+            case ESceneActionId::SetDataVector3fArray:
+            case ESceneActionId::SetDataVector4fArray:
+            case ESceneActionId::SetDataVector2iArray:
+            case ESceneActionId::SetDataVector3iArray:
+            case ESceneActionId::SetDataVector4iArray:
+            case ESceneActionId::SetDataMatrix22fArray:
+            case ESceneActionId::SetDataMatrix33fArray:
+            case ESceneActionId::SetDataMatrix44fArray:
+                return EObjectType::DataField;
+            default:
+                return EObjectType::None;
+            }
+        }
+
+        struct LastWrite
+        {
+            ESceneActionId type;
+            uint32_t size;
+        };
+    }
+
+    size_t PendingFlushMerger::MergePendingFlushes(PendingFlushes& pendingFlushes)
+    {
+        if (pendingFlushes.size() < 2u)
+            return 0u;
+
+        PendingFlushes mergedFlushes;
+        mergedFlushes.reserve(pendingFlushes.size());
+        std::vector<bool> hasMergedActions;
+        for (auto& pendingFlush : pendingFlushes)
+        {
+            if (!mergedFlushes.empty() && CanMergeFlushes(mergedFlushes.back(), pendingFlush))
+            {
+                hasMergedActions.back() = hasMergedActions.back() || !pendingFlush.sceneActions.empty();
+                MergeFlushes(mergedFlushes.back(), std::move(pendingFlush));
+            }
+            else
+            {
+                mergedFlushes.push_back(std::move(pendingFlush));
+                hasMergedActions.push_back(false);
+            }
+        }
+
+        const size_t numMergedFlushes = pendingFlushes.size() - mergedFlushes.size();
+        for (size_t i = 0u; i < mergedFlushes.size(); ++i)
+        {
+            if (hasMergedActions[i])
+                RemoveSupersededSceneActions(mergedFlushes[i].sceneActions);
+        }
+        pendingFlushes.swap(mergedFlushes);
+
+        return numMergedFlushes;
+    }
+
+    void PendingFlushMerger::RemoveSupersededSceneActions(SceneActionCollection& actions)
+    {
+        // object handle followed by field handle in upper bits for data fields, action type for transforms
+        std::unordered_map<uint64_t, LastWrite> lastTransformWrites;
+        std::unordered_map<uint64_t, LastWrite> lastDataFieldWrites;
+
+        const uint32_t numActions = actions.numberOfActions();
+        std::vector<bool> superseded(numActions, false);
+        bool anySuperseded = false;
+        for (uint32_t i = numActions; i > 0u; --i)
+        {
+            const auto action = actions[i - 1u];
+            const EObjectType objectType = GetSupersedableObjectType(action.type());
+            if (objectType == EObjectType::None)
+                continue;
+
+            uint32_t handles[2] = { 0u, 0u }; // NOLINT(modernize-avoid-c-arrays)
+            const uint32_t numHandles = (objectType == EObjectType::DataField ? 2u : 1u);
+            if (action.size() < numHandles * sizeof(uint32_t))
+                continue;
+            PlatformMemory::Copy(handles, action.data(), numHandles * sizeof(uint32_t));
+
+            auto& lastWrites = (objectType == EObjectType::DataField ? lastDataFieldWrites : lastTransformWrites);
+            const uint64_t secondaryKey = (objectType == EObjectType::DataField ? handles[1] : static_cast<uint32_t>(action.type()));
+            const uint64_t key = (secondaryKey << 32u) | handles[0];
+
+            const LastWrite write{ action.type(), action.size() };
+            const auto it = lastWrites.find(key);
+            if (it == lastWrites.end())
+            {
+                lastWrites.emplace(key, write);
+            }
+            else if (it->second.type == write.type && it->second.size == write.size)
+            {
+                superseded[i - 1u] = true;
+                anySuperseded = true;
+            }
+            else
+            {
+                it->second = write;
+            }
+        }
+
+        if (!anySuperseded)
+            return;
+
+        SceneActionCollection remainingActions(actions.collectionData().size(), numActions);
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            if (superseded[i])
+                continue;
+            const auto action = actions[i];
+            remainingActions.addRawSceneActionInformation(action.type(), static_cast<uint32_t>(remainingActions.collectionData().size()));
+            remainingActions.appendRawData(action.data(), action.size());
+        }
+        actions.swap(remainingActions);
+    }
+
+    bool PendingFlushMerger::CanMergeFlushes(const PendingFlush& flush, const PendingFlush& nextFlush)
+    {
+        const bool flushExpires = (flush.timeInfo.expirationTimestamp != FlushTime::InvalidTimestamp);
+        const bool nextFlushExpires = (nextFlush.timeInfo.expirationTimestamp != FlushTime::InvalidTimestamp);
+        return !flush.versionTag.isValid()
+            && !flush.timeInfo.isEffectTimeSync
+            && flushExpires == nextFlushExpires;
+    }
+
+    void PendingFlushMerger::MergeFlushes(PendingFlush& flush, PendingFlush&& nextFlush)
+    {
+        flush.sceneActions.append(nextFlush.sceneActions);
+        flush.flushIndex = nextFlush.flushIndex;
+        flush.timeInfo = nextFlush.timeInfo;
+        flush.versionTag = nextFlush.versionTag;
+
+        flush.resourceDataToProvide.insert(flush.resourceDataToProvide.end(), nextFlush.resourceDataToProvide.cbegin(), nextFlush.resourceDataToProvide.cend());
+        flush.resourcesAdded.insert(flush.resourcesAdded.end(), nextFlush.resourcesAdded.cbegin(), nextFlush.resourcesAdded.cend());
+        flush.resourcesRemoved.insert(flush.resourcesRemoved.end(), nextFlush.resourcesRemoved.cbegin(), nextFlush.resourcesRemoved.cend());
+        flush.traces.insert(flush.traces.end(), nextFlush.traces.cbegin(), nextFlush.traces.cend());
+    }
+}
@@ -0,0 +1,32 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/StagingInfo.h"
+
+namespace ramses::internal
+{
+    // Folds backlog of pending flushes into as few flushes as possible so that they are applied at once
+    // without going through every intermediate state. Flushes which have to be reported individually
+    // (named flush, effect time sync) or which change expiration monitoring state end a merged flush.
+    class PendingFlushMerger
+    {
+    public:
+        // returns number of flushes merged into their predecessors
+        static size_t MergePendingFlushes(PendingFlushes& pendingFlushes);
+
+        // removes actions overwritten by later action of same type on same object (last writer wins),
+        // only actions which fully replace the state they set are considered
+        static void RemoveSupersededSceneActions(SceneActionCollection& actions);
+
+    private:
+        static bool CanMergeFlushes(const PendingFlush& flush, const PendingFlush& nextFlush);
+        static void MergeFlushes(PendingFlush& flush, PendingFlush&& nextFlush);
+    };
+}
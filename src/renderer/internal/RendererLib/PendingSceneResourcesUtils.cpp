@@ -11,6 +11,7 @@
 #include "internal/RendererLib/SceneResourceUploader.h"
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/FrameTimer.h"
+#include "internal/RendererLib/SectionWorkTracker.h"
 #include "internal/SceneGraph/SceneAPI/GeometryDataBuffer.h"
 
 namespace ramses::internal
@@ -96,9 +97,10 @@ namespace ramses::internal
                                                                IRendererResourceManager&        resourceManager,
                                                                const FrameTimer*                frameTimer)
     {
-        constexpr size_t TimeCheckPeriod = 20u;
+        constexpr uint32_t TimeCheckPeriod = 20u;
         constexpr size_t ThresholdForTimeChecking = 100u;
         const bool checkTimeSpent = (frameTimer != nullptr) && (actions.size() > ThresholdForTimeChecking);
+        SectionWorkTracker actionsWork{ checkTimeSpent ? frameTimer : nullptr, EFrameTimerSectionBudget::SceneResourcesUpload, TimeCheckPeriod, TimeCheckPeriod };
 
         for (size_t i = 0u; i < actions.size(); ++i)
         {
@@ -170,11 +172,8 @@ namespace ramses::internal
                 break;
             }
 
-            if (checkTimeSpent && ((i + 1) % TimeCheckPeriod == 0))
-            {
-                if (frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::SceneResourcesUpload))
-                    return false;
-            }
+            if (actionsWork.workDone(1u))
+                return false;
         }
 
         return true;
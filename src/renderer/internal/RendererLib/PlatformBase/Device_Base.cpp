@@ -44,4 +44,12 @@ namespace ramses::internal
         m_drawCalls = 0u;
         return dc;
     }
+
+    void Device_Base::getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped)
+    {
+        numIssued = m_uniformUpdatesIssued;
+        numSkipped = m_uniformUpdatesSkipped;
+        m_uniformUpdatesIssued = 0u;
+        m_uniformUpdatesSkipped = 0u;
+    }
 }
@@ -23,6 +23,7 @@ namespace ramses::internal
 
         // from IDevice
         uint32_t getAndResetDrawCallCount() override;
+        void     getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped) override;
         void     drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         void     drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
@@ -35,5 +36,7 @@ namespace ramses::internal
 
         RendererLimits m_limits;
         uint32_t m_drawCalls = 0u;
+        uint32_t m_uniformUpdatesIssued = 0u;
+        uint32_t m_uniformUpdatesSkipped = 0u;
     };
 }
@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/RingBufferAllocator.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    RingBufferAllocator::RingBufferAllocator(uint32_t capacity, uint32_t alignment)
+        : m_capacity(capacity)
+        , m_alignment(alignment)
+    {
+        assert(m_alignment > 0u && (m_alignment & (m_alignment - 1u)) == 0u);
+        assert(m_capacity % m_alignment == 0u);
+    }
+
+    std::optional<uint32_t> RingBufferAllocator::allocate(uint32_t size)
+    {
+        if (size == 0u || size > m_capacity)
+            return std::nullopt;
+        const uint32_t alignedSize = (size + m_alignment - 1u) & ~(m_alignment - 1u);
+
+        if (m_usedSize == 0u)
+        {
+            // ring empty, start from beginning to have whole capacity contiguous
+            m_head = 0u;
+            m_tail = 0u;
+        }
+
+        uint32_t offset = m_head;
+        uint32_t consumedSize = alignedSize;
+        if (m_head >= m_tail && m_usedSize < m_capacity)
+        {
+            if (alignedSize > m_capacity - m_head)
+            {
+                // does not fit before end of ring, skip the rest and wrap around
+                if (alignedSize > m_tail)
+                    return std::nullopt;
+                offset = 0u;
+                consumedSize += m_capacity - m_head;
+            }
+        }
+        else if (alignedSize > m_tail - m_head)
+        {
+            return std::nullopt;
+        }
+
+        m_head = (offset + alignedSize) % m_capacity;
+        m_usedSize += consumedSize;
+        m_unfencedSize += consumedSize;
+        assert(m_usedSize <= m_capacity);
+
+        return offset;
+    }
+
+    void RingBufferAllocator::fence(uint64_t fenceId)
+    {
+        if (m_unfencedSize == 0u)
+            return;
+
+        assert(m_fencedRanges.empty() || m_fencedRanges.back().fenceId < fenceId);
+        m_fencedRanges.push_back({ fenceId, m_head, m_unfencedSize });
+        m_unfencedSize = 0u;
+    }
+
+    void RingBufferAllocator::retire(uint64_t fenceId)
+    {
+        while (!m_fencedRanges.empty() && m_fencedRanges.front().fenceId <= fenceId)
+        {
+            const auto& range = m_fencedRanges.front();
+            m_tail = range.end;
+            assert(m_usedSize >= range.size);
+            m_usedSize -= range.size;
+            m_fencedRanges.pop_front();
+        }
+    }
+
+    void RingBufferAllocator::reset()
+    {
+        m_head = 0u;
+        m_tail = 0u;
+        m_usedSize = 0u;
+        m_unfencedSize = 0u;
+        m_fencedRanges.clear();
+    }
+
+    bool RingBufferAllocator::hasUnfencedAllocations() const
+    {
+        return m_unfencedSize > 0u;
+    }
+
+    uint32_t RingBufferAllocator::getUnfencedSize() const
+    {
+        return m_unfencedSize;
+    }
+
+    uint32_t RingBufferAllocator::getUsedSize() const
+    {
+        return m_usedSize;
+    }
+
+    uint32_t RingBufferAllocator::getCapacity() const
+    {
+        return m_capacity;
+    }
+}
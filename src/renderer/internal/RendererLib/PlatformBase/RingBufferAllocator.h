@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace ramses::internal
+{
+    // Sub-allocates regions of a fixed size ring of staging memory for streaming uploads.
+    // Allocator only manages offsets, memory itself and fences are owned by the device (e.g. a GL buffer and GL sync objects),
+    // so that it can be used without GPU. Allocated regions are grouped by fences: all regions allocated since previous fence
+    // are assigned to the next fence and become reusable only after that fence is retired, i.e. the GPU finished reading them.
+    // Fences must be retired in the order they were inserted.
+    class RingBufferAllocator
+    {
+    public:
+        // capacity must be multiple of alignment, alignment must be power of two
+        RingBufferAllocator(uint32_t capacity, uint32_t alignment);
+
+        // Returns offset of contiguous region of at least given size (offset is aligned),
+        // nullopt if there is not enough contiguous free memory until more fences are retired
+        [[nodiscard]] std::optional<uint32_t> allocate(uint32_t size);
+
+        // Assigns all regions allocated since last fence to given fence, does nothing if there are none.
+        // Fence IDs must be increasing.
+        void fence(uint64_t fenceId);
+        // Releases all regions assigned to given fence and all fences before it
+        void retire(uint64_t fenceId);
+        // Releases all regions including unfenced ones, e.g. when memory was replaced by new one (orphaned)
+        void reset();
+
+        [[nodiscard]] bool hasUnfencedAllocations() const;
+        [[nodiscard]] uint32_t getUnfencedSize() const;
+        [[nodiscard]] uint32_t getUsedSize() const;
+        [[nodiscard]] uint32_t getCapacity() const;
+
+    private:
+        struct FencedRange
+        {
+            uint64_t fenceId = 0u;
+            uint32_t end = 0u;
+            uint32_t size = 0u;
+        };
+
+        const uint32_t m_capacity;
+        const uint32_t m_alignment;
+
+        // regions are allocated at head and released at tail, head == tail means either empty or full ring (see m_usedSize)
+        uint32_t m_head = 0u;
+        uint32_t m_tail = 0u;
+        uint32_t m_usedSize = 0u;
+        uint32_t m_unfencedSize = 0u;
+        std::deque<FencedRange> m_fencedRanges;
+    };
+}
@@ -0,0 +1,75 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
+
+#include <cassert>
+#include <cstring>
+#include <string_view>
+
+namespace ramses::internal
+{
+    UniformBufferPool::UniformBufferPool(uint32_t capacity, uint32_t alignment)
+        : m_capacity(capacity)
+        , m_alignment(alignment)
+    {
+        assert(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+        assert(capacity % alignment == 0u);
+        m_content.reserve(capacity);
+    }
+
+    std::optional<UniformBufferPool::Range> UniformBufferPool::allocate(const std::byte* data, uint32_t size)
+    {
+        assert(size > 0u);
+        const size_t hash = std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(data), size));
+
+        const auto candidates = m_ranges.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it)
+        {
+            const auto [offset, rangeSize] = it->second;
+            if (rangeSize == size && std::memcmp(m_content.data() + offset, data, size) == 0)
+                return Range{ offset, false };
+        }
+
+        const auto offset = static_cast<uint32_t>(m_content.size());
+        const uint32_t alignedSize = (size + m_alignment - 1u) & ~(m_alignment - 1u);
+        if (alignedSize > m_capacity - offset)
+            return std::nullopt;
+
+        m_content.insert(m_content.end(), data, data + size);
+        m_content.resize(offset + alignedSize);
+        m_ranges.emplace(hash, std::make_pair(offset, size));
+
+        return Range{ offset, true };
+    }
+
+    void UniformBufferPool::reset()
+    {
+        m_content.clear();
+        m_ranges.clear();
+        ++m_generation;
+        // generation 0 is reserved to mark data not allocated in any generation
+        if (m_generation == 0u)
+            m_generation = 1u;
+    }
+
+    uint32_t UniformBufferPool::getGeneration() const
+    {
+        return m_generation;
+    }
+
+    uint32_t UniformBufferPool::getUsedSize() const
+    {
+        return static_cast<uint32_t>(m_content.size());
+    }
+
+    uint32_t UniformBufferPool::getCapacity() const
+    {
+        return m_capacity;
+    }
+}
@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Sub-allocates ranges of uniform buffer data from a single large buffer, data with identical content share the same range.
+    // Pool only manages offsets and keeps copy of the content for comparison, the buffer itself is owned by the device.
+    // Ranges are never released individually, once the pool is full it has to be reset which invalidates all ranges
+    // and starts a new generation (device is expected to re-specify buffer storage at that point).
+    class UniformBufferPool
+    {
+    public:
+        // capacity must be multiple of alignment, alignment must be power of two
+        UniformBufferPool(uint32_t capacity, uint32_t alignment);
+
+        struct Range
+        {
+            uint32_t offset = 0u;
+            bool isNew = false; // data has to be uploaded to the range
+        };
+
+        // Returns range holding given data, nullopt if data is not in pool and there is not enough free memory
+        [[nodiscard]] std::optional<Range> allocate(const std::byte* data, uint32_t size);
+        void reset();
+
+        // generation of ranges allocated from pool, never 0
+        [[nodiscard]] uint32_t getGeneration() const;
+        [[nodiscard]] uint32_t getUsedSize() const;
+        [[nodiscard]] uint32_t getCapacity() const;
+
+    private:
+        const uint32_t m_capacity;
+        const uint32_t m_alignment;
+
+        uint32_t m_generation = 1u;
+        std::vector<std::byte> m_content;
+        std::unordered_multimap<size_t, std::pair<uint32_t, uint32_t>> m_ranges; // content hash -> offset, size
+    };
+}
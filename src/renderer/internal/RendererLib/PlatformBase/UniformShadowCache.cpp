@@ -0,0 +1,40 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformShadowCache.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace ramses::internal
+{
+    bool UniformShadowCache::update(int32_t location, const void* data, size_t size)
+    {
+        assert(location >= 0);
+        const auto index = static_cast<size_t>(location);
+        if (index >= m_entries.size())
+            m_entries.resize(index + 1u);
+
+        auto& entry = m_entries[index];
+        if (entry.valid && entry.size == size && std::memcmp(m_data.data() + entry.offset, data, size) == 0)
+            return false;
+
+        // size of uniform at given location is fixed for a linked program, storage is allocated only once
+        if (!entry.valid || entry.size != size)
+        {
+            entry.offset = m_data.size();
+            entry.size = size;
+            entry.valid = true;
+            m_data.resize(m_data.size() + size);
+        }
+        if (size > 0u)
+            std::memcpy(m_data.data() + entry.offset, data, size);
+
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Shadow copy of uniform values last set on a shader program, keyed by uniform location.
+    // Uniform values are part of program state, therefore one cache per program is needed
+    // and it has to be dropped together with the program (any relink invalidates all values).
+    class UniformShadowCache
+    {
+    public:
+        // Returns true if value differs from cached value (or there is no cached value yet) and caches it,
+        // false if value is unchanged and setting it on device can be skipped.
+        bool update(int32_t location, const void* data, size_t size);
+
+    private:
+        struct Entry
+        {
+            size_t offset = 0u;
+            size_t size = 0u;
+            bool valid = false;
+        };
+
+        std::vector<Entry> m_entries;
+        std::vector<std::byte> m_data;
+    };
+}
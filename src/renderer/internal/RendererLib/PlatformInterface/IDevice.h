@@ -90,6 +90,11 @@ namespace ramses::internal
         virtual bool                    getBinaryShader             (DeviceResourceHandle handle, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) = 0;
         virtual void                    deleteShader                (DeviceResourceHandle handle) = 0;
         virtual void                    activateShader              (DeviceResourceHandle handle) = 0;
+        // activates automatically derived variant of shader taking model dependent semantic uniforms per instance (see AutoInstancing),
+        // returns false if shader has no such variant, in that case no shader is activated
+        virtual bool                    activateInstancedShader     (DeviceResourceHandle handle) = 0;
+        // per-instance data for active instanced shader variant and active vertex array, valid for next draw call only
+        virtual void                    uploadInstanceData          (const std::byte* data, uint32_t dataSize) = 0;
 
         virtual DeviceResourceHandle    allocateTexture2D           (uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) = 0;
         virtual DeviceResourceHandle    allocateTexture3D           (uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes) = 0;
@@ -134,6 +139,7 @@ namespace ramses::internal
 
         [[nodiscard]] virtual uint32_t getTotalGpuMemoryUsageInKB() const = 0;
         virtual uint32_t getAndResetDrawCallCount() = 0;
+        virtual void getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped) = 0;
 
         virtual void    validateDeviceStatusHealthy() const = 0;
         [[nodiscard]] virtual bool    isDeviceStatusHealthy() const = 0;
@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RadixSort.h"
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <utility>
+
+namespace ramses::internal
+{
+    void RadixSort::Sort(SortKeyEntries& entries, SortKeyEntries& scratch)
+    {
+        const size_t count = entries.size();
+        assert(count <= std::numeric_limits<uint32_t>::max());
+
+        if (count < MinEntriesForRadixSort)
+        {
+            for (size_t i = 1u; i < count; ++i)
+            {
+                const SortKeyEntry entry = entries[i];
+                size_t j = i;
+                for (; j > 0u && entries[j - 1u].key > entry.key; --j)
+                    entries[j] = entries[j - 1u];
+                entries[j] = entry;
+            }
+            return;
+        }
+
+        constexpr size_t NumDigits = sizeof(uint64_t);
+        constexpr size_t NumBuckets = 256u;
+        constexpr uint32_t BitsPerDigit = 8u;
+
+        // histograms of all digits are collected in a single pass over the data
+        std::array<std::array<uint32_t, NumBuckets>, NumDigits> histograms{};
+        for (const auto& entry : entries)
+        {
+            for (size_t digit = 0u; digit < NumDigits; ++digit)
+                ++histograms[digit][(entry.key >> (digit * BitsPerDigit)) & 0xFFu];
+        }
+
+        scratch.resize(count);
+        SortKeyEntries* source = &entries;
+        SortKeyEntries* destination = &scratch;
+        for (size_t digit = 0u; digit < NumDigits; ++digit)
+        {
+            const uint32_t shift = static_cast<uint32_t>(digit) * BitsPerDigit;
+            auto& histogram = histograms[digit];
+
+            // all keys have same value of this digit, pass would not change order
+            if (histogram[((*source)[0].key >> shift) & 0xFFu] == count)
+                continue;
+
+            uint32_t offset = 0u;
+            for (auto& bucket : histogram)
+            {
+                const uint32_t bucketSize = bucket;
+                bucket = offset;
+                offset += bucketSize;
+            }
+
+            for (const auto& entry : *source)
+                (*destination)[histogram[(entry.key >> shift) & 0xFFu]++] = entry;
+
+            std::swap(source, destination);
+        }
+
+        if (source != &entries)
+            entries.swap(scratch);
+    }
+}
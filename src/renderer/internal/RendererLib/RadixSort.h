@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace ramses::internal
+{
+    struct SortKeyEntry
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+    using SortKeyEntries = std::vector<SortKeyEntry>;
+
+    class RadixSort
+    {
+    public:
+        // Stable sort of entries by key (LSD radix sort, byte-wise), digits shared by all keys are skipped.
+        // Scratch is used as temporary storage and can be reused between calls to avoid allocations.
+        static void Sort(SortKeyEntries& entries, SortKeyEntries& scratch);
+
+        // below this size insertion sort is used, histogram setup would dominate
+        static constexpr size_t MinEntriesForRadixSort = 64u;
+    };
+}
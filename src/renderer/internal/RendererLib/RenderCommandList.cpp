@@ -0,0 +1,136 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        class CommandExecutor
+        {
+        public:
+            CommandExecutor(IDevice& device, const std::vector<std::byte>& data)
+                : m_device(device)
+                , m_data(data)
+            {
+            }
+
+            void operator()(const RenderCommandList::SetConstant& cmd) const
+            {
+                switch (cmd.dataType)
+                {
+                case EDataType::Float:
+                    setConstant<float>(cmd);
+                    break;
+                case EDataType::Vector2F:
+                    setConstant<glm::vec2>(cmd);
+                    break;
+                case EDataType::Vector3F:
+                    setConstant<glm::vec3>(cmd);
+                    break;
+                case EDataType::Vector4F:
+                    setConstant<glm::vec4>(cmd);
+                    break;
+                case EDataType::Bool:
+                    setConstant<bool>(cmd);
+                    break;
+                case EDataType::Int32:
+                    setConstant<int32_t>(cmd);
+                    break;
+                case EDataType::Vector2I:
+                    setConstant<glm::ivec2>(cmd);
+                    break;
+                case EDataType::Vector3I:
+                    setConstant<glm::ivec3>(cmd);
+                    break;
+                case EDataType::Vector4I:
+                    setConstant<glm::ivec4>(cmd);
+                    break;
+                case EDataType::Matrix22F:
+                    setConstant<glm::mat2>(cmd);
+                    break;
+                case EDataType::Matrix33F:
+                    setConstant<glm::mat3>(cmd);
+                    break;
+                case EDataType::Matrix44F:
+                    setConstant<glm::mat4>(cmd);
+                    break;
+                default:
+                    assert(false && "Unsupported constant data type");
+                    break;
+                }
+            }
+
+            void operator()(const RenderCommandList::Clear& cmd) const { m_device.clear(cmd.clearFlags); }
+            void operator()(const RenderCommandList::DrawIndexedTriangles& cmd) const { m_device.drawIndexedTriangles(cmd.startOffset, cmd.elementCount, cmd.instanceCount); }
+            void operator()(const RenderCommandList::DrawTriangles& cmd) const { m_device.drawTriangles(cmd.startOffset, cmd.elementCount, cmd.instanceCount); }
+            void operator()(const RenderCommandList::Flush& /*cmd*/) const { m_device.flush(); }
+            void operator()(const RenderCommandList::ColorMask& cmd) const { m_device.colorMask(cmd.r, cmd.g, cmd.b, cmd.a); }
+            void operator()(const RenderCommandList::ClearColor& cmd) const { m_device.clearColor(cmd.clearColor); }
+            void operator()(const RenderCommandList::ClearDepth& cmd) const { m_device.clearDepth(cmd.depth); }
+            void operator()(const RenderCommandList::ClearStencil& cmd) const { m_device.clearStencil(cmd.stencil); }
+            void operator()(const RenderCommandList::BlendFactors& cmd) const { m_device.blendFactors(cmd.sourceColor, cmd.destinationColor, cmd.sourceAlpha, cmd.destinationAlpha); }
+            void operator()(const RenderCommandList::BlendOperations& cmd) const { m_device.blendOperations(cmd.operationColor, cmd.operationAlpha); }
+            void operator()(const RenderCommandList::BlendColor& cmd) const { m_device.blendColor(cmd.color); }
+            void operator()(const RenderCommandList::CullMode& cmd) const { m_device.cullMode(cmd.mode); }
+            void operator()(const RenderCommandList::DepthFunc& cmd) const { m_device.depthFunc(cmd.func); }
+            void operator()(const RenderCommandList::DepthWrite& cmd) const { m_device.depthWrite(cmd.flag); }
+            void operator()(const RenderCommandList::ScissorTest& cmd) const { m_device.scissorTest(cmd.flag, cmd.region); }
+            void operator()(const RenderCommandList::StencilFunc& cmd) const { m_device.stencilFunc(cmd.func, cmd.ref, cmd.mask); }
+            void operator()(const RenderCommandList::StencilOp& cmd) const { m_device.stencilOp(cmd.sfail, cmd.dpfail, cmd.dppass); }
+            void operator()(const RenderCommandList::DrawMode& cmd) const { m_device.drawMode(cmd.mode); }
+            void operator()(const RenderCommandList::SetViewport& cmd) const { m_device.setViewport(cmd.x, cmd.y, cmd.width, cmd.height); }
+            void operator()(const RenderCommandList::ActivateUniformBuffer& cmd) const { m_device.activateUniformBuffer(cmd.handle, cmd.field); }
+            void operator()(const RenderCommandList::ActivateVertexArray& cmd) const { m_device.activateVertexArray(cmd.handle); }
+            void operator()(const RenderCommandList::ActivateShader& cmd) const { m_device.activateShader(cmd.handle); }
+            void operator()(const RenderCommandList::ActivateTexture& cmd) const { m_device.activateTexture(cmd.handle, cmd.field); }
+            void operator()(const RenderCommandList::ActivateTextureSamplerObject& cmd) const { m_device.activateTextureSamplerObject(cmd.samplerStates, cmd.field); }
+            void operator()(const RenderCommandList::ActivateRenderTarget& cmd) const { m_device.activateRenderTarget(cmd.handle); }
+            void operator()(const RenderCommandList::DiscardDepthStencil& /*cmd*/) const { m_device.discardDepthStencil(); }
+            void operator()(const RenderCommandList::BlitRenderTargets& cmd) const { m_device.blitRenderTargets(cmd.source, cmd.destination, cmd.sourceRect, cmd.destinationRect, cmd.colorOnly); }
+
+        private:
+            template <typename T>
+            void setConstant(const RenderCommandList::SetConstant& cmd) const
+            {
+                assert(cmd.dataOffset + cmd.count * sizeof(T) <= m_data.size());
+                m_device.setConstant(cmd.field, cmd.count, reinterpret_cast<const T*>(m_data.data() + cmd.dataOffset));
+            }
+
+            IDevice& m_device;
+            const std::vector<std::byte>& m_data;
+        };
+    }
+
+    void RenderCommandList::replay(IDevice& device) const
+    {
+        const CommandExecutor executor{ device, m_data };
+        for (const auto& command : m_commands)
+            std::visit(executor, command);
+    }
+
+    void RenderCommandList::clear()
+    {
+        m_commands.clear();
+        m_data.clear();
+    }
+
+    const std::vector<RenderCommandList::Command>& RenderCommandList::getCommands() const
+    {
+        return m_commands;
+    }
+
+    bool RenderCommandList::empty() const
+    {
+        return m_commands.empty();
+    }
+}
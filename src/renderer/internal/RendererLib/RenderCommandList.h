@@ -0,0 +1,128 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/Types.h"
+#include "internal/SceneGraph/SceneAPI/EDataType.h"
+#include "internal/SceneGraph/SceneAPI/RenderState.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
+#include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IDevice;
+
+    // Compact device independent list of rendering commands (states, resource bindings, uniform values and draw calls).
+    // Commands can be recorded on any thread (see RenderCommandRecorder) and replayed later on the thread owning the device,
+    // replay issues exactly the same sequence of device calls as was recorded.
+    // Uniform values are copied into a data blob owned by the list, recorded data does not reference scene memory.
+    class RenderCommandList
+    {
+    public:
+        struct SetConstant { DataFieldHandle field; uint32_t count; EDataType dataType; uint32_t dataOffset; };
+        struct Clear { ClearFlags clearFlags; };
+        struct DrawIndexedTriangles { int32_t startOffset; int32_t elementCount; uint32_t instanceCount; };
+        struct DrawTriangles { int32_t startOffset; int32_t elementCount; uint32_t instanceCount; };
+        struct Flush {};
+        struct ColorMask { bool r; bool g; bool b; bool a; };
+        struct ClearColor { glm::vec4 clearColor; };
+        struct ClearDepth { float depth; };
+        struct ClearStencil { int32_t stencil; };
+        struct BlendFactors { EBlendFactor sourceColor; EBlendFactor destinationColor; EBlendFactor sourceAlpha; EBlendFactor destinationAlpha; };
+        struct BlendOperations { EBlendOperation operationColor; EBlendOperation operationAlpha; };
+        struct BlendColor { glm::vec4 color; };
+        struct CullMode { ECullMode mode; };
+        struct DepthFunc { EDepthFunc func; };
+        struct DepthWrite { EDepthWrite flag; };
+        struct ScissorTest { EScissorTest flag; RenderState::ScissorRegion region; };
+        struct StencilFunc { EStencilFunc func; uint8_t ref; uint8_t mask; };
+        struct StencilOp { EStencilOp sfail; EStencilOp dpfail; EStencilOp dppass; };
+        struct DrawMode { EDrawMode mode; };
+        struct SetViewport { int32_t x; int32_t y; uint32_t width; uint32_t height; };
+        struct ActivateUniformBuffer { DeviceResourceHandle handle; DataFieldHandle field; };
+        struct ActivateVertexArray { DeviceResourceHandle handle; };
+        struct ActivateShader { DeviceResourceHandle handle; };
+        struct ActivateTexture { DeviceResourceHandle handle; DataFieldHandle field; };
+        struct ActivateTextureSamplerObject { TextureSamplerStates samplerStates; DataFieldHandle field; };
+        struct ActivateRenderTarget { DeviceResourceHandle handle; };
+        struct DiscardDepthStencil {};
+        struct BlitRenderTargets { DeviceResourceHandle source; DeviceResourceHandle destination; PixelRectangle sourceRect; PixelRectangle destinationRect; bool colorOnly; };
+
+        using Command = std::variant<
+            SetConstant,
+            Clear,
+            DrawIndexedTriangles,
+            DrawTriangles,
+            Flush,
+            ColorMask,
+            ClearColor,
+            ClearDepth,
+            ClearStencil,
+            BlendFactors,
+            BlendOperations,
+            BlendColor,
+            CullMode,
+            DepthFunc,
+            DepthWrite,
+            ScissorTest,
+            StencilFunc,
+            StencilOp,
+            DrawMode,
+            SetViewport,
+            ActivateUniformBuffer,
+            ActivateVertexArray,
+            ActivateShader,
+            ActivateTexture,
+            ActivateTextureSamplerObject,
+            ActivateRenderTarget,
+            DiscardDepthStencil,
+            BlitRenderTargets>;
+
+        template <typename T>
+        void addSetConstant(DataFieldHandle field, uint32_t count, const T* value);
+        template <typename T>
+        void add(T&& command);
+
+        void replay(IDevice& device) const;
+        void clear();
+
+        [[nodiscard]] const std::vector<Command>& getCommands() const;
+        [[nodiscard]] bool empty() const;
+
+    private:
+        std::vector<Command> m_commands;
+        std::vector<std::byte> m_data;
+    };
+
+    template <typename T>
+    inline void RenderCommandList::addSetConstant(DataFieldHandle field, uint32_t count, const T* value)
+    {
+        // keep values aligned within blob so that they can be passed to device as typed arrays on replay
+        constexpr size_t alignment = alignof(std::max_align_t);
+        const size_t offset = (m_data.size() + alignment - 1u) & ~(alignment - 1u);
+        const size_t size = count * sizeof(T);
+        m_data.resize(offset + size);
+        if (size > 0u)
+            std::memcpy(m_data.data() + offset, value, size);
+
+        m_commands.emplace_back(SetConstant{ field, count, TypeToEDataTypeTraits<T>::DataType, static_cast<uint32_t>(offset) });
+    }
+
+    template <typename T>
+    inline void RenderCommandList::add(T&& command)
+    {
+        m_commands.emplace_back(std::forward<T>(command));
+    }
+}
@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandPreparer.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/RendererLib/RenderExecutor.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    RenderCommandPreparer::RenderCommandPreparer(const IDevice& device, uint32_t numWorkerThreads)
+        : m_device(device)
+    {
+        m_threads.reserve(numWorkerThreads);
+        for (uint32_t i = 0u; i < numWorkerThreads; ++i)
+        {
+            m_threads.push_back(std::make_unique<PlatformThread>(fmt::format("RndPrep{}", i)));
+            m_threads.back()->start(*this);
+        }
+    }
+
+    RenderCommandPreparer::~RenderCommandPreparer()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            cancel();
+        }
+        m_scenesAvailable.notify_all();
+        for (auto& thread : m_threads)
+            thread->join();
+    }
+
+    void RenderCommandPreparer::prepare(std::vector<SceneCommands>& scenes)
+    {
+        if (scenes.empty())
+            return;
+
+        std::unique_lock lock(m_mutex);
+        assert(m_scenes == nullptr);
+        m_scenes = &scenes;
+        m_nextScene = 0u;
+        m_numScenesPrepared = 0u;
+        m_scenesAvailable.notify_all();
+
+        prepareScenes(lock);
+        m_scenesPrepared.wait(lock, [&]() { return m_numScenesPrepared == scenes.size(); });
+        m_scenes = nullptr;
+    }
+
+    void RenderCommandPreparer::PrepareScene(const IDevice& device, SceneCommands& sceneCommands)
+    {
+        assert(sceneCommands.scene != nullptr);
+        sceneCommands.commands.clear();
+        RenderCommandRecorder recorder(device, sceneCommands.commands);
+
+        // no frame timer, prepared scenes are always executed completely
+        RenderExecutor executor(recorder, sceneCommands.renderContext);
+        [[maybe_unused]] const SceneRenderExecutionIterator renderState = executor.executeScene(*sceneCommands.scene);
+        assert(renderState.getFlattenedRenderableIdx() == 0u);
+    }
+
+    void RenderCommandPreparer::run()
+    {
+        std::unique_lock lock(m_mutex);
+        while (!isCancelRequested())
+        {
+            m_scenesAvailable.wait(lock, [this]() { return isCancelRequested() || (m_scenes != nullptr && m_nextScene < m_scenes->size()); });
+            if (!isCancelRequested())
+                prepareScenes(lock);
+        }
+    }
+
+    void RenderCommandPreparer::prepareScenes(std::unique_lock<std::mutex>& lock)
+    {
+        assert(m_scenes != nullptr);
+        auto& scenes = *m_scenes;
+        while (m_nextScene < scenes.size())
+        {
+            auto& sceneCommands = scenes[m_nextScene++];
+            lock.unlock();
+            PrepareScene(m_device, sceneCommands);
+            lock.lock();
+
+            if (++m_numScenesPrepared == scenes.size())
+                m_scenesPrepared.notify_all();
+        }
+    }
+}
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderingContext.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IDevice;
+    class RendererCachedScene;
+
+    // Prepares rendering of scenes in parallel: every scene is executed by RenderExecutor on a RenderCommandRecorder,
+    // the resulting command lists are then replayed on the device by the thread owning the device context.
+    class RenderCommandPreparer : private Runnable
+    {
+    public:
+        struct SceneCommands
+        {
+            const RendererCachedScene* scene = nullptr;
+            RenderingContext renderContext;
+            RenderCommandList commands;
+        };
+
+        RenderCommandPreparer(const IDevice& device, uint32_t numWorkerThreads);
+        ~RenderCommandPreparer() override;
+
+        // Records commands of all given scenes, each with its own rendering context. Scenes are distributed among worker threads
+        // and the calling thread, returns once all are recorded. Scenes must not be modified meanwhile and every scene can be listed
+        // only once, because execution stores semantic uniform values in the scene.
+        void prepare(std::vector<SceneCommands>& scenes);
+
+        static void PrepareScene(const IDevice& device, SceneCommands& sceneCommands);
+
+    private:
+        void run() override;
+        void prepareScenes(std::unique_lock<std::mutex>& lock);
+
+        const IDevice& m_device;
+        std::vector<std::unique_ptr<PlatformThread>> m_threads;
+
+        std::mutex m_mutex;
+        std::condition_variable m_scenesAvailable;
+        std::condition_variable m_scenesPrepared;
+        std::vector<SceneCommands>* m_scenes = nullptr;
+        size_t m_nextScene = 0u;
+        size_t m_numScenesPrepared = 0u;
+    };
+}
@@ -0,0 +1,499 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/RendererLib/RenderCommandList.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    RenderCommandRecorder::RenderCommandRecorder(const IDevice& deviceDelegate, RenderCommandList& commands)
+        : m_deviceDelegate(deviceDelegate)
+        , m_commands(commands)
+    {
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const float* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec2* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec3* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec4* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const bool* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const int32_t* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec2* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec3* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec4* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat2* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat3* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat4* value)
+    {
+        m_commands.addSetConstant(field, count, value);
+        return true;
+    }
+
+    void RenderCommandRecorder::clear(ClearFlags clearFlags)
+    {
+        m_commands.add(RenderCommandList::Clear{ clearFlags });
+    }
+
+    void RenderCommandRecorder::drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount)
+    {
+        m_commands.add(RenderCommandList::DrawIndexedTriangles{ startOffset, elementCount, instanceCount });
+    }
+
+    void RenderCommandRecorder::drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount)
+    {
+        m_commands.add(RenderCommandList::DrawTriangles{ startOffset, elementCount, instanceCount });
+    }
+
+    void RenderCommandRecorder::flush()
+    {
+        m_commands.add(RenderCommandList::Flush{});
+    }
+
+    void RenderCommandRecorder::colorMask(bool r, bool g, bool b, bool a)
+    {
+        m_commands.add(RenderCommandList::ColorMask{ r, g, b, a });
+    }
+
+    void RenderCommandRecorder::clearColor(const glm::vec4& clearColor)
+    {
+        m_commands.add(RenderCommandList::ClearColor{ clearColor });
+    }
+
+    void RenderCommandRecorder::clearDepth(float d)
+    {
+        m_commands.add(RenderCommandList::ClearDepth{ d });
+    }
+
+    void RenderCommandRecorder::clearStencil(int32_t s)
+    {
+        m_commands.add(RenderCommandList::ClearStencil{ s });
+    }
+
+    void RenderCommandRecorder::blendFactors(EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha)
+    {
+        m_commands.add(RenderCommandList::BlendFactors{ sourceColor, destinationColor, sourceAlpha, destinationAlpha });
+    }
+
+    void RenderCommandRecorder::blendOperations(EBlendOperation operationColor, EBlendOperation operationAlpha)
+    {
+        m_commands.add(RenderCommandList::BlendOperations{ operationColor, operationAlpha });
+    }
+
+    void RenderCommandRecorder::blendColor(const glm::vec4& color)
+    {
+        m_commands.add(RenderCommandList::BlendColor{ color });
+    }
+
+    void RenderCommandRecorder::cullMode(ECullMode mode)
+    {
+        m_commands.add(RenderCommandList::CullMode{ mode });
+    }
+
+    void RenderCommandRecorder::depthFunc(EDepthFunc func)
+    {
+        m_commands.add(RenderCommandList::DepthFunc{ func });
+    }
+
+    void RenderCommandRecorder::depthWrite(EDepthWrite flag)
+    {
+        m_commands.add(RenderCommandList::DepthWrite{ flag });
+    }
+
+    void RenderCommandRecorder::scissorTest(EScissorTest flag, const RenderState::ScissorRegion& region)
+    {
+        m_commands.add(RenderCommandList::ScissorTest{ flag, region });
+    }
+
+    void RenderCommandRecorder::stencilFunc(EStencilFunc func, uint8_t ref, uint8_t mask)
+    {
+        m_commands.add(RenderCommandList::StencilFunc{ func, ref, mask });
+    }
+
+    void RenderCommandRecorder::stencilOp(EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        m_commands.add(RenderCommandList::StencilOp{ sfail, dpfail, dppass });
+    }
+
+    void RenderCommandRecorder::drawMode(EDrawMode mode)
+    {
+        m_commands.add(RenderCommandList::DrawMode{ mode });
+    }
+
+    void RenderCommandRecorder::setViewport(int32_t x, int32_t y, uint32_t width, uint32_t height)
+    {
+        m_commands.add(RenderCommandList::SetViewport{ x, y, width, height });
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateUniformBuffer(uint32_t /*totalSizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::uploadUniformBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::activateUniformBuffer(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        m_commands.add(RenderCommandList::ActivateUniformBuffer{ handle, field });
+    }
+
+    void RenderCommandRecorder::deleteUniformBuffer(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateVertexBuffer(uint32_t /*totalSizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::uploadVertexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::deleteVertexBuffer(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateIndexBuffer(EDataType /*dataType*/, uint32_t /*sizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::uploadIndexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::deleteIndexBuffer(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateVertexArray(const VertexArrayInfo& /*vertexArrayInfo*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::activateVertexArray(DeviceResourceHandle handle)
+    {
+        m_commands.add(RenderCommandList::ActivateVertexArray{ handle });
+    }
+
+    void RenderCommandRecorder::deleteVertexArray(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    std::unique_ptr<const GPUResource> RenderCommandRecorder::uploadShader(const EffectResource& /*effect*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return nullptr;
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::registerShader(std::unique_ptr<const GPUResource> /*shaderResource*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadBinaryShader(const EffectResource& /*effect*/, const std::byte* /*binaryShaderData*/, uint32_t /*binaryShaderDataSize*/, BinaryShaderFormatID /*binaryShaderFormat*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    bool RenderCommandRecorder::getBinaryShader(DeviceResourceHandle /*handle*/, std::vector<std::byte>& /*binaryShader*/, BinaryShaderFormatID& /*binaryShaderFormat*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return false;
+    }
+
+    void RenderCommandRecorder::deleteShader(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::activateShader(DeviceResourceHandle handle)
+    {
+        m_commands.add(RenderCommandList::ActivateShader{ handle });
+    }
+
+    bool RenderCommandRecorder::activateInstancedShader(DeviceResourceHandle /*handle*/)
+    {
+        // instanced variant might need to be compiled first, which requires device context
+        return false;
+    }
+
+    void RenderCommandRecorder::uploadInstanceData(const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        assert(false && "RenderCommandRecorder: instanced shaders are never active while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTexture2D(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTexture3D(uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, EPixelStorageFormat /*textureFormat*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTextureCube(uint32_t /*faceSize*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateExternalTexture()
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::getEmptyExternalTexture() const
+    {
+        return m_deviceDelegate.getEmptyExternalTexture();
+    }
+
+    void RenderCommandRecorder::bindTexture(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::generateMipmaps(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::uploadTextureData(DeviceResourceHandle /*handle*/, uint32_t /*mipLevel*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*z*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, const std::byte* /*data*/, uint32_t /*dataSize*/, uint32_t /*stride*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadStreamTexture2D(DeviceResourceHandle /*handle*/, uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, const std::byte* /*data*/, const TextureSwizzleArray& /*swizzle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::deleteTexture(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        m_commands.add(RenderCommandList::ActivateTexture{ handle, field });
+    }
+
+    uint32_t RenderCommandRecorder::getTextureAddress(DeviceResourceHandle handle) const
+    {
+        return m_deviceDelegate.getTextureAddress(handle);
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, ERenderBufferAccessMode /*accessMode*/, uint32_t /*sampleCount*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::deleteRenderBuffer(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadDmaRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, DmaBufferFourccFormat /*fourccFormat*/, DmaBufferUsageFlags /*usageFlags*/, DmaBufferModifiers /*modifiers*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    int RenderCommandRecorder::getDmaRenderBufferFD(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return -1;
+    }
+
+    uint32_t RenderCommandRecorder::getDmaRenderBufferStride(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return 0u;
+    }
+
+    void RenderCommandRecorder::destroyDmaRenderBuffer(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field)
+    {
+        m_commands.add(RenderCommandList::ActivateTextureSamplerObject{ samplerStates, field });
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::getFramebufferRenderTarget() const
+    {
+        return m_deviceDelegate.getFramebufferRenderTarget();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadRenderTarget(const DeviceHandleVector& /*renderBuffers*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+        return {};
+    }
+
+    void RenderCommandRecorder::activateRenderTarget(DeviceResourceHandle handle)
+    {
+        m_commands.add(RenderCommandList::ActivateRenderTarget{ handle });
+    }
+
+    void RenderCommandRecorder::deleteRenderTarget(DeviceResourceHandle /*handle*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::discardDepthStencil()
+    {
+        m_commands.add(RenderCommandList::DiscardDepthStencil{});
+    }
+
+    void RenderCommandRecorder::pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& /*renderTargets*/, const std::array<DeviceResourceHandle, 2>& /*colorBuffers*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::unpairRenderTargets(DeviceResourceHandle /*renderTarget*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::swapDoubleBufferedRenderTarget(DeviceResourceHandle /*renderTarget*/)
+    {
+        assert(false && "RenderCommandRecorder: resources cannot be managed while recording");
+    }
+
+    void RenderCommandRecorder::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly)
+    {
+        m_commands.add(RenderCommandList::BlitRenderTargets{ rtSrc, rtDst, srcRect, dstRect, colorOnly });
+    }
+
+    void RenderCommandRecorder::readPixels(uint8_t* /*buffer*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/)
+    {
+        assert(false && "RenderCommandRecorder: pixels cannot be read while recording");
+    }
+
+    uint32_t RenderCommandRecorder::getTotalGpuMemoryUsageInKB() const
+    {
+        return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
+    }
+
+    uint32_t RenderCommandRecorder::getAndResetDrawCallCount()
+    {
+        // draw calls are counted by real device on replay
+        return 0u;
+    }
+
+    void RenderCommandRecorder::getAndResetUniformUpdateCount(uint32_t& numIssued, uint32_t& numSkipped)
+    {
+        numIssued = 0u;
+        numSkipped = 0u;
+    }
+
+    void RenderCommandRecorder::validateDeviceStatusHealthy() const
+    {
+        m_deviceDelegate.validateDeviceStatusHealthy();
+    }
+
+    bool RenderCommandRecorder::isDeviceStatusHealthy() const
+    {
+        return m_deviceDelegate.isDeviceStatusHealthy();
+    }
+
+    void RenderCommandRecorder::getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>& formats) const
+    {
+        m_deviceDelegate.getSupportedBinaryProgramFormats(formats);
+    }
+
+    bool RenderCommandRecorder::isExternalTextureExtensionSupported() const
+    {
+        return m_deviceDelegate.isExternalTextureExtensionSupported();
+    }
+
+    uint32_t RenderCommandRecorder::getGPUHandle(DeviceResourceHandle deviceHandle) const
+    {
+        return m_deviceDelegate.getGPUHandle(deviceHandle);
+    }
+}
@@ -8,16 +8,22 @@
 
 #include "internal/RendererLib/RenderExecutor.h"
 #include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/FrustumCulling.h"
+#include "internal/RendererLib/AutoInstancing.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/SceneGraph/SceneAPI/BlitPass.h"
 #include "internal/Components/EffectUniformTime.h"
+#include "glm/gtc/type_ptr.hpp"
+
+#include <algorithm>
 
 namespace ramses::internal
 {
     uint32_t RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
     RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
-        : m_state(device, renderContext, frameTimer)
+        : m_state(device, renderContext)
+        , m_renderWork(frameTimer, EFrameTimerSectionBudget::OffscreenBufferRender, NumRenderablesToRenderInBetweenTimeBudgetChecks, NumRenderablesToRenderInBetweenTimeBudgetChecks)
     {
     }
 
@@ -49,6 +55,14 @@ namespace ramses::internal
         return {};
     }
 
+    bool RenderExecutor::RendersIntoDisplayBuffer(const RendererCachedScene& scene)
+    {
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        return std::any_of(orderedPasses.cbegin(), orderedPasses.cend(), [&scene](const auto& passInfo) {
+            return passInfo.getType() == ERenderingPassType::RenderPass && !scene.getRenderPass(passInfo.getRenderPassHandle()).renderTarget.isValid();
+        });
+    }
+
     bool RenderExecutor::executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const
     {
         const RenderPass& renderPass = scene.getRenderPass(pass);
@@ -98,33 +112,151 @@ namespace ramses::internal
             }
         }
 
+        // camera of the pass is set already, frustum is same for all renderables in the pass
+        std::optional<FrustumCulling::FrustumPlanes> frustumPlanes;
+        if (scene.isFrustumCullingEnabled())
+            frustumPlanes = FrustumCulling::ExtractFrustumPlanes(m_state.getProjectionMatrix() * m_state.getViewMatrix());
+
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
-            if (!scene.renderableResourcesDirty(renderableHandle))
+            uint32_t numRenderablesExecuted = 1u;
+            if (!scene.renderableResourcesDirty(renderableHandle) && !(frustumPlanes && isRenderableCulled(scene, renderableHandle, *frustumPlanes)))
             {
                 assert(!scene.isRenderableVertexArrayDirty(renderableHandle));
                 setRenderableInternalStates(renderableHandle);
                 setSemanticDataFields();
-                executeRenderable();
+
+                const uint32_t numRenderablesInstanced = (m_state.getRenderingContext().autoInstancing ? executeInstancedRenderables(scene, orderedRenderables, frustumPlanes) : 0u);
+                if (numRenderablesInstanced > 0u)
+                    numRenderablesExecuted = numRenderablesInstanced;
+                else
+                    executeRenderable();
             }
-            m_state.m_currentRenderIterator.incrementRenderableIdx();
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            for (uint32_t i = 0u; i < numRenderablesExecuted; ++i)
+                m_state.m_currentRenderIterator.incrementRenderableIdx();
+
+            if (m_renderWork.workDone(numRenderablesExecuted))
                 return false;
         }
 
         return true;
     }
 
+    bool RenderExecutor::isRenderableCulled(const RendererCachedScene& scene, RenderableHandle renderableHandle, const FrustumCulling::FrustumPlanes& frustumPlanes) const
+    {
+        const Renderable& renderable = scene.getRenderable(renderableHandle);
+        // instances can be placed anywhere by shader, bounding volume of single instance is not enough
+        if (!renderable.frustumCulling || renderable.instanceCount != 1u)
+            return false;
+
+        const auto& boundingSphere = scene.getCachedBoundingSpheres()[renderableHandle.asMemoryHandle()];
+        if (!boundingSphere)
+            return false;
+
+        RenderingContext& renderContext = m_state.getRenderingContext();
+        ++renderContext.numRenderablesTestedForCulling;
+        const BoundingSphere worldSphere = FrustumCulling::TransformBoundingSphere(*boundingSphere, scene.getRenderableWorldMatrix(renderableHandle));
+        if (!FrustumCulling::IsOutsideOfFrustum(worldSphere, frustumPlanes))
+            return false;
+
+        ++renderContext.numRenderablesCulled;
+        return true;
+    }
+
+    uint32_t RenderExecutor::executeInstancedRenderables(const RendererCachedScene& scene, const RenderableVector& orderedRenderables, const std::optional<FrustumCulling::FrustumPlanes>& frustumPlanes) const
+    {
+        const uint32_t firstIdx = m_state.m_currentRenderIterator.getRenderableIdx();
+        const Renderable& firstRenderable = scene.getRenderable(orderedRenderables[firstIdx]);
+        if (firstRenderable.instanceCount != 1u)
+            return 0u;
+
+        const uint32_t maxNumRenderables = std::min(static_cast<uint32_t>(orderedRenderables.size()) - firstIdx, AutoInstancing::MaxInstancesPerDrawCall);
+        uint32_t numRenderables = 1u;
+        while (numRenderables < maxNumRenderables && CanBeInstancedTogether(scene, firstRenderable, orderedRenderables[firstIdx + numRenderables]))
+            ++numRenderables;
+        if (numRenderables < 2u)
+            return 0u;
+
+        IDevice& device = m_state.getDevice();
+        if (!device.activateInstancedShader(m_state.shaderDeviceHandle.getState()))
+            return 0u;
+        // instanced variant is a different program, regular shader has to be activated again for next renderable
+        m_state.shaderDeviceHandle.reset();
+
+        executeRenderStates();
+        device.activateVertexArray(m_state.vertexArrayDeviceHandle);
+        executeUniformInputs(false);
+
+        // renderables share uniform data instance, per-instance semantic values are resolved into it one by one and collected
+        const DataInstanceHandle uniformData = firstRenderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataLayout& dataLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(uniformData));
+        const uint32_t fieldCount = dataLayout.getFieldCount();
+        auto& instanceData = m_state.instanceData;
+        instanceData.clear();
+        uint32_t instanceCount = 0u;
+        for (uint32_t i = 0u; i < numRenderables; ++i)
+        {
+            // first renderable was already tested for culling
+            const RenderableHandle renderableHandle = orderedRenderables[firstIdx + i];
+            if (i > 0u && frustumPlanes && isRenderableCulled(scene, renderableHandle, *frustumPlanes))
+                continue;
+
+            m_state.setRenderable(renderableHandle);
+            for (DataFieldHandle field(0u); field < fieldCount; ++field)
+            {
+                const DataFieldInfo& fieldInfo = dataLayout.getField(field);
+                if (!AutoInstancing::IsPerInstanceSemantic(fieldInfo.semantics))
+                    continue;
+
+                resolveAndSetSemanticDataField(fieldInfo.semantics, uniformData, field);
+                if (fieldInfo.dataType == EDataType::Matrix44F)
+                {
+                    const float* value = glm::value_ptr(*scene.getDataMatrix44fArray(uniformData, field));
+                    instanceData.insert(instanceData.end(), value, value + 16u);
+                }
+                else
+                {
+                    assert(fieldInfo.dataType == EDataType::Matrix33F);
+                    const float* value = glm::value_ptr(*scene.getDataMatrix33fArray(uniformData, field));
+                    instanceData.insert(instanceData.end(), value, value + 9u);
+                }
+            }
+            ++instanceCount;
+        }
+
+        device.uploadInstanceData(reinterpret_cast<const std::byte*>(instanceData.data()), static_cast<uint32_t>(instanceData.size() * sizeof(float)));
+        executeDrawCall(instanceCount);
+
+        return numRenderables;
+    }
+
+    bool RenderExecutor::CanBeInstancedTogether(const RendererCachedScene& scene, const Renderable& first, RenderableHandle otherHandle)
+    {
+        if (scene.renderableResourcesDirty(otherHandle))
+            return false;
+
+        // effect is given by layout of geometry data instance
+        const Renderable& other = scene.getRenderable(otherHandle);
+        return other.instanceCount == 1u &&
+            other.dataInstances[ERenderableDataSlotType_Geometry] == first.dataInstances[ERenderableDataSlotType_Geometry] &&
+            other.dataInstances[ERenderableDataSlotType_Uniforms] == first.dataInstances[ERenderableDataSlotType_Uniforms] &&
+            other.renderState == first.renderState &&
+            other.startIndex == first.startIndex &&
+            other.indexCount == first.indexCount &&
+            other.startVertex == first.startVertex;
+    }
+
     void RenderExecutor::executeRenderable() const
     {
         executeRenderStates();
 
         executeEffectAndInputs();
 
-        executeDrawCall();
+        const Renderable& renderable = m_state.getScene().getRenderable(m_state.getRenderable());
+        executeDrawCall(renderable.instanceCount);
     }
 
     void RenderExecutor::executeRenderTarget(RenderTargetHandle renderTarget) const
@@ -212,23 +344,35 @@ namespace ramses::internal
 
     void RenderExecutor::executeEffectAndInputs() const
     {
-        const RendererCachedScene& renderScene = m_state.getScene();
         IDevice& device = m_state.getDevice();
-        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
-        const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
-        assert(uniformData.isValid());
-
-        if (m_state.shaderDeviceHandle.hasChanged())
+        const bool shaderChanged = m_state.shaderDeviceHandle.hasChanged();
+        if (shaderChanged)
             device.activateShader(m_state.shaderDeviceHandle.getState());
 
         device.activateVertexArray(m_state.vertexArrayDeviceHandle);
 
+        // uniform values are program state, values without semantics do not change during frame
+        // and are still set on program if same data instance was rendered last with same shader
+        executeUniformInputs(!shaderChanged && !m_state.uniformInstanceState.hasChanged());
+    }
+
+    void RenderExecutor::executeUniformInputs(bool skipValuesWithoutSemantics) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
+        const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        assert(uniformData.isValid());
+
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
         const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
         const uint32_t uniformsCount = dataLayout.getFieldCount();
         for (DataFieldHandle constantField(0u); constantField < uniformsCount; ++constantField)
         {
             const DataFieldInfo& field = dataLayout.getField(constantField);
+            if (skipValuesWithoutSemantics && field.semantics == EFixedSemantics::Invalid
+                && field.dataType != EDataType::UniformBuffer && !IsTextureSamplerType(field.dataType))
+                continue;
+
             if (field.dataType == EDataType::DataReference)
             {
                 DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
@@ -401,7 +545,7 @@ namespace ramses::internal
         }
     }
 
-    void RenderExecutor::executeDrawCall() const
+    void RenderExecutor::executeDrawCall(uint32_t instanceCount) const
     {
         IDevice& device = m_state.getDevice();
         const auto& renderScene = m_state.getScene();
@@ -409,11 +553,11 @@ namespace ramses::internal
 
         if (m_state.vertexArrayUsesIndices)
         {
-            device.drawIndexedTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawIndexedTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), instanceCount);
         }
         else
         {
-            device.drawTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), instanceCount);
         }
     }
 
@@ -429,10 +573,20 @@ namespace ramses::internal
         const RendererCachedScene& renderScene = m_state.getScene();
         const Renderable& renderable = renderScene.getRenderable(renderableHandle);
 
+        auto& stateChanges = m_state.getRenderingContext().stateChanges;
+
         const DeviceResourceHandle effectDeviceHandle = renderScene.getRenderableEffectDeviceHandle(renderableHandle);
         m_state.shaderDeviceHandle.setState(effectDeviceHandle);
+        if (m_state.shaderDeviceHandle.hasChanged())
+            ++stateChanges.shaders;
+
+        m_state.uniformInstanceState.setState(renderable.dataInstances[ERenderableDataSlotType_Uniforms]);
+        if (m_state.uniformInstanceState.hasChanged())
+            ++stateChanges.uniformInstances;
 
         const auto& vertexArray = renderScene.getCachedHandlesForVertexArrays()[m_state.getRenderable().asMemoryHandle()];
+        if (m_state.vertexArrayDeviceHandle != vertexArray.deviceHandle)
+            ++stateChanges.vertexArrays;
         m_state.vertexArrayDeviceHandle = vertexArray.deviceHandle;
         m_state.vertexArrayUsesIndices = vertexArray.usesIndexArray;
 
@@ -471,6 +625,11 @@ namespace ramses::internal
         m_state.cullModeState.setState(renderState.cullMode);
 
         m_state.drawMode = renderState.drawMode;
+
+        if (m_state.scissorState.hasChanged() || m_state.depthFuncState.hasChanged() || m_state.depthWriteState.hasChanged() || m_state.stencilState.hasChanged() ||
+            m_state.blendFactorsState.hasChanged() || m_state.blendOperationsState.hasChanged() || m_state.blendColorState.hasChanged() ||
+            m_state.colorWriteMaskState.hasChanged() || m_state.cullModeState.hasChanged())
+            ++stateChanges.renderStates;
     }
 
     void RenderExecutor::activateRenderTarget(RenderTargetHandle renderTarget) const
@@ -9,8 +9,11 @@
 #pragma once
 
 #include "internal/RendererLib/RenderExecutorInternalState.h"
+#include "internal/RendererLib/SectionWorkTracker.h"
+#include "internal/RendererLib/FrustumCulling.h"
 #include "internal/SceneGraph/SceneAPI/EDataType.h"
 #include "internal/SceneGraph/SceneAPI/EFixedSemantics.h"
+#include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 
 namespace ramses::internal
 {
@@ -19,6 +22,7 @@ namespace ramses::internal
     class FrameTimer;
     class IScene;
     struct DataFieldInfo;
+    struct Renderable;
 
     class RenderExecutor
     {
@@ -27,19 +31,26 @@ namespace ramses::internal
 
         [[nodiscard]] SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
 
-        // This is exposed and can be modified but acts as a global parameter
+        // Scene with render pass into display buffer, the first such pass executes display buffer clear pending in rendering context
+        [[nodiscard]] static bool RendersIntoDisplayBuffer(const RendererCachedScene& scene);
+
+        // This is exposed and can be modified but acts as a global parameter.
+        // Interruptible rendering always renders this many renderables before checking time budget first, further checks are adaptive
+        // based on predicted cost of renderables (see SectionWorkTracker) but at most this many renderables apart.
         static constexpr const uint32_t DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks = 10u;
         static uint32_t NumRenderablesToRenderInBetweenTimeBudgetChecks;
 
     protected:
         mutable RenderExecutorInternalState m_state;
+        mutable SectionWorkTracker          m_renderWork;
 
         void executeRenderable      () const;
         void executeRenderTarget    (RenderTargetHandle renderTarget) const;
         void executeRenderStates    () const;
         void executeEffectAndInputs () const;
+        void executeUniformInputs   (bool skipValuesWithoutSemantics) const;
         void executeConstant        (const DataFieldInfo& field, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const;
-        void executeDrawCall        () const;
+        void executeDrawCall        (uint32_t instanceCount) const;
 
         void setGlobalInternalStates    (const RendererCachedScene& scene) const;
         void setRenderableInternalStates(RenderableHandle renderableHandle) const;
@@ -54,6 +65,9 @@ namespace ramses::internal
         [[nodiscard]] bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
         [[nodiscard]] bool canDiscardDepthBuffer() const;
+        [[nodiscard]] bool isRenderableCulled(const RendererCachedScene& scene, RenderableHandle renderableHandle, const FrustumCulling::FrustumPlanes& frustumPlanes) const;
+        [[nodiscard]] uint32_t executeInstancedRenderables(const RendererCachedScene& scene, const RenderableVector& orderedRenderables, const std::optional<FrustumCulling::FrustumPlanes>& frustumPlanes) const;
+        [[nodiscard]] static bool CanBeInstancedTogether(const RendererCachedScene& scene, const Renderable& first, RenderableHandle otherHandle);
 
         static RenderBufferHandle FindDepthRenderBufferInRenderTarget(const IScene& scene, RenderTargetHandle renderTarget);
     };
@@ -12,11 +12,10 @@
 
 namespace ramses::internal
 {
-    RenderExecutorInternalState::RenderExecutorInternalState(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
+    RenderExecutorInternalState::RenderExecutorInternalState(IDevice& device, RenderingContext& renderContext)
         : m_currentRenderIterator(renderContext.renderFrom)
         , m_device(device)
         , m_renderContext(renderContext)
-        , m_frameTimer(frameTimer)
     {
         // Currently framebuffer is default render target and invalid RT handle is used to refer to it.
         // For that reason the cached state here needs to be set to another 'invalid' so it can properly
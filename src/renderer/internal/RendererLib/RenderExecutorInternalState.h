@@ -13,9 +13,9 @@
 #include "internal/SceneGraph/SceneAPI/Viewport.h"
 #include "internal/RendererLib/SceneRenderExecutionIterator.h"
 #include "internal/RendererLib/RenderingContext.h"
-#include "internal/RendererLib/FrameTimer.h"
 #include "internal/RendererLib/RenderExecutorInternalRenderStates.h"
 #include <optional>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -65,7 +65,7 @@ namespace ramses::internal
     class RenderExecutorInternalState
     {
     public:
-        RenderExecutorInternalState(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr);
+        RenderExecutorInternalState(IDevice& device, RenderingContext& renderContext);
 
         [[nodiscard]] IDevice& getDevice() const;
 
@@ -86,9 +86,8 @@ namespace ramses::internal
         void                           setRenderable(RenderableHandle renderable);
         [[nodiscard]] RenderableHandle getRenderable() const;
 
-        [[nodiscard]] bool hasExceededTimeBudgetForRendering() const;
-
         CachedState<DeviceResourceHandle> shaderDeviceHandle;
+        CachedState<DataInstanceHandle>   uniformInstanceState;
         DeviceResourceHandle              vertexArrayDeviceHandle;
         bool                              vertexArrayUsesIndices = false;
         CachedState<ScissorState>         scissorState;
@@ -105,6 +104,9 @@ namespace ramses::internal
         CachedState<Viewport>             viewportState;
         EDrawMode                         drawMode{};
 
+        // per-instance data of automatically instanced renderables, kept to avoid re-allocations
+        std::vector<float>                instanceData;
+
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
     private:
@@ -122,8 +124,6 @@ namespace ramses::internal
         glm::vec3                   m_cameraWorldPosition{0.f};
 
         CachedState < CameraHandle >       m_camera;
-
-        const FrameTimer* const            m_frameTimer;
     };
 
     inline RenderableHandle RenderExecutorInternalState::getRenderable() const
@@ -186,9 +186,4 @@ namespace ramses::internal
     {
         return m_modelViewProjectionMatrix;
     }
-
-    inline bool RenderExecutorInternalState::hasExceededTimeBudgetForRendering() const
-    {
-        return m_frameTimer != nullptr ? m_frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : false;
-    }
 }
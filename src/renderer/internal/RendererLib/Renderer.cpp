@@ -15,6 +15,7 @@
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/RendererLib/RenderingContext.h"
 #include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RenderExecutor.h"
 #include "internal/RendererLib/DisplayController.h"
 #include "internal/RendererLib/RendererLogContext.h"
 #include "internal/RendererLib/DisplayConfigData.h"
@@ -108,6 +109,9 @@ namespace ramses::internal
         m_displayBuffersSetup.registerDisplayBuffer(m_frameBufferDeviceHandle, { 0, 0, m_displayController->getDisplayWidth(), m_displayController->getDisplayHeight() },
             DefaultClearColor, false, displayConfig.getAntialiasingSampleCount(), false);
         setClearColor(m_frameBufferDeviceHandle, displayConfig.getClearColor());
+        m_autoInstancingEnabled = displayConfig.isAutoInstancingEnabled();
+        if (displayConfig.getRenderPreparationThreadCount() > 0u)
+            m_renderCommandPreparer = std::make_unique<RenderCommandPreparer>(m_displayController->getRenderBackend().getDevice(), displayConfig.getRenderPreparationThreadCount());
 
         LOG_TRACE(CONTEXT_PROFILING, "RamsesRenderer::createDisplayContext finished creating display");
     }
@@ -120,6 +124,8 @@ namespace ramses::internal
         if (m_platform.getSystemCompositorController() != nullptr)
             systemCompositorDestroyIviSurface(m_displayController->getRenderBackend().getWindow().getWaylandIviSurfaceID());
 
+        m_renderCommandPreparer.reset();
+        m_tempSceneCommands.clear();
         m_displayController.reset();
         m_platform.destroyRenderBackend();
     }
@@ -274,6 +280,7 @@ namespace ramses::internal
         renderContext.displayBufferClearPending = displayBufferInfo.clearFlags;
         renderContext.displayBufferClearColor = displayBufferInfo.clearColor;
         renderContext.displayBufferDepthDiscard = false; // discarding is not meant for default framebuffer, see Device_GL::discardDepthStencil()
+        renderContext.autoInstancing = m_autoInstancingEnabled;
 
         // FB was marked for re-render but has no shown scenes -> clear it
         const auto& assignedScenes = displayBufferInfo.scenes;
@@ -281,15 +288,13 @@ namespace ramses::internal
         if (!hasAnyShownScene)
             m_displayController->clearBuffer(m_frameBufferDeviceHandle, displayBufferInfo.clearFlags, displayBufferInfo.clearColor);
 
+        m_tempScenesToRender.clear();
         for (const auto& sceneInfo : assignedScenes)
         {
             if (sceneInfo.shown)
-            {
-                const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
-                onSceneWasRendered(scene);
-            }
+                m_tempScenesToRender.push_back(sceneInfo.sceneId);
         }
+        renderScenes(m_tempScenesToRender, renderContext, false);
 
         processScheduledScreenshots(m_frameBufferDeviceHandle);
 
@@ -316,6 +321,7 @@ namespace ramses::internal
             renderContext.viewportHeight = displayBufferInfo.viewport.height;
             renderContext.displayBufferClearPending = displayBufferInfo.clearFlags;
             renderContext.displayBufferClearColor = displayBufferInfo.clearColor;
+            renderContext.autoInstancing = m_autoInstancingEnabled;
 
             m_tempScenesToRender.clear();
             for (const auto& assignedScene : displayBufferInfo.scenes)
@@ -328,17 +334,9 @@ namespace ramses::internal
             if (m_tempScenesToRender.empty())
                 m_displayController->clearBuffer(displayBuffer, displayBufferInfo.clearFlags, displayBufferInfo.clearColor);
 
-            for (const auto& sceneId : m_tempScenesToRender)
-            {
-                // offscreen buffer depth component may be discarded after last scene rendered into it and it is not kept for next frame (clear is enabled)
-                if (sceneId == m_tempScenesToRender.back()
-                    && displayBufferInfo.clearFlags.isSet(EClearFlag::Depth) && displayBufferInfo.clearFlags.isSet(EClearFlag::Stencil))
-                    renderContext.displayBufferDepthDiscard = true;
-
-                const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
-                onSceneWasRendered(scene);
-            }
+            // offscreen buffer depth component may be discarded after last scene rendered into it and it is not kept for next frame (clear is enabled)
+            const bool discardDepth = displayBufferInfo.clearFlags.isSet(EClearFlag::Depth) && displayBufferInfo.clearFlags.isSet(EClearFlag::Stencil);
+            renderScenes(m_tempScenesToRender, renderContext, discardDepth);
 
             processScheduledScreenshots(displayBuffer);
 
@@ -364,6 +362,7 @@ namespace ramses::internal
             renderContext.viewportWidth = displayBufferInfo.viewport.width;
             renderContext.viewportHeight = displayBufferInfo.viewport.height;
             renderContext.displayBufferClearPending = EClearFlag::None; // set clear flags accordingly below only if not in interrupted state
+            renderContext.autoInstancing = m_autoInstancingEnabled;
 
             const auto& assignedScenes = displayBufferInfo.scenes;
             if (!m_rendererInterruptState.isInterrupted(displayBuffer))
@@ -406,7 +405,7 @@ namespace ramses::internal
                 }
                 m_rendererInterruptState = RendererInterruptState{};
 
-                onSceneWasRendered(scene);
+                onSceneWasRendered(scene, renderContext);
                 LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers scene fully rendered to interruptible OB {}, scene {}", displayBuffer.asMemoryHandle(), sceneId.getValue());
             }
 
@@ -477,11 +476,68 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
     }
 
-    void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
+    void Renderer::renderScenes(const std::vector<SceneId>& scenes, RenderingContext& renderContext, bool discardDepthAfterLastScene)
+    {
+        if (m_renderCommandPreparer && scenes.size() > 1u)
+        {
+            renderPreparedScenes(scenes, renderContext, discardDepthAfterLastScene);
+            return;
+        }
+
+        for (const auto& sceneId : scenes)
+        {
+            if (sceneId == scenes.back() && discardDepthAfterLastScene)
+                renderContext.displayBufferDepthDiscard = true;
+
+            const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
+            m_displayController->renderScene(scene, renderContext, nullptr);
+            onSceneWasRendered(scene, renderContext);
+        }
+    }
+
+    void Renderer::renderPreparedScenes(const std::vector<SceneId>& scenes, const RenderingContext& renderContext, bool discardDepthAfterLastScene)
+    {
+        // every scene is prepared with its own copy of rendering context, the state which is passed from one scene to next one
+        // when rendered sequentially is the pending clear of display buffer, it is consumed by first scene rendering into it
+        m_tempSceneCommands.resize(scenes.size());
+        bool clearPending = true;
+        for (size_t i = 0u; i < scenes.size(); ++i)
+        {
+            auto& sceneCommands = m_tempSceneCommands[i];
+            sceneCommands.scene = &m_rendererScenes.getScene(scenes[i]);
+            sceneCommands.renderContext = renderContext;
+            sceneCommands.renderContext.autoInstancing = false;
+            sceneCommands.renderContext.displayBufferDepthDiscard = discardDepthAfterLastScene && (i + 1u == scenes.size());
+            if (!clearPending)
+                sceneCommands.renderContext.displayBufferClearPending = EClearFlag::None;
+            else if (RenderExecutor::RendersIntoDisplayBuffer(*sceneCommands.scene))
+                clearPending = false;
+        }
+
+        m_renderCommandPreparer->prepare(m_tempSceneCommands);
+
+        IDevice& device = m_displayController->getRenderBackend().getDevice();
+        for (auto& sceneCommands : m_tempSceneCommands)
+        {
+            sceneCommands.commands.replay(device);
+            onSceneWasRendered(*sceneCommands.scene, sceneCommands.renderContext);
+        }
+    }
+
+    void Renderer::onSceneWasRendered(const RendererCachedScene& scene, RenderingContext& renderContext)
     {
         scene.markAllRenderOncePassesAsRendered();
+        scene.markRenderTargetsAsRendered();
         m_expirationMonitor.onRendered(scene.getSceneId());
         m_statistics.sceneRendered(scene.getSceneId());
+        if (renderContext.numRenderablesTestedForCulling > 0u)
+        {
+            m_statistics.renderablesCulled(scene.getSceneId(), renderContext.numRenderablesTestedForCulling, renderContext.numRenderablesCulled);
+            renderContext.numRenderablesTestedForCulling = 0u;
+            renderContext.numRenderablesCulled = 0u;
+        }
+        m_profilerStatistics.addStateChanges(renderContext.stateChanges);
+        renderContext.stateChanges = {};
     }
 
     void Renderer::assignSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle buffer, int32_t globalSceneOrder)
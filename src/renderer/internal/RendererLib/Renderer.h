@@ -15,6 +15,7 @@
 #include "internal/RendererLib/RendererInterruptState.h"
 #include "internal/RendererLib/DisplaySetup.h"
 #include "internal/RendererLib/DisplayEventHandler.h"
+#include "internal/RendererLib/RenderCommandPreparer.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 
@@ -33,6 +34,7 @@ namespace ramses::internal
     class RendererEventCollector;
     class FrameTimer;
     class SceneExpirationMonitor;
+    struct RenderingContext;
 
     class Renderer
     {
@@ -111,13 +113,17 @@ namespace ramses::internal
         void renderToOffscreenBuffers();
         void renderToInterruptibleOffscreenBuffers();
         void processScheduledScreenshots(DeviceResourceHandle renderTargetHandle);
-        void onSceneWasRendered(const RendererCachedScene& scene);
+        void renderScenes(const std::vector<SceneId>& scenes, RenderingContext& renderContext, bool discardDepthAfterLastScene);
+        void renderPreparedScenes(const std::vector<SceneId>& scenes, const RenderingContext& renderContext, bool discardDepthAfterLastScene);
+        void onSceneWasRendered(const RendererCachedScene& scene, RenderingContext& renderContext);
 
         DisplayHandle                          m_display;
         IPlatform&                             m_platform;
 
         std::unique_ptr<IDisplayController>    m_displayController;
         bool                                   m_canRenderFrame = true;
+        bool                                   m_autoInstancingEnabled = false;
+        std::unique_ptr<RenderCommandPreparer> m_renderCommandPreparer;
         DeviceResourceHandle                   m_frameBufferDeviceHandle;
         DisplaySetup                           m_displayBuffersSetup;
         std::unordered_map<DeviceResourceHandle, ScreenshotInfo> m_screenshots;
@@ -134,5 +140,6 @@ namespace ramses::internal
 
         // temporary containers kept to avoid re-allocations
         std::vector<SceneId> m_tempScenesToRender;
+        std::vector<RenderCommandPreparer::SceneCommands> m_tempSceneCommands;
     };
 }
@@ -7,9 +7,9 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/RendererCachedScene.h"
-#include "internal/RendererLib/RenderableComparator.h"
 #include "RenderingPassOrderComparator.h"
 #include <algorithm>
+#include <optional>
 
 namespace ramses::internal
 {
@@ -19,40 +19,310 @@ namespace ramses::internal
     {
     }
 
+    RenderableHandle RendererCachedScene::allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle)
+    {
+        const RenderableHandle renderable = BaseT::allocateRenderable(nodeHandle, handle);
+        setRenderableStateChanged(renderable);
+        return renderable;
+    }
+
+    void RendererCachedScene::releaseRenderable(RenderableHandle renderableHandle)
+    {
+        BaseT::releaseRenderable(renderableHandle);
+        setRenderableStateChanged(renderableHandle);
+        if (renderableHandle.asMemoryHandle() < m_renderableGroups.size())
+            m_renderableGroups[renderableHandle.asMemoryHandle()].clear();
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        BaseT::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+        if (slot == ERenderableDataSlotType_Geometry || (slot == ERenderableDataSlotType_Uniforms && m_hasStateSortedPasses))
+        {
+            setRenderableStateChanged(renderableHandle);
+            m_renderableOrderingDirty = true;
+        }
+    }
+
+    void RendererCachedScene::setRenderableStartIndex(RenderableHandle renderableHandle, uint32_t startIndex)
+    {
+        BaseT::setRenderableStartIndex(renderableHandle, startIndex);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderableIndexCount(RenderableHandle renderableHandle, uint32_t indexCount)
+    {
+        BaseT::setRenderableIndexCount(renderableHandle, indexCount);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
+    {
+        BaseT::setRenderableRenderState(renderableHandle, stateHandle);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+        setRenderableStateChanged(renderableHandle);
+        m_renderableOrderingDirty = true;
+    }
+
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
         BaseT::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+        setAllPassRenderablesDirty();
+    }
+
+    void RendererCachedScene::setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount)
+    {
+        BaseT::setRenderableInstanceCount(renderableHandle, instanceCount);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderableStartVertex(RenderableHandle renderableHandle, uint32_t startVertex)
+    {
+        BaseT::setRenderableStartVertex(renderableHandle, startVertex);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        BaseT::setRenderableFrustumCulling(renderableHandle, enabled);
+        SetChanged(m_renderablesChanged, renderableHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateBlendFactors(RenderStateHandle stateHandle, EBlendFactor srcColor, EBlendFactor destColor, EBlendFactor srcAlpha, EBlendFactor destAlpha)
+    {
+        BaseT::setRenderStateBlendFactors(stateHandle, srcColor, destColor, srcAlpha, destAlpha);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateBlendOperations(RenderStateHandle stateHandle, EBlendOperation operationColor, EBlendOperation operationAlpha)
+    {
+        BaseT::setRenderStateBlendOperations(stateHandle, operationColor, operationAlpha);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateBlendColor(RenderStateHandle stateHandle, const glm::vec4& color)
+    {
+        BaseT::setRenderStateBlendColor(stateHandle, color);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateCullMode(RenderStateHandle stateHandle, ECullMode cullMode)
+    {
+        BaseT::setRenderStateCullMode(stateHandle, cullMode);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateDrawMode(RenderStateHandle stateHandle, EDrawMode drawMode)
+    {
+        BaseT::setRenderStateDrawMode(stateHandle, drawMode);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateDepthFunc(RenderStateHandle stateHandle, EDepthFunc func)
+    {
+        BaseT::setRenderStateDepthFunc(stateHandle, func);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateDepthWrite(RenderStateHandle stateHandle, EDepthWrite flag)
+    {
+        BaseT::setRenderStateDepthWrite(stateHandle, flag);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateScissorTest(RenderStateHandle stateHandle, EScissorTest flag, const RenderState::ScissorRegion& region)
+    {
+        BaseT::setRenderStateScissorTest(stateHandle, flag, region);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateStencilFunc(RenderStateHandle stateHandle, EStencilFunc func, uint8_t ref, uint8_t mask)
+    {
+        BaseT::setRenderStateStencilFunc(stateHandle, func, ref, mask);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateStencilOps(RenderStateHandle stateHandle, EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        BaseT::setRenderStateStencilOps(stateHandle, sfail, dpfail, dppass);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setRenderStateColorWriteMask(RenderStateHandle stateHandle, ColorWriteMask colorMask)
+    {
+        BaseT::setRenderStateColorWriteMask(stateHandle, colorMask);
+        SetChanged(m_renderStatesChanged, stateHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const float* data)
+    {
+        BaseT::setDataFloatArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec2* data)
+    {
+        BaseT::setDataVector2fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec3* data)
+    {
+        BaseT::setDataVector3fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec4* data)
+    {
+        BaseT::setDataVector4fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataBooleanArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const bool* data)
+    {
+        BaseT::setDataBooleanArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const int32_t* data)
+    {
+        BaseT::setDataIntegerArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec2* data)
+    {
+        BaseT::setDataVector2iArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec3* data)
+    {
+        BaseT::setDataVector3iArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec4* data)
+    {
+        BaseT::setDataVector4iArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat2* data)
+    {
+        BaseT::setDataMatrix22fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat3* data)
+    {
+        BaseT::setDataMatrix33fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat4* data)
+    {
+        BaseT::setDataMatrix44fArray(containerHandle, field, elementCount, data);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride)
+    {
+        BaseT::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
+    {
+        BaseT::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
+    {
+        BaseT::setDataReference(containerHandle, field, dataRef);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::setDataUniformBuffer(DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle)
+    {
+        BaseT::setDataUniformBuffer(containerHandle, field, uniformBufferHandle);
+        SetChanged(m_dataInstancesChanged, containerHandle.asMemoryHandle());
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        for (const auto& entry : BaseT::getRenderGroup(groupHandle).renderables)
+        {
+            auto& groups = m_renderableGroups[entry.renderable.asMemoryHandle()];
+            groups.erase(std::remove(groups.begin(), groups.end(), groupHandle), groups.end());
+        }
         BaseT::releaseRenderGroup(groupHandle);
-        m_renderableOrderingDirty = true;
+        setAllPassRenderablesDirty();
     }
 
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order)
     {
         BaseT::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+        if (renderableHandle.asMemoryHandle() >= m_renderableGroups.size())
+            m_renderableGroups.resize(renderableHandle.asMemoryHandle() + 1u);
+        m_renderableGroups[renderableHandle.asMemoryHandle()].push_back(groupHandle);
+        setRenderGroupSortingDirty(groupHandle);
+        setAllPassRenderablesDirty();
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
+        // removal keeps order of remaining renderables, no need to re-sort the group
         BaseT::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+        auto& groups = m_renderableGroups[renderableHandle.asMemoryHandle()];
+        groups.erase(std::remove(groups.begin(), groups.end(), groupHandle), groups.end());
+        setAllPassRenderablesDirty();
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
+        setRenderPassInputsChanged(passHandle);
         m_renderOncePassesToRender.remove(passHandle);
         BaseT::releaseRenderPass(passHandle);
+        if (passHandle.asMemoryHandle() < m_passRenderablesDirty.size())
+            m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassClearColor(RenderPassHandle passHandle, const glm::vec4& clearColor)
+    {
+        BaseT::setRenderPassClearColor(passHandle, clearColor);
+        setRenderPassInputsChanged(passHandle);
+    }
+
+    void RendererCachedScene::setRenderPassClearFlag(RenderPassHandle passHandle, ClearFlags clearFlag)
+    {
+        BaseT::setRenderPassClearFlag(passHandle, clearFlag);
+        setRenderPassInputsChanged(passHandle);
+    }
+
+    void RendererCachedScene::setRenderPassCamera(RenderPassHandle passHandle, CameraHandle cameraHandle)
+    {
+        BaseT::setRenderPassCamera(passHandle, cameraHandle);
+        setRenderPassInputsChanged(passHandle);
+        // pass without camera is not rendered
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setRenderPassRenderTarget(RenderPassHandle passHandle, RenderTargetHandle targetHandle)
+    {
+        // previous render target has to be rendered without this pass
+        setRenderPassInputsChanged(passHandle);
+        BaseT::setRenderPassRenderTarget(passHandle, targetHandle);
+        setRenderPassInputsChanged(passHandle);
+    }
+
     void RendererCachedScene::setRenderPassRenderOrder(RenderPassHandle passHandle, int32_t renderOrder)
     {
         BaseT::setRenderPassRenderOrder(passHandle, renderOrder);
+        setRenderPassInputsChanged(passHandle);
         m_renderableOrderingDirty = true;
     }
 
@@ -91,6 +361,36 @@ namespace ramses::internal
         return resultHandle;
     }
 
+    void RendererCachedScene::releaseRenderTarget(RenderTargetHandle targetHandle)
+    {
+        BaseT::releaseRenderTarget(targetHandle);
+        invalidateRenderTargetContent(targetHandle);
+    }
+
+    void RendererCachedScene::addRenderTargetRenderBuffer(RenderTargetHandle targetHandle, RenderBufferHandle bufferHandle)
+    {
+        BaseT::addRenderTargetRenderBuffer(targetHandle, bufferHandle);
+        invalidateRenderTargetContent(targetHandle);
+    }
+
+    void RendererCachedScene::setRenderBufferProperties(RenderBufferHandle handle, uint32_t width, uint32_t height, uint32_t sampleCount)
+    {
+        BaseT::setRenderBufferProperties(handle, width, height, sampleCount);
+        m_allRenderTargetsDirty = true;
+    }
+
+    void RendererCachedScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data)
+    {
+        BaseT::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+        SetChanged(m_dataBuffersChanged, handle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::updateUniformBuffer(UniformBufferHandle uniformBufferHandle, uint32_t offset, uint32_t size, const std::byte* data)
+    {
+        BaseT::updateUniformBuffer(uniformBufferHandle, offset, size, data);
+        SetChanged(m_uniformBuffersChanged, uniformBufferHandle.asMemoryHandle());
+    }
+
     void RendererCachedScene::releaseTextureBuffer(TextureBufferHandle handle)
     {
         TextureLinkCachedScene::releaseTextureBuffer(handle);
@@ -105,11 +405,13 @@ namespace ramses::internal
         assert(mipLevel < update.size());
         auto& area = update[mipLevel];
         area = area.getBoundingQuad(Quad{static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width), static_cast<int32_t>(height)});
+        SetChanged(m_textureBuffersChanged, handle.asMemoryHandle());
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled)
     {
         BaseT::setRenderPassEnabled(passHandle, isEnabled);
+        setRenderPassInputsChanged(passHandle);
         if (isEnabled && BaseT::getRenderPass(passHandle).isRenderOnce)
         {
             m_renderOncePassesToRender.put(passHandle);
@@ -124,6 +426,7 @@ namespace ramses::internal
     void RendererCachedScene::setRenderPassRenderOnce(RenderPassHandle passHandle, bool enable)
     {
         BaseT::setRenderPassRenderOnce(passHandle, enable);
+        setRenderPassInputsChanged(passHandle);
         if (enable && BaseT::getRenderPass(passHandle).isEnabled)
         {
             m_renderOncePassesToRender.put(passHandle);
@@ -145,33 +448,97 @@ namespace ramses::internal
         }
     }
 
+    void RendererCachedScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassStateSorting(passHandle, enable);
+        // state sorted keys are not maintained while there is no pass using them
+        if (enable && !m_hasStateSortedPasses)
+            m_renderableStateKeysDirty = true;
+        if (passHandle.asMemoryHandle() < m_passRenderablesDirty.size())
+            m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
+        m_renderableOrderingDirty = true;
+    }
+
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         BaseT::addRenderGroupToRenderPass(passHandle, groupHandle, order);
+        if (passHandle.asMemoryHandle() < m_passRenderablesDirty.size())
+            m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
         m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         BaseT::removeRenderGroupFromRenderPass(passHandle, groupHandle);
+        if (passHandle.asMemoryHandle() < m_passRenderablesDirty.size())
+            m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
         m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order)
     {
         BaseT::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+        setRenderGroupSortingDirty(groupHandleParent);
+        setAllPassRenderablesDirty();
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         BaseT::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
+        setAllPassRenderablesDirty();
+    }
+
+    void RendererCachedScene::setRenderGroupSortingDirty(RenderGroupHandle groupHandle)
+    {
+        // groups not yet tracked will be marked dirty when the tracking vector is resized
+        if (groupHandle.asMemoryHandle() < m_renderGroupSortingDirty.size())
+            m_renderGroupSortingDirty[groupHandle.asMemoryHandle()] = true;
+    }
+
+    void RendererCachedScene::setRenderableStateChanged(RenderableHandle renderable)
+    {
+        if (!IsChanged(m_renderableStateChanged, renderable.asMemoryHandle()))
+        {
+            SetChanged(m_renderableStateChanged, renderable.asMemoryHandle());
+            m_renderablesWithChangedState.push_back(renderable);
+        }
+    }
+
+    void RendererCachedScene::setAllPassRenderablesDirty()
+    {
+        std::fill(m_passRenderablesDirty.begin(), m_passRenderablesDirty.end(), true);
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setRenderPassInputsChanged(RenderPassHandle passHandle)
+    {
+        SetChanged(m_renderPassesChanged, passHandle.asMemoryHandle());
+        // render target rendered by pass so far has to be re-rendered even if pass does not render into it anymore
+        if (BaseT::isRenderPassAllocated(passHandle))
+            invalidateRenderTargetContent(BaseT::getRenderPass(passHandle).renderTarget);
+    }
+
+    void RendererCachedScene::invalidateRenderTargetContent(RenderTargetHandle renderTarget)
+    {
+        if (renderTarget.asMemoryHandle() < m_renderTargetsContentValid.size())
+            m_renderTargetsContentValid[renderTarget.asMemoryHandle()] = false;
+    }
+
+    void RendererCachedScene::SetChanged(BoolVector& changedFlags, MemoryHandle handle)
+    {
+        if (handle >= changedFlags.size())
+            changedFlags.resize(handle + 1u, false);
+        changedFlags[handle] = true;
+    }
+
+    bool RendererCachedScene::IsChanged(const BoolVector& changedFlags, MemoryHandle handle)
+    {
+        return handle < changedFlags.size() && changedFlags[handle];
+    }
+
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
     {
-        return m_sortedRenderingPasses;
+        return m_skipsRenderTargetPasses ? m_passesToRender : m_sortedRenderingPasses;
     }
 
     const RenderableVector& RendererCachedScene::getOrderedRenderablesForPass(RenderPassHandle pass) const
@@ -182,26 +549,65 @@ namespace ramses::internal
 
     void RendererCachedScene::updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor)
     {
+        if (m_hasRenderTargetPasses)
+        {
+            // renderables whose resources get resolved now might be rendered with different resources than before
+            updateRenderablesResourcesDirtiness();
+            for (const auto& renderableIt : getRenderables())
+            {
+                if (renderableResourcesDirty(renderableIt.first))
+                    SetChanged(m_renderablesChanged, renderableIt.first.asMemoryHandle());
+            }
+        }
+
         updateRenderableResources(resourceAccessor);
         updatePassRenderableSorting();
     }
 
     void RendererCachedScene::updatePassRenderableSorting()
     {
+        // rebuilding all keys at once is cheaper than updating most of them one by one
+        if (m_renderableStateKeysDirty || 2u * m_renderablesWithChangedState.size() > BaseT::getRenderableCount())
+        {
+            updateRenderableStateKeys();
+            // keys changed, all groups have to be re-sorted
+            m_renderGroupSortingDirty.assign(BaseT::getRenderGroupCount(), true);
+            setAllPassRenderablesDirty();
+            m_renderableStateKeysDirty = false;
+        }
+        else if (!m_renderablesWithChangedState.empty())
+        {
+            // only groups of changed renderables have to be re-sorted unless keys of all renderables changed
+            if (updateChangedRenderableStateKeys())
+                m_renderGroupSortingDirty.assign(BaseT::getRenderGroupCount(), true);
+            setAllPassRenderablesDirty();
+        }
+
         if (m_renderableOrderingDirty)
         {
             m_sortedRenderingPasses.clear();
+            // passes to render are selected from new pass list
+            m_skipsRenderTargetPasses = false;
 
             const uint32_t totalNumberOfRenderPasses = BaseT::getRenderPassCount();
             const uint32_t totalNumberOfBlitPasses = BaseT::getBlitPassCount();
+            m_renderGroupSortingDirty.resize(BaseT::getRenderGroupCount(), true);
 
             //add render passes
             m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+            m_passRenderablesDirty.resize(totalNumberOfRenderPasses, true);
             for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
             {
-                m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
                 if (shouldRenderPassBeRendered(passHandle))
+                {
                     m_sortedRenderingPasses.emplace_back(passHandle);
+                }
+                else
+                {
+                    // pass is not rendered, its renderables will be collected again once it is
+                    m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
+                    m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
+                }
             }
 
             //add blit passes
@@ -223,11 +629,18 @@ namespace ramses::internal
             RenderingPassOrderComparator comparator(*this);
             std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
 
-            //update renderables according to sorted render passes
+            m_hasRenderTargetPasses = std::any_of(m_sortedRenderingPasses.cbegin(), m_sortedRenderingPasses.cend(), [this](const auto& pass) {
+                return pass.getType() == ERenderingPassType::RenderPass && BaseT::getRenderPass(pass.getRenderPassHandle()).renderTarget.isValid();
+            });
+
+            //update renderables of passes affected by changes
             for (const auto& pass : m_sortedRenderingPasses)
             {
-                if (ERenderingPassType::RenderPass == pass.getType())
+                if (ERenderingPassType::RenderPass == pass.getType() && m_passRenderablesDirty[pass.getRenderPassHandle().asMemoryHandle()])
+                {
                     updateRenderablesInPass(pass.getRenderPassHandle());
+                    m_passRenderablesDirty[pass.getRenderPassHandle().asMemoryHandle()] = false;
+                }
             }
 
             m_renderableOrderingDirty = false;
@@ -240,19 +653,182 @@ namespace ramses::internal
         return m_renderableMatrices[renderable.asMemoryHandle()];
     }
 
+    RendererCachedScene::RenderableSortedState RendererCachedScene::getRenderableSortedState(const Renderable& renderable) const
+    {
+        const DataInstanceHandle geometry = renderable.dataInstances[ERenderableDataSlotType_Geometry];
+        const ResourceContentHash effectHash = geometry.isValid() ? getDataLayout(getLayoutOfDataInstance(geometry)).getEffectHash() : ResourceContentHash::Invalid();
+        return { effectHash, renderable.dataInstances[ERenderableDataSlotType_Uniforms].asMemoryHandle(), geometry.asMemoryHandle(), renderable.renderState.asMemoryHandle() };
+    }
+
+    RendererCachedScene::RenderableState RendererCachedScene::ToRenderableState(const RenderableSortedState& sortedState)
+    {
+        return { std::get<0>(sortedState), std::get<2>(sortedState), std::get<3>(sortedState) };
+    }
+
+    void RendererCachedScene::updateRenderableStateKeys()
+    {
+        m_hasStateSortedPasses = false;
+        for (RenderPassHandle pass(0u); pass < BaseT::getRenderPassCount(); ++pass)
+            m_hasStateSortedPasses |= (BaseT::isRenderPassAllocated(pass) && BaseT::getRenderPass(pass).stateSorting);
+
+        const uint32_t renderableCount = BaseT::getRenderableCount();
+        m_renderableStates.assign(renderableCount, {});
+        m_renderableStateRegistered.assign(renderableCount, false);
+        std::vector<RenderableState> states;
+        std::vector<RenderableSortedState> sortedStates;
+        states.reserve(renderableCount);
+        for (const auto& renderableIt : getRenderables())
+        {
+            const MemoryHandle index = renderableIt.first.asMemoryHandle();
+            m_renderableStates[index] = getRenderableSortedState(*renderableIt.second);
+            m_renderableStateRegistered[index] = true;
+            states.push_back(ToRenderableState(m_renderableStates[index]));
+            if (m_hasStateSortedPasses)
+                sortedStates.push_back(m_renderableStates[index]);
+        }
+        m_stateKeys.reset(states);
+        m_stateSortedKeys.reset(sortedStates);
+        updateAllRenderableStateKeysFromValues();
+
+        m_renderablesWithChangedState.clear();
+        m_renderableStateChanged.assign(renderableCount, false);
+    }
+
+    bool RendererCachedScene::updateChangedRenderableStateKeys()
+    {
+        const uint32_t renderableCount = BaseT::getRenderableCount();
+        m_renderableStates.resize(renderableCount);
+        m_renderableStateRegistered.resize(renderableCount, false);
+        m_renderableStateKeys.resize(renderableCount, 0u);
+        if (m_hasStateSortedPasses)
+            m_renderableStateSortedKeys.resize(renderableCount, 0u);
+
+        bool allKeysChanged = false;
+        for (const RenderableHandle renderable : m_renderablesWithChangedState)
+        {
+            const MemoryHandle index = renderable.asMemoryHandle();
+            m_renderableStateChanged[index] = false;
+
+            // values registered for renderable are replaced by its current state, keys of other renderables are kept
+            if (m_renderableStateRegistered[index])
+            {
+                m_stateKeys.remove(ToRenderableState(m_renderableStates[index]));
+                if (m_hasStateSortedPasses)
+                    m_stateSortedKeys.remove(m_renderableStates[index]);
+                m_renderableStateRegistered[index] = false;
+            }
+            if (!BaseT::isRenderableAllocated(renderable))
+                continue;
+
+            const RenderableSortedState& sortedState = m_renderableStates[index] = getRenderableSortedState(getRenderable(renderable));
+            m_renderableStateRegistered[index] = true;
+            allKeysChanged |= m_stateKeys.add(ToRenderableState(sortedState));
+            m_renderableStateKeys[index] = m_stateKeys.getKey(ToRenderableState(sortedState));
+            if (m_hasStateSortedPasses)
+            {
+                allKeysChanged |= m_stateSortedKeys.add(sortedState);
+                m_renderableStateSortedKeys[index] = m_stateSortedKeys.getKey(sortedState);
+            }
+
+            if (index < m_renderableGroups.size())
+            {
+                for (const RenderGroupHandle group : m_renderableGroups[index])
+                    setRenderGroupSortingDirty(group);
+            }
+        }
+        m_renderablesWithChangedState.clear();
+
+        if (allKeysChanged)
+            updateAllRenderableStateKeysFromValues();
+        return allKeysChanged;
+    }
+
+    void RendererCachedScene::updateAllRenderableStateKeysFromValues()
+    {
+        const uint32_t renderableCount = BaseT::getRenderableCount();
+        m_renderableStateKeys.assign(renderableCount, 0u);
+        m_renderableStateSortedKeys.assign(m_hasStateSortedPasses ? renderableCount : 0u, 0u);
+        for (MemoryHandle index = 0u; index < renderableCount; ++index)
+        {
+            if (!m_renderableStateRegistered[index])
+                continue;
+            m_renderableStateKeys[index] = m_stateKeys.getKey(ToRenderableState(m_renderableStates[index]));
+            if (m_hasStateSortedPasses)
+                m_renderableStateSortedKeys[index] = m_stateSortedKeys.getKey(m_renderableStates[index]);
+        }
+    }
+
+    void RendererCachedScene::sortRenderablesInRenderGroup(RenderGroup& renderGroup)
+    {
+        RenderableOrderVector& renderables = renderGroup.renderables;
+
+        m_sortKeys.clear();
+        for (uint32_t i = 0u; i < static_cast<uint32_t>(renderables.size()); ++i)
+        {
+            const RenderableOrderEntry& entry = renderables[i];
+            assert(entry.renderable.asMemoryHandle() < m_renderableStateKeys.size());
+            // flip sign bit so that signed render order is ordered correctly as unsigned
+            const uint64_t orderKey = static_cast<uint32_t>(entry.order) ^ 0x80000000u;
+            m_sortKeys.push_back({ (orderKey << 32u) | m_renderableStateKeys[entry.renderable.asMemoryHandle()], i });
+        }
+        RadixSort::Sort(m_sortKeys, m_sortKeysScratch);
+
+        m_sortedGroupRenderables.clear();
+        for (const auto& sortKey : m_sortKeys)
+            m_sortedGroupRenderables.push_back(renderables[sortKey.index]);
+        renderables.swap(m_sortedGroupRenderables);
+    }
+
     void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
     {
         RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        // keep previous renderables to detect change of pass content
+        orderedRenderables.swap(m_previousPassRenderables);
+        orderedRenderables.clear();
 
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
 
         std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
 
+        m_collectStateSortBuckets = getRenderPass(passHandle).stateSorting;
+        m_stateSortBucketStarts.clear();
         for(const auto& renderGroup : orderedRenderGroups)
         {
             addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
         }
+
+        if (m_collectStateSortBuckets)
+        {
+            sortRenderablesInPassByState(orderedRenderables);
+            m_collectStateSortBuckets = false;
+        }
+
+        if (orderedRenderables != m_previousPassRenderables)
+            SetChanged(m_renderPassesChanged, passHandle.asMemoryHandle());
+    }
+
+    void RendererCachedScene::sortRenderablesInPassByState(RenderableVector& orderedRenderables)
+    {
+        assert(m_renderableStateSortedKeys.size() == BaseT::getRenderableCount());
+        m_stateSortBucketStarts.push_back(orderedRenderables.size());
+        for (size_t bucket = 0u; bucket + 1u < m_stateSortBucketStarts.size(); ++bucket)
+        {
+            const size_t begin = m_stateSortBucketStarts[bucket];
+            const size_t end = m_stateSortBucketStarts[bucket + 1u];
+            if (end - begin < 2u)
+                continue;
+
+            m_sortKeys.clear();
+            for (size_t i = begin; i < end; ++i)
+                m_sortKeys.push_back({ m_renderableStateSortedKeys[orderedRenderables[i].asMemoryHandle()], static_cast<uint32_t>(i) });
+            RadixSort::Sort(m_sortKeys, m_sortKeysScratch);
+
+            m_stateSortedRenderables.clear();
+            for (const auto& sortKey : m_sortKeys)
+                m_stateSortedRenderables.push_back(orderedRenderables[sortKey.index]);
+            std::copy(m_stateSortedRenderables.cbegin(), m_stateSortedRenderables.cend(), orderedRenderables.begin() + static_cast<std::ptrdiff_t>(begin));
+        }
     }
 
     static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
@@ -268,13 +844,31 @@ namespace ramses::internal
         assert(isRenderGroupAllocated(renderGroupHandle));
 
         RenderGroup& renderGroup = getRenderGroupInternal(renderGroupHandle);
-        // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently
-        RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
-        RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
+        // we sort in-place in scene's RenderGroup, so the group only needs to be sorted again if its content or renderable state keys change
+        if (m_renderGroupSortingDirty[renderGroupHandle.asMemoryHandle()])
+        {
+            sortRenderablesInRenderGroup(renderGroup);
+            std::sort(renderGroup.renderGroups.begin(), renderGroup.renderGroups.end());
+            m_renderGroupSortingDirty[renderGroupHandle.asMemoryHandle()] = false;
+        }
+        const RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
+        const RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
 
-        RenderableComparator renderableComp(*this);
-        std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        // for state sorted pass, renderables of this group with equal render order form a bucket which may be reordered,
+        // renderables of nested groups always start a new bucket
+        std::optional<int32_t> bucketOrder;
+        const auto addRenderable = [&](const RenderableOrderEntry& entry) {
+            if (m_collectStateSortBuckets && bucketOrder != entry.order)
+            {
+                m_stateSortBucketStarts.push_back(orderedRenderables.size());
+                bucketOrder = entry.order;
+            }
+            AddRenderable(*this, orderedRenderables, entry.renderable);
+        };
+        const auto addRenderGroup = [&](RenderGroupHandle nestedGroup) {
+            addRenderablesFromRenderGroup(orderedRenderables, nestedGroup);
+            bucketOrder.reset();
+        };
 
         auto renderablesIterator = orderedGroupRenderables.begin();
         auto renderGroupIterator = orderedRenderGroups.begin();
@@ -283,24 +877,24 @@ namespace ramses::internal
         {
             if (renderGroupIterator == orderedRenderGroups.end())
             {
-                AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                addRenderable(*renderablesIterator);
                 ++renderablesIterator;
             }
             else if (renderablesIterator == orderedGroupRenderables.end())
             {
-                addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                addRenderGroup(renderGroupIterator->renderGroup);
                 ++renderGroupIterator;
             }
             else
             {
                 if (renderablesIterator->order < renderGroupIterator->order)
                 {
-                    AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                    addRenderable(*renderablesIterator);
                     ++renderablesIterator;
                 }
                 else
                 {
-                    addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                    addRenderGroup(renderGroupIterator->renderGroup);
                     ++renderGroupIterator;
                 }
             }
@@ -317,7 +911,17 @@ namespace ramses::internal
                 assert(renderable.isValid());
                 const NodeHandle node = getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
+                setRenderableWorldMatrix(renderable, updateMatrixCache(ETransformationMatrixType_World, node));
+            }
+        }
+
+        m_cameraViewMatrices.resize(BaseT::getCameraCount());
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (pass.getType() == ERenderingPassType::RenderPass)
+            {
+                const CameraHandle camera = BaseT::getRenderPass(pass.getRenderPassHandle()).camera;
+                setCameraViewMatrix(camera, updateMatrixCache(ETransformationMatrixType_Object, BaseT::getCamera(camera).node));
             }
         }
     }
@@ -332,11 +936,41 @@ namespace ramses::internal
                 assert(renderable.isValid());
                 const NodeHandle node = BaseT::getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCacheWithLinks(ETransformationMatrixType_World, node);
+                setRenderableWorldMatrix(renderable, updateMatrixCacheWithLinks(ETransformationMatrixType_World, node));
+            }
+        }
+
+        m_cameraViewMatrices.resize(BaseT::getCameraCount());
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (pass.getType() == ERenderingPassType::RenderPass)
+            {
+                const CameraHandle camera = BaseT::getRenderPass(pass.getRenderPassHandle()).camera;
+                setCameraViewMatrix(camera, updateMatrixCacheWithLinks(ETransformationMatrixType_Object, BaseT::getCamera(camera).node));
             }
         }
     }
 
+    void RendererCachedScene::setRenderableWorldMatrix(RenderableHandle renderable, const glm::mat4& worldMatrix)
+    {
+        glm::mat4& cachedMatrix = m_renderableMatrices[renderable.asMemoryHandle()];
+        if (cachedMatrix != worldMatrix)
+        {
+            cachedMatrix = worldMatrix;
+            SetChanged(m_renderablesChanged, renderable.asMemoryHandle());
+        }
+    }
+
+    void RendererCachedScene::setCameraViewMatrix(CameraHandle camera, const glm::mat4& viewMatrix)
+    {
+        glm::mat4& cachedMatrix = m_cameraViewMatrices[camera.asMemoryHandle()];
+        if (cachedMatrix != viewMatrix)
+        {
+            cachedMatrix = viewMatrix;
+            SetChanged(m_camerasChanged, camera.asMemoryHandle());
+        }
+    }
+
     bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
     {
         if (!BaseT::isRenderPassAllocated(handle))
@@ -381,4 +1015,283 @@ namespace ramses::internal
             m_renderableOrderingDirty = true;
         }
     }
+
+    void RendererCachedScene::markAllRenderTargetsDirty()
+    {
+        m_allRenderTargetsDirty = true;
+    }
+
+    void RendererCachedScene::updateRenderTargetsToRender(bool skipUnchangedRenderTargets)
+    {
+        m_skipsRenderTargetPasses = false;
+        m_renderTargetsToRender.clear();
+        if (!skipUnchangedRenderTargets || !m_hasRenderTargetPasses)
+            return;
+
+        const uint32_t renderTargetCount = BaseT::getRenderTargetCount();
+        m_renderTargetsContentValid.resize(renderTargetCount, false);
+        m_renderTargetDeviceHandles.resize(renderTargetCount);
+        m_renderTargetsIncomplete.assign(renderTargetCount, false);
+        m_renderTargetsToRenderFlags.assign(renderTargetCount, false);
+        m_renderBuffersDirty.assign(BaseT::getRenderBufferCount(), false);
+        m_sampledRenderBuffers.clear();
+        m_dataInstanceInputStates.assign(BaseT::getDataInstanceCount(), 0u);
+
+        const DeviceHandleVector& renderTargetDeviceHandles = getCachedHandlesForRenderTargets();
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (pass.getType() == ERenderingPassType::BlitPass)
+            {
+                // blit passes are always executed, passes rendering into blit destination cannot keep their previous content
+                const RenderBufferHandle destination = BaseT::getBlitPass(pass.getBlitPassHandle()).destinationRenderBuffer;
+                m_renderBuffersDirty[destination.asMemoryHandle()] = true;
+                continue;
+            }
+
+            const RenderPassHandle passHandle = pass.getRenderPassHandle();
+            const RenderTargetHandle renderTarget = BaseT::getRenderPass(passHandle).renderTarget;
+            if (!renderTarget.isValid())
+                continue;
+
+            const MemoryHandle rtIndex = renderTarget.asMemoryHandle();
+            const DeviceResourceHandle deviceHandle = (rtIndex < renderTargetDeviceHandles.size() ? renderTargetDeviceHandles[rtIndex] : DeviceResourceHandle::Invalid());
+            if (!deviceHandle.isValid())
+                m_renderTargetsIncomplete[rtIndex] = true;
+            if (deviceHandle != m_renderTargetDeviceHandles[rtIndex])
+            {
+                m_renderTargetDeviceHandles[rtIndex] = deviceHandle;
+                m_renderTargetsContentValid[rtIndex] = false;
+            }
+
+            // inputs of all passes are evaluated to collect their dependencies on render buffers and incomplete renderables
+            const bool inputsChanged = haveRenderPassInputsChanged(passHandle, renderTarget);
+            if (inputsChanged || m_allRenderTargetsDirty || !m_renderTargetsContentValid[rtIndex])
+                m_renderTargetsToRenderFlags[rtIndex] = true;
+        }
+
+        propagateRenderTargetDirtiness();
+
+        m_passesToRender.clear();
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (pass.getType() == ERenderingPassType::RenderPass)
+            {
+                const RenderTargetHandle renderTarget = BaseT::getRenderPass(pass.getRenderPassHandle()).renderTarget;
+                if (renderTarget.isValid())
+                {
+                    const MemoryHandle rtIndex = renderTarget.asMemoryHandle();
+                    if (!m_renderTargetsToRenderFlags[rtIndex])
+                    {
+                        m_skipsRenderTargetPasses = true;
+                        continue;
+                    }
+
+                    // content is invalid until render target is rendered
+                    m_renderTargetsContentValid[rtIndex] = false;
+                    if (std::find(m_renderTargetsToRender.cbegin(), m_renderTargetsToRender.cend(), renderTarget) == m_renderTargetsToRender.cend())
+                        m_renderTargetsToRender.push_back(renderTarget);
+                }
+            }
+            m_passesToRender.push_back(pass);
+        }
+
+        // all changes are reflected in render targets selected to be rendered
+        for (auto* changedFlags : { &m_renderablesChanged, &m_renderStatesChanged, &m_dataInstancesChanged, &m_renderPassesChanged,
+                                    &m_camerasChanged, &m_dataBuffersChanged, &m_textureBuffersChanged, &m_uniformBuffersChanged })
+        {
+            std::fill(changedFlags->begin(), changedFlags->end(), false);
+        }
+        m_allRenderTargetsDirty = false;
+    }
+
+    void RendererCachedScene::markRenderTargetsAsRendered() const
+    {
+        for (const auto renderTarget : m_renderTargetsToRender)
+            m_renderTargetsContentValid[renderTarget.asMemoryHandle()] = !m_renderTargetsIncomplete[renderTarget.asMemoryHandle()];
+        m_renderTargetsToRender.clear();
+    }
+
+    bool RendererCachedScene::haveRenderPassInputsChanged(RenderPassHandle passHandle, RenderTargetHandle renderTarget)
+    {
+        const RenderPass& renderPass = BaseT::getRenderPass(passHandle);
+        // render once pass is only in list of passes when it is supposed to be rendered
+        bool changed = renderPass.isRenderOnce
+            || IsChanged(m_renderPassesChanged, passHandle.asMemoryHandle())
+            || IsChanged(m_camerasChanged, renderPass.camera.asMemoryHandle());
+        changed |= haveDataInstanceInputsChanged(BaseT::getCamera(renderPass.camera).dataInstance, renderTarget);
+
+        for (const auto renderable : m_passRenderableOrder[passHandle.asMemoryHandle()])
+            changed |= haveRenderableInputsChanged(renderable, renderTarget);
+
+        return changed;
+    }
+
+    bool RendererCachedScene::haveRenderableInputsChanged(RenderableHandle renderable, RenderTargetHandle renderTarget)
+    {
+        bool changed = false;
+        if (renderableResourcesDirty(renderable))
+        {
+            // renderable will not be rendered, render target has to be rendered again once it is complete
+            m_renderTargetsIncomplete[renderTarget.asMemoryHandle()] = true;
+            changed = true;
+        }
+
+        const Renderable& renderableData = BaseT::getRenderable(renderable);
+        changed |= IsChanged(m_renderablesChanged, renderable.asMemoryHandle()) || IsChanged(m_renderStatesChanged, renderableData.renderState.asMemoryHandle());
+        for (const auto dataInstance : renderableData.dataInstances)
+        {
+            if (dataInstance.isValid())
+                changed |= haveDataInstanceInputsChanged(dataInstance, renderTarget);
+        }
+
+        return changed;
+    }
+
+    namespace
+    {
+        enum EDataInstanceInputState : uint8_t
+        {
+            EDataInstanceInputState_Evaluated = 1u,
+            EDataInstanceInputState_Changed = 2u,
+            EDataInstanceInputState_SamplesRenderBuffer = 4u,
+        };
+    }
+
+    bool RendererCachedScene::haveDataInstanceInputsChanged(DataInstanceHandle dataInstance, RenderTargetHandle renderTarget)
+    {
+        uint8_t& state = m_dataInstanceInputStates[dataInstance.asMemoryHandle()];
+        if ((state & EDataInstanceInputState_Evaluated) == 0u)
+            state = evaluateDataInstanceInputs(dataInstance);
+
+        if ((state & EDataInstanceInputState_SamplesRenderBuffer) != 0u)
+        {
+            const DataLayout& layout = BaseT::getDataLayout(BaseT::getLayoutOfDataInstance(dataInstance));
+            for (DataFieldHandle field(0u); field < layout.getFieldCount(); ++field)
+            {
+                if (IsTextureSamplerType(layout.getField(field).dataType))
+                {
+                    const TextureSamplerHandle sampler = BaseT::getDataTextureSamplerHandle(dataInstance, field);
+                    if (sampler.isValid() && BaseT::getTextureSampler(sampler).isRenderBuffer())
+                        m_sampledRenderBuffers.emplace_back(renderTarget, RenderBufferHandle{ BaseT::getTextureSampler(sampler).contentHandle });
+                }
+            }
+        }
+
+        return (state & EDataInstanceInputState_Changed) != 0u;
+    }
+
+    uint8_t RendererCachedScene::evaluateDataInstanceInputs(DataInstanceHandle dataInstance) const
+    {
+        bool changed = IsChanged(m_dataInstancesChanged, dataInstance.asMemoryHandle());
+        bool samplesRenderBuffer = false;
+
+        const DataLayout& layout = BaseT::getDataLayout(BaseT::getLayoutOfDataInstance(dataInstance));
+        for (DataFieldHandle field(0u); field < layout.getFieldCount(); ++field)
+        {
+            const DataFieldInfo& fieldInfo = layout.getField(field);
+            switch (fieldInfo.semantics)
+            {
+            // values provided by renderer which are not tracked
+            case EFixedSemantics::TimeMs:
+            case EFixedSemantics::DisplayBufferResolution:
+            case EFixedSemantics::FramebufferBlock:
+            case EFixedSemantics::SceneBlock:
+                changed = true;
+                break;
+            default:
+                break;
+            }
+
+            if (fieldInfo.dataType == EDataType::DataReference)
+            {
+                changed |= IsChanged(m_dataInstancesChanged, BaseT::getDataReference(dataInstance, field).asMemoryHandle());
+            }
+            else if (fieldInfo.dataType == EDataType::UniformBuffer)
+            {
+                changed |= IsChanged(m_uniformBuffersChanged, BaseT::getDataUniformBuffer(dataInstance, field).asMemoryHandle());
+            }
+            else if (IsBufferDataType(fieldInfo.dataType))
+            {
+                changed |= IsChanged(m_dataBuffersChanged, BaseT::getDataResource(dataInstance, field).dataBuffer.asMemoryHandle());
+            }
+            else if (IsTextureSamplerType(fieldInfo.dataType))
+            {
+                const TextureSamplerHandle sampler = BaseT::getDataTextureSamplerHandle(dataInstance, field);
+                if (!sampler.isValid())
+                    continue;
+
+                const TextureSampler& samplerData = BaseT::getTextureSampler(sampler);
+                switch (samplerData.contentType)
+                {
+                case TextureSampler::ContentType::TextureBuffer:
+                    changed |= IsChanged(m_textureBuffersChanged, samplerData.contentHandle);
+                    break;
+                case TextureSampler::ContentType::RenderBuffer:
+                case TextureSampler::ContentType::RenderBufferMS:
+                    samplesRenderBuffer = true;
+                    break;
+                // content changes outside of this scene
+                case TextureSampler::ContentType::OffscreenBuffer:
+                case TextureSampler::ContentType::StreamBuffer:
+                case TextureSampler::ContentType::ExternalTexture:
+                    changed = true;
+                    break;
+                case TextureSampler::ContentType::None:
+                case TextureSampler::ContentType::ClientTexture:
+                    break;
+                }
+            }
+        }
+
+        uint8_t state = EDataInstanceInputState_Evaluated;
+        if (changed)
+            state |= EDataInstanceInputState_Changed;
+        if (samplesRenderBuffer)
+            state |= EDataInstanceInputState_SamplesRenderBuffer;
+        return state;
+    }
+
+    void RendererCachedScene::propagateRenderTargetDirtiness()
+    {
+        // render target is re-rendered if it shares render buffer with re-rendered render target or samples its render buffer,
+        // repeat until no more render targets become dirty as dependencies might form chains
+        bool anyNewDirty = true;
+        while (anyNewDirty)
+        {
+            anyNewDirty = false;
+            for (RenderTargetHandle renderTarget(0u); renderTarget < BaseT::getRenderTargetCount(); ++renderTarget)
+            {
+                if (!BaseT::isRenderTargetAllocated(renderTarget))
+                    continue;
+
+                const uint32_t bufferCount = BaseT::getRenderTargetRenderBufferCount(renderTarget);
+                bool isDirty = m_renderTargetsToRenderFlags[renderTarget.asMemoryHandle()];
+                for (uint32_t i = 0u; i < bufferCount && !isDirty; ++i)
+                    isDirty = m_renderBuffersDirty[BaseT::getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle()];
+                if (!isDirty)
+                    continue;
+
+                if (!m_renderTargetsToRenderFlags[renderTarget.asMemoryHandle()])
+                {
+                    m_renderTargetsToRenderFlags[renderTarget.asMemoryHandle()] = true;
+                    anyNewDirty = true;
+                }
+                for (uint32_t i = 0u; i < bufferCount; ++i)
+                {
+                    const auto buffer = BaseT::getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle();
+                    anyNewDirty |= !m_renderBuffersDirty[buffer];
+                    m_renderBuffersDirty[buffer] = true;
+                }
+            }
+
+            for (const auto& [renderTarget, renderBuffer] : m_sampledRenderBuffers)
+            {
+                if (m_renderBuffersDirty[renderBuffer.asMemoryHandle()] && !m_renderTargetsToRenderFlags[renderTarget.asMemoryHandle()])
+                {
+                    m_renderTargetsToRenderFlags[renderTarget.asMemoryHandle()] = true;
+                    anyNewDirty = true;
+                }
+            }
+        }
+    }
 }
@@ -9,8 +9,13 @@
 #pragma once
 
 #include "internal/RendererLib/ResourceCachedScene.h"
+#include "internal/RendererLib/RadixSort.h"
+#include "internal/RendererLib/OrderPreservingKeys.h"
 #include "internal/RendererLib/RenderingPassInfo.h"
 
+#include <tuple>
+#include <utility>
+
 namespace ramses::internal
 {
     class IResourceDeviceHandleAccessor;
@@ -29,6 +34,20 @@ namespace ramses::internal
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
 
+        /**
+         * Passes rendering into render targets of this scene are only executed if any input of any pass rendering into the same
+         * render target changed since the render target was rendered last time (renderables, their uniforms, transformations,
+         * render states, textures, buffers, camera or pass properties), other render targets keep their content.
+         * Render targets sampling content of a re-rendered render target are re-rendered as well, passes rendering into display buffer
+         * are never skipped.
+         *
+         * Must be called after all updates of the scene in a frame were done, rendered passes are reported by markRenderTargetsAsRendered.
+         * If skipping is disabled all passes are rendered.
+         */
+        void updateRenderTargetsToRender(bool skipUnchangedRenderTargets);
+        void markRenderTargetsAsRendered() const;
+        void markAllRenderTargetsDirty();
+
         /**
          * The renderer sets this to true when it applies a semantic time uniform
          * that is supposed to enable a shader based animation
@@ -48,17 +67,61 @@ namespace ramses::internal
          */
         bool hasActiveShaderAnimation() const;
 
+        RenderableHandle            allocateRenderable              (NodeHandle nodeHandle, RenderableHandle handle) override;
+        void                        releaseRenderable               (RenderableHandle renderableHandle) override;
+        void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
+        void                        setRenderableStartIndex         (RenderableHandle renderableHandle, uint32_t startIndex) override;
+        void                        setRenderableIndexCount         (RenderableHandle renderableHandle, uint32_t indexCount) override;
+        void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
+        void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableFrustumCulling     (RenderableHandle renderableHandle, bool enabled) override;
+
+        void                        setRenderStateBlendFactors      (RenderStateHandle stateHandle, EBlendFactor srcColor, EBlendFactor destColor, EBlendFactor srcAlpha, EBlendFactor destAlpha) override;
+        void                        setRenderStateBlendOperations   (RenderStateHandle stateHandle, EBlendOperation operationColor, EBlendOperation operationAlpha) override;
+        void                        setRenderStateBlendColor        (RenderStateHandle stateHandle, const glm::vec4& color) override;
+        void                        setRenderStateCullMode          (RenderStateHandle stateHandle, ECullMode cullMode) override;
+        void                        setRenderStateDrawMode          (RenderStateHandle stateHandle, EDrawMode drawMode) override;
+        void                        setRenderStateDepthFunc         (RenderStateHandle stateHandle, EDepthFunc func) override;
+        void                        setRenderStateDepthWrite        (RenderStateHandle stateHandle, EDepthWrite flag) override;
+        void                        setRenderStateScissorTest       (RenderStateHandle stateHandle, EScissorTest flag, const RenderState::ScissorRegion& region) override;
+        void                        setRenderStateStencilFunc       (RenderStateHandle stateHandle, EStencilFunc func, uint8_t ref, uint8_t mask) override;
+        void                        setRenderStateStencilOps        (RenderStateHandle stateHandle, EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass) override;
+        void                        setRenderStateColorWriteMask    (RenderStateHandle stateHandle, ColorWriteMask colorMask) override;
+
+        // single value setters are implemented using array setters
+        void                        setDataFloatArray               (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const float* data) override;
+        void                        setDataVector2fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec2* data) override;
+        void                        setDataVector3fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec3* data) override;
+        void                        setDataVector4fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec4* data) override;
+        void                        setDataBooleanArray             (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const bool* data) override;
+        void                        setDataIntegerArray             (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const int32_t* data) override;
+        void                        setDataVector2iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec2* data) override;
+        void                        setDataVector3iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec3* data) override;
+        void                        setDataVector4iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec4* data) override;
+        void                        setDataMatrix22fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat2* data) override;
+        void                        setDataMatrix33fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat3* data) override;
+        void                        setDataMatrix44fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat4* data) override;
+        void                        setDataResource                 (DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride) override;
+        void                        setDataTextureSamplerHandle     (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
+        void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
+        void                        setDataUniformBuffer            (DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle) override;
 
         void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order) override;
         void                        removeRenderableFromRenderGroup (RenderGroupHandle groupHandle, RenderableHandle renderableHandle) override;
 
         void                        releaseRenderPass               (RenderPassHandle passHandle) override;
+        void                        setRenderPassClearColor         (RenderPassHandle passHandle, const glm::vec4& clearColor) override;
+        void                        setRenderPassClearFlag          (RenderPassHandle passHandle, ClearFlags clearFlag) override;
+        void                        setRenderPassCamera             (RenderPassHandle passHandle, CameraHandle cameraHandle) override;
+        void                        setRenderPassRenderTarget       (RenderPassHandle passHandle, RenderTargetHandle targetHandle) override;
         void                        setRenderPassRenderOrder        (RenderPassHandle passHandle, int32_t renderOrder) override;
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         void                        addRenderGroupToRenderGroup     (RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order) override;
@@ -69,6 +132,13 @@ namespace ramses::internal
         void                        setBlitPassRenderOrder(BlitPassHandle passHandle, int32_t renderOrder) override;
         void                        setBlitPassEnabled(BlitPassHandle passHandle, bool isEnabled) override;
 
+        void                        releaseRenderTarget             (RenderTargetHandle targetHandle) override;
+        void                        addRenderTargetRenderBuffer     (RenderTargetHandle targetHandle, RenderBufferHandle bufferHandle) override;
+        void                        setRenderBufferProperties       (RenderBufferHandle handle, uint32_t width, uint32_t height, uint32_t sampleCount) override;
+
+        void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+        void                        updateUniformBuffer             (UniformBufferHandle uniformBufferHandle, uint32_t offset, uint32_t size, const std::byte* data) override;
+
         TextureBufferHandle         allocateTextureBuffer           (EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle) override;
         void                        releaseTextureBuffer(TextureBufferHandle handle) override;
         void                        updateTextureBuffer             (TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data) override;
@@ -93,18 +163,101 @@ namespace ramses::internal
         }
 
     private:
+        // (effect, geometry instance, render state) and (effect, uniform instance, geometry instance, render state) of renderable
+        using RenderableState = std::tuple<ResourceContentHash, MemoryHandle, MemoryHandle>;
+        using RenderableSortedState = std::tuple<ResourceContentHash, MemoryHandle, MemoryHandle, MemoryHandle>;
+
         void updatePassRenderableSorting();
+        void updateRenderableStateKeys();
+        bool updateChangedRenderableStateKeys();
+        void updateAllRenderableStateKeysFromValues();
+        void setRenderableStateChanged(RenderableHandle renderable);
+        RenderableSortedState getRenderableSortedState(const Renderable& renderable) const;
+        static RenderableState ToRenderableState(const RenderableSortedState& sortedState);
         void updateRenderablesInPass(RenderPassHandle passHandle);
         void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        void sortRenderablesInRenderGroup(RenderGroup& renderGroup);
+        void sortRenderablesInPassByState(RenderableVector& orderedRenderables);
         bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void setRenderGroupSortingDirty(RenderGroupHandle groupHandle);
+        void setAllPassRenderablesDirty();
+        void setRenderableWorldMatrix(RenderableHandle renderable, const glm::mat4& worldMatrix);
+        void setCameraViewMatrix(CameraHandle camera, const glm::mat4& viewMatrix);
+        void setRenderPassInputsChanged(RenderPassHandle passHandle);
+        void invalidateRenderTargetContent(RenderTargetHandle renderTarget);
+        bool haveRenderPassInputsChanged(RenderPassHandle passHandle, RenderTargetHandle renderTarget);
+        bool haveRenderableInputsChanged(RenderableHandle renderable, RenderTargetHandle renderTarget);
+        bool haveDataInstanceInputsChanged(DataInstanceHandle dataInstance, RenderTargetHandle renderTarget);
+        uint8_t evaluateDataInstanceInputs(DataInstanceHandle dataInstance) const;
+        void propagateRenderTargetDirtiness();
+        static void SetChanged(BoolVector& changedFlags, MemoryHandle handle);
+        static bool IsChanged(const BoolVector& changedFlags, MemoryHandle handle);
 
         RenderingPassInfoVector m_sortedRenderingPasses;
         using PassRenderableOrder = std::vector<RenderableVector>;
         PassRenderableOrder     m_passRenderableOrder;
+        // pass list (order, enabled, render once) needs update, flattened renderables are only rebuilt for passes marked in m_passRenderablesDirty
         mutable bool            m_renderableOrderingDirty;
+        BoolVector              m_passRenderablesDirty;
+
+        // Renderables within render group are ordered by 64-bit sort keys: render order in upper 32 bits and renderable state key in lower 32 bits.
+        // State key orders renderables by (effect, geometry instance, render state). Keys are only updated for renderables whose state changed,
+        // keys of other renderables stay valid unless there is no free key left between neighbouring states, and render groups are only re-sorted
+        // if their content or state keys of their renderables changed. All keys are rebuilt at once on first update or if most renderables changed.
+        std::vector<uint32_t>   m_renderableStateKeys;
+        OrderPreservingKeys<RenderableState> m_stateKeys;
+        bool                    m_renderableStateKeysDirty = true;
+        RenderableVector        m_renderablesWithChangedState;
+        BoolVector              m_renderableStateChanged;
+        std::vector<std::vector<RenderGroupHandle>> m_renderableGroups;
+        BoolVector              m_renderGroupSortingDirty;
+        SortKeyEntries          m_sortKeys;
+        SortKeyEntries          m_sortKeysScratch;
+        RenderableOrderVector   m_sortedGroupRenderables;
+
+        // Passes with state sorting enabled additionally reorder renderables of same group and render order by
+        // (effect, uniform instance, geometry instance, render state), these keys are only maintained if there is such pass.
+        // Registered state of each renderable is kept to find the values to replace when it changes.
+        std::vector<uint32_t>   m_renderableStateSortedKeys;
+        OrderPreservingKeys<RenderableSortedState> m_stateSortedKeys;
+        std::vector<RenderableSortedState> m_renderableStates;
+        BoolVector              m_renderableStateRegistered;
+        bool                    m_hasStateSortedPasses = false;
+        bool                    m_collectStateSortBuckets = false;
+        std::vector<size_t>     m_stateSortBucketStarts;
+        RenderableVector        m_stateSortedRenderables;
 
         using MatrixVector = std::vector<glm::mat4>;
         MatrixVector            m_renderableMatrices;
+        MatrixVector            m_cameraViewMatrices;
+        RenderableVector        m_previousPassRenderables;
+
+        // Changes of render pass inputs since last call of updateRenderTargetsToRender, indexed by handle of changed object.
+        // Values of data instances are tracked per data instance, referenced data instances, buffers and textures are checked when
+        // evaluating renderables of a pass.
+        BoolVector              m_renderablesChanged;
+        BoolVector              m_renderStatesChanged;
+        BoolVector              m_dataInstancesChanged;
+        BoolVector              m_renderPassesChanged;
+        BoolVector              m_camerasChanged;
+        BoolVector              m_dataBuffersChanged;
+        BoolVector              m_textureBuffersChanged;
+        BoolVector              m_uniformBuffersChanged;
+        bool                    m_allRenderTargetsDirty = true;
+        bool                    m_hasRenderTargetPasses = false;
+
+        // Render targets keep content from last rendering if valid, render targets with changed inputs are invalidated
+        // and become valid again once rendered completely (i.e. not missing any renderable because of unresolved resources)
+        RenderingPassInfoVector m_passesToRender;
+        bool                    m_skipsRenderTargetPasses = false;
+        mutable BoolVector      m_renderTargetsContentValid;
+        BoolVector              m_renderTargetsIncomplete;
+        BoolVector              m_renderTargetsToRenderFlags;
+        mutable std::vector<RenderTargetHandle> m_renderTargetsToRender;
+        DeviceHandleVector      m_renderTargetDeviceHandles;
+        BoolVector              m_renderBuffersDirty;
+        std::vector<std::pair<RenderTargetHandle, RenderBufferHandle>> m_sampledRenderBuffers;
+        std::vector<uint8_t>    m_dataInstanceInputStates;
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
@@ -15,6 +15,7 @@
 #include "internal/Components/ManagedResource.h"
 #include "internal/Components/SceneGraphComponent.h"
 #include "internal/SceneReferencing/SceneReferenceEvent.h"
+#include "internal/Components/ResourceAvailabilityEvent.h"
 #include "internal/Components/SceneUpdate.h"
 
 namespace ramses::internal
@@ -94,6 +95,24 @@ namespace ramses::internal
         m_sceneGraphConsumerComponent.unsubscribeScene(it->value.first, sceneId);
     }
 
+    void RendererFrameworkLogic::sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources)
+    {
+        ResourceAvailabilityEvent event;
+        event.sceneid = sceneId;
+        event.availableResources = availableResources;
+
+        PlatformGuard guard(m_frameworkLock);
+        auto it = m_sceneClients.find(sceneId);
+        if (it == m_sceneClients.end())
+        {
+            LOG_WARN(CONTEXT_RENDERER, "RendererFrameworkLogic::sendResourcesAvailable: can't send available resources for scene {} because provider unknown", sceneId);
+            return;
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "RendererFrameworkLogic::sendResourcesAvailable: sending {} available resources for scene {} to {}", availableResources.size(), sceneId, it->value.first);
+        m_sceneGraphConsumerComponent.sendResourceAvailabilityEvent(it->value.first, event);
+    }
+
     void RendererFrameworkLogic::sendSceneStateChanged(SceneId masterScene, SceneId referencedScene, RendererSceneState newState)
     {
         SceneReferenceEvent event(masterScene);
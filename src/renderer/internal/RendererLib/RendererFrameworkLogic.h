@@ -46,6 +46,7 @@ namespace ramses::internal
         // IRendererSceneEventSender
         void sendSubscribeScene(SceneId sceneId) override;
         void sendUnsubscribeScene(SceneId sceneId) override;
+        void sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources) override;
         void sendSceneStateChanged(SceneId masterScene, SceneId referencedScene, RendererSceneState newState) override;
         void sendSceneFlushed(SceneId masterScene, SceneId referencedScene, SceneVersionTag tag) override;
         void sendDataLinked(SceneId masterScene, SceneId providerScene, DataSlotId provider, SceneId consumerScene, DataSlotId consumer, bool success) override;
@@ -1095,6 +1095,14 @@ namespace ramses::internal
                 << " sceneResourceUpload " << int64_t(updater.m_frameTimer.getTimeBudgetForSection(EFrameTimerSectionBudget::SceneResourcesUpload).count()) << "us"
                 << " resourceUpload " << int64_t(updater.m_frameTimer.getTimeBudgetForSection(EFrameTimerSectionBudget::ResourcesUpload).count()) << "us"
                 << " obRender " << int64_t(updater.m_frameTimer.getTimeBudgetForSection(EFrameTimerSectionBudget::OffscreenBufferRender).count()) << "us";
+            sos << "\nSection costs last frame (predicted/actual):";
+            const auto logSectionCosts = [&](const char* name, EFrameTimerSectionBudget section) {
+                const auto costs = updater.m_frameTimer.getLastFrameSectionCosts(section);
+                sos << " " << name << " " << int64_t(costs.predicted.count()) << "/" << int64_t(costs.actual.count()) << "us (" << costs.numWorkUnits << " units)";
+            };
+            logSectionCosts("sceneResourceUpload", EFrameTimerSectionBudget::SceneResourcesUpload);
+            logSectionCosts("resourceUpload", EFrameTimerSectionBudget::ResourcesUpload);
+            logSectionCosts("obRender", EFrameTimerSectionBudget::OffscreenBufferRender);
             sos << "\n";
             updater.m_renderer.getProfilerStatistics().writeLongestFrameTimingsToStream(sos);
             sos << "\n";
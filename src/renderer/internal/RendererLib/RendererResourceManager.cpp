@@ -189,11 +189,27 @@ namespace ramses::internal
         return m_resourceRegistry.getResourceDescriptor(hash).type;
     }
 
+    ResourceContentHashVector RendererResourceManager::getUploadedResources() const
+    {
+        ResourceContentHashVector uploadedResources;
+        for (const auto& resDesc : m_resourceRegistry.getAllResourceDescriptors())
+        {
+            if (resDesc.value.status == EResourceStatus::Uploaded)
+                uploadedResources.push_back(resDesc.key);
+        }
+        return uploadedResources;
+    }
+
     DeviceResourceHandle RendererResourceManager::getResourceDeviceHandle(const ResourceContentHash& hash) const
     {
         return m_resourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    std::optional<BoundingSphere> RendererResourceManager::getResourceBoundingSphere(const ResourceContentHash& hash) const
+    {
+        return m_resourceRegistry.getResourceDescriptor(hash).boundingSphere;
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
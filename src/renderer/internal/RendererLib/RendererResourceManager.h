@@ -51,8 +51,10 @@ namespace ramses::internal
         void                 uploadAndUnloadPendingResources() override;
 
         [[nodiscard]] DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& hash) const override;
+        [[nodiscard]] std::optional<BoundingSphere> getResourceBoundingSphere(const ResourceContentHash& hash) const override;
         [[nodiscard]] EResourceStatus      getResourceStatus(const ResourceContentHash& hash) const override;
         [[nodiscard]] EResourceType        getResourceType(const ResourceContentHash& hash) const override;
+        [[nodiscard]] ResourceContentHashVector getUploadedResources() const override;
 
         // Scene resources
         [[nodiscard]] DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle targetHandle, SceneId sceneId) const override;
@@ -163,6 +163,12 @@ namespace ramses::internal
         setResourceStatus(hash, EResourceStatus::Broken);
     }
 
+    void RendererResourceRegistry::setResourceBoundingSphere(const ResourceContentHash& hash, const std::optional<BoundingSphere>& boundingSphere)
+    {
+        assert(m_resources.contains(hash));
+        m_resources.get(hash)->boundingSphere = boundingSphere;
+    }
+
     void RendererResourceRegistry::setResourceStatus(const ResourceContentHash& hash, EResourceStatus status)
     {
         assert(m_resources.contains(hash));
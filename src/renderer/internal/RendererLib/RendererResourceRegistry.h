@@ -25,6 +25,7 @@ namespace ramses::internal
         void                       setResourceScheduledForUpload(const ResourceContentHash& hash);
         void                       setResourceUploaded  (const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, uint32_t vramSize);
         void                       setResourceBroken    (const ResourceContentHash& hash);
+        void                       setResourceBoundingSphere(const ResourceContentHash& hash, const std::optional<BoundingSphere>& boundingSphere);
 
         void                       addResourceRef       (const ResourceContentHash& hash, SceneId sceneId);
         void                       removeResourceRef    (const ResourceContentHash& hash, SceneId sceneId);
@@ -24,6 +24,7 @@
 #include "internal/RendererLib/SceneExpirationMonitor.h"
 #include "internal/RendererLib/EmbeddedCompositingManager.h"
 #include "internal/RendererLib/PendingSceneResourcesUtils.h"
+#include "internal/RendererLib/PendingFlushMerger.h"
 #include "internal/RendererLib/RendererLogger.h"
 #include "internal/RendererLib/IntersectionUtils.h"
 #include "internal/RendererLib/SceneReferenceLogic.h"
@@ -112,6 +113,7 @@ namespace ramses::internal
         assert(!m_asyncEffectUploader);
         m_renderer.resetRenderInterruptState();
         m_renderer.createDisplayContext(displayConfig);
+        m_frustumCullingEnabled = displayConfig.isFrustumCullingEnabled();
 
         if (m_renderer.hasDisplayController())
         {
@@ -195,6 +197,8 @@ namespace ramses::internal
             m_asyncEffectUploader->destroyResourceUploadRenderBackendAndStopThread();
             m_asyncEffectUploader.reset();
         }
+        while (!m_resourcesReferencedOnSubscription.empty())
+            unreferenceResourcesReferencedOnSubscription(m_resourcesReferencedOnSubscription.begin()->first);
         m_displayResourceManager.reset();
 
         m_renderer.resetRenderInterruptState();
@@ -290,6 +294,11 @@ namespace ramses::internal
             updateAndUploadSemanticUniformBuffers();
         }
 
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes select render targets with modified content to be re-rendered");
+            updateScenesRenderTargetsToRender();
+        }
+
         m_renderer.m_traceId = 12;
         for (const auto scene : m_modifiedScenesToRerender)
         {
@@ -386,13 +395,28 @@ namespace ramses::internal
 
         PendingSceneResourcesUtils::ConsolidateSceneResourceActions(resourceChanges.m_sceneResourceActions, pendingData.sceneResourceActions);
 
-        assert(sceneUpdate.resources.size() == resourceChanges.m_resourcesAdded.size());
-        assert(std::equal(sceneUpdate.resources.cbegin(), sceneUpdate.resources.cend(), resourceChanges.m_resourcesAdded.cbegin(),
-            [](const auto& mr, const auto& hash) { return mr->getHash() == hash; }));
+        // resources available at renderer when subscribing might be added without data, otherwise data comes in same order as added resources
+        assert([&]() {
+            auto hashIt = resourceChanges.m_resourcesAdded.cbegin();
+            for (const auto& mr : sceneUpdate.resources)
+            {
+                hashIt = std::find(hashIt, resourceChanges.m_resourcesAdded.cend(), mr->getHash());
+                if (hashIt == resourceChanges.m_resourcesAdded.cend())
+                    return false;
+                ++hashIt;
+            }
+            return true;
+        }());
+        updateResourcesReferencedOnSubscription(sceneID, sceneUpdate.resources, resourceChanges);
         flushInfo.resourceDataToProvide = std::move(sceneUpdate.resources);
         flushInfo.resourcesAdded = std::move(resourceChanges.m_resourcesAdded);
         flushInfo.resourcesRemoved = std::move(resourceChanges.m_resourcesRemoved);
         flushInfo.sceneActions = std::move(sceneUpdate.actions);
+        if (sceneUpdate.trace.enabled)
+        {
+            flushInfo.traces.push_back(sceneUpdate.trace);
+            flushInfo.traces.back().mark(EFlushTraceStage::Pending);
+        }
 
         if (stagingInfo.pendingData.pendingFlushes.size() > m_maximumPendingFlushesToKillScene)
         {
@@ -402,6 +426,54 @@ namespace ramses::internal
         }
     }
 
+    void RendererSceneUpdater::updateResourcesReferencedOnSubscription(SceneId sceneID, const ManagedResourceVector& resourceData, const ResourceChanges& resourceChanges)
+    {
+        const auto it = m_resourcesReferencedOnSubscription.find(sceneID);
+        if (it == m_resourcesReferencedOnSubscription.end())
+            return;
+
+        assert(m_displayResourceManager);
+        ResourceContentHashVector& referencedResources = it->second.resources;
+        ResourceContentHashVector resourcesToKeep;
+        if (!it->second.sceneUpdateReceived)
+        {
+            // keep referenced only those resources that scene uses and whose data was not sent
+            it->second.sceneUpdateReceived = true;
+            ResourceContentHashVector sentResources{ resourceData.size() };
+            std::transform(resourceData.cbegin(), resourceData.cend(), sentResources.begin(), [](const auto& mr) { return mr->getHash(); });
+            std::sort(sentResources.begin(), sentResources.end());
+            ResourceContentHashVector addedResources = resourceChanges.m_resourcesAdded;
+            std::sort(addedResources.begin(), addedResources.end());
+            ResourceContentHashVector resourcesWithoutData;
+            std::set_difference(addedResources.cbegin(), addedResources.cend(), sentResources.cbegin(), sentResources.cend(), std::back_inserter(resourcesWithoutData));
+            std::set_intersection(referencedResources.cbegin(), referencedResources.cend(), resourcesWithoutData.cbegin(), resourcesWithoutData.cend(), std::back_inserter(resourcesToKeep));
+            LOG_INFO(CONTEXT_RENDERER, "Scene {} uses {} of {} resources reported as available on subscription, provider did not send their data", sceneID, resourcesToKeep.size(), referencedResources.size());
+        }
+        else
+        {
+            // resources removed from scene before it got mapped
+            ResourceContentHashVector removedResources = resourceChanges.m_resourcesRemoved;
+            std::sort(removedResources.begin(), removedResources.end());
+            std::set_difference(referencedResources.cbegin(), referencedResources.cend(), removedResources.cbegin(), removedResources.cend(), std::back_inserter(resourcesToKeep));
+        }
+
+        ResourceContentHashVector resourcesToUnreference;
+        std::set_difference(referencedResources.cbegin(), referencedResources.cend(), resourcesToKeep.cbegin(), resourcesToKeep.cend(), std::back_inserter(resourcesToUnreference));
+        m_displayResourceManager->unreferenceResourcesForScene(sceneID, resourcesToUnreference);
+        referencedResources = std::move(resourcesToKeep);
+    }
+
+    void RendererSceneUpdater::unreferenceResourcesReferencedOnSubscription(SceneId sceneID)
+    {
+        const auto it = m_resourcesReferencedOnSubscription.find(sceneID);
+        if (it == m_resourcesReferencedOnSubscription.end())
+            return;
+
+        assert(m_displayResourceManager);
+        m_displayResourceManager->unreferenceResourcesForScene(sceneID, it->second.resources);
+        m_resourcesReferencedOnSubscription.erase(it);
+    }
+
     void RendererSceneUpdater::consolidateResourceDataForMapping(SceneId sceneID)
     {
         // consolidate resources from pending flushes into staging data for mapping
@@ -570,6 +642,11 @@ namespace ramses::internal
 
         if (canApplyFlushes)
         {
+            for (auto& pendingFlush : stagingInfo.pendingData.pendingFlushes)
+            {
+                for (auto& trace : pendingFlush.traces)
+                    trace.mark(EFlushTraceStage::ResourcesReady);
+            }
             stagingInfo.pendingData.allPendingFlushesApplied = true;
             applyPendingFlushes(sceneID, stagingInfo);
         }
@@ -584,6 +661,12 @@ namespace ramses::internal
 
         PendingData& pendingData = stagingInfo.pendingData;
         PendingFlushes& pendingFlushes = pendingData.pendingFlushes;
+
+        // renderer is behind if there is more than one flush to apply, skip intermediate states
+        const size_t numMergedFlushes = PendingFlushMerger::MergePendingFlushes(pendingFlushes);
+        if (numMergedFlushes > 0u)
+            LOG_DEBUG(CONTEXT_RENDERER, "Merged {} pending flushes of scene {}, applying {} flushes", numMergedFlushes, sceneID, pendingFlushes.size());
+
         for (auto& pendingFlush : pendingFlushes)
         {
             const auto hadActiveShaderAnimation = rendererScene.hasActiveShaderAnimation();
@@ -607,6 +690,9 @@ namespace ramses::internal
             stagingInfo.lastAppliedVersionTag = pendingFlush.versionTag;
             m_expirationMonitor.onFlushApplied(sceneID, pendingFlush.timeInfo.expirationTimestamp, pendingFlush.versionTag, pendingFlush.flushIndex);
             m_renderer.getStatistics().flushApplied(sceneID);
+            for (auto& trace : pendingFlush.traces)
+                trace.mark(EFlushTraceStage::Applied);
+            m_renderer.getStatistics().trackAppliedFlushTraces(sceneID, std::move(pendingFlush.traces));
 
             // mark scene as modified only if it received scene actions other than flush
             // also mark scene as modified if it had an active shader animation before (to not stop the animation with an empty flush)
@@ -813,6 +899,7 @@ namespace ramses::internal
             if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
             {
                 RendererCachedScene& rendererScene = *(sceneIt.value.scene);
+                rendererScene.setFrustumCullingEnabled(m_frustumCullingEnabled);
                 rendererScene.updateRenderablesAndResourceCache(*m_displayResourceManager);
             }
         }
@@ -868,6 +955,8 @@ namespace ramses::internal
                     // force retrigger all render once passes,
                     // if scene was rendered before and is remapped, render once passes need to be rendered again
                     m_rendererScenes.getScene(sceneId).retriggerAllRenderOncePasses();
+                    // same applies to render targets which would otherwise keep their content if not modified
+                    m_rendererScenes.getScene(sceneId).markAllRenderTargetsDirty();
                 }
             }
                 break;
@@ -983,6 +1072,7 @@ namespace ramses::internal
     void RendererSceneUpdater::destroyScene(SceneId sceneID)
     {
         m_renderer.resetRenderInterruptState();
+        unreferenceResourcesReferencedOnSubscription(sceneID);
         const ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneID);
         switch (sceneState)
         {
@@ -1049,6 +1139,15 @@ namespace ramses::internal
                 return false;
         }
 
+        // resources referenced on subscription are from now on referenced as any other resource in use by the scene
+        ResourceContentHashVector resourcesReferencedOnSubscription;
+        const auto referencedOnSubscriptionIt = m_resourcesReferencedOnSubscription.find(sceneId);
+        if (referencedOnSubscriptionIt != m_resourcesReferencedOnSubscription.end())
+        {
+            resourcesReferencedOnSubscription = std::move(referencedOnSubscriptionIt->second.resources);
+            m_resourcesReferencedOnSubscription.erase(referencedOnSubscriptionIt);
+        }
+
         // reference all the resources in use by the scene to be mapped
         ResourceContentHashVector resourcesUsedInScene;
         ResourceUtils::GetAllResourcesFromScene(resourcesUsedInScene, scene);
@@ -1061,6 +1160,7 @@ namespace ramses::internal
             const auto& providedResources = m_rendererScenes.getStagingInfo(sceneId).resourcesToUploadOnceMapping;
             ResourceContentHashVector providedHashes{ providedResources.size() };
             std::transform(providedResources.cbegin(), providedResources.cend(), providedHashes.begin(), [](const auto& mr) { return mr->getHash(); });
+            providedHashes.insert(providedHashes.end(), resourcesReferencedOnSubscription.cbegin(), resourcesReferencedOnSubscription.cend());
 
             std::sort(resourcesUsedInScene.begin(), resourcesUsedInScene.end());
             std::sort(providedHashes.begin(), providedHashes.end());
@@ -1105,7 +1205,18 @@ namespace ramses::internal
         if (m_sceneStateExecutor.checkIfCanBeSubscriptionRequested(sceneId))
         {
             assert(!m_rendererScenes.hasScene(sceneId));
-            m_sceneStateExecutor.setSubscriptionRequested(sceneId);
+            ResourceContentHashVector availableResources;
+            if (m_displayResourceManager)
+            {
+                availableResources = m_displayResourceManager->getUploadedResources();
+                if (!availableResources.empty())
+                {
+                    m_displayResourceManager->referenceResourcesForScene(sceneId, availableResources);
+                    std::sort(availableResources.begin(), availableResources.end());
+                    m_resourcesReferencedOnSubscription[sceneId] = { availableResources, false };
+                }
+            }
+            m_sceneStateExecutor.setSubscriptionRequested(sceneId, availableResources);
         }
     }
 
@@ -1731,6 +1842,23 @@ namespace ramses::internal
         }
     }
 
+    void RendererSceneUpdater::updateScenesRenderTargetsToRender()
+    {
+        const bool hasInterruptedRendering = m_renderer.hasAnyBufferWithInterruptedRendering();
+        for (const auto& scene : m_rendererScenes)
+        {
+            const SceneId sceneID = scene.key;
+            if (m_sceneStateExecutor.getSceneState(sceneID) != ESceneState::Rendered)
+                continue;
+
+            // passes of scene whose rendering was interrupted must stay same until scene is fully rendered
+            if (hasInterruptedRendering && m_renderer.isSceneAssignedToInterruptibleOffscreenBuffer(sceneID))
+                continue;
+
+            scene.value.scene->updateRenderTargetsToRender(m_skipUnmodifiedScenes);
+        }
+    }
+
     void RendererSceneUpdater::updateScenesTransformationCache()
     {
         m_scenesNeedingTransformationCacheUpdate.clear();
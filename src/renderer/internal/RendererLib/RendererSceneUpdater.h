@@ -33,6 +33,7 @@ namespace ramses::internal
     class DisplayConfigData;
     class SceneExpirationMonitor;
     struct SceneUpdate;
+    struct ResourceChanges;
     class DataReferenceLinkManager;
     class TransformationLinkManager;
     class TextureLinkManager;
@@ -127,6 +128,8 @@ namespace ramses::internal
         [[nodiscard]] bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
 
         void consolidatePendingSceneActions(SceneId sceneID, SceneUpdate&& sceneUpdate);
+        void updateResourcesReferencedOnSubscription(SceneId sceneID, const ManagedResourceVector& resourceData, const ResourceChanges& resourceChanges);
+        void unreferenceResourcesReferencedOnSubscription(SceneId sceneID);
         void consolidateResourceDataForMapping(SceneId sceneID);
         void referenceAndProvidePendingResourceData(SceneId sceneID);
         void requestAndUploadAndUnloadResources();
@@ -138,6 +141,7 @@ namespace ramses::internal
         void uploadAndUnloadVertexArrays();
         void updateScenesResourceCache();
         void updateScenesShaderAnimations();
+        void updateScenesRenderTargetsToRender();
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
         void updateAndUploadSemanticUniformBuffers();
@@ -174,10 +178,20 @@ namespace ramses::internal
         };
         std::unordered_map<SceneId, SceneMapRequest> m_scenesToBeMapped;
 
+        // resources reported to provider as available when subscribing, provider does not send their data.
+        // They are referenced by the scene until it is mapped, so that they cannot be unloaded in the meantime.
+        struct ResourcesReferencedOnSubscription
+        {
+            ResourceContentHashVector resources; // sorted
+            bool sceneUpdateReceived = false;
+        };
+        std::unordered_map<SceneId, ResourcesReferencedOnSubscription> m_resourcesReferencedOnSubscription;
+
         // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
 
         bool m_skipUnmodifiedScenes = true;
+        bool m_frustumCullingEnabled = false;
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
         std::vector<SceneId> m_offscreeenBufferModifiedScenesVisitingCache;
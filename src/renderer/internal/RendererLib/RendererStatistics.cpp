@@ -9,6 +9,7 @@
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/PlatformAbstraction/Collections/StringOutputStream.h"
+#include "internal/Components/FlushTracer.h"
 
 namespace ramses::internal
 {
@@ -29,6 +30,24 @@ namespace ramses::internal
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
         m_sceneStatistics[sceneId].numRendered++;
+
+        if (!m_flushTracesWaitingForRender.empty())
+        {
+            const auto it = m_flushTracesWaitingForRender.find(sceneId);
+            if (it != m_flushTracesWaitingForRender.end())
+            {
+                for (auto& trace : it->second)
+                    trace.mark(EFlushTraceStage::Rendered);
+                passFlushTracesToTracer(sceneId);
+            }
+        }
+    }
+
+    void RendererStatistics::renderablesCulled(SceneId sceneId, size_t numTested, size_t numCulled)
+    {
+        auto& sceneStat = m_sceneStatistics[sceneId];
+        sceneStat.numRenderablesTestedForCulling += numTested;
+        sceneStat.numRenderablesCulled += numCulled;
     }
 
     void RendererStatistics::offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible)
@@ -140,9 +159,37 @@ namespace ramses::internal
         }
     }
 
+    void RendererStatistics::setFlushTracer(FlushTracer* flushTracer)
+    {
+        m_flushTracer = flushTracer;
+    }
+
+    void RendererStatistics::trackAppliedFlushTraces(SceneId sceneId, FlushTraces&& traces)
+    {
+        if (!m_flushTracer || traces.empty())
+            return;
+
+        auto& waitingTraces = m_flushTracesWaitingForRender[sceneId];
+        waitingTraces.insert(waitingTraces.end(), std::make_move_iterator(traces.begin()), std::make_move_iterator(traces.end()));
+        if (waitingTraces.size() >= MaxFlushTracesWaitingForRender)
+            passFlushTracesToTracer(sceneId);
+    }
+
+    void RendererStatistics::passFlushTracesToTracer(SceneId sceneId)
+    {
+        const auto it = m_flushTracesWaitingForRender.find(sceneId);
+        if (it == m_flushTracesWaitingForRender.end())
+            return;
+
+        for (const auto& trace : it->second)
+            m_flushTracer->addTrace(trace);
+        m_flushTracesWaitingForRender.erase(it);
+    }
+
     void RendererStatistics::untrackScene(SceneId sceneId)
     {
         m_sceneStatistics.erase(sceneId);
+        passFlushTracesToTracer(sceneId);
     }
 
     void RendererStatistics::untrackOffscreenBuffer(DeviceResourceHandle offscreenBuffer)
@@ -155,6 +202,12 @@ namespace ramses::internal
         m_streamTextureStatistics.erase(iviSurface);
     }
 
+    void RendererStatistics::uniformsUpdated(uint32_t numIssued, uint32_t numSkipped)
+    {
+        m_uniformUpdatesIssued += numIssued;
+        m_uniformUpdatesSkipped += numSkipped;
+    }
+
     void RendererStatistics::frameFinished(uint32_t drawCalls)
     {
         const uint64_t currTick = PlatformTime::GetMicrosecondsMonotonic();
@@ -200,6 +253,8 @@ namespace ramses::internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls.reset();
+        m_uniformUpdatesIssued = 0u;
+        m_uniformUpdatesSkipped = 0u;
         m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
@@ -234,6 +289,8 @@ namespace ramses::internal
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numRenderablesTestedForCulling = 0u;
+            sceneStat.numRenderablesCulled = 0u;
         }
 
         m_displayStatistics.numFrameBufferSwapped = 0u;
@@ -263,6 +320,8 @@ namespace ramses::internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawCalls (" << m_drawCalls.minValue << "/" << m_drawCalls.maxValue << "/" << getDrawCallsPerFrame() << ")" <<
             ", numFrames " << m_frameNumber;
+        if (m_uniformUpdatesIssued + m_uniformUpdatesSkipped > 0u)
+            str << ", uniforms issued/skipped (" << m_uniformUpdatesIssued << "/" << m_uniformUpdatesSkipped << ")";
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
         str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB)";
@@ -315,6 +374,8 @@ namespace ramses::internal
 
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numRenderablesTestedForCulling > 0u)
+                str << ", culled " << sceneStats.numRenderablesCulled << "/" << sceneStats.numRenderablesTestedForCulling;
             str << "\n";
         }
 
@@ -13,15 +13,18 @@
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Components/FlushTimeInformation.h"
+#include "internal/Components/FlushTrace.h"
 
 #include <cstdint>
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 namespace ramses::internal
 {
     class StringOutputStream;
+    class FlushTracer;
 
     class RendererStatistics
     {
@@ -30,10 +33,16 @@ namespace ramses::internal
         [[nodiscard]] uint32_t getDrawCallsPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
+        void renderablesCulled(SceneId sceneId, size_t numTested, size_t numCulled);
+        void uniformsUpdated(uint32_t numIssued, uint32_t numSkipped);
         void trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
 
+        // traces of applied flushes are kept until scene is rendered and then passed to flush tracer
+        void setFlushTracer(FlushTracer* flushTracer);
+        void trackAppliedFlushTraces(SceneId sceneId, FlushTraces&& traces);
+
         void offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped();
@@ -55,10 +64,17 @@ namespace ramses::internal
 
         void writeStatsToStream(StringOutputStream& str) const;
 
+        // scenes not rendered (e.g. hidden) pass on their traces when this many are waiting
+        static constexpr size_t MaxFlushTracesWaitingForRender = 100u;
+
     private:
+        void passFlushTracesToTracer(SceneId sceneId);
+
         int32_t m_frameNumber = 0;
         uint64_t m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         SummaryEntry<uint32_t> m_drawCalls;
+        uint64_t m_uniformUpdatesIssued = 0u;
+        uint64_t m_uniformUpdatesSkipped = 0u;
         uint64_t m_lastFrameTick = 0u;
         uint32_t m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         uint32_t m_frameDurationMax = 0u;
@@ -101,6 +117,8 @@ namespace ramses::internal
             size_t sceneResourcesBytesUploaded = 0u;
 
             size_t numRendered = 0u;
+            size_t numRenderablesTestedForCulling = 0u;
+            size_t numRenderablesCulled = 0u;
         };
 
         struct OffscreenBufferStatistics
@@ -138,5 +156,9 @@ namespace ramses::internal
         std::map< SceneId, SceneStatistics, StronglyTypedValueComparator<SceneId> > m_sceneStatistics;
         DisplayStatistics m_displayStatistics;
         std::map< WaylandIviSurfaceId, StreamTextureStatistics, StronglyTypedValueComparator<WaylandIviSurfaceId> > m_streamTextureStatistics;
+
+        // not cleared on reset, traces wait for their scene to be rendered
+        FlushTracer* m_flushTracer = nullptr;
+        std::unordered_map<SceneId, FlushTraces> m_flushTracesWaitingForRender;
     };
 }
@@ -12,6 +12,7 @@
 #include "internal/RendererLib/SceneRenderExecutionIterator.h"
 #include "internal/SceneGraph/SceneAPI/Viewport.h"
 #include "internal/SceneGraph/SceneAPI/RenderState.h"
+#include "internal/RendererLib/FrameProfilerStatistics.h"
 
 namespace ramses::internal
 {
@@ -25,5 +26,13 @@ namespace ramses::internal
         ClearFlags displayBufferClearPending = EClearFlag::None;
         glm::vec4 displayBufferClearColor{};
         bool displayBufferDepthDiscard = false;
+        bool autoInstancing = false;
+
+        // frustum culling results, collected by RenderExecutor
+        uint32_t numRenderablesTestedForCulling = 0u;
+        uint32_t numRenderablesCulled = 0u;
+
+        // state changes between rendered renderables, collected by RenderExecutor
+        FrameProfilerStatistics::StateChanges stateChanges{};
     };
 }
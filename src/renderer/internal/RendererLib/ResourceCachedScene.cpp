@@ -41,6 +41,7 @@ namespace ramses::internal
         resizeContainerIfSmaller(m_renderTargetCache, sizeInfo.renderTargetCount);
         resizeContainerIfSmaller(m_blitPassCache, sizeInfo.blitPassCount * 2u);
         resizeContainerIfSmaller(m_uniformBuffersCache, sizeInfo.renderableCount);
+        resizeContainerIfSmaller(m_boundingSphereCache, sizeInfo.renderableCount);
     }
 
     RenderableHandle ResourceCachedScene::allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle)
@@ -50,6 +51,8 @@ namespace ramses::internal
         const uint32_t indexIntoCache = renderable.asMemoryHandle();
         assert(indexIntoCache < m_effectDeviceHandleCache.size());
         m_effectDeviceHandleCache[indexIntoCache] = DeviceResourceHandle::Invalid();
+        assert(indexIntoCache < m_boundingSphereCache.size());
+        m_boundingSphereCache[indexIntoCache].reset();
         setRenderableResourcesDirtyFlag(renderable, true);
         setRenderableVertexArrayDirtyFlag(renderable, true);
         return renderable;
@@ -214,6 +217,30 @@ namespace ramses::internal
         return m_uniformBuffersCache;
     }
 
+    const BoundingSphereCache& ResourceCachedScene::getCachedBoundingSpheres() const
+    {
+        return m_boundingSphereCache;
+    }
+
+    void ResourceCachedScene::setFrustumCullingEnabled(bool enabled)
+    {
+        if (enabled == m_frustumCullingEnabled)
+            return;
+
+        m_frustumCullingEnabled = enabled;
+        // bounding volumes are collected together with renderable resources, force their update
+        for (const auto& renderableIt : getRenderables())
+        {
+            setRenderableResourcesDirtyFlag(renderableIt.first, true);
+            m_boundingSphereCache[renderableIt.first.asMemoryHandle()].reset();
+        }
+    }
+
+    bool ResourceCachedScene::isFrustumCullingEnabled() const
+    {
+        return m_frustumCullingEnabled;
+    }
+
     bool ResourceCachedScene::CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash)
     {
         deviceHandleInOut = DeviceResourceHandle::Invalid();
@@ -337,6 +364,68 @@ namespace ramses::internal
         return true;
     }
 
+    bool ResourceCachedScene::UsesModelMatrixSemantic(const DataLayout& uniformLayout)
+    {
+        const uint32_t numberOfFields = uniformLayout.getFieldCount();
+        for (DataFieldHandle field(0u); field < numberOfFields; ++field)
+        {
+            switch (uniformLayout.getField(field).semantics)
+            {
+            case EFixedSemantics::ModelMatrix:
+            case EFixedSemantics::ModelViewMatrix:
+            case EFixedSemantics::ModelViewProjectionMatrix:
+            case EFixedSemantics::ModelBlock:
+            case EFixedSemantics::ModelCameraBlock:
+                return true;
+            default:
+                break;
+            }
+        }
+        return false;
+    }
+
+    void ResourceCachedScene::updateBoundingSphere(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable)
+    {
+        auto& boundingSphere = m_boundingSphereCache[renderable.asMemoryHandle()];
+        boundingSphere.reset();
+
+        // Bounding volume is transformed by world matrix of renderable when testing it, that is only known
+        // to be the transformation applied by shader if effect uses one of the model matrix semantics.
+        if (!UsesModelMatrixSemantic(getDataLayout(getLayoutOfDataInstance(getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms]))))
+            return;
+
+        const DataInstanceHandle dataInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        assert(dataInstance.isValid());
+        const DataLayout& geometryLayout = getDataLayout(getLayoutOfDataInstance(dataInstance));
+
+        // Vertex attributes carry no semantics, so it is not known which one holds the positions.
+        // Bounding volume is therefore merged from all attributes that could be positions, this is conservative:
+        // any float vector attribute which cannot be inspected (vec2, vec4 with w other than 1, data buffer, interleaved, instanced)
+        // disables culling for the renderable.
+        std::optional<BoundingSphere> mergedSphere;
+        const uint32_t numberOfGeometryFields = geometryLayout.getFieldCount();
+        for (DataFieldHandle attributeField(1u); attributeField < numberOfGeometryFields; ++attributeField)
+        {
+            const EDataType dataType = geometryLayout.getField(attributeField).dataType;
+            if (dataType == EDataType::Vector2Buffer)
+                return;
+            if (dataType != EDataType::Vector3Buffer && dataType != EDataType::Vector4Buffer)
+                continue;
+
+            const ResourceField& dataResource = getDataResource(dataInstance, attributeField);
+            if (!dataResource.hash.isValid() || dataResource.instancingDivisor != 0u || dataResource.offsetWithinElementInBytes != 0u || dataResource.stride != 0u)
+                return;
+
+            const auto attributeSphere = resourceAccessor.getResourceBoundingSphere(dataResource.hash);
+            if (!attributeSphere)
+                return;
+
+            mergedSphere = (mergedSphere ? FrustumCulling::MergeBoundingSpheres(*mergedSphere, *attributeSphere) : *attributeSphere);
+        }
+
+        boundingSphere = mergedSphere;
+    }
+
     void ResourceCachedScene::checkAndUpdateRenderTargetResources(const IResourceDeviceHandleAccessor& resourceAccessor)
     {
         if (!m_renderTargetsDirty)
@@ -493,6 +582,8 @@ namespace ramses::internal
                     checkGeometryResources(resourceAccessor, renderable) &&
                     checkAndUpdateUniformBuffers(resourceAccessor, renderable))
                 {
+                    if (m_frustumCullingEnabled)
+                        updateBoundingSphere(resourceAccessor, renderable);
                     setRenderableResourcesDirtyFlag(renderable, false);
                 }
             }
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "internal/RendererLib/SemanticUniformBufferScene.h"
+#include "internal/RendererLib/FrustumCulling.h"
+#include <optional>
 
 namespace ramses::internal
 {
@@ -24,6 +26,8 @@ namespace ramses::internal
     using UniformBuffersCacheEntry = DeviceHandleVector;
     using UniformBuffersCache = std::vector<UniformBuffersCacheEntry>;
 
+    using BoundingSphereCache = std::vector<std::optional<BoundingSphere>>;
+
     class ResourceCachedScene : public SemanticUniformBufferScene
     {
         using BaseT = SemanticUniformBufferScene;
@@ -62,6 +66,11 @@ namespace ramses::internal
         const DeviceHandleVector&           getCachedHandlesForBlitPassRenderTargets() const;
         const BoolVector&                   getVertexArraysDirtinessFlags() const;
         const UniformBuffersCache&          getCachedHandlesForUniformInstancesBuffers() const;
+        const BoundingSphereCache&          getCachedBoundingSpheres() const;
+
+        // bounding volumes are only collected when frustum culling is enabled
+        void                                setFrustumCullingEnabled(bool enabled);
+        bool                                isFrustumCullingEnabled() const;
 
         void updateRenderableResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void updateRenderablesResourcesDirtiness();
@@ -86,12 +95,14 @@ namespace ramses::internal
         bool isDataInstanceDirty(DataInstanceHandle handle) const;
         bool isTextureSamplerDirty(TextureSamplerHandle handle) const;
         static bool IsGeometryDataLayout(const DataLayout& layout);
+        static bool UsesModelMatrixSemantic(const DataLayout& uniformLayout);
         static bool CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash);
 
         bool checkAndUpdateEffectResource(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         bool checkAndUpdateTextureResources(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         bool checkGeometryResources(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         bool checkAndUpdateUniformBuffers(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
+        void updateBoundingSphere(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         void checkAndUpdateRenderTargetResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void checkAndUpdateBlitPassResources(const IResourceDeviceHandleAccessor& resourceAccessor);
 
@@ -106,6 +117,7 @@ namespace ramses::internal
         DeviceHandleVector         m_renderTargetCache;
         DeviceHandleVector         m_blitPassCache;
         UniformBuffersCache        m_uniformBuffersCache;
+        BoundingSphereCache        m_boundingSphereCache;
 
         mutable bool       m_renderableResourcesDirtinessNeedsUpdate = false;
         mutable bool       m_renderableVertexArraysDirty = false;
@@ -116,5 +128,6 @@ namespace ramses::internal
 
         bool m_renderTargetsDirty = false;
         bool m_blitPassesDirty = false;
+        bool m_frustumCullingEnabled = false;
     };
 }
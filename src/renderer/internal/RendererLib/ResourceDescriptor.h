@@ -11,6 +11,7 @@
 #include "internal/RendererLib/Enums/EResourceStatus.h"
 #include "internal/SceneGraph/Resource/ResourceTypes.h"
 #include "internal/RendererLib/Types.h"
+#include "internal/RendererLib/FrustumCulling.h"
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 #include "internal/Components/ManagedResource.h"
@@ -29,6 +30,7 @@ namespace ramses::internal
         uint32_t compressedSize = 0;
         uint32_t decompressedSize = 0;
         uint32_t vramSize = 0;
+        std::optional<BoundingSphere> boundingSphere;
     };
 
     using ResourceDescriptors = HashMap<ResourceContentHash, ResourceDescriptor>;
@@ -10,6 +10,7 @@
 #include "internal/RendererLib/RendererResourceRegistry.h"
 #include "internal/RendererLib/IResourceUploader.h"
 #include "internal/RendererLib/FrameTimer.h"
+#include "internal/RendererLib/SectionWorkTracker.h"
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/DisplayConfigData.h"
 #include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
@@ -18,8 +19,10 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
 #include <algorithm>
 #include <chrono>
+#include <iterator>
 
 namespace ramses::internal
 {
@@ -38,6 +41,7 @@ namespace ramses::internal
         , m_frameTimer(frameTimer)
         , m_resourceCacheSize(displayConfig.getGPUMemoryCacheSize())
         , m_resourceUploadBatchSize(displayConfig.getResourceUploadBatchSize())
+        , m_computeBoundingVolumes(displayConfig.isFrustumCullingEnabled())
         , m_stats(stats)
         , m_scenePriorities(displayConfig.getScenePriorities())
     {
@@ -62,7 +66,7 @@ namespace ramses::internal
 
     bool ResourceUploadingManager::hasAnythingToUpload() const
     {
-        return !m_resources.getAllProvidedResources().empty() || m_resources.hasAnyResourcesScheduledForUpload();
+        return !m_resources.getAllProvidedResources().empty() || m_resources.hasAnyResourcesScheduledForUpload() || !m_effectsToRegister.empty();
     }
 
     void ResourceUploadingManager::uploadAndUnloadPendingResources()
@@ -76,8 +80,11 @@ namespace ramses::internal
         getResourcesToUnloadNext(resourcesToUnload, sizeToBeFreed);
 
         unloadResources(resourcesToUnload);
-        uploadResources(resourcesToUpload);
-        syncEffects();
+
+        // first resource is always uploaded so that uploading makes progress every frame
+        SectionWorkTracker uploadWork{ &m_frameTimer, EFrameTimerSectionBudget::ResourcesUpload, 1u, m_resourceUploadBatchSize };
+        uploadResources(resourcesToUpload, uploadWork);
+        syncEffects(uploadWork);
 
         m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
     }
@@ -91,57 +98,73 @@ namespace ramses::internal
         }
     }
 
-    void ResourceUploadingManager::syncEffects()
+    void ResourceUploadingManager::syncEffects(SectionWorkTracker& uploadWork)
     {
         assert(m_asyncEffectUploader || m_effectsToUpload.empty());
         if (!m_asyncEffectUploader)
             return;
         m_asyncEffectUploader->sync(m_effectsToUpload, m_effectsUploadedTemp);
         m_effectsToUpload.clear();
+        std::move(m_effectsUploadedTemp.begin(), m_effectsUploadedTemp.end(), std::back_inserter(m_effectsToRegister));
+        m_effectsUploadedTemp.clear();
 
-        for (auto& e : m_effectsUploadedTemp)
+        // registering compiled effect includes storing its binary in cache which can be as expensive as uploading a large resource,
+        // budget is checked after each effect but at least one is registered every frame
+        size_t numEffectsRegistered = 0u;
+        while (numEffectsRegistered < m_effectsToRegister.size())
         {
-            const auto& hash = e.first;
-            if (!m_resources.containsResource(hash))
-            {
-                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects unexpected effect uploaded, will be ignored because it does not exist in resource registry #{}", hash);
-                assert(false);
-                continue;
-            }
+            auto& effect = m_effectsToRegister[numEffectsRegistered++];
+            registerUploadedEffect(effect.first, std::move(effect.second));
+            if (uploadWork.workDone(1u, true))
+                break;
+        }
 
-            const auto resourceStatus = m_resources.getResourceStatus(hash);
-            if (resourceStatus != EResourceStatus::ScheduledForUpload)
-            {
-                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects unexpected effect uploaded, will be ignored because is not in state scheduled for upload #{} (status :{})", hash, resourceStatus);
-                assert(false);
-                continue;
-            }
+        if (numEffectsRegistered < m_effectsToRegister.size())
+        {
+            LOG_INFO(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects: Interrupt: Exceeded time for resource upload (registered {} effects, remaining {} effects to register)",
+                numEffectsRegistered, m_effectsToRegister.size() - numEffectsRegistered);
+        }
+        m_effectsToRegister.erase(m_effectsToRegister.begin(), m_effectsToRegister.begin() + static_cast<std::ptrdiff_t>(numEffectsRegistered));
+    }
 
-            if (e.second)
-            {
-                const auto& rd = m_resources.getResourceDescriptor(hash);
-                const auto deviceHandle = m_renderBackend.getDevice().registerShader(std::move(e.second));
-                const auto resourceSize = rd.decompressedSize;
-                m_resourceSizes.put(hash, resourceSize);
-                m_resourceTotalUploadedSize += resourceSize;
-                m_resources.setResourceUploaded(hash, deviceHandle, resourceSize);
+    void ResourceUploadingManager::registerUploadedEffect(const ResourceContentHash& hash, std::unique_ptr<const GPUResource> gpuResource)
+    {
+        if (!m_resources.containsResource(hash))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects unexpected effect uploaded, will be ignored because it does not exist in resource registry #{}", hash);
+            assert(false);
+            return;
+        }
 
-                const auto sceneId = (rd.sceneUsage.empty() ? SceneId{} : rd.sceneUsage.front());
-                m_uploader->storeShaderInBinaryShaderCache(m_renderBackend, deviceHandle, hash, sceneId);
-            }
-            else
-            {
-                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects failed to upload effect #{}", hash);
-                m_resources.setResourceBroken(hash);
-            }
+        const auto resourceStatus = m_resources.getResourceStatus(hash);
+        if (resourceStatus != EResourceStatus::ScheduledForUpload)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects unexpected effect uploaded, will be ignored because is not in state scheduled for upload #{} (status :{})", hash, resourceStatus);
+            assert(false);
+            return;
         }
 
-        m_effectsUploadedTemp.clear();
+        if (gpuResource)
+        {
+            const auto& rd = m_resources.getResourceDescriptor(hash);
+            const auto deviceHandle = m_renderBackend.getDevice().registerShader(std::move(gpuResource));
+            const auto resourceSize = rd.decompressedSize;
+            m_resourceSizes.put(hash, resourceSize);
+            m_resourceTotalUploadedSize += resourceSize;
+            m_resources.setResourceUploaded(hash, deviceHandle, resourceSize);
+
+            const auto sceneId = (rd.sceneUsage.empty() ? SceneId{} : rd.sceneUsage.front());
+            m_uploader->storeShaderInBinaryShaderCache(m_renderBackend, deviceHandle, hash, sceneId);
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects failed to upload effect #{}", hash);
+            m_resources.setResourceBroken(hash);
+        }
     }
 
-    void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload)
+    void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload, SectionWorkTracker& uploadWork)
     {
-        assert(m_resourceUploadBatchSize > 0u);
         uint32_t sizeUploaded = 0u;
         for (size_t i = 0u; i < resourcesToUpload.size(); ++i)
         {
@@ -151,10 +174,9 @@ namespace ramses::internal
             m_stats.resourceUploaded(resourceSize);
             sizeUploaded += resourceSize;
 
-            const bool checkTimeLimit = (i % m_resourceUploadBatchSize == 0) || (resourceSize > LargeResourceByteSizeThreshold);
-            std::chrono::milliseconds sectionDuration{};
-            if (checkTimeLimit && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ResourcesUpload, &sectionDuration))
+            if (uploadWork.workDone(1u, resourceSize > LargeResourceByteSizeThreshold))
             {
+                const auto sectionDuration = std::chrono::duration_cast<std::chrono::milliseconds>(FrameTimer::Clock::now() - m_frameTimer.getFrameStartTime());
                 const auto numUploaded = i + 1;
                 const auto numRemaining = resourcesToUpload.size() - numUploaded;
                 LOG_INFO(CONTEXT_RENDERER, "ResourceUploadingManager::uploadResources: Interrupt: Exceeded time for resource upload (uploaded {} resources of size {} B, remaining {} resources to upload). dt {}ms",
@@ -198,6 +220,12 @@ namespace ramses::internal
             {
                 m_resourceSizes.put(rd.hash, resourceSize);
                 m_resourceTotalUploadedSize += resourceSize;
+                // bounding volume has to be computed while resource data is still available
+                if (m_computeBoundingVolumes && rd.type == EResourceType::VertexArray)
+                {
+                    const auto* vertArray = pResource->convertTo<ArrayResource>();
+                    m_resources.setResourceBoundingSphere(rd.hash, FrustumCulling::ComputeBoundingSphere(vertArray->getElementType(), vertArray->getResourceData().data(), vertArray->getElementCount()));
+                }
                 // will also release reference to data (release from system memory if last holder)
                 m_resources.setResourceUploaded(rd.hash, deviceHandle.value(), vramSize);
             }
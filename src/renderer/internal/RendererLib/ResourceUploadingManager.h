@@ -22,6 +22,7 @@ namespace ramses::internal
     class FrameTimer;
     class RendererStatistics;
     class DisplayConfigData;
+    class SectionWorkTracker;
 
     class ResourceUploadingManager
     {
@@ -48,8 +49,9 @@ namespace ramses::internal
 
     private:
         void unloadResources(const ResourceContentHashVector& resourcesToUnload);
-        void uploadResources(const ResourceContentHashVector& resourcesToUpload);
-        void syncEffects();
+        void uploadResources(const ResourceContentHashVector& resourcesToUpload, SectionWorkTracker& uploadWork);
+        void syncEffects(SectionWorkTracker& uploadWork);
+        void registerUploadedEffect(const ResourceContentHash& hash, std::unique_ptr<const GPUResource> gpuResource);
         void uploadResource(const ResourceDescriptor& rd);
         void unloadResource(const ResourceDescriptor& rd);
         void getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, uint64_t sizeToBeFreed, bool keepEffects = true) const;
@@ -63,6 +65,8 @@ namespace ramses::internal
         AsyncEffectUploader*            m_asyncEffectUploader;
         EffectsRawResources             m_effectsToUpload;
         EffectsGpuResources             m_effectsUploadedTemp; //to avoid re-allocation each frame
+        // effects compiled by async uploader, their registration is part of resource upload time budget and can be postponed to next frames
+        EffectsGpuResources             m_effectsToRegister;
 
         const FrameTimer& m_frameTimer;
 
@@ -71,6 +75,7 @@ namespace ramses::internal
         uint64_t        m_resourceTotalUploadedSize = 0u;
         const uint64_t  m_resourceCacheSize = 0u;
         const uint32_t  m_resourceUploadBatchSize   = 10u;
+        const bool      m_computeBoundingVolumes    = false;
 
         RendererStatistics& m_stats;
 
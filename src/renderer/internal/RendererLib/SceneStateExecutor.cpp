@@ -32,9 +32,12 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state PUBLISHED", sceneId);
     }
 
-    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId)
+    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId, const ResourceContentHashVector& availableResources)
     {
         assert(checkIfCanBeSubscriptionRequested(sceneId));
+        // must arrive at provider before subscription
+        if (!availableResources.empty())
+            m_rendererSceneEventSender.sendResourcesAvailable(sceneId, availableResources);
         m_rendererSceneEventSender.sendSubscribeScene(sceneId);
         m_scenesStateInfo.setSceneState(sceneId, ESceneState::SubscriptionRequested);
         LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state SUBSCRIPTION REQUESTED", sceneId);
@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/SceneStateInfo.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 
 namespace ramses::internal
 {
@@ -26,7 +27,7 @@ namespace ramses::internal
 
         void setPublished                     (SceneId sceneId, EScenePublicationMode mode);
         void setUnpublished                   (SceneId sceneId);
-        void setSubscriptionRequested         (SceneId sceneId);
+        void setSubscriptionRequested         (SceneId sceneId, const ResourceContentHashVector& availableResources);
         void setSubscriptionPending           (SceneId sceneId);
         void setSubscribed                    (SceneId sceneId);
         void setUnsubscribed                  (SceneId sceneId, bool indirect);
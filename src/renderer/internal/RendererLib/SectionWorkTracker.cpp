@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SectionWorkTracker.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    SectionWorkTracker::SectionWorkTracker(const FrameTimer* frameTimer, EFrameTimerSectionBudget section, uint32_t unitsBeforeFirstCheck, uint32_t maxUnitsBetweenChecks)
+        : m_frameTimer(frameTimer)
+        , m_section(section)
+        , m_maxUnitsBetweenChecks(maxUnitsBetweenChecks)
+        , m_startTime(frameTimer != nullptr ? FrameTimer::Clock::now() : FrameTimer::Clock::time_point{})
+        , m_nextCheck(unitsBeforeFirstCheck)
+    {
+        assert(maxUnitsBetweenChecks > 0u);
+    }
+
+    SectionWorkTracker::~SectionWorkTracker()
+    {
+        if (m_frameTimer != nullptr)
+            m_frameTimer->reportSectionWork(m_section, m_numWorkUnitsDone, FrameTimer::Clock::now() - m_startTime);
+    }
+
+    bool SectionWorkTracker::workDone(uint32_t numWorkUnits, bool forceCheck)
+    {
+        m_numWorkUnitsDone += numWorkUnits;
+        if (m_frameTimer == nullptr)
+            return false;
+        if (m_interrupted)
+            return true;
+        if (!forceCheck && m_numWorkUnitsDone < m_nextCheck)
+            return false;
+
+        // do not start next unit of work if it is predicted to miss the deadline
+        const uint64_t affordableUnits = m_frameTimer->getAffordableWorkUnits(m_section);
+        if (affordableUnits == 0u)
+        {
+            m_interrupted = true;
+            return true;
+        }
+
+        // check again halfway through the work predicted to fit, the closer the deadline the more frequent the checks
+        m_nextCheck = m_numWorkUnitsDone + std::clamp<uint64_t>(affordableUnits / 2u, 1u, m_maxUnitsBetweenChecks);
+        return false;
+    }
+
+    uint64_t SectionWorkTracker::getNumWorkUnitsDone() const
+    {
+        return m_numWorkUnitsDone;
+    }
+}
@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/FrameTimer.h"
+
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Tracks work done in an interruptible frame section and decides when the section has to check its time budget.
+    // The budget is checked first after a fixed number of work units so that the section makes progress every frame.
+    // Further checks are adaptive: at most every maxUnitsBetweenChecks units, more often when the cost of the work
+    // predicted by frame timer approaches the remaining budget. Work predicted not to fit anymore is not started at all.
+    // Measured work is reported to frame timer on destruction to refine the prediction for next frames.
+    class SectionWorkTracker
+    {
+    public:
+        // no budget checks and no reporting if frameTimer is nullptr
+        SectionWorkTracker(const FrameTimer* frameTimer, EFrameTimerSectionBudget section, uint32_t unitsBeforeFirstCheck, uint32_t maxUnitsBetweenChecks);
+        ~SectionWorkTracker();
+
+        SectionWorkTracker(const SectionWorkTracker&) = delete;
+        SectionWorkTracker& operator=(const SectionWorkTracker&) = delete;
+
+        // Returns true if section has to be interrupted, forceCheck can be used after work known to be expensive
+        [[nodiscard]] bool workDone(uint32_t numWorkUnits, bool forceCheck = false);
+
+        [[nodiscard]] uint64_t getNumWorkUnitsDone() const;
+
+    private:
+        const FrameTimer* const         m_frameTimer;
+        const EFrameTimerSectionBudget  m_section;
+        const uint32_t                  m_maxUnitsBetweenChecks;
+        const FrameTimer::Clock::time_point m_startTime;
+        uint64_t                        m_numWorkUnitsDone = 0u;
+        uint64_t                        m_nextCheck;
+        bool                            m_interrupted = false;
+    };
+}
@@ -0,0 +1,204 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ShaderSourceUtils.h"
+
+#include <cctype>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        bool IsIdentifierChar(char c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+        }
+
+        bool IsSpace(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        bool IsDigit(char c)
+        {
+            return std::isdigit(static_cast<unsigned char>(c)) != 0;
+        }
+
+        // moves pos before the word preceding it (whitespace in between is skipped) and returns the word
+        std::string_view ReadWordBefore(std::string_view source, size_t& pos)
+        {
+            while (pos > 0u && IsSpace(source[pos - 1u]))
+                --pos;
+            const size_t end = pos;
+            while (pos > 0u && IsIdentifierChar(source[pos - 1u]))
+                --pos;
+            return source.substr(pos, end - pos);
+        }
+
+        size_t SkipSpaces(std::string_view source, size_t pos)
+        {
+            while (pos < source.size() && IsSpace(source[pos]))
+                ++pos;
+            return pos;
+        }
+
+        // position after '#version' directive keyword, npos if there is none
+        size_t FindVersionNumber(std::string_view source)
+        {
+            const size_t directivePos = source.find("#version");
+            if (directivePos == std::string_view::npos)
+                return std::string_view::npos;
+            return SkipSpaces(source, directivePos + std::string_view("#version").size());
+        }
+
+        size_t GetNextLine(std::string_view source, size_t pos)
+        {
+            const size_t lineEnd = source.find('\n', pos);
+            return lineEnd == std::string_view::npos ? source.size() : lineEnd + 1u;
+        }
+    }
+
+    std::vector<size_t> ShaderSourceUtils::FindWholeWord(std::string_view source, std::string_view word)
+    {
+        std::vector<size_t> positions;
+        for (size_t pos = source.find(word); pos != std::string_view::npos; pos = source.find(word, pos + 1u))
+        {
+            const size_t end = pos + word.size();
+            if ((pos == 0u || !IsIdentifierChar(source[pos - 1u])) && (end == source.size() || !IsIdentifierChar(source[end])))
+                positions.push_back(pos);
+        }
+        return positions;
+    }
+
+    bool ShaderSourceUtils::IsUsedInPreprocessorDirective(std::string_view source, std::string_view word)
+    {
+        for (const size_t wordPos : FindWholeWord(source, word))
+        {
+            // directive can span several lines joined by backslash at line end
+            size_t lineStart = source.rfind('\n', wordPos);
+            lineStart = (lineStart == std::string_view::npos ? 0u : lineStart + 1u);
+            while (lineStart >= 2u && source[lineStart - 2u] == '\\')
+            {
+                const size_t prevLineEnd = source.rfind('\n', lineStart - 2u);
+                lineStart = (prevLineEnd == std::string_view::npos ? 0u : prevLineEnd + 1u);
+            }
+
+            const size_t pos = SkipSpaces(source, lineStart);
+            if (pos < wordPos && source[pos] == '#')
+                return true;
+        }
+        return false;
+    }
+
+    uint32_t ShaderSourceUtils::GetShaderVersion(std::string_view source)
+    {
+        size_t pos = FindVersionNumber(source);
+        if (pos == std::string_view::npos)
+            return 100u;
+
+        uint32_t version = 0u;
+        while (pos < source.size() && IsDigit(source[pos]))
+            version = version * 10u + static_cast<uint32_t>(source[pos++] - '0');
+        return version;
+    }
+
+    bool ShaderSourceUtils::IsESShader(std::string_view source)
+    {
+        size_t pos = FindVersionNumber(source);
+        if (pos == std::string_view::npos)
+            return true;
+
+        while (pos < source.size() && IsDigit(source[pos]))
+            ++pos;
+        pos = SkipSpaces(source, pos);
+        return source.substr(pos, 2u) == "es" && (pos + 2u == source.size() || !IsIdentifierChar(source[pos + 2u]));
+    }
+
+    size_t ShaderSourceUtils::GetDeclarationsInsertPosition(std::string_view source)
+    {
+        size_t insertPos = 0u;
+        size_t lineStart = 0u;
+        while (lineStart < source.size())
+        {
+            const size_t nextLine = GetNextLine(source, lineStart);
+            size_t pos = lineStart;
+            while (pos < nextLine && IsSpace(source[pos]))
+                ++pos;
+
+            const std::string_view line = source.substr(pos, nextLine - pos);
+            if (line.substr(0u, 8u) == "#version" || line.substr(0u, 10u) == "#extension")
+                insertPos = nextLine;
+            else if (!line.empty() && line.substr(0u, 2u) != "//")
+                break;
+            lineStart = nextLine;
+        }
+        return insertPos;
+    }
+
+    bool ShaderSourceUtils::FindUniformDeclaration(std::string_view source, std::string_view name, std::string_view typeName, std::optional<UniformDeclaration>& declaration)
+    {
+        declaration.reset();
+        for (const size_t namePos : FindWholeWord(source, name))
+        {
+            size_t nameEnd = namePos + name.size();
+            size_t end = SkipSpaces(source, nameEnd);
+            if (end < source.size() && source[end] == '[')
+            {
+                end = SkipSpaces(source, end + 1u);
+                while (end < source.size() && IsDigit(source[end]))
+                    ++end;
+                end = SkipSpaces(source, end);
+                if (end == source.size() || source[end] != ']')
+                    continue;
+                nameEnd = end + 1u;
+                end = SkipSpaces(source, nameEnd);
+            }
+            if (end == source.size() || source[end] != ';')
+                continue;
+
+            size_t begin = namePos;
+            if (ReadWordBefore(source, begin) != typeName)
+                continue;
+            std::string_view precision = ReadWordBefore(source, begin);
+            if (precision == "lowp" || precision == "mediump" || precision == "highp")
+            {
+                if (ReadWordBefore(source, begin) != "uniform")
+                    continue;
+            }
+            else if (precision == "uniform")
+            {
+                precision = {};
+            }
+            else
+            {
+                continue;
+            }
+
+            // only declarations on their own line are accepted, this excludes layout qualifiers or multiple declarations before or after
+            size_t lineStart = begin;
+            while (lineStart > 0u && source[lineStart - 1u] != '\n' && IsSpace(source[lineStart - 1u]))
+                --lineStart;
+            if (lineStart > 0u && source[lineStart - 1u] != '\n')
+                return false;
+
+            size_t restPos = end + 1u;
+            while (restPos < source.size() && source[restPos] != '\n' && IsSpace(source[restPos]))
+                ++restPos;
+            if (restPos < source.size() && source[restPos] != '\n' && source.substr(restPos, 2u) != "//")
+                return false;
+
+            // declared more than once (e.g. in preprocessor branches), give up
+            if (declaration)
+                return false;
+
+            declaration = UniformDeclaration{ begin, nameEnd, end + 1u, precision };
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Simple textual analysis of GLSL sources used to derive shader variants,
+    // it does not run preprocessor and recognizes only declarations written in a straightforward way.
+    namespace ShaderSourceUtils
+    {
+        // positions of all occurrences of word in source which are not part of a longer identifier
+        std::vector<size_t> FindWholeWord(std::string_view source, std::string_view word);
+
+        // version from '#version' directive, 100 if there is none
+        uint32_t GetShaderVersion(std::string_view source);
+        bool IsESShader(std::string_view source);
+
+        // position where declarations can be inserted, i.e. beginning of line following '#version' and '#extension' directives
+        size_t GetDeclarationsInsertPosition(std::string_view source);
+
+        struct UniformDeclaration
+        {
+            size_t begin = 0u;          // position of 'uniform' keyword
+            size_t nameEnd = 0u;        // position after name including array size
+            size_t end = 0u;            // position after terminating semicolon
+            std::string_view precision; // empty if declared without precision qualifier
+        };
+
+        // true if word occurs in a preprocessor directive (e.g. macro definition or condition),
+        // usages of word cannot be found reliably then without running preprocessor
+        bool IsUsedInPreprocessorDirective(std::string_view source, std::string_view word);
+
+        // Finds declaration '[uniform] [precision] <type> <name>[ '[' <size> ']' ];' written on its own line (only comment may follow).
+        // Returns false if declaration cannot be used for rewriting (not on its own line or declared more than once),
+        // otherwise declaration is set if found.
+        bool FindUniformDeclaration(std::string_view source, std::string_view name, std::string_view typeName, std::optional<UniformDeclaration>& declaration);
+    }
+}
@@ -14,6 +14,7 @@
 #include "internal/SceneGraph/Scene/ResourceChanges.h"
 #include "internal/SceneReferencing/SceneReferenceAction.h"
 #include "internal/Components/FlushTimeInformation.h"
+#include "internal/Components/FlushTrace.h"
 #include "internal/Components/ManagedResource.h"
 
 namespace ramses::internal
@@ -30,6 +31,9 @@ namespace ramses::internal
         ManagedResourceVector     resourceDataToProvide;
         ResourceContentHashVector resourcesAdded;
         ResourceContentHashVector resourcesRemoved;
+
+        // one trace per flush received if tracing enabled, merged flushes keep traces of all flushes
+        FlushTraces               traces;
     };
     using PendingFlushes = std::vector<PendingFlush>;
 
@@ -0,0 +1,91 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
+#include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+    std::atomic<size_t> allocationCount{ 0u };
+}
+
+// counts all heap allocations of this benchmark binary
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size > 0u ? size : 1u))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+namespace ramses::internal
+{
+    // Scene update is serialized into packets of same size as used by TCPConnectionSystem and every packet
+    // is deserialized right away, as when received over loopback connection (without socket overhead).
+    static void BM_SceneUpdateLoopback(benchmark::State& state)
+    {
+        const auto numActions = static_cast<uint32_t>(state.range(0));
+        const auto resourceElements = static_cast<uint32_t>(state.range(1));
+
+        SceneUpdate update;
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            update.actions.beginWriteSceneAction(ESceneActionId::TestAction);
+            for (uint32_t v = 0u; v < 16u; ++v)
+                update.actions.write(i + v);
+        }
+        const std::vector<float> resourceData(resourceElements, 1.f);
+        update.resources.push_back(std::make_shared<const ArrayResource>(EResourceType::VertexArray, resourceElements, EDataType::Float, resourceData.data(), "res"));
+
+        StatisticCollectionScene sceneStatistics;
+        const SceneUpdateSerializer serializer(update, sceneStatistics, EFeatureLevel_Latest);
+        SceneUpdateStreamDeserializer deserializer(EFeatureLevel_Latest);
+        std::vector<std::byte> packet(300000u);
+
+        size_t bytesTransferred = 0u;
+        size_t allocations = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+            const bool success = serializer.writeToPackets({ packet.data(), packet.size() }, [&](size_t size) {
+                bytesTransferred += size;
+                auto result = deserializer.processData({ packet.data(), size });
+                benchmark::DoNotOptimize(result);
+                return result.result != SceneUpdateStreamDeserializer::ResultType::Failed;
+            });
+            allocations += allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+            if (!success)
+                state.SkipWithError("scene update loopback failed");
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(bytesTransferred));
+        state.counters["allocs/update"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK(BM_SceneUpdateLoopback)->Args({ 100, 1024 })->Args({ 10000, 1024 })->Args({ 1000, 1024 * 1024 });
+}
@@ -0,0 +1,271 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Communication/TransportTCP/TCPConnectionSystem.h"
+#include "internal/Communication/TransportCommon/IConnectionStatusListener.h"
+#include "internal/Communication/TransportCommon/IConnectionStatusUpdateNotifier.h"
+#include "internal/Communication/TransportCommon/ServiceHandlerInterfaces.h"
+#include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
+#include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        constexpr uint32_t NumPublishers = 8u;
+        constexpr uint32_t NumSubscribers = 4u;
+        constexpr uint32_t UpdatesPerIteration = 4u;
+        // not the default daemon port to not interfere with a running daemon
+        constexpr uint16_t DaemonPort = 5997u;
+
+        class ConnectionCounter : public IConnectionStatusListener
+        {
+        public:
+            void newParticipantHasConnected(const Guid& /*guid*/) override
+            {
+                ++connected;
+            }
+
+            void participantHasDisconnected(const Guid& /*guid*/) override
+            {
+                --connected;
+            }
+
+            std::atomic<uint32_t> connected{ 0u };
+        };
+
+        // deserializes scene updates per publisher without holding framework lock, like SceneGraphComponent does
+        class UpdateReceiver : public ISceneRendererServiceHandler
+        {
+        public:
+            void handleNewScenesAvailable(const SceneInfoVector& /*newScenes*/, const Guid& /*providerID*/, EFeatureLevel /*featureLevel*/) override {}
+            void handleScenesBecameUnavailable(const SceneInfoVector& /*unavailableScenes*/, const Guid& /*providerID*/) override {}
+            void handleSceneNotAvailable(const SceneId& /*sceneId*/, const Guid& /*providerID*/) override {}
+            void handleInitializeScene(const SceneId& /*sceneId*/, const Guid& /*providerID*/) override {}
+
+            void handleSceneUpdate(const SceneId& /*sceneId*/, absl::Span<const std::byte> actionData, const Guid& providerID) override
+            {
+                SceneUpdateStreamDeserializer* deserializer = nullptr;
+                {
+                    std::lock_guard<std::mutex> guard(m_mutex);
+                    auto& entry = m_deserializers[providerID];
+                    if (!entry)
+                        entry = std::make_unique<SceneUpdateStreamDeserializer>(EFeatureLevel_Latest);
+                    deserializer = entry.get();
+                }
+
+                const auto result = deserializer->processData(actionData);
+                if (result.result == SceneUpdateStreamDeserializer::ResultType::Empty)
+                    return;
+
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if (result.result == SceneUpdateStreamDeserializer::ResultType::Failed)
+                    m_failed = true;
+                ++m_receivedUpdates;
+                m_condition.notify_all();
+            }
+
+            bool waitForUpdates(uint64_t count)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                const bool received = m_condition.wait_for(lock, std::chrono::seconds{ 10 }, [&]() { return m_receivedUpdates >= count; });
+                return received && !m_failed;
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::unordered_map<Guid, std::unique_ptr<SceneUpdateStreamDeserializer>> m_deserializers;
+            uint64_t m_receivedUpdates = 0u;
+            bool m_failed = false;
+        };
+
+        struct Participant
+        {
+            Participant(const NetworkParticipantAddress& address, bool pureDaemon, uint32_t dispatchThreadCount, std::string unixSocketDirectory = {})
+                : connectionSystem(address, 0u, NetworkParticipantAddress(TCPConnectionSystem::GetDaemonId(), "SM", "127.0.0.1", DaemonPort), pureDaemon,
+                    lock, statistics, std::chrono::milliseconds{ 1000 }, std::chrono::milliseconds{ 10000 }, {}, dispatchThreadCount, std::move(unixSocketDirectory))
+            {
+                connectionSystem.getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(&connections);
+            }
+
+            ~Participant()
+            {
+                connectionSystem.disconnectServices();
+                connectionSystem.getRamsesConnectionStatusUpdateNotifier().unregisterForConnectionUpdates(&connections);
+            }
+
+            Participant(const Participant&) = delete;
+            Participant& operator=(const Participant&) = delete;
+
+            PlatformLock lock;
+            StatisticCollectionFramework statistics;
+            ConnectionCounter connections;
+            UpdateReceiver receiver;
+            TCPConnectionSystem connectionSystem;
+        };
+
+        bool WaitForConnections(const std::vector<std::unique_ptr<Participant>>& participants, uint32_t expectedConnections)
+        {
+            for (uint32_t i = 0u; i < 1000u; ++i)
+            {
+                if (std::all_of(participants.cbegin(), participants.cend(), [&](const auto& p) { return p->connections.connected >= expectedConnections; }))
+                    return true;
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+            }
+            return false;
+        }
+    }
+
+    // Each publisher sends scene updates with a large resource to all subscribers over loopback connections.
+    // Subscribers receive from all publishers at once and deserialize on given number of connection threads.
+    static void BM_TCPConnectionSceneUpdateFanIn(benchmark::State& state)
+    {
+        const auto threadCount = static_cast<uint32_t>(state.range(0));
+        const auto resourceElements = static_cast<uint32_t>(state.range(1));
+
+        Participant daemon(NetworkParticipantAddress(TCPConnectionSystem::GetDaemonId(), "SM", "127.0.0.1", DaemonPort), true, 1u);
+        daemon.connectionSystem.connectServices();
+
+        std::vector<std::unique_ptr<Participant>> publishers;
+        std::vector<std::unique_ptr<Participant>> subscribers;
+        std::vector<Guid> subscriberIds;
+        for (uint32_t i = 0u; i < NumPublishers; ++i)
+            publishers.push_back(std::make_unique<Participant>(NetworkParticipantAddress(Guid(100u + i), "pub" + std::to_string(i), "127.0.0.1", 0u), false, 1u));
+        for (uint32_t i = 0u; i < NumSubscribers; ++i)
+        {
+            subscriberIds.emplace_back(200u + i);
+            subscribers.push_back(std::make_unique<Participant>(NetworkParticipantAddress(subscriberIds.back(), "sub" + std::to_string(i), "127.0.0.1", 0u), false, threadCount));
+            subscribers.back()->connectionSystem.setSceneRendererServiceHandler(&subscribers.back()->receiver);
+        }
+        for (auto& p : publishers)
+            p->connectionSystem.connectServices();
+        for (auto& p : subscribers)
+            p->connectionSystem.connectServices();
+
+        if (!WaitForConnections(publishers, NumPublishers + NumSubscribers - 1u) || !WaitForConnections(subscribers, NumPublishers + NumSubscribers - 1u))
+        {
+            state.SkipWithError("participants did not connect");
+            return;
+        }
+
+        SceneUpdate update;
+        for (uint32_t i = 0u; i < 1000u; ++i)
+        {
+            update.actions.beginWriteSceneAction(ESceneActionId::TestAction);
+            for (uint32_t v = 0u; v < 16u; ++v)
+                update.actions.write(i + v);
+        }
+        const std::vector<float> resourceData(resourceElements, 1.f);
+        update.resources.push_back(std::make_shared<const ArrayResource>(EResourceType::VertexArray, resourceElements, EDataType::Float, resourceData.data(), "res"));
+
+        StatisticCollectionScene sceneStatistics;
+        const SceneUpdateSerializer serializer(update, sceneStatistics, EFeatureLevel_Latest);
+        size_t updateSize = 0u;
+        std::vector<std::byte> packet(300000u);
+        serializer.writeToPackets({ packet.data(), packet.size() }, [&](size_t size) {
+            updateSize += size;
+            return true;
+        });
+
+        uint64_t expectedUpdates = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (uint32_t u = 0u; u < UpdatesPerIteration; ++u)
+            {
+                for (uint32_t i = 0u; i < NumPublishers; ++i)
+                {
+                    PlatformGuard guard(publishers[i]->lock);
+                    publishers[i]->connectionSystem.sendSceneUpdate(subscriberIds, SceneId(i + 1u), serializer);
+                }
+            }
+
+            expectedUpdates += NumPublishers * UpdatesPerIteration;
+            for (auto& p : subscribers)
+            {
+                if (!p->receiver.waitForUpdates(expectedUpdates))
+                {
+                    state.SkipWithError("scene updates not received");
+                    break;
+                }
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * NumPublishers * NumSubscribers * UpdatesPerIteration * updateSize));
+    }
+
+    BENCHMARK(BM_TCPConnectionSceneUpdateFanIn)->Args({ 1, 256 * 1024 })->Args({ 2, 256 * 1024 })->Args({ 4, 256 * 1024 })->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    // Round trip of small scene update from flush on publisher to receive at renderer side, one update at a time.
+    // Both participants on same host, connected via tcp loopback (0) or unix domain socket (1).
+    static void BM_TCPConnectionSceneUpdateLatency(benchmark::State& state)
+    {
+        const bool useUnixSocket = (state.range(0) != 0);
+        const auto numActions = static_cast<uint32_t>(state.range(1));
+        const std::string unixSocketDirectory = (useUnixSocket ? "/tmp" : "");
+
+        Participant daemon(NetworkParticipantAddress(TCPConnectionSystem::GetDaemonId(), "SM", "127.0.0.1", DaemonPort), true, 1u, unixSocketDirectory);
+        daemon.connectionSystem.connectServices();
+
+        std::vector<std::unique_ptr<Participant>> participants;
+        participants.push_back(std::make_unique<Participant>(NetworkParticipantAddress(Guid(100u), "pub", "127.0.0.1", 0u), false, 1u, unixSocketDirectory));
+        participants.push_back(std::make_unique<Participant>(NetworkParticipantAddress(Guid(200u), "sub", "127.0.0.1", 0u), false, 1u, unixSocketDirectory));
+        Participant& publisher = *participants[0];
+        Participant& subscriber = *participants[1];
+        subscriber.connectionSystem.setSceneRendererServiceHandler(&subscriber.receiver);
+        for (auto& p : participants)
+            p->connectionSystem.connectServices();
+
+        if (!WaitForConnections(participants, 1u))
+        {
+            state.SkipWithError("participants did not connect");
+            return;
+        }
+
+        SceneUpdate update;
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            update.actions.beginWriteSceneAction(ESceneActionId::TestAction);
+            update.actions.write(i);
+        }
+        StatisticCollectionScene sceneStatistics;
+        const SceneUpdateSerializer serializer(update, sceneStatistics, EFeatureLevel_Latest);
+        const std::vector<Guid> subscriberIds{ Guid(200u) };
+
+        uint64_t expectedUpdates = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            {
+                PlatformGuard guard(publisher.lock);
+                publisher.connectionSystem.sendSceneUpdate(subscriberIds, SceneId(1u), serializer);
+            }
+            if (!subscriber.receiver.waitForUpdates(++expectedUpdates))
+            {
+                state.SkipWithError("scene updates not received");
+                break;
+            }
+        }
+    }
+
+    BENCHMARK(BM_TCPConnectionSceneUpdateLatency)->ArgNames({ "unixSocket", "actions" })->Args({ 0, 10 })->Args({ 1, 10 })->Args({ 0, 1000 })->Args({ 1, 1000 })->UseRealTime()->Unit(benchmark::kMicrosecond);
+}
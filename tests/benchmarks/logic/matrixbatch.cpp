@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/logic/MatrixBatch.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    static void FillMatrices(std::vector<matrix44f>& lhs, std::vector<matrix44f>& rhs, size_t count)
+    {
+        lhs.resize(count);
+        rhs.resize(count);
+        for (size_t i = 0u; i < count; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int r = 0; r < 4; ++r)
+                {
+                    lhs[i][c][r] = static_cast<float>(i + 4u * static_cast<size_t>(c) + static_cast<size_t>(r));
+                    rhs[i][c][r] = 1.f / static_cast<float>(1 + c + r);
+                }
+            }
+        }
+    }
+
+    // joint matrices of skin binding (joint world matrix times inverse bind matrix), batch implementation
+    static void BM_MatrixBatchMultiply(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<matrix44f> lhs;
+        std::vector<matrix44f> rhs;
+        FillMatrices(lhs, rhs, count);
+        std::vector<matrix44f> result(count);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            MatrixBatch::Multiply(lhs.data(), rhs.data(), result.data(), count);
+            benchmark::DoNotOptimize(result.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+        state.SetLabel(MatrixBatch::GetImplementationName());
+    }
+    BENCHMARK(BM_MatrixBatchMultiply)->Arg(16)->Arg(64)->Arg(256);
+
+    // same multiplication with glm one matrix at a time, as reference for batch implementation
+    static void BM_MatrixMultiplyScalar(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<matrix44f> lhs;
+        std::vector<matrix44f> rhs;
+        FillMatrices(lhs, rhs, count);
+        std::vector<matrix44f> result(count);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t i = 0u; i < count; ++i)
+                result[i] = lhs[i] * rhs[i];
+            benchmark::DoNotOptimize(result.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    }
+    BENCHMARK(BM_MatrixMultiplyScalar)->Arg(16)->Arg(64)->Arg(256);
+}
@@ -9,6 +9,7 @@
 #include "benchmarksetup.h"
 #include "ramses/client/logic/LuaScript.h"
 #include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/NodeBinding.h"
 
 #include "impl/logic/LogicEngineImpl.h"
 #include "fmt/format.h"
@@ -128,6 +129,85 @@ namespace ramses
     // Same as BM_Update_AssignProperty, but with arrays
     BENCHMARK(BM_Update_AssignArray)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 
+    static void BM_Update_AssignArrayFlat(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const int64_t loopCount = state.range(0);
+
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.array = Type:Array(255, Type:Vec4f())
+                OUT.array = Type:Array(255, Type:Vec4f())
+            end
+            function run(IN,OUT)
+                for i = 0,{},1 do
+                    rl_setFlat(OUT.array, rl_getFlat(IN.array))
+                end
+            end
+        )", loopCount);
+
+        logicEngine.createLuaScript(scriptSrc);
+
+        logicEngine.impl().disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Same as BM_Update_AssignArray, but with bulk transfer using flat tables
+    BENCHMARK(BM_Update_AssignArrayFlat)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_ScriptMath(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const int64_t loopCount = state.range(0);
+
+        // pure Lua arithmetic (low-pass filter and 4x4 matrix products) with a single property write at the end,
+        // dominated by the Lua VM itself - use it to compare the internal Lua with ramses-sdk_USE_PLATFORM_LUAJIT
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.param = Type:Float()
+                OUT.param = Type:Float()
+            end
+            function run(IN,OUT)
+                local a = {{ 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }}
+                local b = {{ 0.5, 0.1, 0, 0, -0.1, 0.5, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1 }}
+                local c = {{}}
+                local filtered = 0
+                for i = 1,{},1 do
+                    filtered = filtered + 0.1 * (IN.param + math.sin(i) - filtered)
+                    for row = 0,3 do
+                        for col = 1,4 do
+                            c[row * 4 + col] = a[row * 4 + 1] * b[col] + a[row * 4 + 2] * b[4 + col] + a[row * 4 + 3] * b[8 + col] + a[row * 4 + 4] * b[12 + col]
+                        end
+                    end
+                    a, c = c, a
+                end
+                OUT.param = filtered + a[16]
+            end
+        )", loopCount);
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Math);
+        logicEngine.createLuaScript(scriptSrc, config);
+
+        logicEngine.impl().disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Measures update() speed of computation-heavy scripts which barely touch properties
+    // Dirty handling: off
+    // ARG: how many filter steps and matrix products are computed in run()
+    BENCHMARK(BM_Update_ScriptMath)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
     // Test that update is faster when fewer scripts have to be updated (i.e. the dirty handling works
     // as expected). This benchmark creates a static list of linearly linked scripts so that if the
     // first in the list has its 'dirty_trigger' value changed, all scripts in the change will be
@@ -200,6 +280,40 @@ namespace ramses
     }
 
     BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
-}
 
+    // Measures update() in steady state when only a single binding out of many changes every frame.
+    // Only dirty nodes (and nodes dirtied by them via links) are visited, so the update time should stay close
+    // to constant regardless of total count of nodes. Second arg enables update report which forces
+    // a traversal of all nodes (it reports also the skipped nodes) for comparison.
+    // ARG0: total count of node bindings
+    // ARG1: update report enabled (1) or disabled (0)
+    static void BM_Update_SparseChanges(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto bindingCount = static_cast<std::size_t>(state.range(0));
+        logicEngine.enableUpdateReport(state.range(1) != 0);
 
+        std::vector<NodeBinding*> bindings(bindingCount);
+        for (std::size_t i = 0; i < bindingCount; ++i)
+            bindings[i] = logicEngine.createNodeBinding(*setup.m_scene.createNode(), ERotationType::Euler_XYZ, fmt::format("binding{}", i));
+
+        bool success = logicEngine.update();
+        (void)success;
+        assert(success);
+
+        Property* translation = bindings[bindingCount / 2]->getInputs()->getChild("translation");
+        float value = 1.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            success = translation->set<vec3f>({ value, 0.f, 0.f });
+            assert(success);
+            value += 1.f;
+            success = logicEngine.update();
+            assert(success);
+        }
+    }
+
+    BENCHMARK(BM_Update_SparseChanges)->Args({ 100, 0 })->Args({ 1000, 0 })->Args({ 10000, 0 })->Args({ 10000, 1 })->Unit(benchmark::kMicrosecond);
+}
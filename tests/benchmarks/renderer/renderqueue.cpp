@@ -0,0 +1,165 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/IResourceDeviceHandleAccessor.h"
+
+#include <random>
+
+namespace ramses::internal
+{
+    // reports every resource as uploaded, so that renderables become clean after first update and only sorting is measured
+    class UploadedResourcesAccessor : public IResourceDeviceHandleAccessor
+    {
+    public:
+        DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& /*resourceHash*/) const override { return DeviceResourceHandle{ 1u }; }
+        std::optional<BoundingSphere> getResourceBoundingSphere(const ResourceContentHash& /*resourceHash*/) const override { return std::nullopt; }
+        DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle /*targetHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle /*bufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        void getBlitPassRenderTargetsDeviceHandle(BlitPassHandle /*blitPassHandle*/, SceneId /*sceneId*/, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const override
+        {
+            srcRT = DeviceResourceHandle{ 1u };
+            dstRT = DeviceResourceHandle{ 1u };
+        }
+        DeviceResourceHandle getOffscreenBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getOffscreenBufferColorBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 1u }; }
+        int getDmaOffscreenBufferFD(OffscreenBufferHandle /*bufferHandle*/) const override { return -1; }
+        uint32_t getDmaOffscreenBufferStride(OffscreenBufferHandle /*bufferHandle*/) const override { return 0u; }
+        OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle /*bufferDeviceHandle*/) const override { return OffscreenBufferHandle::Invalid(); }
+        DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getExternalBufferDeviceHandle(ExternalBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getEmptyExternalBufferDeviceHandle() const override { return DeviceResourceHandle{ 1u }; }
+        uint32_t getExternalBufferGlId(ExternalBufferHandle /*externalTexHandle*/) const override { return 0u; }
+        DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle /*dataBufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle /*textureBufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle /*renderableHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getUniformBufferDeviceHandle(UniformBufferHandle /*uniformBufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+        DeviceResourceHandle getUniformBufferDeviceHandle(SemanticUniformBufferHandle /*handle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 1u }; }
+    };
+
+    class RenderQueueBenchmarkScene
+    {
+    public:
+        static constexpr uint32_t NumPasses = 20u;
+        static constexpr uint32_t NumGroupsPerPass = 5u;
+        static constexpr uint32_t NumEffects = 32u;
+        static constexpr uint32_t NumRenderStates = 16u;
+        static constexpr int32_t NumRenderOrders = 8;
+
+        explicit RenderQueueBenchmarkScene(uint32_t numRenderables)
+        {
+            std::mt19937 generator(numRenderables);
+
+            std::vector<DataLayoutHandle> geometryLayouts;
+            std::vector<DataInstanceHandle> uniformInstances;
+            for (uint32_t i = 0u; i < NumEffects; ++i)
+            {
+                const ResourceContentHash effectHash{ generator(), generator() };
+                geometryLayouts.push_back(m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices } }, effectHash, {}));
+                const auto uniformLayout = m_scene.allocateDataLayout({}, effectHash, {});
+                uniformInstances.push_back(m_scene.allocateDataInstance(uniformLayout, {}));
+            }
+
+            for (uint32_t i = 0u; i < NumRenderStates; ++i)
+                m_renderStates.push_back(m_scene.allocateRenderState({}));
+
+            const auto cameraLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::DataReference } }, {}, {});
+            for (uint32_t p = 0u; p < NumPasses; ++p)
+            {
+                const RenderPassHandle pass = m_scene.allocateRenderPass(NumGroupsPerPass, {});
+                m_scene.setRenderPassCamera(pass, m_scene.allocateCamera(ECameraProjectionType::Perspective, m_scene.allocateNode(0u, {}), m_scene.allocateDataInstance(cameraLayout, {}), {}));
+                m_scene.setRenderPassRenderOrder(pass, static_cast<int32_t>(p));
+                m_passes.push_back(pass);
+                for (uint32_t g = 0u; g < NumGroupsPerPass; ++g)
+                {
+                    const RenderGroupHandle group = m_scene.allocateRenderGroup(numRenderables / (NumPasses * NumGroupsPerPass), 0u, {});
+                    m_scene.addRenderGroupToRenderPass(pass, group, static_cast<int32_t>(g));
+                    m_groups.push_back(group);
+                }
+            }
+
+            for (uint32_t i = 0u; i < numRenderables; ++i)
+            {
+                const RenderableHandle renderable = m_scene.allocateRenderable(m_scene.allocateNode(0u, {}), {});
+                const uint32_t effect = generator() % NumEffects;
+                m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, m_scene.allocateDataInstance(geometryLayouts[effect], {}));
+                m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniformInstances[effect]);
+                m_scene.setRenderableRenderState(renderable, m_renderStates[generator() % NumRenderStates]);
+                m_scene.addRenderableToRenderGroup(m_groups[i % m_groups.size()], renderable, static_cast<int32_t>(generator() % NumRenderOrders));
+                m_renderables.push_back(renderable);
+            }
+
+            update();
+        }
+
+        void update()
+        {
+            m_scene.updateRenderablesAndResourceCache(m_resourceAccessor);
+        }
+
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_rendererScenes{ m_eventCollector };
+        RendererCachedScene& m_scene{ m_rendererScenes.createScene(SceneInfo{}) };
+        UploadedResourcesAccessor m_resourceAccessor;
+
+        std::vector<RenderPassHandle> m_passes;
+        std::vector<RenderGroupHandle> m_groups;
+        std::vector<RenderStateHandle> m_renderStates;
+        std::vector<RenderableHandle> m_renderables;
+    };
+
+    // Render state of a renderable changes every frame, all sort keys are rebuilt and all groups re-sorted
+    static void BM_RenderQueue_RenderableStateChanged(benchmark::State& state)
+    {
+        RenderQueueBenchmarkScene setup(static_cast<uint32_t>(state.range(0)));
+        const RenderableHandle renderable = setup.m_renderables.front();
+
+        size_t frame = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            setup.m_scene.setRenderableRenderState(renderable, setup.m_renderStates[++frame % setup.m_renderStates.size()]);
+            setup.update();
+        }
+    }
+    BENCHMARK(BM_RenderQueue_RenderableStateChanged)->Arg(5000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+
+    // Renderable is moved within its group every frame, only this group is re-sorted
+    static void BM_RenderQueue_RenderGroupChanged(benchmark::State& state)
+    {
+        RenderQueueBenchmarkScene setup(static_cast<uint32_t>(state.range(0)));
+        const RenderableHandle renderable = setup.m_renderables.front();
+        const RenderGroupHandle group = setup.m_groups.front();
+
+        int32_t frame = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            setup.m_scene.removeRenderableFromRenderGroup(group, renderable);
+            setup.m_scene.addRenderableToRenderGroup(group, renderable, ++frame % RenderQueueBenchmarkScene::NumRenderOrders);
+            setup.update();
+        }
+    }
+    BENCHMARK(BM_RenderQueue_RenderGroupChanged)->Arg(5000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+
+    // Only order of passes changes every frame, renderables of passes are kept
+    static void BM_RenderQueue_RenderPassOrderChanged(benchmark::State& state)
+    {
+        RenderQueueBenchmarkScene setup(static_cast<uint32_t>(state.range(0)));
+        const RenderPassHandle pass = setup.m_passes.front();
+
+        int32_t frame = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            setup.m_scene.setRenderPassRenderOrder(pass, (++frame % 2) * static_cast<int32_t>(RenderQueueBenchmarkScene::NumPasses));
+            setup.update();
+        }
+    }
+    BENCHMARK(BM_RenderQueue_RenderPassOrderChanged)->Arg(5000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+}
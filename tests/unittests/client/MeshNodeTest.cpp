@@ -343,6 +343,23 @@ namespace ramses::internal
         EXPECT_EQ(startVertex, m_meshNode->getStartVertex());
     }
 
+    TEST_F(MeshNodeTest, hasFrustumCullingEnabledByDefault)
+    {
+        EXPECT_TRUE(m_meshNode->isFrustumCullingEnabled());
+        EXPECT_TRUE(m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).frustumCulling);
+    }
+
+    TEST_F(MeshNodeTest, setsAndGetsFrustumCulling)
+    {
+        EXPECT_TRUE(m_meshNode->setFrustumCullingEnabled(false));
+        EXPECT_FALSE(m_meshNode->isFrustumCullingEnabled());
+        EXPECT_FALSE(m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).frustumCulling);
+
+        EXPECT_TRUE(m_meshNode->setFrustumCullingEnabled(true));
+        EXPECT_TRUE(m_meshNode->isFrustumCullingEnabled());
+        EXPECT_TRUE(m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).frustumCulling);
+    }
+
     TEST_F(MeshNodeTest, setsAndGetsSameIndexCount)
     {
         const uint32_t indexCount = 1u;
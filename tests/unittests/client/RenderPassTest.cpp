@@ -697,4 +697,17 @@ namespace ramses::internal
     {
         EXPECT_FALSE(renderpass.retriggerRenderOnce());
     }
+
+    TEST_F(ARenderPass, hasStateSortingDisabledInitially)
+    {
+        EXPECT_FALSE(renderpass.isStateSortingEnabled());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableStateSorting)
+    {
+        EXPECT_TRUE(renderpass.setStateSortingEnabled(true));
+        EXPECT_TRUE(renderpass.isStateSortingEnabled());
+        EXPECT_TRUE(renderpass.setStateSortingEnabled(false));
+        EXPECT_FALSE(renderpass.isStateSortingEnabled());
+    }
 }
@@ -137,6 +137,22 @@ namespace ramses::internal
 #endif
     }
 
+    TEST(ASceneConfig, HasNormalTransmissionPriorityByDefault)
+    {
+        SceneConfig config;
+        EXPECT_EQ(ETransmissionPriority::Normal, config.impl().getTransmissionPriority());
+        config.setTransmissionPriority(ETransmissionPriority::Low);
+        EXPECT_EQ(ETransmissionPriority::Low, config.impl().getTransmissionPriority());
+    }
+
+    TEST(ASceneConfig, HasBufferDeltaEncodingDisabledByDefault)
+    {
+        SceneConfig config;
+        EXPECT_FALSE(config.impl().getBufferDeltaEncodingEnabled());
+        config.setBufferDeltaEncodingEnabled(true);
+        EXPECT_TRUE(config.impl().getBufferDeltaEncodingEnabled());
+    }
+
     class ASceneWithContent : public SimpleSceneTopology
     {
     };
@@ -274,6 +290,20 @@ namespace ramses::internal
         EXPECT_EQ(TargetSPIRVVersion, iscene.getSPIRVVersion());
     }
 
+    TEST_F(AScene, sendsFullBufferUpdatesByDefault)
+    {
+        EXPECT_FALSE(m_internalScene.isBufferDeltaEncodingEnabled());
+    }
+
+    TEST_F(AScene, canCreateSceneWithBufferDeltaEncoding)
+    {
+        SceneConfig sceneConfig{ sceneId_t{456u} };
+        sceneConfig.setBufferDeltaEncodingEnabled(true);
+        auto* scene = client.createScene(sceneConfig);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_TRUE(scene->impl().getIScene().isBufferDeltaEncodingEnabled());
+    }
+
     TEST_F(AScene, canNotCreateSceneWithVulkanAndOpenGLCompatibilityWithFeatureLevel01)
     {
         RamsesFramework fl0Framework(LocalTestClient::GetDefaultFrameworkConfig(EFeatureLevel::EFeatureLevel_01));
@@ -573,5 +573,57 @@ namespace ramses::internal
         m_logicEngine->update();
         EXPECT_FALSE(m_apiObjects.bindingsDirty());
     }
-}
 
+    TEST_F(ALogicEngine_BindingDirtiness, ReportsSceneObjectsOfExecutedBindings)
+    {
+        NodeBinding* nodeBinding = m_logicEngine->createNodeBinding(*m_node, ramses::ERotationType::Euler_XYZ, "");
+        AppearanceBinding* appBinding = m_logicEngine->createAppearanceBinding(*m_appearance, "");
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(m_logicEngine->getSceneObjectsUpdatedByBindings().empty());
+
+        nodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 1, 2, 3 });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_THAT(m_logicEngine->getSceneObjectsUpdatedByBindings(), ::testing::ElementsAre(m_node));
+
+        appBinding->getInputs()->getChild("floatUniform")->set(15.f);
+        nodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 3, 2, 1 });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_THAT(m_logicEngine->getSceneObjectsUpdatedByBindings(), ::testing::UnorderedElementsAre(m_node, m_appearance));
+
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(m_logicEngine->getSceneObjectsUpdatedByBindings().empty());
+    }
+
+    TEST_F(ALogicEngine_BindingDirtiness, ReportsSceneObjectsOfBindingsExecutedDueToLinkActivation)
+    {
+        LuaScript* script = m_logicEngine->createLuaScript(m_bindningDataScript);
+        NodeBinding* binding = m_logicEngine->createNodeBinding(*m_node, ramses::ERotationType::Euler_XYZ, "");
+        ASSERT_TRUE(m_logicEngine->link(*script->getOutputs()->getChild("vec3f"), *binding->getInputs()->getChild("rotation")));
+
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_THAT(m_logicEngine->getSceneObjectsUpdatedByBindings(), ::testing::ElementsAre(m_node));
+
+        // script produces same values again, link is not activated
+        script->impl().setDirty(true);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(m_logicEngine->getSceneObjectsUpdatedByBindings().empty());
+    }
+
+    TEST_F(ALogicEngine_BindingDirtiness, ReportsSameSceneObjectsWithUpdateReportEnabled)
+    {
+        NodeBinding* nodeBinding = m_logicEngine->createNodeBinding(*m_node, ramses::ERotationType::Euler_XYZ, "");
+        m_logicEngine->enableUpdateReport(true);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(m_logicEngine->getSceneObjectsUpdatedByBindings().empty());
+
+        nodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 1, 2, 3 });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_THAT(m_logicEngine->getSceneObjectsUpdatedByBindings(), ::testing::ElementsAre(m_node));
+
+        // switching back to dirty nodes worklist keeps pending nodes
+        nodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 3, 2, 1 });
+        m_logicEngine->enableUpdateReport(false);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_THAT(m_logicEngine->getSceneObjectsUpdatedByBindings(), ::testing::ElementsAre(m_node));
+    }
+}
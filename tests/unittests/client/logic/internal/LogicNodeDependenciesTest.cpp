@@ -497,4 +497,119 @@ namespace ramses::internal
         m_dependencies.addBindingDependency(m_binding2, m_binding1);
         expectSortedNodeOrder({ &m_binding2, &m_binding1 });
     }
+
+    TEST_F(ALogicNodeDependencies, PopsDirtyNodesInTopologicalOrder)
+    {
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(m_nodeA);
+        EXPECT_TRUE(m_dependencies.link(m_nodeA.getOutputs()->getChild("output1")->impl(), m_nodeB.getInputs()->getChild("input1")->impl(), false, m_errorReporting));
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+
+        EXPECT_EQ(&m_nodeA, m_dependencies.popNextDirtyNode());
+        m_nodeA.setDirty(false);
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
+
+    TEST_F(ALogicNodeDependencies, PopsOnlyNodesMarkedDirty)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        m_nodeA.setDirty(false);
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+
+        m_nodeB.setDirty(true);
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
+
+    TEST_F(ALogicNodeDependencies, PopsNodeDirtiedDuringUpdateIfItIsAfterLastPoppedNode)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        EXPECT_TRUE(m_dependencies.link(m_nodeA.getOutputs()->getChild("output1")->impl(), m_nodeB.getInputs()->getChild("input1")->impl(), false, m_errorReporting));
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        m_nodeA.setDirty(false);
+        m_nodeB.setDirty(false);
+
+        m_nodeA.setDirty(true);
+        EXPECT_EQ(&m_nodeA, m_dependencies.popNextDirtyNode());
+        m_nodeA.setDirty(false);
+        // simulates link activation
+        m_nodeB.setDirty(true);
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
+
+    TEST_F(ALogicNodeDependencies, DefersNodeDirtiedDuringUpdateIfItIsBeforeLastPoppedNode)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        // B is updated before A, A is linked back to B
+        EXPECT_TRUE(m_dependencies.link(m_nodeB.getOutputs()->getChild("output1")->impl(), m_nodeA.getInputs()->getChild("input1")->impl(), false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(m_nodeA.getOutputs()->getChild("output1")->impl(), m_nodeB.getInputs()->getChild("input1")->impl(), true, m_errorReporting));
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        m_nodeA.setDirty(false);
+        m_nodeB.setDirty(false);
+
+        m_nodeA.setDirty(true);
+        EXPECT_EQ(&m_nodeA, m_dependencies.popNextDirtyNode());
+        m_nodeA.setDirty(false);
+        // simulates weak link activation
+        m_nodeB.setDirty(true);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+
+        // B updated in next update
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
+
+    TEST_F(ALogicNodeDependencies, DoesNotPopRemovedDirtyNode)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        m_dependencies.removeNode(m_nodeA);
+
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
+
+    TEST_F(ALogicNodeDependencies, ReordersQueuedDirtyNodesAfterTopologyChange)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        EXPECT_TRUE(m_dependencies.link(m_nodeA.getOutputs()->getChild("output1")->impl(), m_nodeB.getInputs()->getChild("input1")->impl(), false, m_errorReporting));
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        EXPECT_EQ(&m_nodeA, m_dependencies.popNextDirtyNode());
+        m_nodeA.setDirty(false);
+        m_dependencies.finishDirtyNodesUpdate();
+
+        // B is still queued, A becomes dirty again by linking
+        EXPECT_TRUE(m_dependencies.unlink(m_nodeA.getOutputs()->getChild("output1")->impl(), m_nodeB.getInputs()->getChild("input1")->impl(), m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(m_nodeB.getOutputs()->getChild("output1")->impl(), m_nodeA.getInputs()->getChild("input1")->impl(), false, m_errorReporting));
+        ASSERT_TRUE(m_dependencies.getTopologicallySortedNodes());
+        expectSortedNodeOrder({ &m_nodeB, &m_nodeA });
+
+        EXPECT_EQ(&m_nodeB, m_dependencies.popNextDirtyNode());
+        m_nodeB.setDirty(false);
+        EXPECT_EQ(&m_nodeA, m_dependencies.popNextDirtyNode());
+        m_nodeA.setDirty(false);
+        EXPECT_EQ(nullptr, m_dependencies.popNextDirtyNode());
+        m_dependencies.finishDirtyNodesUpdate();
+    }
 }
@@ -151,6 +151,8 @@ namespace ramses::internal
         EXPECT_TRUE(m_sol["rl_next"].valid());
         EXPECT_TRUE(m_sol["rl_pairs"].valid());
         EXPECT_TRUE(m_sol["rl_ipairs"].valid());
+        EXPECT_TRUE(m_sol["rl_setFlat"].valid());
+        EXPECT_TRUE(m_sol["rl_getFlat"].valid());
     }
 
     class TheLuaCustomizations_Len : public TheLuaCustomizations
@@ -1037,4 +1039,75 @@ namespace ramses::internal
             end
         )", "rl_ipairs() called on an unsupported type 'String'. Use only with array-like built-in types or modules!");
     }
+
+    class TheLuaCustomizations_Flat : public TheLuaCustomizations
+    {
+    protected:
+        TheLuaCustomizations_Flat()
+        {
+            m_sol["OUT"] = std::ref(m_wrappedOutput);
+            m_sol["A"] = std::ref(m_wrappedArray);
+        }
+
+        HierarchicalTypeData m_outputType = { TypeData("OUT", EPropertyType::Struct), {MakeArray("vecs", 2, EPropertyType::Vec3f), MakeArray("ints", 3, EPropertyType::Int32), MakeArray("strings", 1, EPropertyType::String)} };
+        PropertyImpl m_outputProp = { m_outputType, EPropertySemantics::ScriptOutput };
+        WrappedLuaProperty m_wrappedOutput = WrappedLuaProperty{ m_outputProp };
+    };
+
+    TEST_F(TheLuaCustomizations_Flat, SetsWholeVectorArrayFromFlatTable)
+    {
+        expectNoErrors("rl_setFlat(OUT.vecs, {1, 2, 3, 4, 5, 6.5})");
+
+        const PropertyImpl& vecs = m_outputProp.getChild("vecs")->impl();
+        EXPECT_EQ(vec3f(1.f, 2.f, 3.f), vecs.getChild(0)->impl().getValueAs<vec3f>());
+        EXPECT_EQ(vec3f(4.f, 5.f, 6.5f), vecs.getChild(1)->impl().getValueAs<vec3f>());
+    }
+
+    TEST_F(TheLuaCustomizations_Flat, SetsWholeIntArrayFromFlatTable)
+    {
+        expectNoErrors("rl_setFlat(OUT.ints, {7, -8, 9})");
+
+        const PropertyImpl& ints = m_outputProp.getChild("ints")->impl();
+        EXPECT_EQ(7, ints.getChild(0)->impl().getValueAs<int32_t>());
+        EXPECT_EQ(-8, ints.getChild(1)->impl().getValueAs<int32_t>());
+        EXPECT_EQ(9, ints.getChild(2)->impl().getValueAs<int32_t>());
+    }
+
+    TEST_F(TheLuaCustomizations_Flat, GetsFlatTableOfArray)
+    {
+        expectNoErrors(R"(
+            local flat = rl_getFlat(A)
+            assert(#flat == 3)
+            assert(flat[1] == 11 and flat[2] == 12 and flat[3] == 13)
+
+            rl_setFlat(OUT.vecs, {1, 2, 3, 4, 5, 6})
+            local vecs = rl_getFlat(OUT.vecs)
+            assert(#vecs == 6)
+            for i = 1,6 do
+                assert(vecs[i] == i)
+            end
+        )");
+    }
+
+    TEST_F(TheLuaCustomizations_Flat, ReportsErrorsAndDoesNotModifyArrayWhenValuesInvalid)
+    {
+        expectError("rl_setFlat(OUT.ints, {1, 2})", "Element size mismatch when assigning flat values to array property 'ints'! Expected 3 numbers but got 2");
+        expectError("rl_setFlat(OUT.ints, {1, 2, 3, 4})", "Element size mismatch when assigning flat values to array property 'ints'! Expected 3 numbers but got 4");
+        expectError("rl_setFlat(OUT.ints, {1, 'x', 3})", "Error while extracting numbers: unexpected value (type: 'string') at table element # 2!");
+        expectError("rl_setFlat(OUT.ints, {1, 2, 3.5})",
+            "Unexpected value at table element # 3! Reason: Error while extracting integer: implicit rounding (fractional part '0.5' is not negligible)");
+        expectError("rl_setFlat(OUT.ints, 5)", "Expected a Lua table with numbers but got object of type number instead!");
+
+        const PropertyImpl& ints = m_outputProp.getChild("ints")->impl();
+        EXPECT_EQ(0, ints.getChild(0)->impl().getValueAs<int32_t>());
+        EXPECT_EQ(0, ints.getChild(1)->impl().getValueAs<int32_t>());
+    }
+
+    TEST_F(TheLuaCustomizations_Flat, ReportsErrorsWhenUsedOnUnsupportedTypes)
+    {
+        expectError("rl_setFlat(A, {1, 2, 3})", "Error while writing to 'A'. Writing input values is not allowed, only outputs!");
+        expectError("rl_setFlat(OUT.strings, {1})", "rl_setFlat() called on property 'strings' which is not an array of numbers or vectors!");
+        expectError("rl_getFlat(OUT)", "rl_getFlat() called on property 'OUT' which is not an array of numbers or vectors!");
+        expectError("rl_getFlat({1, 2})", "rl_getFlat() called on an unsupported type 'table', expected an array property");
+    }
 }
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internal/logic/MatrixBatch.h"
+#include "TestEqualHelper.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include <vector>
+
+namespace ramses::internal
+{
+    class AMatrixBatch : public ::testing::Test
+    {
+    protected:
+        AMatrixBatch()
+        {
+            for (size_t i = 0u; i < Count; ++i)
+            {
+                const auto f = static_cast<float>(i);
+                m_lhs.push_back(glm::rotate(glm::translate(glm::identity<matrix44f>(), glm::vec3{ 0.1f * f, -0.2f * f, 0.5f }), 0.1f * f, glm::vec3{ 0.f, 1.f, 0.f }));
+                m_rhs.push_back(glm::scale(glm::rotate(glm::identity<matrix44f>(), -0.3f * f, glm::vec3{ 1.f, 0.f, 0.f }), glm::vec3{ 1.f + 0.1f * f, 2.f, 0.5f }));
+                m_expected.push_back(m_lhs.back() * m_rhs.back());
+            }
+        }
+
+        static constexpr size_t Count = 7u;
+        std::vector<matrix44f> m_lhs;
+        std::vector<matrix44f> m_rhs;
+        std::vector<matrix44f> m_expected;
+    };
+
+    TEST_F(AMatrixBatch, MultipliesSameAsGlm)
+    {
+        std::vector<matrix44f> result(Count);
+        MatrixBatch::Multiply(m_lhs.data(), m_rhs.data(), result.data(), Count);
+
+        for (size_t i = 0u; i < Count; ++i)
+            expectMatrixFloatEqual(m_expected[i], result[i]);
+    }
+
+    TEST_F(AMatrixBatch, MultipliesInPlace)
+    {
+        MatrixBatch::Multiply(m_lhs.data(), m_rhs.data(), m_lhs.data(), Count);
+        for (size_t i = 0u; i < Count; ++i)
+            expectMatrixFloatEqual(m_expected[i], m_lhs[i]);
+
+        // result aliasing rhs
+        auto lhs = m_expected;
+        const auto rhs = m_rhs;
+        MatrixBatch::Multiply(lhs.data(), m_rhs.data(), m_rhs.data(), Count);
+        for (size_t i = 0u; i < Count; ++i)
+            expectMatrixFloatEqual(lhs[i] * rhs[i], m_rhs[i]);
+    }
+
+    TEST_F(AMatrixBatch, DoesNothingForEmptyBatch)
+    {
+        matrix44f result{ 3.f };
+        MatrixBatch::Multiply(m_lhs.data(), m_rhs.data(), &result, 0u);
+        expectMatrixFloatEqual(matrix44f{ 3.f }, result);
+    }
+
+    TEST_F(AMatrixBatch, ReportsImplementationName)
+    {
+        EXPECT_NE(nullptr, MatrixBatch::GetImplementationName());
+    }
+}
@@ -92,6 +92,36 @@ namespace ramses::internal
         EXPECT_TRUE(env["rl_logError"].valid());
     }
 
+    TEST_F(ASolState, AcceptsByteCodeDumpedByItself)
+    {
+        auto load_result = m_solState.loadScript(m_valid_empty_script, "validEmptryScript");
+        ASSERT_TRUE(load_result.valid());
+        sol::protected_function mainFunction = load_result;
+        const sol::bytecode byteCode = mainFunction.dump();
+
+        EXPECT_TRUE(SolState::IsCompatibleByteCode(byteCode.as_string_view()));
+    }
+
+    TEST_F(ASolState, RejectsByteCodeOfOtherLuaRuntimes)
+    {
+        EXPECT_FALSE(SolState::IsCompatibleByteCode(""));
+        EXPECT_FALSE(SolState::IsCompatibleByteCode("function run() end"));
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        EXPECT_FALSE(SolState::IsCompatibleByteCode("\x1bLua\x51\x00\x01"));
+#else
+        EXPECT_FALSE(SolState::IsCompatibleByteCode("\x1bLJ\x02\x00"));
+#endif
+    }
+
+    TEST_F(ASolState, DoesNotExposeJitLibrariesToEnvironment)
+    {
+        sol::environment env = m_solState.createEnvironment({StdModules.cbegin(), StdModules.cend()}, {}, false);
+        ASSERT_TRUE(env.valid());
+
+        EXPECT_FALSE(env["jit"].valid());
+        EXPECT_FALSE(env["ffi"].valid());
+    }
+
     class ASolState_Environment : public ASolState
     {
     protected:
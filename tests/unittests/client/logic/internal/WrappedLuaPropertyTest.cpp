@@ -229,6 +229,38 @@ namespace ramses::internal
     }
 
 
+    TEST_F(AWrappedLuaProperty_Access, ResolvesStructFieldsAndArrayElements_WhenFieldNamesAreBound)
+    {
+        PropertyImpl nestedStruct(HierarchicalTypeData{ TypeData("Nested", EPropertyType::Struct), {m_structWithAllPrimitiveTypes, MakeArray("array", 2, EPropertyType::Int32)} }, EPropertySemantics::ScriptInput);
+        setDummyDataRecursively(nestedStruct);
+        WrappedLuaProperty wrapped(nestedStruct);
+        wrapped.bindFieldNames(m_sol.lua_state());
+        m_sol["Nested"] = std::ref(wrapped);
+
+        EXPECT_FLOAT_EQ(0.5f, extractValue<float>("Nested.ROOT.Float"));
+        EXPECT_EQ("hello", extractValue<std::string>("Nested.ROOT.String"));
+        EXPECT_EQ(42, extractValue<int32_t>("Nested.ROOT.Int32"));
+        EXPECT_EQ(42, extractValue<int32_t>("Nested.array[2]"));
+        // dynamically built keys
+        EXPECT_EQ(421, extractValue<int64_t>("Nested.ROOT['Int' .. tostring(64)]"));
+        EXPECT_EQ(42, extractValue<int32_t>("Nested.array[1 + 1]"));
+    }
+
+    TEST_F(AWrappedLuaProperty_Access, ReportsErrorsForUnknownFieldsAndBadIndices_WhenFieldNamesAreBound)
+    {
+        PropertyImpl nestedStruct(HierarchicalTypeData{ TypeData("Nested", EPropertyType::Struct), {MakeArray("array", 2, EPropertyType::Int32)} }, EPropertySemantics::ScriptInput);
+        WrappedLuaProperty wrapped(nestedStruct);
+        wrapped.bindFieldNames(m_sol.lua_state());
+        m_sol["Nested"] = std::ref(wrapped);
+
+        sol::error err = run_WithResult("value = Nested.notThere");
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("Tried to access undefined struct property 'notThere'"));
+        err = run_WithResult("value = Nested.array[3]");
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("Index out of range! Expected 0 < index <= 2 but received index == 3"));
+        err = run_WithResult("value = Nested.array[0]");
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("Index out of range! Expected 0 < index <= 2 but received index == 0"));
+    }
+
     class AWrappedLuaProperty_Assignment : public AWrappedLuaProperty_Access
     {
     protected:
@@ -497,6 +529,40 @@ namespace ramses::internal
             ::testing::HasSubstr("Error during assignment of property 'Float'! Error while extracting floating point number: value would cause overflow in float"));
     }
 
+    TEST_F(AWrappedLuaProperty_Assignment, AssignsPrimitivesAndAppliesNumericChecks_WhenFieldNamesAreBound)
+    {
+        PropertyImpl root(m_structWithAllPrimitiveTypes, EPropertySemantics::ScriptOutput);
+        WrappedLuaProperty wrapped(root);
+        wrapped.bindFieldNames(m_sol.lua_state());
+        m_sol["ROOT"] = std::ref(wrapped);
+
+        EXPECT_EQ(12, assignExpressionToValue<int32_t>("12", "ROOT.Int32"));
+        EXPECT_EQ(12, root.getChild("Int32")->impl().getValueAs<int32_t>());
+        EXPECT_EQ(-13, assignExpressionToValue<int64_t>("-13", "ROOT.Int64"));
+        EXPECT_EQ(-13, root.getChild("Int64")->impl().getValueAs<int64_t>());
+        EXPECT_FLOAT_EQ(1.5f, assignExpressionToValue<float>("1.5", "ROOT.Float"));
+        EXPECT_FLOAT_EQ(1.5f, root.getChild("Float")->impl().getValueAs<float>());
+        EXPECT_TRUE(assignExpressionToValue<bool>("true", "ROOT.Bool"));
+        EXPECT_TRUE(root.getChild("Bool")->impl().getValueAs<bool>());
+
+        sol::error err = run_WithResult(R"(
+            ROOT.Int32 = 1.5
+        )");
+        EXPECT_THAT(err.what(),
+            ::testing::HasSubstr("Error during assignment of property 'Int32'! Error while extracting integer: implicit rounding (fractional part '0.5' is not negligible)"));
+
+        err = run_WithResult(R"(
+            ROOT.Float = 1000000000000000000000000000000000000000.0
+        )");
+        EXPECT_THAT(err.what(),
+            ::testing::HasSubstr("Error during assignment of property 'Float'! Error while extracting floating point number: value would cause overflow in float"));
+
+        err = run_WithResult(R"(
+            ROOT.Bool = 1
+        )");
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("Assigning number to 'Bool' output 'Bool'!"));
+    }
+
     TEST_F(AWrappedLuaProperty_Assignment, AppliesNumericChecks_StructFields_Vec)
     {
         PropertyImpl root(m_structWithAllPrimitiveTypes, EPropertySemantics::ScriptOutput);
@@ -54,6 +54,7 @@ namespace ramses::internal
 
         MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& consumer), (override));
         MOCK_METHOD(void, handlePublishScene, (SceneId sceneId, EScenePublicationMode publicationMode), (override));
+        MOCK_METHOD(void, handleSetSceneTransmissionPriority, (SceneId sceneId, ETransmissionPriority priority), (override));
         MOCK_METHOD(void, handleUnpublishScene, (SceneId sceneId), (override));
         MOCK_METHOD(bool, handleFlush, (SceneId sceneId, const FlushTimeInformation&, SceneVersionTag), (override));
         MOCK_METHOD(void, handleRemoveScene, (SceneId sceneId), (override));
@@ -94,6 +94,7 @@ namespace ramses::internal
             scene.setRenderableVisibility(renderable, EVisibilityMode::Invisible);
             scene.setRenderableInstanceCount(renderable, renderableInstanceCount);
             scene.setRenderableStartVertex(renderable, startVertex);
+            scene.setRenderableFrustumCulling(renderable, false);
             scene.allocateRenderable(child, renderable2);
 
             DataFieldInfoVector uniformLayoutDataFields{
@@ -181,6 +182,7 @@ namespace ramses::internal
             scene.setRenderPassRenderOrder(renderPass, 1);
             scene.setRenderPassEnabled(renderPass, false);
             scene.setRenderPassRenderOnce(renderPass, true);
+            scene.setRenderPassStateSorting(renderPass, true);
 
             scene.addRenderGroupToRenderPass(renderPass, renderGroup, 15);
             scene.addRenderGroupToRenderPass(renderPass, renderGroup2, 5);
@@ -312,6 +314,8 @@ namespace ramses::internal
             EXPECT_EQ(EVisibilityMode::Invisible, renderableData.visibilityMode);
             EXPECT_EQ(renderableInstanceCount, renderableData.instanceCount);
             EXPECT_EQ(startVertex, renderableData.startVertex);
+            EXPECT_FALSE(renderableData.frustumCulling);
+            EXPECT_TRUE(otherScene.getRenderable(renderable2).frustumCulling);
         }
 
         void CheckStatesEquivalentTo(const IScene& otherScene) const
@@ -512,6 +516,7 @@ namespace ramses::internal
             EXPECT_EQ(EClearFlag::None, rp.clearFlags);
             EXPECT_FALSE(rp.isEnabled);
             EXPECT_TRUE(rp.isRenderOnce);
+            EXPECT_TRUE(rp.stateSorting);
 
             ASSERT_TRUE(RenderGroupUtils::ContainsRenderGroup(getMappedHandle(renderGroup), rp));
             EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(getMappedHandle(renderGroup2), rp));
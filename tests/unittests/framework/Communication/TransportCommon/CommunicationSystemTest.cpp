@@ -9,6 +9,7 @@
 #include "ServiceHandlerMocks.h"
 #include "CommunicationSystemTest.h"
 #include "ConnectionSystemTestHelper.h"
+#include "SceneUpdateSerializerTestHelper.h"
 #include "internal/Components/SceneUpdate.h"
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 
@@ -43,7 +44,7 @@ namespace ramses::internal
         EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendUnsubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneId()));
-        EXPECT_FALSE(csw->commSystem->sendSceneUpdate(to, SceneId(123), SceneUpdateSerializer(SceneUpdate(), sceneStatistics, EFeatureLevel_Latest)));
+        EXPECT_FALSE(csw->commSystem->sendSceneUpdate({ to }, SceneId(123), SceneUpdateSerializer(SceneUpdate(), sceneStatistics, EFeatureLevel_Latest)));
     }
 
     TEST_P(ACommunicationSystem, sendFunctionsFailAfterCallingDisconnect)
@@ -60,7 +61,7 @@ namespace ramses::internal
         EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendUnsubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneId()));
-        EXPECT_FALSE(csw->commSystem->sendSceneUpdate(to, SceneId(123), SceneUpdateSerializer(SceneUpdate(), sceneStatistics, EFeatureLevel_Latest)));
+        EXPECT_FALSE(csw->commSystem->sendSceneUpdate({ to }, SceneId(123), SceneUpdateSerializer(SceneUpdate(), sceneStatistics, EFeatureLevel_Latest)));
     }
 
     TEST_P(ACommunicationSystemWithDaemon, canConnectAndDisconnectWithoutBlocking)
@@ -164,6 +165,60 @@ namespace ramses::internal
         state->disconnectAll();
     }
 
+    TEST_P(ACommunicationSystemWithDaemon, canSendInitializeSceneAndSceneUpdateToSubscribedParticipant)
+    {
+        auto provider = std::make_unique<CommunicationSystemTestWrapper>(*state, "provider");
+        auto renderer = std::make_unique<CommunicationSystemTestWrapper>(*state, "renderer");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneProviderServiceHandlerMock> providerHandler;
+        StrictMock<SceneRendererServiceHandlerMock> rendererHandler;
+        provider->commSystem->setSceneProviderServiceHandler(&providerHandler);
+        renderer->commSystem->setSceneRendererServiceHandler(&rendererHandler);
+
+        const SceneId sceneId(123u);
+        {
+            PlatformGuard g(provider->frameworkLock);
+            EXPECT_CALL(providerHandler, handleSubscribeScene(sceneId, renderer->id)).WillOnce(InvokeWithoutArgs([&](){ state->sendEvent(); }));
+        }
+        renderer->commSystem->sendSubscribeScene(provider->id, sceneId);
+        ASSERT_TRUE(state->event.waitForEvents(1));
+
+        const std::vector<std::vector<std::byte>> packets{ { std::byte{1}, std::byte{2}, std::byte{3} }, { std::byte{4}, std::byte{5} } };
+        std::vector<std::vector<std::byte>> receivedPackets;
+        {
+            PlatformGuard g(renderer->frameworkLock);
+            InSequence seq;
+            EXPECT_CALL(rendererHandler, handleInitializeScene(sceneId, provider->id));
+            EXPECT_CALL(rendererHandler, handleSceneUpdate(sceneId, _, provider->id)).Times(2).WillRepeatedly(Invoke([&](const auto& /*unused*/, absl::Span<const std::byte> data, const auto& /*unused*/) {
+                receivedPackets.emplace_back(data.begin(), data.end());
+                state->sendEvent();
+            }));
+        }
+
+        SceneUpdateSerializerMock serializer;
+        EXPECT_CALL(serializer, writeToPackets(_, _)).WillOnce(Invoke([&](absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+            for (const auto& packet : packets)
+            {
+                std::memcpy(packetMem.data(), packet.data(), packet.size());
+                if (!writeDoneFunc(packet.size()))
+                    return false;
+            }
+            return true;
+        }));
+        EXPECT_TRUE(provider->commSystem->sendInitializeScene(renderer->id, sceneId));
+        EXPECT_TRUE(provider->commSystem->sendSceneUpdate({ renderer->id }, sceneId, serializer));
+        ASSERT_TRUE(state->event.waitForEvents(2));
+        {
+            PlatformGuard g(renderer->frameworkLock);
+            EXPECT_EQ(packets, receivedPackets);
+        }
+
+        state->disconnectAll();
+    }
+
     TEST_P(ACommunicationSystemWithDaemon, canConnectAndDisconnectMultipleTimes)
     {
         auto csw = std::make_unique<CommunicationSystemTestWrapper>(*state);
@@ -25,6 +25,12 @@ namespace ramses::internal
         case ECommunicationSystemType::Tcp:
             *os << "ECommunicationSystemType::Tcp";
             return;
+        case ECommunicationSystemType::TcpUnixSocket:
+            *os << "ECommunicationSystemType::TcpUnixSocket";
+            return;
+        case ECommunicationSystemType::SharedMemory:
+            *os << "ECommunicationSystemType::SharedMemory";
+            return;
         };
         *os << static_cast<int>(type) << " (INVALID ECommunicationSystemType)";
     }
@@ -99,15 +105,32 @@ namespace ramses::internal
         std::vector<ECommunicationSystemType> ret;
 #if defined(HAS_TCP_COMM)
         ret.push_back(ECommunicationSystemType::Tcp);
+#if defined(__linux__)
+        ret.push_back(ECommunicationSystemType::TcpUnixSocket);
+#endif
+#endif
+#if defined(HAS_SHM_COMM)
+        ret.push_back(ECommunicationSystemType::SharedMemory);
 #endif
         return ret;
     }
 
-    CommunicationSystemTestWrapper::CommunicationSystemTestWrapper(CommunicationSystemTestState& state_, std::string_view name, const Guid& id_)
+    CommunicationSystemTestWrapper::CommunicationSystemTestWrapper(CommunicationSystemTestState& state_, std::string_view name, const Guid& id_, const TransmissionBandwidthLimits& bandwidthLimits,
+        const std::function<void(RamsesFrameworkConfigImpl&)>& configModifier)
         : id(id_.isValid() ? id_ : Guid(TestRandom::Get(255, std::numeric_limits<size_t>::max())))
         , state(state_)
     {
         RamsesFrameworkConfigImpl config(EFeatureLevel_Latest);
+        if (state.communicationSystemType == ECommunicationSystemType::SharedMemory)
+            config.setConnectionSystem(EConnectionSystem::SharedMemory);
+        if (state.communicationSystemType == ECommunicationSystemType::TcpUnixSocket)
+        {
+            EXPECT_TRUE(config.setUnixSocketDirectory("/tmp"));
+        }
+        for (size_t i = 0u; i < TransmissionPriorityCount; ++i)
+            config.m_tcpConfig.setBandwidthLimit(static_cast<ETransmissionPriority>(i), bandwidthLimits[i]);
+        if (configModifier)
+            configModifier(config);
 
         commSystem = CommunicationSystemFactory::ConstructCommunicationSystem(config, ParticipantIdentifier(id, name), frameworkLock, statisticCollection);
         state.knownCommunicationSystems.push_back(this);
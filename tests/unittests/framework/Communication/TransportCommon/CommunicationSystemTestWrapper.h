@@ -17,12 +17,15 @@
 #include "internal/PlatformAbstraction/Collections/Guid.h"
 
 #include <string_view>
+#include <functional>
 
 namespace ramses::internal
 {
     enum class ECommunicationSystemType
     {
         Tcp,
+        TcpUnixSocket,
+        SharedMemory,
     };
 
     enum class EServiceType
@@ -57,7 +60,8 @@ namespace ramses::internal
     class CommunicationSystemTestWrapper
     {
     public:
-        explicit CommunicationSystemTestWrapper(CommunicationSystemTestState& state_, std::string_view name = {}, const Guid& id_ = Guid());
+        explicit CommunicationSystemTestWrapper(CommunicationSystemTestState& state_, std::string_view name = {}, const Guid& id_ = Guid(), const TransmissionBandwidthLimits& bandwidthLimits = {},
+            const std::function<void(RamsesFrameworkConfigImpl&)>& configModifier = {});
         virtual ~CommunicationSystemTestWrapper();
 
         virtual void registerAsEventReceiver() {}
@@ -8,6 +8,8 @@
 
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 #include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "internal/Communication/TransportCommon/SingleSceneUpdateWriter.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
 #include "internal/Components/SceneUpdate.h"
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
 #include "gtest/gtest.h"
@@ -341,6 +343,30 @@ namespace ramses::internal
         EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, res.result);
     }
 
+    TEST_F(ASceneUpdateSerialization, failsDeserializeWhenBlockSizeDoesNotMatchDescriptionAndDataSize)
+    {
+        BinaryOutputStream os;
+        os << static_cast<uint32_t>(1u)
+           << SingleSceneUpdateWriter::lastPacketFlag
+           << static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+           << static_cast<uint32_t>(20u)  // block size
+           << static_cast<uint32_t>(4u)   // description size
+           << static_cast<uint32_t>(4u)   // data size
+           << static_cast<uint32_t>(0u)
+           << static_cast<uint32_t>(0u)
+           << static_cast<uint32_t>(0u);
+        const auto res = deser.processData(os.release());
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, res.result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, canDeserializeResourceWithDescriptionSplitOverPackets)
+    {
+        update.resources.push_back(CreateTestResource(1000));
+        EXPECT_TRUE(serialize(50));
+        EXPECT_GT(data.size(), 2u);
+        expectDeserializeToSame();
+    }
+
     TEST_F(ASceneUpdateSerialization, failsWithTruncatedFirstPacket)
     {
         addTestActions();
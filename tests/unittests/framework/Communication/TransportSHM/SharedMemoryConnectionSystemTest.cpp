@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryConnectionSystem.h"
+#include "internal/Communication/TransportCommon/ConnectionStatusUpdateNotifier.h"
+#include "internal/Core/Utils/LogMacros.h"
+#include "CommunicationSystemMock.h"
+#include "ServiceHandlerMocks.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class PacketFillingSerializer : public ISceneUpdateSerializer
+    {
+    public:
+        explicit PacketFillingSerializer(uint8_t value)
+            : m_value(value)
+        {
+        }
+
+        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override
+        {
+            std::fill(packetMem.begin(), packetMem.end(), std::byte{ m_value });
+            return writeDoneFunc(packetMem.size());
+        }
+
+    private:
+        uint8_t m_value;
+    };
+
+    class ASharedMemoryConnectionSystem : public ::testing::Test
+    {
+    protected:
+        ASharedMemoryConnectionSystem()
+        {
+            auto providerControl = std::make_unique<NiceMock<CommunicationSystemMock>>();
+            m_providerControl = providerControl.get();
+            ON_CALL(*m_providerControl, getRamsesConnectionStatusUpdateNotifier()).WillByDefault(ReturnRef(m_providerNotifier));
+            m_provider = std::make_unique<SharedMemoryConnectionSystem>(std::move(providerControl), m_providerId, "provider", m_providerLock, SendTimeout);
+
+            auto rendererControl = std::make_unique<NiceMock<CommunicationSystemMock>>();
+            m_rendererControl = rendererControl.get();
+            ON_CALL(*m_rendererControl, getRamsesConnectionStatusUpdateNotifier()).WillByDefault(ReturnRef(m_rendererNotifier));
+            m_renderer = std::make_unique<SharedMemoryConnectionSystem>(std::move(rendererControl), m_rendererId, "renderer", m_rendererLock, SendTimeout);
+            m_renderer->setSceneRendererServiceHandler(&m_rendererHandler);
+
+            ON_CALL(m_rendererHandler, handleSceneUpdate(m_sceneId, _, m_providerId)).WillByDefault([this](const auto& /*sceneId*/, absl::Span<const std::byte> data, const auto& /*provider*/) {
+                std::lock_guard<std::mutex> lock(m_receivedMutex);
+                m_receivedUpdates.push_back(data.empty() ? 0u : static_cast<uint8_t>(data.front()));
+                m_receivedChanged.notify_all();
+            });
+
+            m_providerNotifier.triggerNotification(m_rendererId, EConnectionStatus_Connected);
+            m_rendererNotifier.triggerNotification(m_providerId, EConnectionStatus_Connected);
+        }
+
+        ~ASharedMemoryConnectionSystem() override
+        {
+            m_renderer.reset();
+            m_provider.reset();
+        }
+
+        void subscribeAndInitializeScene()
+        {
+            EXPECT_CALL(*m_rendererControl, sendSubscribeScene(m_providerId, m_sceneId)).WillOnce(Return(true));
+            EXPECT_TRUE(m_renderer->sendSubscribeScene(m_providerId, m_sceneId));
+            EXPECT_CALL(*m_providerControl, sendInitializeScene(_, _)).Times(0);
+            EXPECT_TRUE(m_provider->sendInitializeScene(m_rendererId, m_sceneId));
+        }
+
+        bool waitForReceivedUpdates(size_t count)
+        {
+            std::unique_lock<std::mutex> lock(m_receivedMutex);
+            return m_receivedChanged.wait_for(lock, std::chrono::seconds{ 10 }, [&]() { return m_receivedUpdates.size() >= count; });
+        }
+
+        static constexpr std::chrono::milliseconds SendTimeout{ 10000 };
+
+        const Guid m_providerId{ (uint64_t{ 0x5e } << 56u) + static_cast<uint64_t>(getpid()) };
+        const Guid m_rendererId{ (uint64_t{ 0x7e } << 56u) + static_cast<uint64_t>(getpid()) };
+        const SceneId m_sceneId{ 123u };
+
+        PlatformLock m_providerLock;
+        PlatformLock m_rendererLock;
+        ConnectionStatusUpdateNotifier m_providerNotifier{ "provider", CONTEXT_COMMUNICATION, "test", m_providerLock };
+        ConnectionStatusUpdateNotifier m_rendererNotifier{ "renderer", CONTEXT_COMMUNICATION, "test", m_rendererLock };
+        NiceMock<SceneRendererServiceHandlerMock> m_rendererHandler;
+        NiceMock<CommunicationSystemMock>* m_providerControl = nullptr;
+        NiceMock<CommunicationSystemMock>* m_rendererControl = nullptr;
+        std::unique_ptr<SharedMemoryConnectionSystem> m_provider;
+        std::unique_ptr<SharedMemoryConnectionSystem> m_renderer;
+
+        std::mutex m_receivedMutex;
+        std::condition_variable m_receivedChanged;
+        std::vector<uint8_t> m_receivedUpdates;
+    };
+
+    TEST_F(ASharedMemoryConnectionSystem, sendsSceneInitializationAndUpdatesThroughRing)
+    {
+        EXPECT_CALL(m_rendererHandler, handleInitializeScene(m_sceneId, m_providerId));
+        subscribeAndInitializeScene();
+
+        EXPECT_CALL(*m_providerControl, sendSceneUpdate(_, _, _)).Times(0);
+        EXPECT_TRUE(m_provider->sendSceneUpdate({ m_rendererId }, m_sceneId, PacketFillingSerializer{ 1u }));
+        EXPECT_TRUE(m_provider->sendSceneUpdate({ m_rendererId }, m_sceneId, PacketFillingSerializer{ 2u }));
+
+        ASSERT_TRUE(waitForReceivedUpdates(2u));
+        std::lock_guard<std::mutex> lock(m_receivedMutex);
+        EXPECT_THAT(m_receivedUpdates, ElementsAre(uint8_t{ 1u }, uint8_t{ 2u }));
+    }
+
+    TEST_F(ASharedMemoryConnectionSystem, doesNotWaitForBusyReceiverWhenRingIsFullAndDeliversQueuedUpdatesInOrder)
+    {
+        // receiver blocks in handling of first message, ring fills up
+        std::promise<void> receiverBlocked;
+        std::promise<void> unblockReceiver;
+        auto unblocked = unblockReceiver.get_future();
+        EXPECT_CALL(m_rendererHandler, handleInitializeScene(m_sceneId, m_providerId)).WillOnce([&](const auto& /*sceneId*/, const auto& /*provider*/) {
+            receiverBlocked.set_value();
+            unblocked.wait();
+        });
+        subscribeAndInitializeScene();
+        receiverBlocked.get_future().wait();
+
+        // sent with framework lock held like on flush, more updates than fit into ring
+        constexpr auto numUpdates = static_cast<uint8_t>(2u * SharedMemoryConnectionSystem::RingCapacity / SharedMemoryConnectionSystem::SceneUpdatePacketSize);
+        {
+            PlatformGuard guard(m_providerLock);
+            for (uint8_t i = 1u; i <= numUpdates; ++i)
+                EXPECT_TRUE(m_provider->sendSceneUpdate({ m_rendererId }, m_sceneId, PacketFillingSerializer{ i }));
+        }
+
+        unblockReceiver.set_value();
+        ASSERT_TRUE(waitForReceivedUpdates(numUpdates));
+        std::lock_guard<std::mutex> lock(m_receivedMutex);
+        ASSERT_EQ(numUpdates, m_receivedUpdates.size());
+        for (uint8_t i = 0u; i < numUpdates; ++i)
+            EXPECT_EQ(static_cast<uint8_t>(i + 1u), m_receivedUpdates[i]);
+    }
+}
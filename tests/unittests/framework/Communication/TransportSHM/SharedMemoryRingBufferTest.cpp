@@ -0,0 +1,201 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "ScopedConsoleLogDisable.h"
+#include "gtest/gtest.h"
+#include "fmt/format.h"
+
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    class ASharedMemoryRingBuffer : public ::testing::Test
+    {
+    protected:
+        static std::vector<std::byte> CreateMessage(size_t size, uint8_t firstValue)
+        {
+            std::vector<std::byte> message(size);
+            for (size_t i = 0u; i < size; ++i)
+                message[i] = std::byte(static_cast<uint8_t>(firstValue + i));
+            return message;
+        }
+
+        static bool Write(SharedMemoryRingBuffer& ring, const std::vector<std::byte>& message, std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 })
+        {
+            return ring.write({ { message.data(), message.size() } }, timeout);
+        }
+
+        static std::vector<std::byte> Read(SharedMemoryRingBuffer& ring, std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 })
+        {
+            const auto message = ring.peek(timeout);
+            std::vector<std::byte> result(message.begin(), message.end());
+            ring.release();
+            return result;
+        }
+
+        const std::string name = fmt::format("/ramses-ringbuffer-test-{}", getpid());
+    };
+
+    TEST_F(ASharedMemoryRingBuffer, createsRingWithCapacityRoundedToRecordAlignment)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1001u);
+        ASSERT_TRUE(consumer);
+        EXPECT_EQ(name, consumer->getName());
+        EXPECT_EQ(1008u, consumer->getCapacity());
+        EXPECT_EQ(1000u, consumer->getMaxMessageSize());
+
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+        EXPECT_EQ(1008u, producer->getCapacity());
+        EXPECT_TRUE(producer->isConsumerAttached());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, cannotOpenRingWhichWasNotCreated)
+    {
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(name));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, canBeOpenedByOnlyOneProducerAtATime)
+    {
+        ScopedConsoleLogDisable consoleDisabler;
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(name));
+
+        producer.reset();
+        EXPECT_TRUE(SharedMemoryRingBuffer::Open(name));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, cannotBeOpenedAfterConsumerDetached)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        consumer->detachConsumer();
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(name));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, transfersMessagesInOrderAlsoWhenWrappingAround)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            const auto message1 = CreateMessage(i * 7u % 300u, static_cast<uint8_t>(i));
+            const auto message2 = CreateMessage(i * 13u % 400u + 1u, static_cast<uint8_t>(i + 1u));
+            ASSERT_TRUE(Write(*producer, message1));
+            ASSERT_TRUE(Write(*producer, message2));
+            EXPECT_EQ(message1, Read(*consumer));
+            EXPECT_EQ(message2, Read(*consumer));
+        }
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, concatenatesMessageParts)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        const auto message = CreateMessage(20u, 0u);
+        ASSERT_TRUE(producer->write({ { message.data(), 5u }, {}, { message.data() + 5u, 15u } }, std::chrono::milliseconds{ 0 }));
+        EXPECT_EQ(message, Read(*consumer));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, keepsMessageDataUntilReleased)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 64u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        const auto message = CreateMessage(40u, 3u);
+        ASSERT_TRUE(Write(*producer, message));
+        const auto data = consumer->peek(std::chrono::milliseconds{ 0 });
+        ASSERT_EQ(message.size(), data.size());
+
+        // no space for another message while first one is not released
+        EXPECT_FALSE(Write(*producer, CreateMessage(40u, 0u), std::chrono::milliseconds{ 10 }));
+        EXPECT_EQ(message, std::vector<std::byte>(data.begin(), data.end()));
+
+        consumer->release();
+        EXPECT_TRUE(Write(*producer, CreateMessage(40u, 0u), std::chrono::milliseconds{ 0 }));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, peekReturnsEmptyDataWhenNothingWrittenWithinTimeout)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        EXPECT_TRUE(consumer->peek(std::chrono::milliseconds{ 10 }).empty());
+        consumer->release();
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToWriteMessageBiggerThanCapacity)
+    {
+        ScopedConsoleLogDisable consoleDisabler;
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 64u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        EXPECT_FALSE(Write(*producer, CreateMessage(57u, 0u)));
+        EXPECT_TRUE(Write(*producer, CreateMessage(56u, 0u)));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToWriteAfterConsumerDetached)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 1024u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        consumer->detachConsumer();
+        EXPECT_FALSE(producer->isConsumerAttached());
+        EXPECT_FALSE(Write(*producer, CreateMessage(8u, 0u)));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, wakesUpProducerBlockedOnFullRingWhenConsumerDetaches)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 64u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+        ASSERT_TRUE(Write(*producer, CreateMessage(56u, 0u)));
+
+        std::thread producerThread([&]() {
+            EXPECT_FALSE(Write(*producer, CreateMessage(56u, 0u), std::chrono::milliseconds{ 60000 }));
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+        consumer->detachConsumer();
+        producerThread.join();
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, transfersManyMessagesBetweenThreadsBlockingOnFullAndEmptyRing)
+    {
+        const auto consumer = SharedMemoryRingBuffer::Create(name, 256u);
+        const auto producer = SharedMemoryRingBuffer::Open(name);
+        ASSERT_TRUE(producer);
+
+        constexpr uint32_t NumMessages = 10000u;
+        std::thread producerThread([&]() {
+            for (uint32_t i = 0u; i < NumMessages; ++i)
+            {
+                if (!Write(*producer, CreateMessage(i % 100u + 1u, static_cast<uint8_t>(i)), std::chrono::milliseconds{ 10000 }))
+                {
+                    ADD_FAILURE() << "failed to write message " << i;
+                    return;
+                }
+            }
+        });
+
+        for (uint32_t i = 0u; i < NumMessages; ++i)
+        {
+            const auto message = Read(*consumer, std::chrono::milliseconds{ 10000 });
+            EXPECT_EQ(CreateMessage(i % 100u + 1u, static_cast<uint8_t>(i)), message) << "message " << i;
+        }
+        producerThread.join();
+    }
+}
@@ -0,0 +1,173 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportTCP/SendLanes.h"
+#include "gmock/gmock.h"
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class ASendLanes : public ::testing::Test
+    {
+    protected:
+        static constexpr size_t HighLane = 1u + static_cast<size_t>(ETransmissionPriority::High);
+        static constexpr size_t NormalLane = 1u + static_cast<size_t>(ETransmissionPriority::Normal);
+        static constexpr size_t LowLane = 1u + static_cast<size_t>(ETransmissionPriority::Low);
+
+        static OutBuffer CreateBuffer(EMessageId messageType, size_t size)
+        {
+            return OutBuffer{ messageType, std::make_shared<const std::vector<std::byte>>(size), StartTime };
+        }
+
+        static std::vector<size_t> GetSizes(const std::vector<OutBuffer>& buffers)
+        {
+            std::vector<size_t> sizes;
+            for (const auto& buffer : buffers)
+                sizes.push_back(buffer.data->size());
+            return sizes;
+        }
+
+        static std::vector<OutBuffer> TakeNextWrite(SendLanes& lanes, std::chrono::steady_clock::time_point now)
+        {
+            std::vector<OutBuffer> buffers;
+            const size_t fullSize = lanes.takeNextWrite(now, buffers);
+            size_t expectedSize = 0u;
+            for (const auto& buffer : buffers)
+                expectedSize += buffer.data->size();
+            EXPECT_EQ(expectedSize, fullSize);
+            return buffers;
+        }
+
+        // far enough from epoch so that limited lanes start with full burst credit
+        static constexpr std::chrono::steady_clock::time_point StartTime{ std::chrono::seconds{ 10 } };
+        static constexpr size_t PacketSize = SendLanes::MaxBytesPerWrite;
+    };
+
+    TEST_F(ASendLanes, sendsQueuedMessagesInStrictLanePriorityOrder)
+    {
+        SendLanes lanes({});
+        lanes.push(LowLane, CreateBuffer(EMessageId::SendSceneUpdate, 1u));
+        lanes.push(NormalLane, CreateBuffer(EMessageId::SendSceneUpdate, 2u));
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, 3u));
+        lanes.push(SendLanes::ControlLane, CreateBuffer(EMessageId::SubscribeScene, 4u));
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, 5u));
+        lanes.pushFront(SendLanes::ControlLane, CreateBuffer(EMessageId::Alive, 6u));
+
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(6u, 4u, 3u, 5u, 2u, 1u));
+        EXPECT_TRUE(TakeNextWrite(lanes, StartTime).empty());
+
+        for (size_t lane = 0u; lane < SendLanes::LaneCount; ++lane)
+        {
+            EXPECT_TRUE(lanes.getLane(lane).queue.empty());
+            EXPECT_EQ(0u, lanes.getLane(lane).queuedBytes);
+        }
+        EXPECT_EQ(10u, lanes.getLane(SendLanes::ControlLane).sentBytes);
+        EXPECT_EQ(8u, lanes.getLane(HighLane).sentBytes);
+    }
+
+    TEST_F(ASendLanes, limitsNumberOfMessagesPerWrite)
+    {
+        SendLanes lanes({});
+        for (size_t i = 0u; i < SendLanes::MaxBuffersPerWrite + 2u; ++i)
+            lanes.push(NormalLane, CreateBuffer(EMessageId::SendSceneUpdate, 10u));
+
+        EXPECT_EQ(SendLanes::MaxBuffersPerWrite, TakeNextWrite(lanes, StartTime).size());
+        EXPECT_EQ(2u, TakeNextWrite(lanes, StartTime).size());
+    }
+
+    TEST_F(ASendLanes, interleavesLargeLowPriorityUpdatePacketByPacketWithHighPriorityMessages)
+    {
+        SendLanes lanes({});
+        for (size_t i = 0u; i < 3u; ++i)
+            lanes.push(LowLane, CreateBuffer(EMessageId::SendSceneUpdate, PacketSize));
+
+        // write stops after size of one packet
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(PacketSize));
+
+        // high priority packets queued meanwhile go first with next write
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, 100u));
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, 200u));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(100u, 200u, PacketSize));
+
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, PacketSize));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(PacketSize));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(PacketSize));
+        EXPECT_TRUE(TakeNextWrite(lanes, StartTime).empty());
+    }
+
+    TEST_F(ASendLanes, throttlesLimitedLaneAndResumesItWhenCreditIsRegained)
+    {
+        // 1MB/s, lane may burst one full write
+        TransmissionBandwidthLimits limits{};
+        limits[static_cast<size_t>(ETransmissionPriority::Normal)] = 1000000u;
+        SendLanes lanes(limits);
+        for (size_t i = 0u; i < 4u; ++i)
+            lanes.push(NormalLane, CreateBuffer(EMessageId::SendSceneUpdate, 200000u));
+
+        // second message exceeds credit by 100000 bytes
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(200000u, 200000u));
+        EXPECT_EQ(-100000, lanes.getLane(NormalLane).sendCredit);
+
+        EXPECT_TRUE(TakeNextWrite(lanes, StartTime).empty());
+        const auto wait = lanes.getThrottleWait();
+        ASSERT_TRUE(wait);
+        EXPECT_EQ(std::chrono::microseconds{ 100002 }, *wait);
+
+        // credit is still not positive right before wait elapsed
+        EXPECT_TRUE(TakeNextWrite(lanes, StartTime + std::chrono::microseconds{ 100000 }).empty());
+        EXPECT_TRUE(lanes.getThrottleWait());
+
+        // timer resumes sending
+        const auto resumeTime = StartTime + std::chrono::microseconds{ 100000 } + std::chrono::microseconds{ 2 };
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, resumeTime)), ElementsAre(200000u));
+        EXPECT_TRUE(TakeNextWrite(lanes, resumeTime).empty());
+        EXPECT_TRUE(lanes.getThrottleWait());
+
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, resumeTime + std::chrono::milliseconds{ 200 })), ElementsAre(200000u));
+        EXPECT_FALSE(lanes.getThrottleWait());
+    }
+
+    TEST_F(ASendLanes, letsLowerPriorityLanesSendWhileHigherPriorityLaneIsThrottled)
+    {
+        TransmissionBandwidthLimits limits{};
+        limits[static_cast<size_t>(ETransmissionPriority::High)] = 1000000u;
+        SendLanes lanes(limits);
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, PacketSize + 1u));
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, 10u));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(PacketSize + 1u));
+
+        lanes.push(LowLane, CreateBuffer(EMessageId::SendSceneUpdate, 20u));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(20u));
+        EXPECT_TRUE(lanes.getThrottleWait());
+    }
+
+    TEST_F(ASendLanes, neverThrottlesControlLaneWithAliveMessages)
+    {
+        TransmissionBandwidthLimits limits{};
+        limits.fill(1u);
+        SendLanes lanes(limits);
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, PacketSize));
+        lanes.push(HighLane, CreateBuffer(EMessageId::SendSceneUpdate, PacketSize));
+        EXPECT_THAT(GetSizes(TakeNextWrite(lanes, StartTime)), ElementsAre(PacketSize));
+        EXPECT_TRUE(TakeNextWrite(lanes, StartTime).empty());
+
+        for (size_t i = 0u; i < 3u; ++i)
+        {
+            lanes.pushFront(SendLanes::ControlLane, CreateBuffer(EMessageId::Alive, 12u));
+            const auto buffers = TakeNextWrite(lanes, StartTime);
+            ASSERT_EQ(1u, buffers.size());
+            EXPECT_EQ(EMessageId::Alive, buffers.front().messageType);
+        }
+
+        // only scene lane waits for credit
+        const auto wait = lanes.getThrottleWait();
+        ASSERT_TRUE(wait);
+        EXPECT_GT(*wait, std::chrono::seconds{ 1 });
+    }
+}
@@ -11,8 +11,14 @@
 #include "internal/Core/Utils/ThreadBarrier.h"
 #include "ScopedConsoleLogDisable.h"
 #include "CommunicationSystemTest.h"
+#include "SceneUpdateSerializerTestHelper.h"
+#include "impl/RamsesFrameworkConfigImpl.h"
 #include "gtest/gtest.h"
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstring>
+#include <numeric>
 
 namespace ramses::internal
 {
@@ -171,4 +177,220 @@ namespace ramses::internal
         csw2->commSystem->disconnectServices();
         ASSERT_TRUE(state->event.waitForEvents(2));
     }
+
+    TEST_P(ACommunicationSystemWithDaemon_TCP, sendsSceneUnpublicationAfterQueuedUpdatesOfThrottledScene)
+    {
+        TransmissionBandwidthLimits limits{};
+        limits[static_cast<size_t>(ETransmissionPriority::Low)] = 1000000u;
+        auto provider = std::make_unique<CommunicationSystemTestWrapper>(*state, "provider", Guid(), limits);
+        auto renderer = std::make_unique<CommunicationSystemTestWrapper>(*state, "renderer");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneProviderServiceHandlerMock> providerHandler;
+        StrictMock<SceneRendererServiceHandlerMock> rendererHandler;
+        provider->commSystem->setSceneProviderServiceHandler(&providerHandler);
+        renderer->commSystem->setSceneRendererServiceHandler(&rendererHandler);
+
+        const SceneId sceneId(123u);
+        provider->commSystem->setSceneTransmissionPriority(sceneId, ETransmissionPriority::Low);
+        {
+            PlatformGuard g(provider->frameworkLock);
+            EXPECT_CALL(providerHandler, handleSubscribeScene(sceneId, renderer->id)).WillOnce(InvokeWithoutArgs([&](){ state->sendEvent(); }));
+        }
+        renderer->commSystem->sendSubscribeScene(provider->id, sceneId);
+        ASSERT_TRUE(state->event.waitForEvents(1));
+
+        // packets of full size exceed burst credit of lane, so that they are throttled to one packet per ~300ms
+        const SceneInfoVector unavailableScenes{ SceneInfo{ sceneId } };
+        {
+            PlatformGuard g(renderer->frameworkLock);
+            InSequence seq;
+            EXPECT_CALL(rendererHandler, handleInitializeScene(sceneId, provider->id));
+            EXPECT_CALL(rendererHandler, handleSceneUpdate(sceneId, _, provider->id)).Times(3);
+            EXPECT_CALL(rendererHandler, handleScenesBecameUnavailable(unavailableScenes, provider->id)).WillOnce(InvokeWithoutArgs([&](){ state->sendEvent(); }));
+        }
+
+        SceneUpdateSerializerMock serializer;
+        EXPECT_CALL(serializer, writeToPackets(_, _)).WillOnce(Invoke([&](absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+            for (size_t i = 0u; i < 3u; ++i)
+            {
+                if (!writeDoneFunc(packetMem.size()))
+                    return false;
+            }
+            return true;
+        }));
+        EXPECT_TRUE(provider->commSystem->sendInitializeScene(renderer->id, sceneId));
+        EXPECT_TRUE(provider->commSystem->sendSceneUpdate({ renderer->id }, sceneId, serializer));
+        EXPECT_TRUE(provider->commSystem->broadcastScenesBecameUnavailable(unavailableScenes));
+        ASSERT_TRUE(state->event.waitForEvents(1));
+
+        state->disconnectAll();
+    }
+
+    class ATCPConnectionSystemDispatch : public ACommunicationSystemWithDaemon
+    {
+    public:
+        ATCPConnectionSystemDispatch()
+        {
+            // no alive messages while test runs, so received messages are only those sent by test
+            daemon = std::make_unique<ConnectionSystemTestDaemon>(&ATCPConnectionSystemDispatch::ConfigureNoAlive);
+        }
+
+        static void ConfigureNoAlive(RamsesFrameworkConfigImpl& config)
+        {
+            config.m_tcpConfig.setAliveInterval(std::chrono::milliseconds{60000});
+            config.m_tcpConfig.setAliveTimeout(std::chrono::milliseconds{120000});
+        }
+
+        static void ConfigureFourDispatchThreads(RamsesFrameworkConfigImpl& config)
+        {
+            ConfigureNoAlive(config);
+            config.m_tcpConfig.setThreadCount(4u);
+        }
+
+        static void ExpectSequencedSceneUpdates(SceneUpdateSerializerMock& serializer, uint32_t count)
+        {
+            EXPECT_CALL(serializer, writeToPackets(_, _)).WillOnce(Invoke([count](absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+                for (uint32_t i = 0u; i < count; ++i)
+                {
+                    std::memcpy(packetMem.data(), &i, sizeof(i));
+                    if (!writeDoneFunc(sizeof(i)))
+                        return false;
+                }
+                return true;
+            }));
+        }
+
+        static uint32_t GetSequenceNumber(absl::Span<const std::byte> actionData)
+        {
+            uint32_t sequenceNumber = 0u;
+            EXPECT_EQ(sizeof(sequenceNumber), actionData.size());
+            std::memcpy(&sequenceNumber, actionData.data(), sizeof(sequenceNumber));
+            return sequenceNumber;
+        }
+
+        static testing::AssertionResult WaitForCounterValue(const StatisticCollectionFramework& statistics, uint32_t expectedValue)
+        {
+            const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+            while (statistics.statMessagesReceived.getCounterValue() < expectedValue)
+            {
+                if (std::chrono::steady_clock::now() > endTime)
+                    return testing::AssertionFailure() << "Timeout while waiting for " << expectedValue << " received messages, got " << statistics.statMessagesReceived.getCounterValue();
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+            return testing::AssertionSuccess();
+        }
+    };
+
+    INSTANTIATE_TEST_SUITE_P(TypedCommunicationTest, ATCPConnectionSystemDispatch, ::testing::Combine(::testing::Values(ECommunicationSystemType::Tcp), ::testing::Values(EServiceType::Ramses)));
+
+    TEST_P(ATCPConnectionSystemDispatch, handlesMessagesOfEachParticipantInOrderWhenDispatchedConcurrently)
+    {
+        constexpr uint32_t ProviderCount = 3u;
+        constexpr uint32_t UpdateCount = 50u;
+
+        std::vector<std::unique_ptr<CommunicationSystemTestWrapper>> providers;
+        for (uint32_t i = 0u; i < ProviderCount; ++i)
+            providers.push_back(std::make_unique<CommunicationSystemTestWrapper>(*state, "provider", Guid(), TransmissionBandwidthLimits{}, &ATCPConnectionSystemDispatch::ConfigureNoAlive));
+        auto renderer = std::make_unique<CommunicationSystemTestWrapper>(*state, "renderer", Guid(), TransmissionBandwidthLimits{}, &ATCPConnectionSystemDispatch::ConfigureFourDispatchThreads);
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        // handler is called from dispatch threads without framework lock
+        std::mutex receivedLock;
+        std::unordered_map<Guid, std::vector<uint32_t>> receivedSequenceNumbers;
+        StrictMock<SceneRendererServiceHandlerMock> rendererHandler;
+        renderer->commSystem->setSceneRendererServiceHandler(&rendererHandler);
+
+        const SceneId sceneId(123u);
+        EXPECT_CALL(rendererHandler, handleSceneUpdate(sceneId, _, _)).Times(ProviderCount * UpdateCount).WillRepeatedly(Invoke([&](const SceneId& /*sceneId*/, absl::Span<const std::byte> actionData, const Guid& providerID) {
+            const uint32_t sequenceNumber = GetSequenceNumber(actionData);
+            // give other dispatch threads a chance to overtake this one
+            std::this_thread::sleep_for(std::chrono::microseconds{200});
+            std::lock_guard<std::mutex> g(receivedLock);
+            receivedSequenceNumbers[providerID].push_back(sequenceNumber);
+            state->sendEvent();
+        }));
+
+        std::vector<SceneUpdateSerializerMock> serializers(ProviderCount);
+        for (uint32_t i = 0u; i < ProviderCount; ++i)
+        {
+            ExpectSequencedSceneUpdates(serializers[i], UpdateCount);
+            EXPECT_TRUE(providers[i]->commSystem->sendSceneUpdate({ renderer->id }, sceneId, serializers[i]));
+        }
+        ASSERT_TRUE(state->event.waitForEvents(ProviderCount * UpdateCount));
+
+        std::vector<uint32_t> expectedSequenceNumbers(UpdateCount);
+        std::iota(expectedSequenceNumbers.begin(), expectedSequenceNumbers.end(), 0u);
+        std::lock_guard<std::mutex> g(receivedLock);
+        ASSERT_EQ(ProviderCount, receivedSequenceNumbers.size());
+        for (const auto& provider : providers)
+            EXPECT_EQ(expectedSequenceNumbers, receivedSequenceNumbers[provider->id]);
+
+        state->disconnectAll();
+    }
+
+    TEST_P(ATCPConnectionSystemDispatch, pausesReadingFromParticipantWithTooManyPendingMessagesAndResumesWhenHandled)
+    {
+        constexpr uint32_t UpdateCount = 20u;
+        constexpr uint32_t MaxPendingMessages = 8u;
+
+        auto provider = std::make_unique<CommunicationSystemTestWrapper>(*state, "provider", Guid(), TransmissionBandwidthLimits{}, &ATCPConnectionSystemDispatch::ConfigureNoAlive);
+        auto renderer = std::make_unique<CommunicationSystemTestWrapper>(*state, "renderer", Guid(), TransmissionBandwidthLimits{}, &ATCPConnectionSystemDispatch::ConfigureNoAlive);
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> rendererHandler;
+        renderer->commSystem->setSceneRendererServiceHandler(&rendererHandler);
+
+        // first update blocks dispatch of provider messages until released
+        std::mutex releaseLock;
+        std::condition_variable releaseCondition;
+        bool released = false;
+        std::vector<uint32_t> receivedSequenceNumbers;
+
+        const SceneId sceneId(123u);
+        {
+            InSequence seq;
+            EXPECT_CALL(rendererHandler, handleSceneUpdate(sceneId, _, provider->id)).WillOnce(Invoke([&](const SceneId& /*sceneId*/, absl::Span<const std::byte> actionData, const Guid& /*providerID*/) {
+                receivedSequenceNumbers.push_back(GetSequenceNumber(actionData));
+                std::unique_lock<std::mutex> l(releaseLock);
+                releaseCondition.wait(l, [&]() { return released; });
+            }));
+            EXPECT_CALL(rendererHandler, handleSceneUpdate(sceneId, _, provider->id)).Times(UpdateCount - 1u).WillRepeatedly(Invoke([&](const SceneId& /*sceneId*/, absl::Span<const std::byte> actionData, const Guid& /*providerID*/) {
+                receivedSequenceNumbers.push_back(GetSequenceNumber(actionData));
+                state->sendEvent();
+            }));
+        }
+
+        const uint32_t receivedBeforeUpdates = renderer->statisticCollection.statMessagesReceived.getCounterValue();
+        SceneUpdateSerializerMock serializer;
+        ExpectSequencedSceneUpdates(serializer, UpdateCount);
+        EXPECT_TRUE(provider->commSystem->sendSceneUpdate({ renderer->id }, sceneId, serializer));
+
+        // reading stops once threshold of pending messages is reached, although more were sent
+        ASSERT_TRUE(WaitForCounterValue(renderer->statisticCollection, receivedBeforeUpdates + MaxPendingMessages));
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        EXPECT_EQ(receivedBeforeUpdates + MaxPendingMessages, renderer->statisticCollection.statMessagesReceived.getCounterValue());
+
+        {
+            std::lock_guard<std::mutex> l(releaseLock);
+            released = true;
+        }
+        releaseCondition.notify_one();
+
+        // reading resumes when pending messages are handled
+        ASSERT_TRUE(state->event.waitForEvents(UpdateCount - 1u));
+        EXPECT_EQ(receivedBeforeUpdates + UpdateCount, renderer->statisticCollection.statMessagesReceived.getCounterValue());
+
+        std::vector<uint32_t> expectedSequenceNumbers(UpdateCount);
+        std::iota(expectedSequenceNumbers.begin(), expectedSequenceNumbers.end(), 0u);
+        EXPECT_EQ(expectedSequenceNumbers, receivedSequenceNumbers);
+
+        state->disconnectAll();
+    }
 }
@@ -1834,6 +1834,39 @@ TYPED_TEST(AClientSceneLogic_All, resolvesOldResourcesForNewSubscriber)
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, doesNotSendResourceDataToNewSubscriberWhichHasResourcesAvailable)
+{
+    this->publish();
+    this->m_scene.allocateNode(0, {});
+    this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), {}, {}, this->m_textureResource->getHash(), {} }, {});
+    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, true);
+    this->flush();
+
+    const Guid otherRendererID(4242);
+    Mock::VerifyAndClearExpectations(&this->m_resourceComponent); // strict behavior for this test
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _)).WillOnce([&](const auto& /*unused*/, const auto& update, auto /*unused*/, auto /*unused*/, auto& /*unused*/)
+        {
+            EXPECT_TRUE(update.resources.empty());
+            EXPECT_EQ(ResourceContentHashVector{ this->m_textureResource->getHash() }, update.flushInfos.resourceChanges.m_resourcesAdded);
+        });
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ otherRendererID }, _, this->m_sceneId, _, _)).WillOnce([&](const auto& /*unused*/, const auto& update, auto /*unused*/, auto /*unused*/, auto& /*unused*/)
+        {
+            ASSERT_EQ(1u, update.resources.size());
+            EXPECT_EQ(this->m_textureResource->getHash(), update.resources[0]->getHash());
+        });
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(otherRendererID, this->m_sceneInfo));
+
+    this->m_sceneLogic.setResourcesAvailableAtSubscriber(this->m_rendererID, { this->m_textureResource->getHash() });
+    this->expectResourceQueries({}, { this->m_textureResource }, false, false, true);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->expectResourceQueries({}, { this->m_textureResource }, false, false, true);
+    this->m_sceneLogic.addSubscriber(otherRendererID);
+    this->expectResourceQueries({}, { this->m_textureResource }, false, true, false);
+    this->flush();
+    this->expectSceneUnpublish();
+}
+
 TYPED_TEST(AClientSceneLogic_All, succeedsASecondFlushContainingAllSceneActionsAfterAddingResourcesMissingFromFailedFirstFlush)
 {
     this->publish();
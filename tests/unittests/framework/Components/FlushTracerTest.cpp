@@ -0,0 +1,116 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "internal/Components/FlushTracer.h"
+#include "internal/Core/Utils/File.h"
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class AFlushTracer : public ::testing::Test
+    {
+    protected:
+        static FlushTrace CreateTrace(SceneId sceneId, uint64_t flushIndex, std::initializer_list<std::pair<EFlushTraceStage, uint64_t>> stagesWithMicroseconds)
+        {
+            FlushTrace trace;
+            trace.enabled = true;
+            trace.sceneId = sceneId;
+            trace.flushIndex = flushIndex;
+            for (const auto& stage : stagesWithMicroseconds)
+                trace.timestamps[static_cast<size_t>(stage.first)] = FlushTime::Clock::time_point(std::chrono::microseconds(stage.second));
+            return trace;
+        }
+
+        FlushTracer tracer{ "flushTracerTest.json", 42u, "renderer \"main\"" };
+    };
+
+    TEST(AFlushTrace, marksStagesOnlyIfEnabled)
+    {
+        FlushTrace trace;
+        trace.mark(EFlushTraceStage::Receive);
+        EXPECT_EQ(FlushTime::InvalidTimestamp, trace.getTimestamp(EFlushTraceStage::Receive));
+
+        trace.enabled = true;
+        trace.mark(EFlushTraceStage::Receive);
+        EXPECT_NE(FlushTime::InvalidTimestamp, trace.getTimestamp(EFlushTraceStage::Receive));
+        EXPECT_EQ(FlushTime::InvalidTimestamp, trace.getTimestamp(EFlushTraceStage::Deserialize));
+    }
+
+    TEST(AFlushTrace, hasStageNames)
+    {
+        EXPECT_STREQ("flush", EnumToString(EFlushTraceStage::Flush));
+        EXPECT_STREQ("resources ready", EnumToString(EFlushTraceStage::ResourcesReady));
+        EXPECT_STREQ("rendered", EnumToString(EFlushTraceStage::Rendered));
+    }
+
+    TEST_F(AFlushTracer, exportsProcessAndSceneNames)
+    {
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 1u, { { EFlushTraceStage::Receive, 1000u } }));
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 2u, { { EFlushTraceStage::Receive, 2000u } }));
+
+        const std::string json = tracer.getChromeTraceJson();
+        EXPECT_THAT(json, HasSubstr(R"({"name":"process_name","ph":"M","pid":42,"args":{"name":"renderer \"main\""}})"));
+        EXPECT_THAT(json, HasSubstr(R"({"name":"thread_name","ph":"M","pid":42,"tid":7,"args":{"name":"scene 7"}})"));
+        // scene name only once
+        EXPECT_EQ(json.find("thread_name"), json.rfind("thread_name"));
+    }
+
+    TEST_F(AFlushTracer, exportsStagesUntilNextStageAndLastStageAsInstant)
+    {
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 3u, {
+            { EFlushTraceStage::Receive, 1000u },
+            { EFlushTraceStage::Deserialize, 1500u },
+            { EFlushTraceStage::Pending, 4000u },
+            { EFlushTraceStage::Applied, 4100u } }));
+
+        const std::string json = tracer.getChromeTraceJson();
+        EXPECT_THAT(json, HasSubstr(R"({"name":"receive","cat":"flush","pid":42,"tid":7,"ts":1000,"ph":"X","dur":500,"args":{"scene":7,"flush":3}})"));
+        EXPECT_THAT(json, HasSubstr(R"({"name":"deserialize","cat":"flush","pid":42,"tid":7,"ts":1500,"ph":"X","dur":2500,"args":{"scene":7,"flush":3}})"));
+        // skips stages not reached
+        EXPECT_THAT(json, HasSubstr(R"({"name":"pending","cat":"flush","pid":42,"tid":7,"ts":4000,"ph":"X","dur":100,"args":{"scene":7,"flush":3}})"));
+        EXPECT_THAT(json, Not(HasSubstr(R"("name":"resources ready")")));
+        EXPECT_THAT(json, HasSubstr(R"({"name":"applied","cat":"flush","pid":42,"tid":7,"ts":4100,"ph":"i","s":"t","args":{"scene":7,"flush":3}})"));
+    }
+
+    TEST_F(AFlushTracer, linksSendAndReceiveWithFlowEventsOfSameId)
+    {
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 3u, { { EFlushTraceStage::Flush, 100u }, { EFlushTraceStage::Send, 200u } }));
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 3u, { { EFlushTraceStage::Receive, 300u } }));
+
+        const std::string json = tracer.getChromeTraceJson();
+        EXPECT_THAT(json, HasSubstr(R"({"name":"flush","cat":"flush","ph":"s","id":"7:3","pid":42,"tid":7,"ts":200})"));
+        EXPECT_THAT(json, HasSubstr(R"({"name":"flush","cat":"flush","ph":"f","bp":"e","id":"7:3","pid":42,"tid":7,"ts":300})"));
+    }
+
+    TEST_F(AFlushTracer, dropsTracesOverLimit)
+    {
+        for (size_t i = 0u; i < FlushTracer::MaxNumberOfTraces + 10u; ++i)
+            tracer.addTrace(CreateTrace(SceneId{ 7u }, i, { { EFlushTraceStage::Receive, 1000u } }));
+        EXPECT_EQ(FlushTracer::MaxNumberOfTraces, tracer.getNumberOfTraces());
+    }
+
+    TEST_F(AFlushTracer, writesTraceFile)
+    {
+        tracer.addTrace(CreateTrace(SceneId{ 7u }, 1u, { { EFlushTraceStage::Receive, 1000u } }));
+        ASSERT_TRUE(tracer.writeTraceFile());
+
+        const std::string json = tracer.getChromeTraceJson();
+        File file("flushTracerTest.json");
+        ASSERT_TRUE(file.open(File::Mode::ReadOnly));
+        size_t fileSize = 0u;
+        ASSERT_TRUE(file.getSizeInBytes(fileSize));
+        std::string content(fileSize, '\0');
+        size_t numBytes = 0u;
+        EXPECT_EQ(EStatus::Ok, file.read(content.data(), content.size(), numBytes));
+        EXPECT_EQ(json, content);
+        file.close();
+        EXPECT_TRUE(file.remove());
+    }
+}
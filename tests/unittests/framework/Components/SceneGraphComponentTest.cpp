@@ -56,7 +56,7 @@ public:
 
     void expectSendSceneActionsToNetwork(Guid remote, SceneId sceneId, const SceneActionCollection& expectedActions)
     {
-        EXPECT_CALL(communicationSystem, sendSceneUpdate(remote, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remote }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
             // grab actions directly out of serializer
             const auto actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions.copy();
             EXPECT_EQ(expectedActions, actions);
@@ -354,7 +354,7 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
         std::make_shared<const ArrayResource>(EResourceType::VertexArray, 1024u, EDataType::Float, blob.data(), "fl")
     };
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         // grab resources directly out of serializer
         const auto resources = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().resources;
         EXPECT_EQ(resourcesToSend, resources);
@@ -402,6 +402,21 @@ TEST_F(ASceneGraphComponent, sendsAllSceneActionsAtOnceToRemoteProvider)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
 }
 
+TEST_F(ASceneGraphComponent, sendsSceneUpdateOnceToAllRemoteProviders)
+{
+    SceneId sceneId(1);
+    const Guid otherRemoteParticipantID(13);
+    SceneActionCollection list(CreateFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID, otherRemoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        const auto actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions.copy();
+        EXPECT_EQ(list, actions);
+        return true;
+    });
+    SceneUpdate update;
+    update.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID, otherRemoteParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+}
+
 TEST_F(ASceneGraphComponent, doesNotsendSceneUpdateToRemoteIfSceneWasPublishedLocalOnly)
 {
     const SceneId sceneId(111);
@@ -537,7 +552,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.handleSubscribeScene(SceneId(1), localParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _));
 
     EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _,  _));
@@ -560,12 +575,12 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     sceneGraphComponent.handleSubscribeScene(SceneId(1), remoteParticipantID);
 
     // flush again
     flushTimesWithExpirationToPreventFlushOptimizazion.expirationTimestamp += std::chrono::milliseconds{ 1 };
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _, _));
     EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), flushTimesWithExpirationToPreventFlushOptimizazion, {}));
 
@@ -1273,7 +1288,7 @@ TEST_F(ASceneGraphComponent, sendSceneUpdatePassesSceneStatisticsToSerializer)
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
     sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ localSceneId, "", EScenePublicationMode::LocalAndRemote });
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         const auto& stats = static_cast<const SceneUpdateSerializer&>(serializer).getStatisticCollection();
         EXPECT_EQ(&sceneStatistics, &stats);
         return true;
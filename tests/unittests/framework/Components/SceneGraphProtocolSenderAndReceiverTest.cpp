@@ -173,7 +173,7 @@ namespace ramses::internal
         }
 
         FakseSceneUpdateSerializer serializer({blob_1, blob_2}, 300000);
-        EXPECT_TRUE(sender.sendSceneUpdate(receiverId, sceneId, serializer));
+        EXPECT_TRUE(sender.sendSceneUpdate({ receiverId }, sceneId, serializer));
         ASSERT_TRUE(waitForEvent(2));
     }
 
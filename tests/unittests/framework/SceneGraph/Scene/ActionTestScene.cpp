@@ -119,6 +119,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderableFrustumCulling(RenderableHandle renderableHandle, bool enabled)
+    {
+        m_actionCollector.setRenderableFrustumCulling(renderableHandle, enabled);
+        flushPendingSceneActions();
+    }
+
     const Renderable& ActionTestScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_scene.getRenderable(renderableHandle);
@@ -1122,6 +1128,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderPassStateSorting(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassStateSorting(pass, enable);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         m_actionCollector.addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -0,0 +1,209 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/SceneGraph/SceneUtils/BufferDeltaEncoding.h"
+#include "internal/SceneGraph/Scene/ActionCollectingScene.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/SceneAPI/GeometryDataBuffer.h"
+#include "internal/SceneGraph/SceneAPI/TextureBuffer.h"
+
+namespace ramses::internal
+{
+    class ABufferDeltaEncoding : public testing::Test
+    {
+    protected:
+        ABufferDeltaEncoding()
+            : previous(256u)
+        {
+            for (size_t i = 0u; i < previous.size(); ++i)
+                previous[i] = std::byte(i);
+            current = previous;
+        }
+
+        std::vector<std::byte> encodeAndApply(size_t maxEncodedSize = 256u)
+        {
+            EXPECT_TRUE(BufferDeltaEncoding::Encode(previous, current, maxEncodedSize, encoded));
+            std::vector<std::byte> data = previous;
+            EXPECT_TRUE(BufferDeltaEncoding::Apply(encoded, absl::MakeSpan(data)));
+            return data;
+        }
+
+        std::vector<std::byte> previous;
+        std::vector<std::byte> current;
+        std::vector<std::byte> encoded;
+    };
+
+    TEST_F(ABufferDeltaEncoding, encodesNothingIfContentUnchanged)
+    {
+        EXPECT_EQ(previous, encodeAndApply());
+        EXPECT_TRUE(encoded.empty());
+    }
+
+    TEST_F(ABufferDeltaEncoding, encodesOnlyChangedBytes)
+    {
+        current[3] = std::byte{ 0xFF };
+        current[200] = std::byte{ 0xFF };
+        current[201] = std::byte{ 0xFE };
+        current[255] = std::byte{ 0xFD };
+
+        EXPECT_EQ(current, encodeAndApply());
+        // 3 runs: headers and 4 changed bytes
+        EXPECT_EQ(3u * 8u + 4u, encoded.size());
+    }
+
+    TEST_F(ABufferDeltaEncoding, mergesChangedBytesWithShortUnchangedGapIntoOneRun)
+    {
+        current[10] = std::byte{ 0xFF };
+        current[14] = std::byte{ 0xFF };
+
+        EXPECT_EQ(current, encodeAndApply());
+        EXPECT_EQ(8u + 5u, encoded.size());
+    }
+
+    TEST_F(ABufferDeltaEncoding, failsIfDeltaNotSmallerThanLimit)
+    {
+        for (size_t i = 0u; i < current.size(); i += 2u)
+            current[i] = std::byte{ 0xFF };
+
+        EXPECT_FALSE(BufferDeltaEncoding::Encode(previous, current, 128u, encoded));
+    }
+
+    TEST_F(ABufferDeltaEncoding, failsToApplyDeltaExceedingData)
+    {
+        current[250] = std::byte{ 0xFF };
+        ASSERT_TRUE(BufferDeltaEncoding::Encode(previous, current, 256u, encoded));
+
+        std::vector<std::byte> data(200u);
+        EXPECT_FALSE(BufferDeltaEncoding::Apply(encoded, absl::MakeSpan(data)));
+    }
+
+    TEST_F(ABufferDeltaEncoding, failsToApplyTruncatedDelta)
+    {
+        current[50] = std::byte{ 0xFF };
+        current[51] = std::byte{ 0xFF };
+        ASSERT_TRUE(BufferDeltaEncoding::Encode(previous, current, 256u, encoded));
+        encoded.pop_back();
+
+        std::vector<std::byte> data = previous;
+        EXPECT_FALSE(BufferDeltaEncoding::Apply(encoded, absl::MakeSpan(data)));
+    }
+
+    class AnActionCollectingSceneWithDeltaEncoding : public testing::Test
+    {
+    protected:
+        AnActionCollectingSceneWithDeltaEncoding()
+        {
+            scene.setBufferDeltaEncodingEnabled(true);
+        }
+
+        std::vector<ESceneActionId> applyCollectedActions()
+        {
+            std::vector<ESceneActionId> types;
+            for (const auto& action : scene.getSceneActionCollection())
+                types.push_back(action.type());
+            SceneActionApplier::ApplyActionsOnScene(receiverScene, scene.getSceneActionCollection(), EFeatureLevel_Latest);
+            scene.getSceneActionCollection().clear();
+            return types;
+        }
+
+        ActionCollectingScene scene;
+        Scene receiverScene;
+    };
+
+    TEST_F(AnActionCollectingSceneWithDeltaEncoding, sendsDeltaOfDataBufferUpdateChangingFewBytes)
+    {
+        const auto handle = scene.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Float, 1024u, {});
+        std::vector<std::byte> data(1024u, std::byte{ 1 });
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::AllocateDataBuffer, ESceneActionId::UpdateDataBuffer }), applyCollectedActions());
+
+        data[100] = std::byte{ 2 };
+        data[900] = std::byte{ 3 };
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBufferDelta }), applyCollectedActions());
+        EXPECT_EQ(scene.getDataBuffer(handle).data, receiverScene.getDataBuffer(handle).data);
+
+        // partial update
+        data[512] = std::byte{ 4 };
+        scene.updateDataBuffer(handle, 512u, 256u, data.data() + 512u);
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBufferDelta }), applyCollectedActions());
+        EXPECT_EQ(scene.getDataBuffer(handle).data, receiverScene.getDataBuffer(handle).data);
+    }
+
+    TEST_F(AnActionCollectingSceneWithDeltaEncoding, sendsFullDataBufferUpdateIfMostBytesChangedOrBeyondUsedRange)
+    {
+        const auto handle = scene.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Float, 1024u, {});
+        std::vector<std::byte> data(512u, std::byte{ 1 });
+        scene.updateDataBuffer(handle, 0u, 512u, data.data());
+        applyCollectedActions();
+
+        // previous content beyond used range
+        scene.updateDataBuffer(handle, 256u, 512u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBuffer }), applyCollectedActions());
+
+        std::fill(data.begin(), data.end(), std::byte{ 2 });
+        scene.updateDataBuffer(handle, 0u, 512u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBuffer }), applyCollectedActions());
+        EXPECT_EQ(scene.getDataBuffer(handle).data, receiverScene.getDataBuffer(handle).data);
+    }
+
+    TEST_F(AnActionCollectingSceneWithDeltaEncoding, sendsDeltaOfTextureBufferRegionUpdateChangingFewTexels)
+    {
+        const auto handle = scene.allocateTextureBuffer(EPixelStorageFormat::RGBA8, { { 16u, 16u } }, {});
+        std::vector<std::byte> data(16u * 16u * 4u, std::byte{ 1 });
+        scene.updateTextureBuffer(handle, 0u, 0u, 0u, 16u, 16u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::AllocateTextureBuffer, ESceneActionId::UpdateTextureBuffer }), applyCollectedActions());
+
+        // region 8x8 at 4,4 with one changed texel
+        std::vector<std::byte> regionData(8u * 8u * 4u, std::byte{ 1 });
+        regionData[4u * (8u * 3u + 5u)] = std::byte{ 7 };
+        scene.updateTextureBuffer(handle, 0u, 4u, 4u, 8u, 8u, regionData.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateTextureBufferDelta }), applyCollectedActions());
+        EXPECT_EQ(scene.getTextureBuffer(handle).mipMaps[0].data, receiverScene.getTextureBuffer(handle).mipMaps[0].data);
+        EXPECT_EQ(std::byte{ 7 }, receiverScene.getTextureBuffer(handle).mipMaps[0].data[4u * (16u * 7u + 9u)]);
+    }
+
+    TEST_F(AnActionCollectingSceneWithDeltaEncoding, sendsFullBufferUpdatesIfDeltaEncodingDisabled)
+    {
+        scene.setBufferDeltaEncodingEnabled(false);
+        const auto dataBuffer = scene.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Float, 1024u, {});
+        const auto textureBuffer = scene.allocateTextureBuffer(EPixelStorageFormat::RGBA8, { { 16u, 16u } }, {});
+        std::vector<std::byte> data(1024u, std::byte{ 1 });
+        scene.updateDataBuffer(dataBuffer, 0u, 1024u, data.data());
+        scene.updateTextureBuffer(textureBuffer, 0u, 0u, 0u, 16u, 16u, data.data());
+        applyCollectedActions();
+
+        data[100] = std::byte{ 2 };
+        scene.updateDataBuffer(dataBuffer, 0u, 1024u, data.data());
+        scene.updateTextureBuffer(textureBuffer, 0u, 0u, 0u, 16u, 16u, data.data());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBuffer, ESceneActionId::UpdateTextureBuffer }), applyCollectedActions());
+        EXPECT_EQ(scene.getDataBuffer(dataBuffer).data, receiverScene.getDataBuffer(dataBuffer).data);
+        EXPECT_EQ(scene.getTextureBuffer(textureBuffer).mipMaps[0].data, receiverScene.getTextureBuffer(textureBuffer).mipMaps[0].data);
+    }
+
+    TEST_F(AnActionCollectingSceneWithDeltaEncoding, receiverAppliesFullAndDeltaUpdatesInSequence)
+    {
+        const auto handle = scene.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Float, 1024u, {});
+        std::vector<std::byte> data(1024u, std::byte{ 1 });
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+        applyCollectedActions();
+
+        data[10] = std::byte{ 2 };
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+        scene.setBufferDeltaEncodingEnabled(false);
+        data[20] = std::byte{ 3 };
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+        scene.setBufferDeltaEncodingEnabled(true);
+        data[30] = std::byte{ 4 };
+        scene.updateDataBuffer(handle, 0u, 1024u, data.data());
+
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::UpdateDataBufferDelta, ESceneActionId::UpdateDataBuffer, ESceneActionId::UpdateDataBufferDelta }), applyCollectedActions());
+        EXPECT_EQ(data, receiverScene.getDataBuffer(handle).data);
+    }
+}
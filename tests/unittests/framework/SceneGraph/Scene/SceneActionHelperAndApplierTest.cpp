@@ -31,6 +31,7 @@ namespace ramses::internal
         MOCK_METHOD(void , setRenderableInstanceCount, (RenderableHandle, uint32_t), (override));
         MOCK_METHOD(void , setRenderableDataInstance, (RenderableHandle, ERenderableDataSlotType, DataInstanceHandle), (override));
         MOCK_METHOD(void, setRenderableStartVertex, (RenderableHandle, uint32_t), (override));
+        MOCK_METHOD(void, setRenderableFrustumCulling, (RenderableHandle, bool), (override));
 
         MOCK_METHOD(RenderStateHandle, allocateRenderState, (RenderStateHandle), (override));
         MOCK_METHOD(void , setRenderStateBlendFactors, (RenderStateHandle, EBlendFactor, EBlendFactor, EBlendFactor, EBlendFactor), (override));
@@ -169,6 +170,20 @@ namespace ramses::internal
         SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
     }
 
+    TEST_F(ASceneActionCreatorAndApplier, CanSerializeRenderableFrustumCulling)
+    {
+        const RenderableHandle renderable(43u);
+
+        creator.setRenderableFrustumCulling(renderable, false);
+
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId::SetRenderableFrustumCulling, collection[0].type());
+
+        EXPECT_CALL(scene, setRenderableFrustumCulling(renderable, false));
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+    }
+
     TEST_F(ASceneActionCreatorAndApplier, CanSerializeCompoundState)
     {
         const RenderStateHandle state(77u);
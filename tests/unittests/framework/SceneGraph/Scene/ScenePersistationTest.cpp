@@ -9,6 +9,8 @@
 #include "gtest/gtest.h"
 #include "internal/SceneGraph/Scene/ScenePersistation.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Core/Utils/BinaryInputStream.h"
 #include "TestingScene.h"
 #include "FeatureLevelTestValues.h"
 
@@ -47,4 +49,53 @@ namespace ramses::internal
         ScenePersistation::ReadSceneFromFile("testfile", loadedScene, GetParam(), nullptr);
         testingScene.VerifyContent(loadedScene);
     }
+
+    TEST_P(AScenePersistation, marksSceneUsingFrustumCullingActionDifferentlyAndReadsItBack)
+    {
+        ClientScene scene;
+        const NodeHandle node = scene.allocateNode(0, {});
+        const RenderableHandle renderable = scene.allocateRenderable(node, {});
+
+        BinaryOutputStream defaultStream;
+        ScenePersistation::WriteSceneToStream(defaultStream, scene, GetParam());
+
+        scene.setRenderableFrustumCulling(renderable, false);
+        BinaryOutputStream cullingStream;
+        ScenePersistation::WriteSceneToStream(cullingStream, scene, GetParam());
+
+        uint32_t defaultMarker = 0u;
+        uint32_t cullingMarker = 0u;
+        BinaryInputStream defaultMarkerStream(defaultStream.getData());
+        BinaryInputStream cullingMarkerStream(cullingStream.getData());
+        defaultMarkerStream >> defaultMarker;
+        cullingMarkerStream >> cullingMarker;
+        EXPECT_EQ(0x534d4152u, defaultMarker);
+        EXPECT_EQ(0x584d4152u, cullingMarker);
+
+        Scene loadedScene;
+        BinaryInputStream inStream(cullingStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene, GetParam(), nullptr);
+        ASSERT_TRUE(loadedScene.isRenderableAllocated(renderable));
+        EXPECT_FALSE(loadedScene.getRenderable(renderable).frustumCulling);
+    }
+
+    TEST_P(AScenePersistation, marksSceneUsingStateSortedRenderPassDifferentlyAndReadsItBack)
+    {
+        ClientScene scene;
+        const RenderPassHandle renderPass = scene.allocateRenderPass(0u, {});
+        scene.setRenderPassStateSorting(renderPass, true);
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneToStream(outStream, scene, GetParam());
+
+        uint32_t marker = 0u;
+        BinaryInputStream markerStream(outStream.getData());
+        markerStream >> marker;
+        EXPECT_EQ(0x584d4152u, marker);
+
+        Scene loadedScene;
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene, GetParam(), nullptr);
+        ASSERT_TRUE(loadedScene.isRenderPassAllocated(renderPass));
+        EXPECT_TRUE(loadedScene.getRenderPass(renderPass).stateSorting);
+    }
 }
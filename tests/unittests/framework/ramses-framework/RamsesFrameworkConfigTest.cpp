@@ -172,6 +172,44 @@ namespace ramses::internal
         EXPECT_TRUE(frameworkConfig.impl().m_periodicLogsEnabled);
     }
 
+    TEST_F(ARamsesFrameworkConfig, CanSetTransmissionBandwidthLimit)
+    {
+        EXPECT_EQ(TransmissionBandwidthLimits({ 0u, 0u, 0u }), frameworkConfig.impl().m_tcpConfig.getBandwidthLimits());
+        frameworkConfig.setTransmissionBandwidthLimit(ETransmissionPriority::Low, 1000000u);
+        EXPECT_EQ(TransmissionBandwidthLimits({ 0u, 0u, 1000000u }), frameworkConfig.impl().m_tcpConfig.getBandwidthLimits());
+        frameworkConfig.setTransmissionBandwidthLimit(ETransmissionPriority::Low, 0u);
+        EXPECT_EQ(TransmissionBandwidthLimits({ 0u, 0u, 0u }), frameworkConfig.impl().m_tcpConfig.getBandwidthLimits());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetConnectionThreadCount)
+    {
+        EXPECT_EQ(1u, frameworkConfig.impl().m_tcpConfig.getThreadCount());
+        EXPECT_TRUE(frameworkConfig.setConnectionThreadCount(4u));
+        EXPECT_EQ(4u, frameworkConfig.impl().m_tcpConfig.getThreadCount());
+        EXPECT_FALSE(frameworkConfig.setConnectionThreadCount(0u));
+        EXPECT_EQ(4u, frameworkConfig.impl().m_tcpConfig.getThreadCount());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetUnixSocketDirectory)
+    {
+        EXPECT_TRUE(frameworkConfig.impl().m_tcpConfig.getUnixSocketDirectory().empty());
+        EXPECT_TRUE(frameworkConfig.setUnixSocketDirectoryForTCPCommunication("/tmp/ramses"));
+        EXPECT_EQ("/tmp/ramses", frameworkConfig.impl().m_tcpConfig.getUnixSocketDirectory());
+        EXPECT_FALSE(frameworkConfig.setUnixSocketDirectoryForTCPCommunication(std::string(81u, 'x')));
+        EXPECT_EQ("/tmp/ramses", frameworkConfig.impl().m_tcpConfig.getUnixSocketDirectory());
+        EXPECT_TRUE(frameworkConfig.setUnixSocketDirectoryForTCPCommunication(""));
+        EXPECT_TRUE(frameworkConfig.impl().m_tcpConfig.getUnixSocketDirectory().empty());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetFlushTraceFile)
+    {
+        EXPECT_TRUE(frameworkConfig.impl().getFlushTraceFile().empty());
+        frameworkConfig.setFlushTraceFile("/tmp/flushes.json");
+        EXPECT_EQ("/tmp/flushes.json", frameworkConfig.impl().getFlushTraceFile());
+        frameworkConfig.setFlushTraceFile("");
+        EXPECT_TRUE(frameworkConfig.impl().getFlushTraceFile().empty());
+    }
+
     TEST_F(ARamsesFrameworkConfig, CanSetInterfaceSelectionSocket)
     {
         EXPECT_EQ(frameworkConfig.impl().m_tcpConfig.getIPAddress(), "127.0.0.1");
@@ -199,6 +237,13 @@ namespace ramses::internal
         EXPECT_EQ(EConnectionProtocol::Off, frameworkConfig.impl().getUsedProtocol());
         EXPECT_TRUE(frameworkConfig.setConnectionSystem(EConnectionSystem::TCP));
         EXPECT_EQ(EConnectionProtocol::TCP, frameworkConfig.impl().getUsedProtocol());
+#if defined(HAS_SHM_COMM)
+        EXPECT_TRUE(frameworkConfig.setConnectionSystem(EConnectionSystem::SharedMemory));
+        EXPECT_EQ(EConnectionProtocol::SharedMemory, frameworkConfig.impl().getUsedProtocol());
+#else
+        EXPECT_FALSE(frameworkConfig.setConnectionSystem(EConnectionSystem::SharedMemory));
+        EXPECT_EQ(EConnectionProtocol::TCP, frameworkConfig.impl().getUsedProtocol());
+#endif
     }
 
     TEST_F(ARamsesFrameworkConfig, CanSetTCPKeepAlive)
@@ -61,6 +61,10 @@ namespace ramses::internal
         EXPECT_EQ(EConnectionProtocol::Off, config.impl().getUsedProtocol());
         cli.parse(std::vector<std::string>{"--connection=tcp"});
         EXPECT_EQ(EConnectionProtocol::TCP, config.impl().getUsedProtocol());
+#if defined(HAS_SHM_COMM)
+        cli.parse(std::vector<std::string>{"--connection=shm"});
+        EXPECT_EQ(EConnectionProtocol::SharedMemory, config.impl().getUsedProtocol());
+#endif
     }
 
     TEST_F(ARamsesFrameworkConfig, cliRamsh)
@@ -377,6 +377,18 @@ namespace ramses::internal
         EXPECT_FALSE(config.impl().getInternalDisplayConfig().isAsyncEffectUploadEnabled());
     }
 
+    TEST_F(ADisplayConfig, setAutoInstancingEnabled)
+    {
+        EXPECT_TRUE(config.setAutoInstancingEnabled(true));
+        EXPECT_TRUE(config.impl().getInternalDisplayConfig().isAutoInstancingEnabled());
+    }
+
+    TEST_F(ADisplayConfig, setRenderPreparationThreadCount)
+    {
+        EXPECT_TRUE(config.setRenderPreparationThreadCount(3u));
+        EXPECT_EQ(3u, config.impl().getInternalDisplayConfig().getRenderPreparationThreadCount());
+    }
+
     TEST_F(ADisplayConfig, canSetEmbeddedCompositingSocketGroup)
     {
         config.setWaylandEmbeddedCompositingSocketGroup("permissionGroup");
@@ -0,0 +1,229 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AutoInstancing.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AAutoInstancing : public ::testing::Test
+    {
+    protected:
+        static std::optional<std::string> CreateInstancedVertexShader(const std::string& vertexShader, const std::string& fragmentShader, EffectInputInformationVector uniformInputs)
+        {
+            const EffectResource effect(vertexShader, fragmentShader, "", {}, {}, std::move(uniformInputs), EffectInputInformationVector(), "effect", EFeatureLevel_Latest);
+            return AutoInstancing::CreateInstancedVertexShader(effect);
+        }
+
+        const std::string fragmentShader = "#version 300 es\nout lowp vec4 color;\nvoid main() { color = vec4(1.0); }\n";
+        const EffectInputInformationVector mvpInput{ EffectInputInformation("u_mvp", 1, EDataType::Matrix44F, EFixedSemantics::ModelViewProjectionMatrix) };
+    };
+
+    TEST_F(AAutoInstancing, treatsOnlyModelDependentSemanticsAsPerInstance)
+    {
+        EXPECT_TRUE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ModelMatrix));
+        EXPECT_TRUE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ModelViewMatrix));
+        EXPECT_TRUE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ModelViewMatrix33));
+        EXPECT_TRUE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ModelViewProjectionMatrix));
+        EXPECT_TRUE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::NormalMatrix));
+
+        EXPECT_FALSE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::Invalid));
+        EXPECT_FALSE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ViewMatrix));
+        EXPECT_FALSE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ProjectionMatrix));
+        EXPECT_FALSE(AutoInstancing::IsPerInstanceSemantic(EFixedSemantics::ModelBlock));
+    }
+
+    TEST_F(AAutoInstancing, declaresPerInstanceUniformsAsInputsKeepingPrecision)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "in vec3 a_position;\n"
+            "uniform highp mat4 u_mvp;\n"
+            "  uniform mat3 u_normal ;\n"
+            "uniform vec4 u_color;\n"
+            "void main() { gl_Position = u_mvp * vec4(u_normal * a_position, 1.0) + u_color; }\n";
+        const EffectInputInformationVector uniformInputs{
+            mvpInput[0],
+            EffectInputInformation("u_normal", 1, EDataType::Matrix33F, EFixedSemantics::ModelViewMatrix33),
+            EffectInputInformation("u_color", 1, EDataType::Vector4F, EFixedSemantics::Invalid) };
+
+        const auto instancedVertexShader = CreateInstancedVertexShader(vertexShader, fragmentShader, uniformInputs);
+        ASSERT_TRUE(instancedVertexShader);
+        EXPECT_EQ(
+            "#version 300 es\n"
+            "in vec3 a_position;\n"
+            "in highp mat4 u_mvp;\n"
+            "  in mat3 u_normal ;\n"
+            "uniform vec4 u_color;\n"
+            "void main() { gl_Position = u_mvp * vec4(u_normal * a_position, 1.0) + u_color; }\n",
+            *instancedVertexShader);
+    }
+
+    TEST_F(AAutoInstancing, declaresPerInstanceUniformsAsAttributesInShadersBeforeVersion130)
+    {
+        const std::string vertexShader =
+            "attribute vec3 a_position;\n"
+            "uniform mat4 u_mvp;\n"
+            "void main() { gl_Position = u_mvp * vec4(a_position, 1.0); }\n";
+        const auto instancedVertexShader = CreateInstancedVertexShader(vertexShader, "void main() { gl_FragColor = vec4(1.0); }\n", mvpInput);
+        ASSERT_TRUE(instancedVertexShader);
+        EXPECT_EQ(
+            "attribute vec3 a_position;\n"
+            "attribute mat4 u_mvp;\n"
+            "void main() { gl_Position = u_mvp * vec4(a_position, 1.0); }\n",
+            *instancedVertexShader);
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectWithoutPerInstanceUniform)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform mat4 u_view;\n"
+            "void main() { gl_Position = u_view * vec4(1.0); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, { EffectInputInformation("u_view", 1, EDataType::Matrix44F, EFixedSemantics::ViewMatrix) }));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectUsingPerInstanceUniformInFragmentShader)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp;\n"
+            "void main() { gl_Position = u_mvp * vec4(1.0); }\n";
+        const std::string fragmentShaderUsingMvp =
+            "#version 300 es\n"
+            "uniform highp mat4 u_mvp;\n"
+            "out lowp vec4 color;\n"
+            "void main() { color = u_mvp[0]; }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShaderUsingMvp, mvpInput));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectUsingInstanceID)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp;\n"
+            "void main() { gl_Position = u_mvp * vec4(float(gl_InstanceID)); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, mvpInput));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectWithModelUniformBlock)
+    {
+        const std::string vertexShader =
+            "#version 310 es\n"
+            "uniform mat4 u_mvp;\n"
+            "layout(std140, binding=1) uniform modelBlock { mat4 u_model; };\n"
+            "void main() { gl_Position = u_mvp * u_model * vec4(1.0); }\n";
+        EffectInputInformationVector uniformInputs = mvpInput;
+        uniformInputs.emplace_back("modelBlock", 1, EDataType::UniformBuffer, EFixedSemantics::ModelBlock, UniformBufferBinding{ 1u }, UniformBufferElementSize{ 64u }, UniformBufferFieldOffset{});
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, uniformInputs));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectWithPerInstanceUniformArray)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp[2];\n"
+            "void main() { gl_Position = u_mvp[1] * vec4(1.0); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, { EffectInputInformation("u_mvp", 2, EDataType::Matrix44F, EFixedSemantics::ModelViewProjectionMatrix) }));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectDeclaringPerInstanceUniformTogetherWithOthers)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform vec4 u_color; uniform mat4 u_mvp;\n"
+            "void main() { gl_Position = u_mvp * u_color; }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, mvpInput));
+
+        const std::string vertexShaderWithDeclarationAfter =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp; uniform vec4 u_color;\n"
+            "void main() { gl_Position = u_mvp * u_color; }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderWithDeclarationAfter, fragmentShader, mvpInput));
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectDeclaringSeveralMatricesInOneDeclaration)
+    {
+        const EffectInputInformationVector uniformInputs{
+            mvpInput[0],
+            EffectInputInformation("u_model", 1, EDataType::Matrix44F, EFixedSemantics::ModelMatrix) };
+
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp, u_model;\n"
+            "void main() { gl_Position = u_mvp * u_model[0]; }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShader, fragmentShader, uniformInputs));
+
+        const std::string vertexShaderMvpLast =
+            "#version 300 es\n"
+            "uniform highp mat4 u_model, u_mvp;\n"
+            "void main() { gl_Position = u_mvp * u_model[0]; }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderMvpLast, fragmentShader, uniformInputs));
+    }
+
+    TEST_F(AAutoInstancing, keepsUsagesOfPerInstanceUniformInExpressionsUnchanged)
+    {
+        const std::string vertexShader =
+            "#version 300 es\n"
+            "in vec3 a_position;\n"
+            "uniform mat4 u_mvp; // model view projection\n"
+            "vec4 transform(mat4 m, vec3 p) { return m * vec4(p, 1.0); }\n"
+            "void main() {\n"
+            "    mat4 mvpT = transpose(u_mvp);\n"
+            "    gl_Position = transform(u_mvp, a_position) + u_mvp[3] * mvpT[0].x + (u_mvp*u_mvp)[0];\n"
+            "}\n";
+
+        const auto instancedVertexShader = CreateInstancedVertexShader(vertexShader, fragmentShader, mvpInput);
+        ASSERT_TRUE(instancedVertexShader);
+        EXPECT_EQ(
+            "#version 300 es\n"
+            "in vec3 a_position;\n"
+            "in mat4 u_mvp; // model view projection\n"
+            "vec4 transform(mat4 m, vec3 p) { return m * vec4(p, 1.0); }\n"
+            "void main() {\n"
+            "    mat4 mvpT = transpose(u_mvp);\n"
+            "    gl_Position = transform(u_mvp, a_position) + u_mvp[3] * mvpT[0].x + (u_mvp*u_mvp)[0];\n"
+            "}\n",
+            *instancedVertexShader);
+    }
+
+    TEST_F(AAutoInstancing, cannotInstanceEffectUsingPerInstanceUniformInMacros)
+    {
+        const std::string vertexShaderWithMacroAlias =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp;\n"
+            "#define MVP u_mvp\n"
+            "void main() { gl_Position = MVP * vec4(1.0); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderWithMacroAlias, fragmentShader, mvpInput));
+
+        const std::string vertexShaderWithMacroDeclaration =
+            "#version 300 es\n"
+            "#define DECLARE_MATRIX(name) \\\n"
+            "    uniform mat4 name;\n"
+            "DECLARE_MATRIX(u_mvp)\n"
+            "void main() { gl_Position = u_mvp * vec4(1.0); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderWithMacroDeclaration, fragmentShader, mvpInput));
+
+        const std::string vertexShaderWithMultilineMacro =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp;\n"
+            "#define TRANSFORM(p) \\\n"
+            "    (u_mvp * (p))\n"
+            "void main() { gl_Position = TRANSFORM(vec4(1.0)); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderWithMultilineMacro, fragmentShader, mvpInput));
+
+        const std::string vertexShaderWithCondition =
+            "#version 300 es\n"
+            "uniform mat4 u_mvp;\n"
+            "#if defined(u_mvp)\n"
+            "#endif\n"
+            "void main() { gl_Position = u_mvp * vec4(1.0); }\n";
+        EXPECT_FALSE(CreateInstancedVertexShader(vertexShaderWithCondition, fragmentShader, mvpInput));
+    }
+}
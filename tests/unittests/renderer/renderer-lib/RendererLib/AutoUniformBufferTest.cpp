@@ -0,0 +1,229 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AutoUniformBuffer.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstring>
+
+namespace ramses::internal
+{
+    class AAutoUniformBuffer : public ::testing::Test
+    {
+    protected:
+        static EffectResource CreateEffect(const std::string& vertexShader, const std::string& fragmentShader, EffectInputInformationVector uniformInputs)
+        {
+            return EffectResource(vertexShader, fragmentShader, "", {}, {}, std::move(uniformInputs), EffectInputInformationVector(), "effect", EFeatureLevel_Latest);
+        }
+
+        const std::string vertexShader =
+            "#version 310 es\n"
+            "uniform highp mat4 u_mvp;\n"
+            "uniform vec3 u_offset;\n"
+            "uniform float u_scale;\n"
+            "void main() { gl_Position = u_mvp * vec4(u_offset * u_scale, 1.0); }\n";
+        const std::string fragmentShader =
+            "#version 310 es\n"
+            "precision mediump float;\n"
+            "uniform vec4 u_color;\n"
+            "uniform float u_scale;\n"
+            "uniform sampler2D u_texture;\n"
+            "out vec4 color;\n"
+            "void main() { color = u_color * u_scale * texture(u_texture, vec2(0.0)); }\n";
+        const EffectInputInformationVector uniformInputs{
+            EffectInputInformation("u_mvp", 1, EDataType::Matrix44F, EFixedSemantics::ModelViewProjectionMatrix),
+            EffectInputInformation("u_offset", 1, EDataType::Vector3F, EFixedSemantics::Invalid),
+            EffectInputInformation("u_scale", 1, EDataType::Float, EFixedSemantics::Invalid),
+            EffectInputInformation("u_color", 1, EDataType::Vector4F, EFixedSemantics::Invalid),
+            EffectInputInformation("u_texture", 1, EDataType::TextureSampler2D, EFixedSemantics::Invalid) };
+    };
+
+    TEST_F(AAutoUniformBuffer, packsNonSemanticUniformsInStd140Layout)
+    {
+        const auto layout = AutoUniformBuffer::CreateLayout(CreateEffect(vertexShader, fragmentShader, uniformInputs));
+        ASSERT_TRUE(layout);
+        EXPECT_EQ(UniformBufferBinding{ 0u }, layout->binding);
+        ASSERT_EQ(5u, layout->fields.size());
+        EXPECT_FALSE(layout->fields[0]);
+        ASSERT_TRUE(layout->fields[1]);
+        ASSERT_TRUE(layout->fields[2]);
+        ASSERT_TRUE(layout->fields[3]);
+        EXPECT_FALSE(layout->fields[4]);
+
+        // float fits into padding after vec3, vec4 needs its own alignment
+        EXPECT_EQ(0u, layout->fields[1]->offset);
+        EXPECT_EQ(12u, layout->fields[2]->offset);
+        EXPECT_EQ(16u, layout->fields[3]->offset);
+        EXPECT_EQ(32u, layout->size);
+    }
+
+    TEST_F(AAutoUniformBuffer, alignsArrayElementsAndMatrixColumnsToVec4)
+    {
+        const std::string shader =
+            "#version 310 es\n"
+            "uniform float u_weights[3];\n"
+            "uniform mat3 u_rotation;\n"
+            "uniform vec2 u_uv;\n"
+            "uniform bool u_flag;\n"
+            "void main() { gl_Position = vec4(u_rotation * vec3(u_uv, u_weights[2]), u_flag ? 1.0 : 0.0); }\n";
+        const auto layout = AutoUniformBuffer::CreateLayout(CreateEffect(shader, fragmentShader, {
+            EffectInputInformation("u_weights", 3, EDataType::Float, EFixedSemantics::Invalid),
+            EffectInputInformation("u_rotation", 1, EDataType::Matrix33F, EFixedSemantics::Invalid),
+            EffectInputInformation("u_uv", 1, EDataType::Vector2F, EFixedSemantics::Invalid),
+            EffectInputInformation("u_flag", 1, EDataType::Bool, EFixedSemantics::Invalid) }));
+        ASSERT_TRUE(layout);
+        ASSERT_EQ(4u, layout->fields.size());
+
+        EXPECT_EQ(0u, layout->fields[0]->offset);
+        EXPECT_EQ(16u, layout->fields[0]->elementStride);
+        EXPECT_EQ(48u, layout->fields[1]->offset);
+        EXPECT_EQ(96u, layout->fields[2]->offset);
+        EXPECT_EQ(104u, layout->fields[3]->offset);
+        EXPECT_EQ(112u, layout->size);
+    }
+
+    TEST_F(AAutoUniformBuffer, usesBindingAfterUniformBuffersOfEffect)
+    {
+        EffectInputInformationVector inputs = uniformInputs;
+        inputs.emplace_back("modelBlock", 1, EDataType::UniformBuffer, EFixedSemantics::ModelBlock, UniformBufferBinding{ 3u }, UniformBufferElementSize{ 64u }, UniformBufferFieldOffset{});
+        inputs.emplace_back("modelBlock.u_model", 1, EDataType::Matrix44F, EFixedSemantics::ModelBlock, UniformBufferBinding{ 3u }, UniformBufferElementSize{ 64u }, UniformBufferFieldOffset{ 0u });
+
+        const auto layout = AutoUniformBuffer::CreateLayout(CreateEffect(vertexShader, fragmentShader, inputs));
+        ASSERT_TRUE(layout);
+        EXPECT_EQ(UniformBufferBinding{ 4u }, layout->binding);
+        // uniform buffer fields have no uniform location, they are not listed
+        EXPECT_EQ(6u, layout->fields.size());
+    }
+
+    TEST_F(AAutoUniformBuffer, cannotPackUniformsOfShadersWithoutExplicitBlockBinding)
+    {
+        const std::string shader300 = "#version 300 es\nuniform vec3 u_offset;\nuniform float u_scale;\nvoid main() { gl_Position = vec4(u_offset, u_scale); }\n";
+        EXPECT_FALSE(AutoUniformBuffer::CreateLayout(CreateEffect(shader300, fragmentShader, uniformInputs)));
+
+        const std::string shader410 = "#version 410\nuniform vec3 u_offset;\nuniform float u_scale;\nvoid main() { gl_Position = vec4(u_offset, u_scale); }\n";
+        EXPECT_FALSE(AutoUniformBuffer::CreateLayout(CreateEffect(shader410, fragmentShader, uniformInputs)));
+
+        const std::string shader420 = "#version 420\nuniform vec3 u_offset;\nuniform float u_scale;\nvoid main() { gl_Position = vec4(u_offset, u_scale); }\n";
+        EXPECT_TRUE(AutoUniformBuffer::CreateLayout(CreateEffect(shader420, fragmentShader, uniformInputs)));
+    }
+
+    TEST_F(AAutoUniformBuffer, doesNotPackSingleUniform)
+    {
+        EXPECT_FALSE(AutoUniformBuffer::CreateLayout(CreateEffect(vertexShader, fragmentShader, {
+            EffectInputInformation("u_mvp", 1, EDataType::Matrix44F, EFixedSemantics::ModelViewProjectionMatrix),
+            EffectInputInformation("u_scale", 1, EDataType::Float, EFixedSemantics::Invalid) })));
+    }
+
+    TEST_F(AAutoUniformBuffer, replacesDeclarationsWithBlockInStagesUsingPackedUniforms)
+    {
+        const auto effect = CreateEffect(vertexShader, fragmentShader, uniformInputs);
+        const auto layout = AutoUniformBuffer::CreateLayout(effect);
+        ASSERT_TRUE(layout);
+        const auto packedEffect = AutoUniformBuffer::CreatePackedEffect(effect, *layout);
+        ASSERT_TRUE(packedEffect);
+
+        const std::string block =
+            "layout(std140, binding = 0) uniform ramses_autoUniforms\n"
+            "{\n"
+            "    highp vec3 u_offset;\n"
+            "    highp float u_scale;\n"
+            "    highp vec4 u_color;\n"
+            "};\n";
+        EXPECT_EQ(
+            "#version 310 es\n" + block +
+            "uniform highp mat4 u_mvp;\n"
+            "\n"
+            "\n"
+            "void main() { gl_Position = u_mvp * vec4(u_offset * u_scale, 1.0); }\n",
+            std::string(packedEffect->getVertexShader()));
+        EXPECT_EQ(
+            "#version 310 es\n" + block +
+            "precision mediump float;\n"
+            "\n"
+            "\n"
+            "uniform sampler2D u_texture;\n"
+            "out vec4 color;\n"
+            "void main() { color = u_color * u_scale * texture(u_texture, vec2(0.0)); }\n",
+            std::string(packedEffect->getFragmentShader()));
+        EXPECT_EQ(effect.getUniformInputs(), packedEffect->getUniformInputs());
+    }
+
+    TEST_F(AAutoUniformBuffer, insertsBlockAfterExtensionDirectives)
+    {
+        const std::string shader =
+            "#version 310 es\n"
+            "#extension GL_OES_EGL_image_external_essl3 : require\n"
+            "uniform vec3 u_offset;\n"
+            "uniform float u_scale;\n"
+            "void main() { gl_Position = vec4(u_offset, u_scale); }\n";
+        const auto effect = CreateEffect(shader, fragmentShader, uniformInputs);
+        const auto packedEffect = AutoUniformBuffer::CreatePackedEffect(effect, *AutoUniformBuffer::CreateLayout(effect));
+        ASSERT_TRUE(packedEffect);
+        EXPECT_EQ(0u, std::string(packedEffect->getVertexShader()).find("#version 310 es\n#extension GL_OES_EGL_image_external_essl3 : require\nlayout(std140"));
+    }
+
+    TEST_F(AAutoUniformBuffer, cannotPackUniformDeclaredTogetherWithOthers)
+    {
+        const std::string shader =
+            "#version 310 es\n"
+            "uniform vec3 u_offset; uniform float u_scale;\n"
+            "void main() { gl_Position = vec4(u_offset, u_scale); }\n";
+        const auto effect = CreateEffect(shader, fragmentShader, uniformInputs);
+        EXPECT_FALSE(AutoUniformBuffer::CreatePackedEffect(effect, *AutoUniformBuffer::CreateLayout(effect)));
+    }
+
+    TEST_F(AAutoUniformBuffer, cannotPackUniformWithUnrecognizedDeclaration)
+    {
+        const std::string shader =
+            "#version 310 es\n"
+            "uniform vec3 u_offset;\n"
+            "uniform float u_scale;\n"
+            "#define u_color vec4(1.0)\n"
+            "void main() { gl_Position = vec4(u_offset, u_scale) * u_color; }\n";
+        const auto effect = CreateEffect(shader, fragmentShader, uniformInputs);
+        EXPECT_FALSE(AutoUniformBuffer::CreatePackedEffect(effect, *AutoUniformBuffer::CreateLayout(effect)));
+    }
+
+    TEST_F(AAutoUniformBuffer, writesValuesWithStd140Padding)
+    {
+        AutoUniformBuffer::Field field;
+        field.offset = 16u;
+        field.elementCount = 2u;
+        field.elementStride = 16u;
+
+        std::array<std::byte, 64u> data{};
+        const std::array<float, 2> values{ 1.f, 2.f };
+        EXPECT_TRUE(AutoUniformBuffer::WriteValues(data.data(), field, 2u, values.data()));
+        EXPECT_FALSE(AutoUniformBuffer::WriteValues(data.data(), field, 2u, values.data()));
+
+        float value = 0.f;
+        std::memcpy(&value, data.data() + 16u, sizeof(float));
+        EXPECT_EQ(1.f, value);
+        std::memcpy(&value, data.data() + 32u, sizeof(float));
+        EXPECT_EQ(2.f, value);
+    }
+
+    TEST_F(AAutoUniformBuffer, writesMatrixColumnsAndBoolsAsStd140)
+    {
+        std::array<std::byte, 64u> data{};
+        const glm::mat3 matrix{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+        EXPECT_TRUE(AutoUniformBuffer::WriteValues(data.data(), { 0u, 1u, 48u }, 1u, &matrix));
+
+        std::array<float, 3> column{};
+        std::memcpy(column.data(), data.data() + 32u, sizeof(column));
+        EXPECT_EQ((std::array<float, 3>{ 7.f, 8.f, 9.f }), column);
+
+        const bool flag = true;
+        EXPECT_TRUE(AutoUniformBuffer::WriteValues(data.data(), { 48u, 1u, 4u }, 1u, &flag));
+        int32_t flagValue = 0;
+        std::memcpy(&flagValue, data.data() + 48u, sizeof(int32_t));
+        EXPECT_EQ(1, flagValue);
+    }
+}
@@ -34,6 +34,8 @@ namespace ramses::internal
         EXPECT_EQ("", m_config.getWaylandDisplay());
         EXPECT_EQ(ramses::EDepthBufferType::DepthStencil, m_config.getDepthStencilBufferType());
         EXPECT_TRUE(m_config.isAsyncEffectUploadEnabled());
+        EXPECT_FALSE(m_config.isAutoInstancingEnabled());
+        EXPECT_EQ(0u, m_config.getRenderPreparationThreadCount());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbedded());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbeddedGroup());
         EXPECT_EQ(-1, m_config.getWaylandSocketEmbeddedFD());
@@ -95,6 +97,12 @@ namespace ramses::internal
         m_config.setAsyncEffectUploadEnabled(false);
         EXPECT_FALSE(m_config.isAsyncEffectUploadEnabled());
 
+        m_config.setAutoInstancingEnabled(true);
+        EXPECT_TRUE(m_config.isAutoInstancingEnabled());
+
+        m_config.setRenderPreparationThreadCount(2u);
+        EXPECT_EQ(2u, m_config.getRenderPreparationThreadCount());
+
         m_config.setWaylandEmbeddedCompositingSocketName("wayland-11");
         EXPECT_EQ(std::string("wayland-11"), m_config.getWaylandSocketEmbedded());
 
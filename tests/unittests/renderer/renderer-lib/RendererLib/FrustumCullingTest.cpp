@@ -0,0 +1,128 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FrustumCulling.h"
+#include "gmock/gmock.h"
+#include "glm/gtx/transform.hpp"
+#include <vector>
+
+namespace ramses::internal
+{
+    class AFrustumCulling : public ::testing::Test
+    {
+    protected:
+        static std::optional<BoundingSphere> ComputeSphere(EDataType type, const std::vector<float>& data, uint32_t elementCount)
+        {
+            return FrustumCulling::ComputeBoundingSphere(type, reinterpret_cast<const std::byte*>(data.data()), elementCount);
+        }
+
+        // camera at origin looking down negative z, near 1, far 100
+        const FrustumCulling::FrustumPlanes frustumPlanes = FrustumCulling::ExtractFrustumPlanes(glm::perspective(glm::radians(90.f), 1.f, 1.f, 100.f));
+    };
+
+    TEST_F(AFrustumCulling, computesBoundingSphereOfVec3Data)
+    {
+        const std::vector<float> data{ -1.f, 0.f, 0.f,  3.f, 0.f, 0.f,  1.f, 2.f, 0.f,  1.f, -2.f, 0.f };
+        const auto sphere = ComputeSphere(EDataType::Vector3F, data, 4u);
+        ASSERT_TRUE(sphere);
+        EXPECT_FLOAT_EQ(1.f, sphere->center.x);
+        EXPECT_FLOAT_EQ(0.f, sphere->center.y);
+        EXPECT_FLOAT_EQ(0.f, sphere->center.z);
+        EXPECT_FLOAT_EQ(2.f, sphere->radius);
+    }
+
+    TEST_F(AFrustumCulling, computesBoundingSphereOfVec4DataWithWEqualToOne)
+    {
+        const std::vector<float> data{ 0.f, 0.f, 0.f, 1.f,  0.f, 0.f, 6.f, 1.f };
+        const auto sphere = ComputeSphere(EDataType::Vector4F, data, 2u);
+        ASSERT_TRUE(sphere);
+        EXPECT_EQ(glm::vec3(0.f, 0.f, 3.f), sphere->center);
+        EXPECT_FLOAT_EQ(3.f, sphere->radius);
+    }
+
+    TEST_F(AFrustumCulling, doesNotComputeBoundingSphereOfVec4DataWithOtherW)
+    {
+        // shader would divide by w, sphere of xyz could be far off
+        const std::vector<float> data{ 0.f, 0.f, 0.f, 1.f,  0.f, 0.f, 6.f, 2.f };
+        EXPECT_FALSE(ComputeSphere(EDataType::Vector4F, data, 2u));
+
+        // may not be a position at all, e.g. colors
+        const std::vector<float> colors{ 1.f, 0.f, 0.f, 0.5f };
+        EXPECT_FALSE(ComputeSphere(EDataType::Vector4F, colors, 1u));
+    }
+
+    TEST_F(AFrustumCulling, doesNotComputeBoundingSphereOfVec2Data)
+    {
+        // z of position is up to shader
+        const std::vector<float> data{ 0.f, 0.f,  0.f, 4.f };
+        EXPECT_FALSE(ComputeSphere(EDataType::Vector2F, data, 2u));
+    }
+
+    TEST_F(AFrustumCulling, doesNotComputeBoundingSphereOfUnsupportedOrEmptyData)
+    {
+        const std::vector<float> data{ 1.f, 2.f, 3.f };
+        EXPECT_FALSE(ComputeSphere(EDataType::Float, data, 3u));
+        EXPECT_FALSE(ComputeSphere(EDataType::Vector3I, data, 1u));
+        EXPECT_FALSE(ComputeSphere(EDataType::Vector3F, data, 0u));
+        EXPECT_FALSE(FrustumCulling::ComputeBoundingSphere(EDataType::Vector3F, nullptr, 1u));
+    }
+
+    TEST_F(AFrustumCulling, mergesBoundingSpheres)
+    {
+        const BoundingSphere s1{ glm::vec3{ 0.f }, 1.f };
+        const BoundingSphere s2{ glm::vec3{ 4.f, 0.f, 0.f }, 1.f };
+        const BoundingSphere merged = FrustumCulling::MergeBoundingSpheres(s1, s2);
+        EXPECT_FLOAT_EQ(2.f, merged.center.x);
+        EXPECT_FLOAT_EQ(0.f, merged.center.y);
+        EXPECT_FLOAT_EQ(0.f, merged.center.z);
+        EXPECT_FLOAT_EQ(3.f, merged.radius);
+
+        // contained spheres
+        const BoundingSphere inner{ glm::vec3{ 0.5f, 0.f, 0.f }, 0.2f };
+        EXPECT_EQ(s1, FrustumCulling::MergeBoundingSpheres(s1, inner));
+        EXPECT_EQ(s1, FrustumCulling::MergeBoundingSpheres(inner, s1));
+        EXPECT_EQ(s1, FrustumCulling::MergeBoundingSpheres(s1, s1));
+    }
+
+    TEST_F(AFrustumCulling, transformsBoundingSphereUsingLargestScale)
+    {
+        const BoundingSphere sphere{ glm::vec3{ 1.f, 0.f, 0.f }, 1.f };
+        const glm::mat4 model = glm::translate(glm::vec3{ 0.f, 10.f, 0.f }) * glm::scale(glm::vec3{ 2.f, 3.f, 0.5f });
+        const BoundingSphere transformed = FrustumCulling::TransformBoundingSphere(sphere, model);
+        EXPECT_FLOAT_EQ(2.f, transformed.center.x);
+        EXPECT_FLOAT_EQ(10.f, transformed.center.y);
+        EXPECT_FLOAT_EQ(0.f, transformed.center.z);
+        EXPECT_FLOAT_EQ(3.f, transformed.radius);
+    }
+
+    TEST_F(AFrustumCulling, keepsSpheresInsideOrIntersectingFrustum)
+    {
+        EXPECT_FALSE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, -10.f }, 1.f }, frustumPlanes));
+        // center outside of near plane but sphere intersects it
+        EXPECT_FALSE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, 0.f }, 1.5f }, frustumPlanes));
+        // center right of frustum but sphere intersects it
+        EXPECT_FALSE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 11.f, 0.f, -10.f }, 2.f }, frustumPlanes));
+        // sphere enclosing whole frustum
+        EXPECT_FALSE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, -50.f }, 1000.f }, frustumPlanes));
+    }
+
+    TEST_F(AFrustumCulling, cullsSpheresOutsideOfFrustum)
+    {
+        // behind camera
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, 10.f }, 1.f }, frustumPlanes));
+        // in front of near plane
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, -0.5f }, 0.4f }, frustumPlanes));
+        // beyond far plane
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 0.f, -110.f }, 5.f }, frustumPlanes));
+        // left, right, top, bottom
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ -20.f, 0.f, -10.f }, 1.f }, frustumPlanes));
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 20.f, 0.f, -10.f }, 1.f }, frustumPlanes));
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, 20.f, -10.f }, 1.f }, frustumPlanes));
+        EXPECT_TRUE(FrustumCulling::IsOutsideOfFrustum({ glm::vec3{ 0.f, -20.f, -10.f }, 1.f }, frustumPlanes));
+    }
+}
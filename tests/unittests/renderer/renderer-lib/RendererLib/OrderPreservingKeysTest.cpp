@@ -0,0 +1,111 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/OrderPreservingKeys.h"
+#include "gmock/gmock.h"
+#include <algorithm>
+#include <random>
+
+namespace ramses::internal
+{
+    class AnOrderPreservingKeys : public ::testing::Test
+    {
+    protected:
+        void expectKeysOrderedLikeValues(const std::vector<int>& values) const
+        {
+            for (size_t i = 1u; i < values.size(); ++i)
+            {
+                if (values[i - 1u] < values[i])
+                    EXPECT_LT(keys.getKey(values[i - 1u]), keys.getKey(values[i]));
+                else if (values[i - 1u] == values[i])
+                    EXPECT_EQ(keys.getKey(values[i - 1u]), keys.getKey(values[i]));
+                else
+                    EXPECT_GT(keys.getKey(values[i - 1u]), keys.getKey(values[i]));
+            }
+        }
+
+        OrderPreservingKeys<int> keys;
+    };
+
+    TEST_F(AnOrderPreservingKeys, assignsOrderedKeysToValues)
+    {
+        keys.reset({ 30, 10, 20, 10 });
+        EXPECT_EQ(3u, keys.size());
+        expectKeysOrderedLikeValues({ 10, 20, 30 });
+    }
+
+    TEST_F(AnOrderPreservingKeys, keepsKeysOfOtherValuesWhenValueAddedBetweenThem)
+    {
+        keys.reset({ 10, 20, 30 });
+        const uint32_t key10 = keys.getKey(10);
+        const uint32_t key20 = keys.getKey(20);
+        const uint32_t key30 = keys.getKey(30);
+
+        EXPECT_FALSE(keys.add(15));
+        EXPECT_FALSE(keys.add(5));
+        EXPECT_FALSE(keys.add(35));
+        expectKeysOrderedLikeValues({ 5, 10, 15, 20, 30, 35 });
+        EXPECT_EQ(key10, keys.getKey(10));
+        EXPECT_EQ(key20, keys.getKey(20));
+        EXPECT_EQ(key30, keys.getKey(30));
+    }
+
+    TEST_F(AnOrderPreservingKeys, keepsValueUntilAllReferencesRemoved)
+    {
+        keys.reset({ 10, 20 });
+        const uint32_t key20 = keys.getKey(20);
+        EXPECT_FALSE(keys.add(20));
+        keys.remove(20);
+        EXPECT_EQ(2u, keys.size());
+        EXPECT_EQ(key20, keys.getKey(20));
+        keys.remove(20);
+        EXPECT_EQ(1u, keys.size());
+    }
+
+    TEST_F(AnOrderPreservingKeys, spreadsAllKeysWhenThereIsNoGapForAddedValue)
+    {
+        keys.reset({ 0 });
+        bool keysSpread = false;
+        std::vector<int> values{ 0 };
+        // each value added after last one halves remaining gap
+        for (int value = 1; value < 100 && !keysSpread; ++value)
+        {
+            keysSpread = keys.add(value);
+            values.push_back(value);
+        }
+        EXPECT_TRUE(keysSpread);
+        expectKeysOrderedLikeValues(values);
+
+        // keys are spread evenly so that there is gap after last value again
+        EXPECT_FALSE(keys.add(values.back() + 1));
+    }
+
+    TEST_F(AnOrderPreservingKeys, keepsKeysOrderedForRandomAddsAndRemoves)
+    {
+        std::mt19937 generator(42u);
+        std::vector<int> values;
+        for (int i = 0; i < 2000; ++i)
+        {
+            if (!values.empty() && generator() % 3u == 0u)
+            {
+                const size_t index = generator() % values.size();
+                keys.remove(values[index]);
+                values.erase(values.begin() + static_cast<std::ptrdiff_t>(index));
+            }
+            else
+            {
+                const int value = static_cast<int>(generator() % 500u);
+                keys.add(value);
+                values.push_back(value);
+            }
+        }
+
+        std::sort(values.begin(), values.end());
+        expectKeysOrderedLikeValues(values);
+    }
+}
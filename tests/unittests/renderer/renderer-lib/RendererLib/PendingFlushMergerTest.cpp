@@ -0,0 +1,229 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/RendererLib/PendingFlushMerger.h"
+#include "internal/SceneGraph/Scene/ActionCollectingScene.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+
+namespace ramses::internal
+{
+    class APendingFlushMerger : public ::testing::Test
+    {
+    public:
+        APendingFlushMerger()
+        {
+            transform = scene.allocateTransform(scene.allocateNode(0u, {}), {});
+            const auto layout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F, 2u }, DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid(), {});
+            dataInstance = scene.allocateDataInstance(layout, {});
+            addFlush();
+            applyPendingFlushes();
+            pendingFlushes.clear();
+        }
+
+    protected:
+        void addFlush(SceneVersionTag versionTag = {}, bool effectTimeSync = false, FlushTime::Clock::time_point expirationTimestamp = FlushTime::InvalidTimestamp)
+        {
+            pendingFlushes.emplace_back();
+            auto& flush = pendingFlushes.back();
+            flush.flushIndex = ++flushIndex;
+            flush.versionTag = versionTag;
+            flush.timeInfo.isEffectTimeSync = effectTimeSync;
+            flush.timeInfo.expirationTimestamp = expirationTimestamp;
+            flush.resourcesAdded.push_back(ResourceContentHash(flushIndex, 0u));
+            flush.resourcesRemoved.push_back(ResourceContentHash(0u, flushIndex));
+            flush.sceneActions = std::move(scene.getSceneActionCollection());
+            scene.getSceneActionCollection().clear();
+        }
+
+        std::vector<ESceneActionId> getActionTypes(size_t flushIdx) const
+        {
+            std::vector<ESceneActionId> types;
+            for (const auto& action : pendingFlushes[flushIdx].sceneActions)
+                types.push_back(action.type());
+            return types;
+        }
+
+        void applyPendingFlushes()
+        {
+            for (const auto& flush : pendingFlushes)
+                SceneActionApplier::ApplyActionsOnScene(receiverScene, flush.sceneActions, EFeatureLevel_Latest);
+        }
+
+        ActionCollectingScene scene;
+        Scene receiverScene;
+        TransformHandle transform;
+        DataInstanceHandle dataInstance;
+        PendingFlushes pendingFlushes;
+        uint64_t flushIndex = 0u;
+    };
+
+    TEST_F(APendingFlushMerger, doesNotMergeSingleFlush)
+    {
+        scene.setTranslation(transform, { 1.f, 0.f, 0.f });
+        scene.setTranslation(transform, { 2.f, 0.f, 0.f });
+        addFlush();
+
+        EXPECT_EQ(0u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(1u, pendingFlushes.size());
+        EXPECT_EQ(2u, pendingFlushes[0].flushIndex);
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetTranslation, ESceneActionId::SetTranslation }), getActionTypes(0u));
+    }
+
+    TEST_F(APendingFlushMerger, mergesFlushesIntoOneWithUnionOfResourceChanges)
+    {
+        scene.setTranslation(transform, { 1.f, 2.f, 3.f });
+        addFlush();
+        scene.setScaling(transform, { 2.f, 2.f, 2.f });
+        addFlush();
+
+        EXPECT_EQ(1u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(1u, pendingFlushes.size());
+        const auto& flush = pendingFlushes[0];
+        EXPECT_EQ(3u, flush.flushIndex);
+        EXPECT_EQ(ResourceContentHashVector({ ResourceContentHash(2u, 0u), ResourceContentHash(3u, 0u) }), flush.resourcesAdded);
+        EXPECT_EQ(ResourceContentHashVector({ ResourceContentHash(0u, 2u), ResourceContentHash(0u, 3u) }), flush.resourcesRemoved);
+
+        applyPendingFlushes();
+        EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), receiverScene.getTranslation(transform));
+        EXPECT_EQ(glm::vec3(2.f, 2.f, 2.f), receiverScene.getScaling(transform));
+    }
+
+    TEST_F(APendingFlushMerger, keepsFlushTracesOfAllMergedFlushes)
+    {
+        scene.setTranslation(transform, { 1.f, 2.f, 3.f });
+        addFlush();
+        pendingFlushes.back().traces.emplace_back().flushIndex = flushIndex;
+        scene.setScaling(transform, { 2.f, 2.f, 2.f });
+        addFlush();
+        pendingFlushes.back().traces.emplace_back().flushIndex = flushIndex;
+
+        EXPECT_EQ(1u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(1u, pendingFlushes.size());
+        const auto& traces = pendingFlushes[0].traces;
+        ASSERT_EQ(2u, traces.size());
+        EXPECT_EQ(2u, traces[0].flushIndex);
+        EXPECT_EQ(3u, traces[1].flushIndex);
+    }
+
+    TEST_F(APendingFlushMerger, keepsOnlyLastWriteOfSameTransformPropertyFromMergedFlushes)
+    {
+        scene.setTranslation(transform, { 1.f, 0.f, 0.f });
+        scene.setRotation(transform, { 1.f, 0.f, 0.f, 0.f }, ERotationType::Euler_XYZ);
+        addFlush();
+        scene.setTranslation(transform, { 2.f, 0.f, 0.f });
+        addFlush();
+        scene.setTranslation(transform, { 3.f, 0.f, 0.f });
+        addFlush();
+
+        EXPECT_EQ(2u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(1u, pendingFlushes.size());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetRotation, ESceneActionId::SetTranslation }), getActionTypes(0u));
+
+        applyPendingFlushes();
+        EXPECT_EQ(glm::vec3(3.f, 0.f, 0.f), receiverScene.getTranslation(transform));
+        EXPECT_EQ(glm::vec4(1.f, 0.f, 0.f, 0.f), receiverScene.getRotation(transform));
+    }
+
+    TEST_F(APendingFlushMerger, keepsOnlyLastWriteOfSameDataFieldWithSameElementCount)
+    {
+        const glm::vec4 values1[] = { glm::vec4{ 1.f }, glm::vec4{ 2.f } }; // NOLINT(modernize-avoid-c-arrays)
+        const glm::vec4 values2[] = { glm::vec4{ 3.f }, glm::vec4{ 4.f } }; // NOLINT(modernize-avoid-c-arrays)
+        scene.setDataVector4fArray(dataInstance, DataFieldHandle{ 0u }, 2u, values1);
+        const float value = 1.f;
+        scene.setDataFloatArray(dataInstance, DataFieldHandle{ 1u }, 1u, &value);
+        addFlush();
+        scene.setDataVector4fArray(dataInstance, DataFieldHandle{ 0u }, 2u, values2);
+        addFlush();
+
+        PendingFlushMerger::MergePendingFlushes(pendingFlushes);
+        ASSERT_EQ(1u, pendingFlushes.size());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetDataFloatArray, ESceneActionId::SetDataVector4fArray }), getActionTypes(0u));
+
+        applyPendingFlushes();
+        EXPECT_EQ(glm::vec4{ 3.f }, receiverScene.getDataVector4fArray(dataInstance, DataFieldHandle{ 0u })[0]);
+        EXPECT_EQ(glm::vec4{ 4.f }, receiverScene.getDataVector4fArray(dataInstance, DataFieldHandle{ 0u })[1]);
+        EXPECT_EQ(1.f, receiverScene.getDataSingleFloat(dataInstance, DataFieldHandle{ 1u }));
+    }
+
+    TEST_F(APendingFlushMerger, keepsPartialDataFieldWritesWithDifferentElementCount)
+    {
+        const glm::vec4 values[] = { glm::vec4{ 1.f }, glm::vec4{ 2.f } }; // NOLINT(modernize-avoid-c-arrays)
+        scene.setDataVector4fArray(dataInstance, DataFieldHandle{ 0u }, 2u, values);
+        addFlush();
+        scene.setDataVector4fArray(dataInstance, DataFieldHandle{ 0u }, 1u, values + 1);
+        addFlush();
+
+        PendingFlushMerger::MergePendingFlushes(pendingFlushes);
+        ASSERT_EQ(1u, pendingFlushes.size());
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetDataVector4fArray, ESceneActionId::SetDataVector4fArray }), getActionTypes(0u));
+
+        applyPendingFlushes();
+        EXPECT_EQ(glm::vec4{ 2.f }, receiverScene.getDataVector4fArray(dataInstance, DataFieldHandle{ 0u })[0]);
+        EXPECT_EQ(glm::vec4{ 2.f }, receiverScene.getDataVector4fArray(dataInstance, DataFieldHandle{ 0u })[1]);
+    }
+
+    TEST_F(APendingFlushMerger, endsMergedFlushWithNamedFlush)
+    {
+        scene.setTranslation(transform, { 1.f, 0.f, 0.f });
+        addFlush(SceneVersionTag{ 11u });
+        scene.setTranslation(transform, { 2.f, 0.f, 0.f });
+        addFlush();
+        scene.setTranslation(transform, { 3.f, 0.f, 0.f });
+        addFlush();
+
+        EXPECT_EQ(1u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(2u, pendingFlushes.size());
+        EXPECT_EQ(SceneVersionTag{ 11u }, pendingFlushes[0].versionTag);
+        EXPECT_EQ(2u, pendingFlushes[0].flushIndex);
+        EXPECT_FALSE(pendingFlushes[1].versionTag.isValid());
+        EXPECT_EQ(4u, pendingFlushes[1].flushIndex);
+
+        // state of named flush is kept
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetTranslation }), getActionTypes(0u));
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetTranslation }), getActionTypes(1u));
+    }
+
+    TEST_F(APendingFlushMerger, mergesPrecedingFlushesIntoNamedFlush)
+    {
+        scene.setTranslation(transform, { 1.f, 0.f, 0.f });
+        addFlush();
+        scene.setTranslation(transform, { 2.f, 0.f, 0.f });
+        addFlush(SceneVersionTag{ 11u });
+
+        EXPECT_EQ(1u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(1u, pendingFlushes.size());
+        EXPECT_EQ(SceneVersionTag{ 11u }, pendingFlushes[0].versionTag);
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetTranslation }), getActionTypes(0u));
+    }
+
+    TEST_F(APendingFlushMerger, endsMergedFlushWithEffectTimeSync)
+    {
+        addFlush({}, true);
+        addFlush();
+
+        EXPECT_EQ(0u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(2u, pendingFlushes.size());
+        EXPECT_TRUE(pendingFlushes[0].timeInfo.isEffectTimeSync);
+        EXPECT_FALSE(pendingFlushes[1].timeInfo.isEffectTimeSync);
+    }
+
+    TEST_F(APendingFlushMerger, doesNotMergeFlushesChangingExpirationMonitoring)
+    {
+        const auto expirationTimestamp = FlushTime::Clock::time_point(std::chrono::milliseconds(1000));
+        addFlush({}, false, expirationTimestamp);
+        addFlush({}, false, expirationTimestamp + std::chrono::milliseconds(10));
+        addFlush();
+
+        EXPECT_EQ(1u, PendingFlushMerger::MergePendingFlushes(pendingFlushes));
+        ASSERT_EQ(2u, pendingFlushes.size());
+        EXPECT_EQ(expirationTimestamp + std::chrono::milliseconds(10), pendingFlushes[0].timeInfo.expirationTimestamp);
+        EXPECT_EQ(FlushTime::InvalidTimestamp, pendingFlushes[1].timeInfo.expirationTimestamp);
+    }
+}
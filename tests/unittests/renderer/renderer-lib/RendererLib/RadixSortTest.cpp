@@ -0,0 +1,78 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RadixSort.h"
+#include "gmock/gmock.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace ramses::internal
+{
+    class ARadixSort : public ::testing::TestWithParam<size_t>
+    {
+    protected:
+        static SortKeyEntries CreateRandomEntries(size_t count, uint64_t keyMask)
+        {
+            std::mt19937_64 generator(count);
+            SortKeyEntries entries;
+            for (size_t i = 0u; i < count; ++i)
+                entries.push_back({ generator() & keyMask, static_cast<uint32_t>(i) });
+            return entries;
+        }
+
+        static void ExpectSortedStable(const SortKeyEntries& input, const SortKeyEntries& sorted)
+        {
+            auto expected = input;
+            std::stable_sort(expected.begin(), expected.end(), [](const auto& e1, const auto& e2) { return e1.key < e2.key; });
+            ASSERT_EQ(expected.size(), sorted.size());
+            for (size_t i = 0u; i < expected.size(); ++i)
+            {
+                EXPECT_EQ(expected[i].key, sorted[i].key);
+                EXPECT_EQ(expected[i].index, sorted[i].index);
+            }
+        }
+
+        SortKeyEntries m_scratch;
+    };
+
+    // sizes below and above threshold for insertion sort
+    INSTANTIATE_TEST_SUITE_P(ARadixSortTests, ARadixSort, ::testing::Values(0u, 1u, 2u, 17u, RadixSort::MinEntriesForRadixSort - 1u, RadixSort::MinEntriesForRadixSort, 1000u));
+
+    TEST_P(ARadixSort, sortsFullRangeKeys)
+    {
+        const auto input = CreateRandomEntries(GetParam(), std::numeric_limits<uint64_t>::max());
+        auto entries = input;
+        RadixSort::Sort(entries, m_scratch);
+        ExpectSortedStable(input, entries);
+    }
+
+    TEST_P(ARadixSort, sortsStableWithManyEqualKeys)
+    {
+        const auto input = CreateRandomEntries(GetParam(), 0x0300000000000003u);
+        auto entries = input;
+        RadixSort::Sort(entries, m_scratch);
+        ExpectSortedStable(input, entries);
+    }
+
+    TEST_P(ARadixSort, keepsOrderOfAlreadySortedAndEqualKeys)
+    {
+        SortKeyEntries input;
+        for (uint32_t i = 0u; i < GetParam(); ++i)
+            input.push_back({ 42u, i });
+        auto entries = input;
+        RadixSort::Sort(entries, m_scratch);
+        ExpectSortedStable(input, entries);
+
+        for (uint32_t i = 0u; i < GetParam(); ++i)
+            input[i].key = (uint64_t{ i } << 40u) | i;
+        entries = input;
+        RadixSort::Sort(entries, m_scratch);
+        ExpectSortedStable(input, entries);
+    }
+}
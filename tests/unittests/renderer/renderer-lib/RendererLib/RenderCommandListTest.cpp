@@ -0,0 +1,132 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/RendererLib/LoggingDevice.h"
+#include "internal/RendererLib/RendererLogContext.h"
+#include "DeviceMock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class ARenderCommandList : public ::testing::Test
+    {
+    protected:
+        // issues same sequence of render commands to given device
+        static void IssueCommands(IDevice& device)
+        {
+            device.activateRenderTarget(DeviceResourceHandle{ 3u });
+            device.setViewport(1, 2, 30u, 40u);
+            device.colorMask(true, false, true, false);
+            device.clearColor({ 0.1f, 0.2f, 0.3f, 0.4f });
+            device.clear(EClearFlag::Color | EClearFlag::Depth);
+            device.activateShader(DeviceResourceHandle{ 5u });
+            device.blendFactors(EBlendFactor::SrcAlpha, EBlendFactor::OneMinusSrcAlpha, EBlendFactor::One, EBlendFactor::Zero);
+            device.blendOperations(EBlendOperation::Add, EBlendOperation::Max);
+            device.depthFunc(EDepthFunc::LessEqual);
+            device.depthWrite(EDepthWrite::Disabled);
+            device.cullMode(ECullMode::BackFacing);
+            device.stencilFunc(EStencilFunc::Equal, 1u, 0xffu);
+            device.stencilOp(EStencilOp::Keep, EStencilOp::Replace, EStencilOp::Increment);
+            device.scissorTest(EScissorTest::Enabled, { 1, 2, 3u, 4u });
+            device.drawMode(EDrawMode::Lines);
+
+            const std::array<glm::mat4, 2> matrices{ glm::mat4(1.f), glm::mat4(2.f) };
+            EXPECT_TRUE(device.setConstant(DataFieldHandle{ 1u }, 2u, matrices.data()));
+            const std::array<int32_t, 3> ints{ 7, 8, 9 };
+            EXPECT_TRUE(device.setConstant(DataFieldHandle{ 2u }, 3u, ints.data()));
+            const glm::vec3 vec{ 1.f, 2.f, 3.f };
+            EXPECT_TRUE(device.setConstant(DataFieldHandle{ 3u }, 1u, &vec));
+
+            device.activateTexture(DeviceResourceHandle{ 6u }, DataFieldHandle{ 4u });
+            device.activateVertexArray(DeviceResourceHandle{ 7u });
+            device.drawIndexedTriangles(10, 20, 1u);
+            device.drawTriangles(0, 3, 4u);
+            device.discardDepthStencil();
+        }
+
+        std::string issueCommandsDirectly()
+        {
+            RendererLogContext logContext(ERendererLogLevelFlag_Details);
+            LoggingDevice loggingDevice(deviceDelegate, logContext);
+            IssueCommands(loggingDevice);
+            return logContext.getStream().data();
+        }
+
+        static std::string replayCommands(const IDevice& deviceDelegate, const RenderCommandList& commands)
+        {
+            RendererLogContext logContext(ERendererLogLevelFlag_Details);
+            LoggingDevice loggingDevice(deviceDelegate, logContext);
+            commands.replay(loggingDevice);
+            return logContext.getStream().data();
+        }
+
+        NiceMock<DeviceMock> deviceDelegate;
+        RenderCommandList commands;
+    };
+
+    TEST_F(ARenderCommandList, isEmptyInitially)
+    {
+        EXPECT_TRUE(commands.empty());
+        EXPECT_TRUE(commands.getCommands().empty());
+        EXPECT_EQ("", replayCommands(deviceDelegate, commands));
+    }
+
+    TEST_F(ARenderCommandList, replaysRecordedCommandsInSameOrderWithSameArguments)
+    {
+        RenderCommandRecorder recorder(deviceDelegate, commands);
+        IssueCommands(recorder);
+        EXPECT_FALSE(commands.empty());
+
+        const std::string expectedLog = issueCommandsDirectly();
+        EXPECT_FALSE(expectedLog.empty());
+        EXPECT_EQ(expectedLog, replayCommands(deviceDelegate, commands));
+    }
+
+    TEST_F(ARenderCommandList, canBeReplayedMultipleTimes)
+    {
+        RenderCommandRecorder recorder(deviceDelegate, commands);
+        IssueCommands(recorder);
+
+        const std::string expectedLog = issueCommandsDirectly();
+        EXPECT_EQ(expectedLog, replayCommands(deviceDelegate, commands));
+        EXPECT_EQ(expectedLog, replayCommands(deviceDelegate, commands));
+    }
+
+    TEST_F(ARenderCommandList, keepsConstantValuesIndependentOfRecordedSourceData)
+    {
+        RenderCommandRecorder recorder(deviceDelegate, commands);
+        std::array<float, 2> values{ 1.f, 2.f };
+        EXPECT_TRUE(recorder.setConstant(DataFieldHandle{ 1u }, 2u, values.data()));
+        values = { 3.f, 4.f };
+
+        RendererLogContext logContext(ERendererLogLevelFlag_Details);
+        LoggingDevice loggingDevice(deviceDelegate, logContext);
+        const std::array<float, 2> expectedValues{ 1.f, 2.f };
+        EXPECT_TRUE(loggingDevice.setConstant(DataFieldHandle{ 1u }, 2u, expectedValues.data()));
+
+        EXPECT_EQ(logContext.getStream().data(), replayCommands(deviceDelegate, commands));
+    }
+
+    TEST_F(ARenderCommandList, isEmptyAfterClear)
+    {
+        RenderCommandRecorder recorder(deviceDelegate, commands);
+        IssueCommands(recorder);
+        commands.clear();
+        EXPECT_TRUE(commands.empty());
+        EXPECT_EQ("", replayCommands(deviceDelegate, commands));
+
+        IssueCommands(recorder);
+        EXPECT_EQ(issueCommandsDirectly(), replayCommands(deviceDelegate, commands));
+    }
+}
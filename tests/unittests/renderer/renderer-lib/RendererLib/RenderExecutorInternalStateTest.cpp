@@ -15,7 +15,6 @@
 #include "ResourceDeviceHandleAccessorMock.h"
 #include "internal/RendererLib/RendererEventCollector.h"
 #include "TestSceneHelper.h"
-#include <limits>
 
 namespace ramses::internal
 {
@@ -41,7 +40,6 @@ namespace ramses::internal
         ARenderExecutorInternalState()
             : m_renderContext{ DeviceResourceHandle(0u), FakeVpWidth, FakeVpHeight, SceneRenderExecutionIterator{}, EClearFlag::All, glm::vec4{1.f}, false }
             , m_executorState(m_device, m_renderContext)
-            , m_executorStateWithTimer(m_device, m_renderContext, &m_frameTimer)
             , m_rendererScenes(m_rendererEventCollector)
             , m_sceneLinksManager(m_rendererScenes.getSceneLinksManager())
             , m_sceneId(666u)
@@ -49,15 +47,12 @@ namespace ramses::internal
             , m_sceneAllocator(m_scene)
         {
             m_executorState.setScene(m_scene);
-            m_frameTimer.startFrame();
         }
 
     protected:
         StrictMock<DeviceMock>             m_device;
         RenderingContext                   m_renderContext;
-        FrameTimer                         m_frameTimer;
         RenderExecutorInternalState        m_executorState;
-        RenderExecutorInternalState        m_executorStateWithTimer;
         RendererEventCollector             m_rendererEventCollector;
         RendererScenes                     m_rendererScenes;
         SceneLinksManager&                 m_sceneLinksManager;
@@ -677,22 +672,4 @@ namespace ramses::internal
         EXPECT_EQ(0u, m_executorState.m_currentRenderIterator.getRenderableIdx());
         EXPECT_EQ(4u, m_executorState.m_currentRenderIterator.getFlattenedRenderableIdx());
     }
-
-    TEST_F(ARenderExecutorInternalState, reportsExceedingOfTimeBudget)
-    {
-        m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, 0u);
-        ASSERT_TRUE(m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender));
-        EXPECT_TRUE(m_executorStateWithTimer.hasExceededTimeBudgetForRendering());
-    }
-
-    TEST_F(ARenderExecutorInternalState, reportsExceedingOfTimeBudgetOnlyAfterItIsReallyExceeded)
-    {
-        m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, std::numeric_limits<uint64_t>::max());
-        ASSERT_FALSE(m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender));
-        EXPECT_FALSE(m_executorStateWithTimer.hasExceededTimeBudgetForRendering());
-
-        m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, 0u);
-        ASSERT_TRUE(m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender));
-        EXPECT_TRUE(m_executorStateWithTimer.hasExceededTimeBudgetForRendering());
-    }
 }
@@ -368,6 +368,18 @@ namespace ramses::internal {
             return dataInstances;
         }
 
+        // frustum culling needs bounding volume of every attribute which could hold positions, vec2 attributes cannot be culled
+        DataInstanceHandle createGeometryDataInstanceWithPositionsOnly()
+        {
+            DataFieldInfoVector dataFields(2u);
+            dataFields[indicesField.asMemoryHandle()] = DataFieldInfo(EDataType::Indices, 1u, EFixedSemantics::Indices);
+            dataFields[vertPosField.asMemoryHandle()] = DataFieldInfo(EDataType::Vector3Buffer, 1u, EFixedSemantics::Invalid);
+            const DataInstanceHandle geometryData = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(dataFields, MockResourceHash::EffectHash));
+            scene.setDataResource(geometryData, indicesField, MockResourceHash::IndexArrayHash, DataBufferHandle::Invalid(), 2u, 0u, 0u);
+            scene.setDataResource(geometryData, vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+            return geometryData;
+        }
+
         RenderGroupHandle createRenderGroup(RenderPassHandle pass)
         {
             const RenderGroupHandle renderGroup = sceneAllocator.allocateRenderGroup();
@@ -454,7 +466,8 @@ namespace ramses::internal {
             EExpectedRenderStateChange expectRenderStateChanges = EExpectedRenderStateChange::All,
             uint32_t instanceCount = 1u,
             bool expectIndexedRendering = true,
-            int32_t expectedUniformTimeMs = 0)
+            int32_t expectedUniformTimeMs = 0,
+            bool expectValuesWithoutSemantics = true)
         {
             // TODO violin this is not entirely needed, only need to check that draw call is at the end of the commands
             InSequence seq;
@@ -491,7 +504,8 @@ namespace ramses::internal {
                 EXPECT_CALL(device, activateShader(FakeShaderDeviceHandle))                                                                           .InSequence(deviceSequence);
             }
             EXPECT_CALL(device, activateVertexArray(_))                                                                               .InSequence(deviceSequence);
-            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const float*>(Pointee(Eq(0.1f)))))                                       .InSequence(deviceSequence);
+            if (expectValuesWithoutSemantics)
+                EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const float*>(Pointee(Eq(0.1f)))))                                       .InSequence(deviceSequence);
             EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))                  .InSequence(deviceSequence);
             EXPECT_CALL(device, setConstant(fieldViewMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedViewMatrix)))))                    .InSequence(deviceSequence);
             EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .InSequence(deviceSequence);
@@ -500,14 +514,18 @@ namespace ramses::internal {
             EXPECT_CALL(device, activateTextureSamplerObject(Property(&TextureSamplerStates::hash, Eq(expectedSamplerStates.hash())), textureField)).InSequence(deviceSequence);
             EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureFieldMS))                                                                         .InSequence(deviceSequence);
 
-            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const float*>(Pointee(Eq(-666.f)))))                                     .InSequence(deviceSequence);
-            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const glm::mat2*>(Pointee(Eq(glm::mat2(1,2,3,4))))))             .InSequence(deviceSequence);
+            if (expectValuesWithoutSemantics)
+            {
+                EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const float*>(Pointee(Eq(-666.f)))))                                     .InSequence(deviceSequence);
+                EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const glm::mat2*>(Pointee(Eq(glm::mat2(1,2,3,4))))))             .InSequence(deviceSequence);
+            }
 
             EXPECT_CALL(device, activateTexture(fakeExternalTextureDeviceHandle, textureFieldExternal)).InSequence(deviceSequence);
             const TextureSamplerStates expectedSamplerExternalStates(ETextureAddressMode::Repeat, ETextureAddressMode::Clamp, ETextureAddressMode::Mirror, ETextureSamplingMethod::Nearest_MipMapNearest, ETextureSamplingMethod::Nearest, 1u);
             EXPECT_CALL(device, activateTextureSamplerObject(Property(&TextureSamplerStates::hash, Eq(expectedSamplerExternalStates.hash())), textureFieldExternal)).InSequence(deviceSequence);
 
-            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldBool, 1, Matcher<const bool*>(Pointee(Eq(true)))))                                     .InSequence(deviceSequence);
+            if (expectValuesWithoutSemantics)
+                EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldBool, 1, Matcher<const bool*>(Pointee(Eq(true)))))                                     .InSequence(deviceSequence);
             EXPECT_CALL(device, activateUniformBuffer(DeviceMock::FakeUniformBufferDeviceHandle, fakeEffectInputs.uniformBufferField))                          .InSequence(deviceSequence);
             EXPECT_CALL(device, activateUniformBuffer(fakeEffectInputs.modelUniformBufferDeviceHandle, fakeEffectInputs.modelUniformBufferField))               .InSequence(deviceSequence);
             EXPECT_CALL(device, activateUniformBuffer(fakeEffectInputs.cameraUniformBufferDeviceHandle, fakeEffectInputs.cameraUniformBufferField))             .InSequence(deviceSequence);
@@ -527,6 +545,12 @@ namespace ramses::internal {
             }
         }
 
+        // renderable rendered right after other renderable with same shader and uniform data instance
+        void expectFrameRenderCommandsWithSameUniforms(RenderableHandle renderable, const glm::mat4& expectedProjMatrix, EExpectedRenderStateChange expectRenderStateChanges)
+        {
+            expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjMatrix, false, expectRenderStateChanges, 1u, true, 0, false);
+        }
+
         void expectActivateRenderTarget(DeviceResourceHandle rtDeviceHandle, bool expectViewport = true, const Viewport& viewport = Viewport(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight))
         {
             EXPECT_CALL(device, activateRenderTarget(rtDeviceHandle)).InSequence(deviceSequence);
@@ -1060,6 +1084,172 @@ namespace ramses::internal {
         Mock::VerifyAndClearExpectations(&device);
     }
 
+    TEST_F(ARenderExecutor, DrawsConsecutiveIdenticalRenderablesInstancedIfAutoInstancingEnabled)
+    {
+        renderContext.autoInstancing = true;
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+        const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+        scene.addRenderableToRenderGroup(group, renderable2, 1);
+        scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+        scene.setTranslation(addTransformToRenderable(renderable2), glm::vec3(0.5f));
+
+        updateScenes({ renderable1, renderable2 });
+
+        EXPECT_CALL(device, activateInstancedShader(DeviceMock::FakeShaderDeviceHandle)).WillOnce(Return(true));
+        std::vector<glm::mat4> instanceModelMatrices;
+        EXPECT_CALL(device, uploadInstanceData(_, 2u * sizeof(glm::mat4))).WillOnce([&](const std::byte* data, uint32_t dataSize)
+            {
+                instanceModelMatrices.resize(dataSize / sizeof(glm::mat4));
+                std::memcpy(instanceModelMatrices.data(), data, dataSize);
+            });
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), CameraMatrixHelper::ProjectionMatrix(projParams), false, EExpectedRenderStateChange::All, 2u);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+
+        ASSERT_EQ(2u, instanceModelMatrices.size());
+        EXPECT_THAT(instanceModelMatrices[0], PermissiveMatrixEq(glm::identity<glm::mat4>()));
+        EXPECT_THAT(instanceModelMatrices[1], PermissiveMatrixEq(glm::translate(glm::vec3(0.5f))));
+    }
+
+    TEST_F(ARenderExecutor, DrawsRenderablesWithDifferentUniformDataInstancesOneByOneIfAutoInstancingEnabled)
+    {
+        renderContext.autoInstancing = true;
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        // same geometry and effect, only values of uniforms are in other data instance
+        const DataInstances otherUniformsDataInstances{ createTestDataInstance().first, dataInstances.second };
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+        const RenderableHandle renderable2 = createTestRenderable(otherUniformsDataInstances);
+        scene.addRenderableToRenderGroup(group, renderable2, 1);
+        scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+
+        updateScenes({ renderable1, renderable2 });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+        EXPECT_CALL(device, activateInstancedShader(_)).Times(0);
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
+    TEST_F(ARenderExecutor, DrawsIdenticalRenderablesOneByOneIfShaderHasNoInstancedVariant)
+    {
+        renderContext.autoInstancing = true;
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+        const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+        scene.addRenderableToRenderGroup(group, renderable2, 1);
+        scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+
+        updateScenes({ renderable1, renderable2 });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+        EXPECT_CALL(device, activateInstancedShader(DeviceMock::FakeShaderDeviceHandle)).WillOnce(Return(false));
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        expectFrameRenderCommandsWithSameUniforms(renderable2, projMatrix, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
+    TEST_F(ARenderExecutor, SetsUniformValuesWithoutSemanticsAgainOnlyIfUniformDataInstanceOrShaderChanged)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances);
+        const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+        const RenderableHandle renderable3 = createTestRenderable(createTestDataInstance());
+        scene.addRenderableToRenderGroup(group, renderable1, 0);
+        scene.addRenderableToRenderGroup(group, renderable2, 1);
+        scene.addRenderableToRenderGroup(group, renderable3, 2);
+
+        updateScenes({ renderable1, renderable2, renderable3 });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        expectFrameRenderCommandsWithSameUniforms(renderable2, projMatrix, EExpectedRenderStateChange::None);
+        expectFrameRenderCommands(renderable3, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+
+        // new frame, values have to be set again even if same shader and data instance are rendered first
+        updateScenes({});
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        expectFrameRenderCommandsWithSameUniforms(renderable2, projMatrix, EExpectedRenderStateChange::None);
+        expectFrameRenderCommands(renderable3, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
+    TEST_F(ARenderExecutor, SkipsRenderablesOutsideOfCameraFrustumIfFrustumCullingEnabled)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderGroupHandle group = createRenderGroup(pass);
+        DataInstances dataInstances = createTestDataInstance();
+        dataInstances.second = createGeometryDataInstanceWithPositionsOnly();
+        ON_CALL(resourceManager, getResourceBoundingSphere(_)).WillByDefault(Return(BoundingSphere{ glm::vec3(0.f, 0.f, -10.f), 1.f }));
+
+        const RenderableHandle visibleRenderable = createTestRenderable(dataInstances, group);
+        const RenderableHandle culledRenderable = createTestRenderable(dataInstances, group);
+        // moved behind camera
+        scene.setTranslation(addTransformToRenderable(culledRenderable), glm::vec3(0.f, 0.f, 20.f));
+
+        updateScenes({ visibleRenderable, culledRenderable });
+        expectFrameWithSinglePass(visibleRenderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+
+        EXPECT_EQ(2u, renderContext.numRenderablesTestedForCulling);
+        EXPECT_EQ(1u, renderContext.numRenderablesCulled);
+    }
+
+    TEST_F(ARenderExecutor, RendersRenderableOutsideOfCameraFrustumIfFrustumCullingDisabledForIt)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        DataInstances dataInstances = createTestDataInstance();
+        dataInstances.second = createGeometryDataInstanceWithPositionsOnly();
+        ON_CALL(resourceManager, getResourceBoundingSphere(_)).WillByDefault(Return(BoundingSphere{ glm::vec3(0.f, 0.f, 10.f), 1.f }));
+
+        const RenderableHandle renderable = createTestRenderable(dataInstances, createRenderGroup(pass));
+        scene.setRenderableFrustumCulling(renderable, false);
+
+        updateScenes({ renderable });
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+
+        EXPECT_EQ(0u, renderContext.numRenderablesTestedForCulling);
+        EXPECT_EQ(0u, renderContext.numRenderablesCulled);
+    }
+
     TEST_F(ARenderExecutor, UpdatesModelMatrixWhenChangingTranslationRotationOrScalingOfNode)
     {
         const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -1200,13 +1390,13 @@ namespace ramses::internal {
             expectActivateRenderTarget(renderTargetDeviceHandle);
             expectClearRenderTarget();
             expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
-            expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+            expectFrameRenderCommandsWithSameUniforms(renderable2, expectedProjectionMatrix, EExpectedRenderStateChange::None);
             expectDepthStencilDiscard();
 
             expectActivateFramebufferRenderTarget(false);
             expectClearRenderTarget();
-            expectFrameRenderCommands(renderable3, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::CausedByClear);
-            expectFrameRenderCommands(renderable4, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+            expectFrameRenderCommandsWithSameUniforms(renderable3, expectedProjectionMatrix, EExpectedRenderStateChange::CausedByClear);
+            expectFrameRenderCommandsWithSameUniforms(renderable4, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
 
         FrameTimer frameTimer;
@@ -1241,7 +1431,7 @@ namespace ramses::internal {
             // one batch of renderables is rendered, first sets states
             expectFrameRenderCommands(batchRenderables.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             for (auto it = batchRenderables.cbegin() + 1; it != batchRenderables.cend(); ++it)
-                expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+                expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
 
         FrameTimer frameTimer;
@@ -1298,7 +1488,7 @@ namespace ramses::internal {
             expectClearRenderTarget();
             expectFrameRenderCommands(batchRenderables1.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             for (auto it = batchRenderables1.cbegin() + 1; it != batchRenderables1.cend(); ++it)
-                expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+                expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
         SceneRenderExecutionIterator renderIterator = executeScene(&frameTimer);
         EXPECT_EQ(0u, renderIterator.getRenderPassIdx());
@@ -1309,7 +1499,7 @@ namespace ramses::internal {
             expectActivateRenderTarget(renderTargetDeviceHandle); // no clear
             expectFrameRenderCommands(batchRenderables2.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             for (auto it = batchRenderables2.cbegin() + 1; it != batchRenderables2.cend(); ++it)
-                expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+                expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
         renderContext.renderFrom = renderIterator;
         renderIterator = executeScene(&frameTimer);
@@ -1327,7 +1517,7 @@ namespace ramses::internal {
             expectClearRenderTarget();
             expectFrameRenderCommands(batchRenderables3.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             for (auto it = batchRenderables3.cbegin() + 1; it != batchRenderables3.cend(); ++it)
-                expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+                expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
         renderContext.renderFrom = renderIterator;
         renderIterator = executeScene(&frameTimer);
@@ -1339,7 +1529,7 @@ namespace ramses::internal {
             expectActivateFramebufferRenderTarget();
             expectFrameRenderCommands(batchRenderables4.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             for (auto it = batchRenderables4.cbegin() + 1; it != batchRenderables4.cend(); ++it)
-                expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+                expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
         }
         renderContext.renderFrom = renderIterator;
         renderIterator = executeScene(&frameTimer);
@@ -1489,7 +1679,7 @@ namespace ramses::internal {
         // one batch of renderables is rendered, first sets states
         expectFrameRenderCommands(batchRenderables.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
         for (auto it = batchRenderables.cbegin() + 1; it != batchRenderables.cend(); ++it)
-            expectFrameRenderCommands(*it, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+            expectFrameRenderCommandsWithSameUniforms(*it, expectedProjectionMatrix, EExpectedRenderStateChange::None);
 
         FrameTimer frameTimer;
         frameTimer.startFrame();
@@ -1054,6 +1054,195 @@ namespace ramses::internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, reordersRenderablesWhenGeometryInstanceChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+
+        const ResourceContentHash effect1{ 1, 0 };
+        const ResourceContentHash effect2{ 2, 0 };
+        const DataLayoutHandle effect1layout = sceneAllocator.allocateDataLayout({}, effect1);
+        const DataLayoutHandle effect2layout = sceneAllocator.allocateDataLayout({}, effect2);
+        const DataInstanceHandle effect1geometry = sceneAllocator.allocateDataInstance(effect1layout);
+        const DataInstanceHandle effect2geometry = sceneAllocator.allocateDataInstance(effect2layout);
+
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect2geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect1geometry);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect1geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect2geometry);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, ordersRenderablesWithSameEffectAndGeometryByRenderState)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+
+        const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(layout);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, geometry);
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Geometry, geometry);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state2);
+        scene.setRenderableRenderState(rend2, state1);
+        scene.setRenderableRenderState(rend3, state2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, ordersRenderablesWithSameRenderOrderByUniformInstanceInStateSortedPass)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend4 = sceneHelper.createRenderable(group);
+
+        const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        const DataInstanceHandle uniforms1 = sceneAllocator.allocateDataInstance(layout);
+        const DataInstanceHandle uniforms2 = sceneAllocator.allocateDataInstance(layout);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Uniforms, uniforms2);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Uniforms, uniforms1);
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Uniforms, uniforms2);
+        scene.setRenderableDataInstance(rend4, ERenderableDataSlotType_Uniforms, uniforms1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3, rend4 });
+
+        scene.setRenderPassStateSorting(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend4, rend1, rend3 });
+
+        // uniform instance change is reflected in state sorted pass
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Uniforms, uniforms2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend4, rend1, rend2, rend3 });
+
+        scene.setRenderPassStateSorting(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3, rend4 });
+    }
+
+    TEST_F(ARendererCachedScene, doesNotReorderRenderablesWithDifferentRenderOrderInStateSortedPass)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        scene.setRenderPassStateSorting(pass, true);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend2, 1);
+        scene.addRenderableToRenderGroup(group, rend3, 1);
+
+        const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        const DataInstanceHandle uniforms1 = sceneAllocator.allocateDataInstance(layout);
+        const DataInstanceHandle uniforms2 = sceneAllocator.allocateDataInstance(layout);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Uniforms, uniforms2);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Uniforms, uniforms2);
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Uniforms, uniforms1);
+
+        // only renderables with render order 1 are reordered
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, keepsSortedRenderablesOfOtherGroupsWhenRenderableAddedToGroup)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass);
+        scene.removeRenderGroupFromRenderPass(pass, group2);
+        scene.addRenderGroupToRenderPass(pass, group2, 1);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group2, rend3, -1);
+        const RenderableHandle rend4 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group1, rend4, 1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend4, rend3, rend2 });
+
+        scene.removeRenderableFromRenderGroup(group1, rend1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend4, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, reordersOnlyRenderableWhoseRenderStateChanged)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state3 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state1);
+        scene.setRenderableRenderState(rend2, state2);
+        scene.setRenderableRenderState(rend3, state3);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+
+        // renderables with same state keep their order
+        scene.setRenderableRenderState(rend1, state3);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1, rend3 });
+
+        scene.removeRenderableFromRenderGroup(group, rend2);
+        scene.releaseRenderable(rend2);
+        scene.setRenderableRenderState(rend3, state1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, keepsRenderablesOrderedWhenStateKeysRunOutOfGapsForRenderablesAddedOneByOne)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        std::vector<DataInstanceHandle> geometries;
+        for (uint32_t i = 0u; i < 64u; ++i)
+            geometries.push_back(sceneAllocator.allocateDataInstance(layout));
+
+        // each renderable is ordered before all previous ones, so that keys have to be spread again several times
+        RenderableVector expectedOrder;
+        for (auto geometry = geometries.crbegin(); geometry != geometries.crend(); ++geometry)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable(group);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, *geometry);
+            expectedOrder.insert(expectedOrder.begin(), renderable);
+
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+            EXPECT_EQ(expectedOrder, scene.getOrderedRenderablesForPass(pass));
+        }
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1434,4 +1623,179 @@ namespace ramses::internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    TEST_F(ARendererCachedScene, skipsPassRenderingIntoRenderTargetAfterRenderedWithoutChanges)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(pass, orderedPasses[0].getRenderPassHandle());
+
+        // still rendered until marked as rendered
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_EQ(1u, scene.getSortedRenderingPasses().size());
+        scene.markRenderTargetsAsRendered();
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_TRUE(scene.getSortedRenderingPasses().empty());
+    }
+
+    TEST_F(ARendererCachedScene, alwaysKeepsPassRenderingIntoDisplayBuffer)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle rtPass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(rtPass, sceneHelper.renderTarget);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_EQ(2u, scene.getSortedRenderingPasses().size());
+        scene.markRenderTargetsAsRendered();
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(pass, orderedPasses[0].getRenderPassHandle());
+    }
+
+    TEST_F(ARendererCachedScene, keepsAllPassesIfSkippingUnchangedRenderTargetsDisabled)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(false);
+        scene.markRenderTargetsAsRendered();
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(false);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(pass, orderedPasses[0].getRenderPassHandle());
+    }
+
+    TEST_F(ARendererCachedScene, rendersPassIntoRenderTargetAgainIfPassPropertyChanged)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        scene.markRenderTargetsAsRendered();
+
+        scene.setRenderPassClearColor(pass, { 0.1f, 0.2f, 0.3f, 0.4f });
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_EQ(1u, scene.getSortedRenderingPasses().size());
+        scene.markRenderTargetsAsRendered();
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_TRUE(scene.getSortedRenderingPasses().empty());
+    }
+
+    TEST_F(ARendererCachedScene, rendersPassIntoRenderTargetAgainIfUniformOfItsRenderableChanged)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = sceneHelper.createRenderable(group);
+        const DataInstanceHandle uniforms = sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeTexture());
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        scene.markRenderTargetsAsRendered();
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_TRUE(scene.getSortedRenderingPasses().empty());
+
+        scene.setDataSingleFloat(uniforms, sceneHelper.dataField, 0.5f);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(pass, orderedPasses[0].getRenderPassHandle());
+    }
+
+    TEST_F(ARendererCachedScene, keepsRenderingIntoRenderTargetWhileResourcesOfItsRenderableAreMissing)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        sceneHelper.createRenderable(group);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+            scene.updateRenderTargetsToRender(true);
+            EXPECT_EQ(1u, scene.getSortedRenderingPasses().size());
+            scene.markRenderTargetsAsRendered();
+        }
+    }
+
+    TEST_F(ARendererCachedScene, rendersPassIntoRenderTargetAgainIfItSamplesRenderBufferOfRenderTargetRenderedAgain)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass1, sceneHelper.renderTarget);
+
+        // second render target samples color buffer of first one
+        const RenderTargetHandle renderTarget2 = sceneAllocator.allocateRenderTarget();
+        const RenderBufferHandle colorBuffer2 = sceneAllocator.allocateRenderBuffer({ 16u, 12u, EPixelStorageFormat::R8, ERenderBufferAccessMode::ReadWrite, 0u });
+        scene.addRenderTargetRenderBuffer(renderTarget2, colorBuffer2);
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass2, renderTarget2);
+        scene.setRenderPassRenderOrder(pass2, 1);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass2);
+        const RenderableHandle renderable = sceneHelper.createRenderable(group);
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSampler(sceneHelper.renderTargetColorBuffer));
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_EQ(2u, scene.getSortedRenderingPasses().size());
+        scene.markRenderTargetsAsRendered();
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_TRUE(scene.getSortedRenderingPasses().empty());
+
+        scene.setRenderPassClearColor(pass1, { 0.1f, 0.2f, 0.3f, 0.4f });
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(2u, orderedPasses.size());
+        EXPECT_EQ(pass1, orderedPasses[0].getRenderPassHandle());
+        EXPECT_EQ(pass2, orderedPasses[1].getRenderPassHandle());
+    }
+
+    TEST_F(ARendererCachedScene, rendersAllPassesIntoRenderTargetsAgainWhenMarkedDirty)
+    {
+        sceneHelper.createRenderTarget();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderTarget(pass, sceneHelper.renderTarget);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        scene.markRenderTargetsAsRendered();
+
+        scene.markAllRenderTargetsDirty();
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderTargetsToRender(true);
+        EXPECT_EQ(1u, scene.getSortedRenderingPasses().size());
+    }
 }
@@ -69,6 +69,7 @@ namespace ramses::internal {
         EXPECT_CALL(*this, getOffscreenBufferColorBufferDeviceHandle(_)).Times(AnyNumber());
         EXPECT_CALL(*this, getStreamBufferDeviceHandle(_)).Times(AnyNumber());
         EXPECT_CALL(*this, getResourcesInUseByScene(_)).Times(AnyNumber());
+        EXPECT_CALL(*this, getUploadedResources()).Times(AnyNumber());
         EXPECT_CALL(*this, getExternalBufferDeviceHandle(_)).Times(AnyNumber());
         EXPECT_CALL(*this, getEmptyExternalBufferDeviceHandle()).Times(AnyNumber());
         EXPECT_CALL(*this, getUniformBufferDeviceHandle(Matcher<UniformBufferHandle>(_), _)).Times(AnyNumber());
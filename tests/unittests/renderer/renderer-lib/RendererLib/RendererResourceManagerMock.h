@@ -20,6 +20,7 @@ namespace ramses::internal{
         RendererResourceManagerMock();
         // IResourceDeviceHandleAccessor
         MOCK_METHOD(DeviceResourceHandle, getResourceDeviceHandle, (const ResourceContentHash&), (const, override));
+        MOCK_METHOD(std::optional<BoundingSphere>, getResourceBoundingSphere, (const ResourceContentHash&), (const, override));
         MOCK_METHOD(DeviceResourceHandle, getRenderTargetDeviceHandle, (RenderTargetHandle, SceneId), (const, override));
         MOCK_METHOD(DeviceResourceHandle, getRenderTargetBufferDeviceHandle, (RenderBufferHandle, SceneId), (const, override));
         MOCK_METHOD(DeviceResourceHandle, getOffscreenBufferDeviceHandle, (OffscreenBufferHandle), (const, override));
@@ -39,6 +40,7 @@ namespace ramses::internal{
         // IRendererResourceManager
         MOCK_METHOD(EResourceStatus, getResourceStatus, (const ResourceContentHash& hash), (const, override));
         MOCK_METHOD(EResourceType, getResourceType, (const ResourceContentHash& hash), (const, override));
+        MOCK_METHOD(ResourceContentHashVector, getUploadedResources, (), (const, override));
         MOCK_METHOD(void, referenceResourcesForScene, (SceneId sceneId, const ResourceContentHashVector& resources), (override));
         MOCK_METHOD(void, unreferenceResourcesForScene, (SceneId sceneId, const ResourceContentHashVector& resources), (override));
         MOCK_METHOD(void, unloadAllSceneResourcesForScene, (SceneId sceneId), (override));
@@ -20,6 +20,7 @@ namespace ramses::internal
 
         MOCK_METHOD(void, sendSubscribeScene, (SceneId sceneId), (override));
         MOCK_METHOD(void, sendUnsubscribeScene, (SceneId sceneId), (override));
+        MOCK_METHOD(void, sendResourcesAvailable, (SceneId sceneId, const ResourceContentHashVector& availableResources), (override));
 
         MOCK_METHOD(void, sendSceneStateChanged, (SceneId masterScene, SceneId referencedScene, RendererSceneState newState), (override));
         MOCK_METHOD(void, sendSceneFlushed, (SceneId masterScene, SceneId referencedScene, SceneVersionTag tag), (override));
@@ -375,6 +375,62 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, reportsAndReferencesUploadedResourcesWhenRequestingSubscriptionUntilSceneUnsubscribed)
+    {
+        createDisplayAndExpectSuccess();
+        createStagingScene();
+        publishScene();
+
+        const ResourceContentHashVector uploadedResources{ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getUploadedResources()).WillOnce(Return(uploadedResources));
+        expectResourcesReferenced(uploadedResources);
+        EXPECT_CALL(sceneEventSender, sendResourcesAvailable(getSceneId(), UnorderedElementsAreArray(uploadedResources)));
+        requestSceneSubscription();
+        receiveScene();
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+        EXPECT_CALL(sceneEventSender, sendUnsubscribeScene(getSceneId()));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, unreferenceResourcesForScene(getSceneId(), UnorderedElementsAreArray(uploadedResources)));
+        rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+        expectInternalSceneStateEvent(ERendererEventType::SceneUnsubscribed);
+        expectNoResourceReferencedByScene();
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, unreferencesResourcesReferencedOnSubscriptionIfProviderSentTheirData)
+    {
+        createDisplayAndExpectSuccess();
+        createStagingScene();
+        publishScene();
+
+        const ResourceContentHashVector uploadedResources{ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getUploadedResources()).WillOnce(Return(uploadedResources));
+        expectResourcesReferenced(uploadedResources);
+        EXPECT_CALL(sceneEventSender, sendResourcesAvailable(getSceneId(), _));
+        requestSceneSubscription();
+        receiveScene();
+
+        // initial flush comes with data of all resources
+        createRenderableNoFlush();
+        setRenderableResourcesNoFlush();
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, unreferenceResourcesForScene(getSceneId(), UnorderedElementsAreArray(uploadedResources)));
+        performFlush();
+        update();
+        EXPECT_EQ(ESceneState::Subscribed, sceneStateExecutor.getSceneState(getSceneId()));
+        expectInternalSceneStateEvent(ERendererEventType::SceneSubscribed);
+        expectNoResourceReferencedByScene();
+
+        expectResourcesReferencedAndProvided_altogether({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        mapScene();
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+        unmapScene();
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, updatesScenesCachedStreamBufferHandles_SingleScene)
     {
         createDisplayAndExpectSuccess();
@@ -9,6 +9,7 @@
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/FrameProfilerStatistics.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Components/FlushTracer.h"
 #include "gmock/gmock.h"
 
 using namespace testing;
@@ -54,6 +55,23 @@ namespace ramses::internal
         EXPECT_STREQ(EnumToString(FrameProfilerStatistics::ERegion::MaxFramerateSleep), "MaxFramerateSleep");
     }
 
+    TEST_F(ARendererStatistics, frameProfilerReportsStateChangesOfLongestFrameAndAverage)
+    {
+        FrameProfilerStatistics profiler;
+        profiler.addStateChanges({ 2u, 4u, 6u, 8u });
+        profiler.addStateChanges({ 4u, 4u, 0u, 2u });
+        profiler.markFrameFinished(std::chrono::microseconds{ 0u });
+
+        StringOutputStream str;
+        profiler.writeLongestFrameTimingsToStream(str);
+        EXPECT_THAT(str.release(), HasSubstr("ShaderChanges:6 [3] UniformInstanceChanges:8 [4] VertexArrayChanges:6 [3] RenderStateChanges:10 [5]"));
+
+        profiler.resetFrameTimings();
+        StringOutputStream strAfterReset;
+        profiler.writeLongestFrameTimingsToStream(strAfterReset);
+        EXPECT_THAT(strAfterReset.release(), HasSubstr("ShaderChanges:0 [0] UniformInstanceChanges:0 [0] VertexArrayChanges:0 [0] RenderStateChanges:0 [0]"));
+    }
+
     TEST_F(ARendererStatistics, tracksDrawCallsPerFrame)
     {
         stats.frameFinished(1u);
@@ -95,6 +113,38 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), HasSubstr("Scene 22: rendered 3"));
     }
 
+    TEST_F(ARendererStatistics, tracksCulledRenderablesOnlyIfCullingWasApplied)
+    {
+        stats.sceneRendered(sceneId1);
+        stats.sceneRendered(sceneId2);
+        stats.renderablesCulled(sceneId1, 10u, 4u);
+        stats.frameFinished(0u);
+        stats.renderablesCulled(sceneId1, 10u, 1u);
+        stats.frameFinished(0u);
+
+        EXPECT_THAT(logOutput(), HasSubstr(", culled 5/20"));
+        EXPECT_THAT(logOutput(), Not(HasSubstr(", culled 0/0")));
+
+        stats.reset();
+        EXPECT_THAT(logOutput(), Not(HasSubstr("culled")));
+    }
+
+    TEST_F(ARendererStatistics, tracksIssuedAndSkippedUniformUpdates)
+    {
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("uniforms")));
+
+        stats.uniformsUpdated(10u, 0u);
+        stats.frameFinished(0u);
+        stats.uniformsUpdated(2u, 8u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr(", uniforms issued/skipped (12/8)"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("uniforms")));
+    }
+
     TEST_F(ARendererStatistics, untracksScene)
     {
         stats.sceneRendered(sceneId1);
@@ -384,6 +434,54 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), Not(HasSubstr("Exp (")));
     }
 
+    TEST_F(ARendererStatistics, passesFlushTracesToTracerWhenSceneRendered)
+    {
+        FlushTracer tracer{ "flushTraces.json", 1u, "renderer" };
+        stats.setFlushTracer(&tracer);
+
+        FlushTrace trace;
+        trace.enabled = true;
+        trace.sceneId = sceneId1;
+        trace.flushIndex = 3u;
+        trace.mark(EFlushTraceStage::Applied);
+        stats.trackAppliedFlushTraces(sceneId1, { trace });
+
+        stats.sceneRendered(sceneId2);
+        EXPECT_EQ(0u, tracer.getNumberOfTraces());
+        stats.sceneRendered(sceneId1);
+        EXPECT_EQ(1u, tracer.getNumberOfTraces());
+        EXPECT_THAT(tracer.getChromeTraceJson(), HasSubstr(R"("name":"rendered")"));
+
+        // rendered again does not pass trace again
+        stats.sceneRendered(sceneId1);
+        EXPECT_EQ(1u, tracer.getNumberOfTraces());
+    }
+
+    TEST_F(ARendererStatistics, passesFlushTracesOfUntrackedSceneToTracerWithoutRender)
+    {
+        FlushTracer tracer{ "flushTraces.json", 1u, "renderer" };
+        stats.setFlushTracer(&tracer);
+
+        FlushTrace trace;
+        trace.enabled = true;
+        trace.mark(EFlushTraceStage::Applied);
+        stats.trackAppliedFlushTraces(sceneId1, { trace, trace });
+        EXPECT_EQ(0u, tracer.getNumberOfTraces());
+
+        stats.untrackScene(sceneId1);
+        EXPECT_EQ(2u, tracer.getNumberOfTraces());
+        EXPECT_THAT(tracer.getChromeTraceJson(), Not(HasSubstr(R"("name":"rendered")")));
+    }
+
+    TEST_F(ARendererStatistics, ignoresFlushTracesWithoutTracer)
+    {
+        FlushTrace trace;
+        trace.enabled = true;
+        stats.trackAppliedFlushTraces(sceneId1, { trace });
+        stats.sceneRendered(sceneId1);
+        stats.untrackScene(sceneId1);
+    }
+
 
     TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
     {
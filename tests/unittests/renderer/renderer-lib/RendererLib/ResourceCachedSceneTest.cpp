@@ -1300,4 +1300,72 @@ namespace ramses::internal
         EXPECT_TRUE(scene.hasDirtyVertexArrays());
         EXPECT_TRUE(scene.getVertexArraysDirtinessFlags()[renderable.asMemoryHandle()]);
     }
+
+    TEST_F(AResourceCachedScene, collectsBoundingSphereOfRenderableWithVec3PositionsAndModelMatrixIfFrustumCullingEnabled)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable({}, {}, { EFixedSemantics::ModelMatrix });
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.setFrustumCullingEnabled(true);
+
+        const BoundingSphere sphere{ glm::vec3{ 1.f, 2.f, 3.f }, 4.f };
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingSphere(MockResourceHash::VertArrayHash)).WillOnce(Return(sphere));
+        updateRenderableResourcesAndVertexArray({ renderable });
+
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        ASSERT_TRUE(scene.getCachedBoundingSpheres()[renderable.asMemoryHandle()]);
+        EXPECT_EQ(sphere, *scene.getCachedBoundingSpheres()[renderable.asMemoryHandle()]);
+    }
+
+    TEST_F(AResourceCachedScene, doesNotCollectBoundingSphereOfRenderableWhoseEffectDoesNotUseModelMatrix)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable({}, {}, { EFixedSemantics::ViewMatrix, EFixedSemantics::ProjectionMatrix });
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.setFrustumCullingEnabled(true);
+
+        // world matrix of renderable is not known to be applied to positions by shader
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingSphere(_)).Times(0);
+        updateRenderableResourcesAndVertexArray({ renderable });
+
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getCachedBoundingSpheres()[renderable.asMemoryHandle()]);
+    }
+
+    TEST_F(AResourceCachedScene, doesNotCollectBoundingSphereOfRenderableWithVec2Attribute)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable({}, {}, { EFixedSemantics::ModelViewProjectionMatrix });
+        DataFieldInfoVector geometryFields(3u);
+        geometryFields[0u] = DataFieldInfo(EDataType::Indices, 1u, EFixedSemantics::Indices);
+        geometryFields[1u] = DataFieldInfo(EDataType::Vector3Buffer);
+        geometryFields[2u] = DataFieldInfo(EDataType::Vector2Buffer);
+        const DataInstanceHandle geometryData = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(geometryFields, MockResourceHash::EffectHash));
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometryData);
+        scene.setDataResource(geometryData, DataFieldHandle(0u), MockResourceHash::IndexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometryData, DataFieldHandle(1u), MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometryData, DataFieldHandle(2u), MockResourceHash::VertArrayHash2, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setFrustumCullingEnabled(true);
+
+        // vec2 attribute could be the position, its z is up to shader
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingSphere(_)).Times(AnyNumber()).WillRepeatedly(Return(BoundingSphere{ glm::vec3{ 0.f }, 1.f }));
+        updateRenderableResourcesAndVertexArray({ renderable });
+
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getCachedBoundingSpheres()[renderable.asMemoryHandle()]);
+    }
+
+    TEST_F(AResourceCachedScene, doesNotCollectBoundingSphereOfRenderableIfAttributeHasNoKnownBoundingSphere)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable({}, {}, { EFixedSemantics::ModelMatrix });
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.setFrustumCullingEnabled(true);
+
+        // e.g. vec4 data with w other than 1
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingSphere(MockResourceHash::VertArrayHash)).WillOnce(Return(std::nullopt));
+        updateRenderableResourcesAndVertexArray({ renderable });
+
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getCachedBoundingSpheres()[renderable.asMemoryHandle()]);
+    }
 }
@@ -0,0 +1,152 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/RingBufferAllocator.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class ARingBufferAllocator : public ::testing::Test
+    {
+    protected:
+        RingBufferAllocator allocator{ 1024u, 64u };
+    };
+
+    TEST_F(ARingBufferAllocator, allocatesConsecutiveAlignedRegions)
+    {
+        EXPECT_EQ(0u, allocator.allocate(10u));
+        EXPECT_EQ(64u, allocator.allocate(64u));
+        EXPECT_EQ(128u, allocator.allocate(65u));
+        EXPECT_EQ(256u, allocator.allocate(1u));
+        EXPECT_EQ(320u, allocator.getUsedSize());
+        EXPECT_EQ(320u, allocator.getUnfencedSize());
+        EXPECT_EQ(1024u, allocator.getCapacity());
+    }
+
+    TEST_F(ARingBufferAllocator, failsToAllocateEmptyOrTooLargeRegion)
+    {
+        EXPECT_FALSE(allocator.allocate(0u));
+        EXPECT_FALSE(allocator.allocate(1025u));
+        EXPECT_EQ(0u, allocator.allocate(1024u));
+        EXPECT_EQ(1024u, allocator.getUsedSize());
+    }
+
+    TEST_F(ARingBufferAllocator, failsToAllocateWhenFullUntilFenceRetired)
+    {
+        EXPECT_EQ(0u, allocator.allocate(512u));
+        EXPECT_EQ(512u, allocator.allocate(512u));
+        EXPECT_FALSE(allocator.allocate(1u));
+
+        // unfenced regions cannot be released
+        allocator.retire(1u);
+        EXPECT_FALSE(allocator.allocate(1u));
+
+        allocator.fence(1u);
+        EXPECT_FALSE(allocator.hasUnfencedAllocations());
+        EXPECT_FALSE(allocator.allocate(1u));
+
+        allocator.retire(1u);
+        EXPECT_EQ(0u, allocator.getUsedSize());
+        EXPECT_EQ(0u, allocator.allocate(1024u));
+    }
+
+    TEST_F(ARingBufferAllocator, releasesOnlyRegionsOfRetiredFences)
+    {
+        EXPECT_EQ(0u, allocator.allocate(256u));
+        allocator.fence(1u);
+        EXPECT_EQ(256u, allocator.allocate(256u));
+        allocator.fence(2u);
+        EXPECT_EQ(512u, allocator.allocate(256u));
+        EXPECT_TRUE(allocator.hasUnfencedAllocations());
+        EXPECT_EQ(768u, allocator.getUsedSize());
+
+        allocator.retire(1u);
+        EXPECT_EQ(512u, allocator.getUsedSize());
+        allocator.retire(2u);
+        EXPECT_EQ(256u, allocator.getUsedSize());
+        EXPECT_EQ(256u, allocator.getUnfencedSize());
+    }
+
+    TEST_F(ARingBufferAllocator, retiringFenceReleasesAlsoAllPreviousFences)
+    {
+        EXPECT_EQ(0u, allocator.allocate(256u));
+        allocator.fence(1u);
+        EXPECT_EQ(256u, allocator.allocate(256u));
+        allocator.fence(2u);
+
+        allocator.retire(2u);
+        EXPECT_EQ(0u, allocator.getUsedSize());
+    }
+
+    TEST_F(ARingBufferAllocator, fenceWithoutAllocationsIsIgnored)
+    {
+        allocator.fence(1u);
+        EXPECT_EQ(0u, allocator.allocate(1024u));
+        allocator.fence(2u);
+        allocator.retire(1u);
+        EXPECT_EQ(1024u, allocator.getUsedSize());
+        allocator.retire(2u);
+        EXPECT_EQ(0u, allocator.getUsedSize());
+    }
+
+    TEST_F(ARingBufferAllocator, wrapsAroundSkippingRestOfRingIfRegionDoesNotFitBeforeEnd)
+    {
+        EXPECT_EQ(0u, allocator.allocate(512u));
+        allocator.fence(1u);
+        EXPECT_EQ(512u, allocator.allocate(384u));
+        allocator.fence(2u);
+        allocator.retire(1u);
+
+        // 128 bytes left at end, not enough
+        EXPECT_EQ(0u, allocator.allocate(256u));
+        EXPECT_EQ(384u + 128u + 256u, allocator.getUsedSize());
+        EXPECT_EQ(256u, allocator.allocate(256u));
+        EXPECT_FALSE(allocator.allocate(1u));
+
+        // skipped rest of ring is released together with regions of fence it was skipped for
+        allocator.fence(3u);
+        allocator.retire(2u);
+        EXPECT_EQ(128u + 512u, allocator.getUsedSize());
+        EXPECT_FALSE(allocator.allocate(512u));
+        EXPECT_EQ(512u, allocator.allocate(384u));
+
+        allocator.fence(4u);
+        allocator.retire(3u);
+        EXPECT_EQ(384u, allocator.getUsedSize());
+    }
+
+    TEST_F(ARingBufferAllocator, failsToWrapAroundIfRegionDoesNotFitBeforeOldestUsedRegion)
+    {
+        EXPECT_EQ(0u, allocator.allocate(256u));
+        allocator.fence(1u);
+        EXPECT_EQ(256u, allocator.allocate(512u));
+        allocator.fence(2u);
+        allocator.retire(1u);
+
+        EXPECT_FALSE(allocator.allocate(320u));
+        EXPECT_EQ(768u, allocator.allocate(256u));
+        EXPECT_EQ(0u, allocator.allocate(256u));
+    }
+
+    TEST_F(ARingBufferAllocator, releasesAllRegionsIncludingUnfencedOnesWhenReset)
+    {
+        EXPECT_EQ(0u, allocator.allocate(512u));
+        allocator.fence(1u);
+        EXPECT_EQ(512u, allocator.allocate(256u));
+        EXPECT_FALSE(allocator.allocate(512u));
+
+        allocator.reset();
+        EXPECT_EQ(0u, allocator.getUsedSize());
+        EXPECT_FALSE(allocator.hasUnfencedAllocations());
+        EXPECT_EQ(0u, allocator.allocate(1024u));
+
+        // retiring fence from before reset has no effect
+        allocator.retire(1u);
+        EXPECT_EQ(1024u, allocator.getUsedSize());
+    }
+}
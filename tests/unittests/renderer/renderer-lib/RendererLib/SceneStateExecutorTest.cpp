@@ -74,7 +74,7 @@ namespace ramses::internal
         void subscribeScene()
         {
             EXPECT_CALL(rendererSceneSender, sendSubscribeScene(sceneId));
-            sceneStateExecutor.setSubscriptionRequested(sceneId);
+            sceneStateExecutor.setSubscriptionRequested(sceneId, {});
             EXPECT_EQ(ESceneState::SubscriptionRequested, sceneStateExecutor.getSceneState(sceneId));
         }
 
@@ -940,7 +940,19 @@ namespace ramses::internal
     {
         publishScene();
         EXPECT_CALL(rendererSceneSender, sendSubscribeScene(sceneId));
-        sceneStateExecutor.setSubscriptionRequested(sceneId);
+        sceneStateExecutor.setSubscriptionRequested(sceneId, {});
+        expectNoRendererEvent();
+    }
+
+    TEST_F(ASceneStateExecutor, sendsAvailableResourcesBeforeRequestingSubscription)
+    {
+        publishScene();
+        const ResourceContentHashVector availableResources{ ResourceContentHash{ 1u, 2u }, ResourceContentHash{ 3u, 4u } };
+        InSequence seq;
+        EXPECT_CALL(rendererSceneSender, sendResourcesAvailable(sceneId, availableResources));
+        EXPECT_CALL(rendererSceneSender, sendSubscribeScene(sceneId));
+        sceneStateExecutor.setSubscriptionRequested(sceneId, availableResources);
+        EXPECT_EQ(ESceneState::SubscriptionRequested, sceneStateExecutor.getSceneState(sceneId));
         expectNoRendererEvent();
     }
 
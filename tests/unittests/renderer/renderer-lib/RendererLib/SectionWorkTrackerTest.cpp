@@ -0,0 +1,159 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SectionWorkTracker.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+
+namespace ramses::internal
+{
+    class ASectionWorkTracker : public ::testing::Test
+    {
+    protected:
+        ASectionWorkTracker()
+        {
+            frameTimer.startFrame();
+        }
+
+        void setBudget(uint64_t budgetInMicrosecs)
+        {
+            frameTimer.setSectionTimeBudget(section, budgetInMicrosecs);
+        }
+
+        static constexpr EFrameTimerSectionBudget section = EFrameTimerSectionBudget::OffscreenBufferRender;
+        FrameTimer frameTimer;
+    };
+
+    TEST_F(ASectionWorkTracker, neverInterruptsWithoutFrameTimer)
+    {
+        SectionWorkTracker work{ nullptr, section, 1u, 1u };
+        for (uint32_t i = 0u; i < 100u; ++i)
+            EXPECT_FALSE(work.workDone(1u, true));
+        EXPECT_EQ(100u, work.getNumWorkUnitsDone());
+    }
+
+    TEST_F(ASectionWorkTracker, doesGivenNumberOfUnitsBeforeFirstCheckEvenIfOutOfBudget)
+    {
+        setBudget(0u);
+        SectionWorkTracker work{ &frameTimer, section, 3u, 10u };
+        EXPECT_FALSE(work.workDone(1u));
+        EXPECT_FALSE(work.workDone(1u));
+        EXPECT_TRUE(work.workDone(1u));
+        EXPECT_EQ(3u, work.getNumWorkUnitsDone());
+    }
+
+    TEST_F(ASectionWorkTracker, checksAfterWorkForcedToBeChecked)
+    {
+        setBudget(0u);
+        SectionWorkTracker work{ &frameTimer, section, 3u, 10u };
+        EXPECT_TRUE(work.workDone(1u, true));
+    }
+
+    TEST_F(ASectionWorkTracker, staysInterruptedOnceInterrupted)
+    {
+        setBudget(0u);
+        SectionWorkTracker work{ &frameTimer, section, 1u, 10u };
+        EXPECT_TRUE(work.workDone(1u));
+        setBudget(std::numeric_limits<uint64_t>::max());
+        EXPECT_TRUE(work.workDone(1u));
+    }
+
+    TEST_F(ASectionWorkTracker, checksAtMostEveryMaxUnitsWithoutPrediction)
+    {
+        setBudget(std::numeric_limits<uint64_t>::max());
+        SectionWorkTracker work{ &frameTimer, section, 1u, 5u };
+        EXPECT_FALSE(work.workDone(1u));
+
+        // budget exceeded in between checks is noticed only at next check
+        setBudget(0u);
+        for (uint32_t i = 0u; i < 4u; ++i)
+            EXPECT_FALSE(work.workDone(1u));
+        EXPECT_TRUE(work.workDone(1u));
+    }
+
+    TEST_F(ASectionWorkTracker, reportsWorkToFrameTimerOnDestruction)
+    {
+        setBudget(std::numeric_limits<uint64_t>::max());
+        EXPECT_EQ(FrameTimer::Clock::duration::zero(), frameTimer.predictSectionWorkCost(section, 1u));
+        {
+            SectionWorkTracker work{ &frameTimer, section, 1u, 10u };
+            EXPECT_FALSE(work.workDone(2u));
+            PlatformThread::Sleep(2u);
+        }
+        EXPECT_GE(frameTimer.predictSectionWorkCost(section, 2u), std::chrono::milliseconds{ 2 });
+
+        frameTimer.startFrame();
+        const auto costs = frameTimer.getLastFrameSectionCosts(section);
+        EXPECT_EQ(2u, costs.numWorkUnits);
+        EXPECT_EQ(0, costs.predicted.count()); // no prediction available before first report
+        EXPECT_GE(costs.actual, std::chrono::milliseconds{ 2 });
+
+        // costs of other sections are not affected
+        EXPECT_EQ(0u, frameTimer.getLastFrameSectionCosts(EFrameTimerSectionBudget::ResourcesUpload).numWorkUnits);
+    }
+
+    TEST_F(ASectionWorkTracker, interruptsBeforeWorkPredictedToExceedRemainingBudget)
+    {
+        // learn that one unit costs around a second
+        frameTimer.reportSectionWork(section, 1u, std::chrono::seconds{ 1 });
+
+        // budget is not exceeded yet but next unit would not fit anymore
+        setBudget(100000u);
+        frameTimer.startFrame();
+        SectionWorkTracker work{ &frameTimer, section, 1u, 10u };
+        EXPECT_TRUE(work.workDone(1u));
+    }
+
+    TEST_F(ASectionWorkTracker, checksMoreOftenWhenApproachingPredictedDeadline)
+    {
+        // learn that one unit costs 10ms, budget of 1s fits around 100 units, check is done halfway through predicted work
+        frameTimer.reportSectionWork(section, 1u, std::chrono::milliseconds{ 10 });
+        setBudget(1000000u);
+        frameTimer.startFrame();
+
+        SectionWorkTracker work{ &frameTimer, section, 1u, 1000u };
+        EXPECT_FALSE(work.workDone(1u));
+
+        // budget exceeded before predicted check is noticed already after about 50 units, not after max units
+        setBudget(0u);
+        uint32_t numUnitsTillInterrupt = 1u;
+        while (!work.workDone(1u))
+            ++numUnitsTillInterrupt;
+        EXPECT_LE(numUnitsTillInterrupt, 51u);
+    }
+
+    TEST(AFrameTimer, reportsPredictedAndActualSectionCostsOfPreviousFrame)
+    {
+        FrameTimer frameTimer;
+        frameTimer.startFrame();
+        frameTimer.reportSectionWork(EFrameTimerSectionBudget::ResourcesUpload, 4u, std::chrono::milliseconds{ 8 });
+        frameTimer.startFrame();
+        frameTimer.reportSectionWork(EFrameTimerSectionBudget::ResourcesUpload, 2u, std::chrono::milliseconds{ 6 });
+
+        // costs of current frame are not reported until next frame starts
+        EXPECT_EQ(4u, frameTimer.getLastFrameSectionCosts(EFrameTimerSectionBudget::ResourcesUpload).numWorkUnits);
+
+        frameTimer.startFrame();
+        const auto costs = frameTimer.getLastFrameSectionCosts(EFrameTimerSectionBudget::ResourcesUpload);
+        EXPECT_EQ(2u, costs.numWorkUnits);
+        EXPECT_EQ(std::chrono::milliseconds{ 4 }, costs.predicted);
+        EXPECT_EQ(std::chrono::milliseconds{ 6 }, costs.actual);
+    }
+
+    TEST(AFrameTimer, adaptsPredictedUnitCostGradually)
+    {
+        FrameTimer frameTimer;
+        frameTimer.reportSectionWork(EFrameTimerSectionBudget::ResourcesUpload, 1u, std::chrono::milliseconds{ 1 });
+        EXPECT_EQ(std::chrono::milliseconds{ 1 }, frameTimer.predictSectionWorkCost(EFrameTimerSectionBudget::ResourcesUpload, 1u));
+
+        frameTimer.reportSectionWork(EFrameTimerSectionBudget::ResourcesUpload, 1u, std::chrono::milliseconds{ 9 });
+        EXPECT_EQ(std::chrono::milliseconds{ 2 }, frameTimer.predictSectionWorkCost(EFrameTimerSectionBudget::ResourcesUpload, 1u));
+    }
+}
@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
+#include "gtest/gtest.h"
+#include <array>
+
+namespace ramses::internal
+{
+    class AUniformBufferPool : public ::testing::Test
+    {
+    protected:
+        template <size_t N>
+        std::optional<UniformBufferPool::Range> allocate(const std::array<float, N>& values)
+        {
+            return pool.allocate(reinterpret_cast<const std::byte*>(values.data()), static_cast<uint32_t>(N * sizeof(float)));
+        }
+
+        UniformBufferPool pool{ 256u, 64u };
+    };
+
+    TEST_F(AUniformBufferPool, allocatesAlignedRangesForDifferentData)
+    {
+        const auto range1 = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f });
+        const auto range2 = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 5.f });
+        ASSERT_TRUE(range1 && range2);
+        EXPECT_TRUE(range1->isNew);
+        EXPECT_TRUE(range2->isNew);
+        EXPECT_EQ(0u, range1->offset);
+        EXPECT_EQ(64u, range2->offset);
+        EXPECT_EQ(128u, pool.getUsedSize());
+    }
+
+    TEST_F(AUniformBufferPool, sharesRangeForSameData)
+    {
+        const auto range1 = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f });
+        const auto range2 = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f });
+        ASSERT_TRUE(range1 && range2);
+        EXPECT_TRUE(range1->isNew);
+        EXPECT_FALSE(range2->isNew);
+        EXPECT_EQ(range1->offset, range2->offset);
+        EXPECT_EQ(64u, pool.getUsedSize());
+    }
+
+    TEST_F(AUniformBufferPool, doesNotShareRangeIfDataSizeDiffers)
+    {
+        const auto range1 = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f });
+        const auto range2 = allocate(std::array<float, 2>{ 1.f, 2.f });
+        ASSERT_TRUE(range1 && range2);
+        EXPECT_TRUE(range2->isNew);
+        EXPECT_NE(range1->offset, range2->offset);
+    }
+
+    TEST_F(AUniformBufferPool, failsToAllocateIfFullButStillProvidesExistingData)
+    {
+        for (float i = 0.f; i < 4.f; i += 1.f)
+        {
+            ASSERT_TRUE(allocate(std::array<float, 1>{ i }));
+        }
+        EXPECT_EQ(256u, pool.getUsedSize());
+        EXPECT_FALSE(allocate(std::array<float, 1>{ 4.f }));
+
+        const auto range = allocate(std::array<float, 1>{ 2.f });
+        ASSERT_TRUE(range);
+        EXPECT_FALSE(range->isNew);
+        EXPECT_EQ(128u, range->offset);
+    }
+
+    TEST_F(AUniformBufferPool, startsNewGenerationOnReset)
+    {
+        const auto generation = pool.getGeneration();
+        EXPECT_NE(0u, generation);
+        ASSERT_TRUE(allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f }));
+
+        pool.reset();
+        EXPECT_NE(generation, pool.getGeneration());
+        EXPECT_EQ(0u, pool.getUsedSize());
+
+        const auto range = allocate(std::array<float, 4>{ 1.f, 2.f, 3.f, 4.f });
+        ASSERT_TRUE(range);
+        EXPECT_TRUE(range->isNew);
+        EXPECT_EQ(0u, range->offset);
+    }
+}
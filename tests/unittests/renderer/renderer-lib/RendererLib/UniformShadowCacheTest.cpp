@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformShadowCache.h"
+#include "gtest/gtest.h"
+#include <array>
+
+namespace ramses::internal
+{
+    class AUniformShadowCache : public ::testing::Test
+    {
+    protected:
+        UniformShadowCache cache;
+    };
+
+    TEST_F(AUniformShadowCache, reportsChangeForFirstUpdateOfLocation)
+    {
+        const std::array<float, 2> value{ 1.f, 2.f };
+        EXPECT_TRUE(cache.update(0, value.data(), sizeof(value)));
+        EXPECT_TRUE(cache.update(5, value.data(), sizeof(value)));
+    }
+
+    TEST_F(AUniformShadowCache, reportsNoChangeForSameValue)
+    {
+        const std::array<float, 2> value{ 1.f, 2.f };
+        EXPECT_TRUE(cache.update(3, value.data(), sizeof(value)));
+        EXPECT_FALSE(cache.update(3, value.data(), sizeof(value)));
+
+        const std::array<float, 2> sameValue{ 1.f, 2.f };
+        EXPECT_FALSE(cache.update(3, sameValue.data(), sizeof(sameValue)));
+    }
+
+    TEST_F(AUniformShadowCache, reportsChangeForDifferentValue)
+    {
+        std::array<int32_t, 3> value{ 1, 2, 3 };
+        EXPECT_TRUE(cache.update(1, value.data(), sizeof(value)));
+        value[2] = 4;
+        EXPECT_TRUE(cache.update(1, value.data(), sizeof(value)));
+        EXPECT_FALSE(cache.update(1, value.data(), sizeof(value)));
+    }
+
+    TEST_F(AUniformShadowCache, tracksLocationsIndependently)
+    {
+        const std::array<float, 1> value1{ 1.f };
+        const std::array<float, 1> value2{ 2.f };
+        EXPECT_TRUE(cache.update(0, value1.data(), sizeof(value1)));
+        EXPECT_TRUE(cache.update(1, value2.data(), sizeof(value2)));
+        EXPECT_FALSE(cache.update(0, value1.data(), sizeof(value1)));
+        EXPECT_FALSE(cache.update(1, value2.data(), sizeof(value2)));
+        EXPECT_TRUE(cache.update(0, value2.data(), sizeof(value2)));
+        EXPECT_FALSE(cache.update(1, value2.data(), sizeof(value2)));
+    }
+
+    TEST_F(AUniformShadowCache, reportsChangeIfSizeOfValueDiffers)
+    {
+        const std::array<float, 4> value{ 1.f, 2.f, 3.f, 4.f };
+        EXPECT_TRUE(cache.update(2, value.data(), 2 * sizeof(float)));
+        EXPECT_TRUE(cache.update(2, value.data(), sizeof(value)));
+        EXPECT_FALSE(cache.update(2, value.data(), sizeof(value)));
+    }
+}
@@ -77,6 +77,8 @@ namespace ramses::internal
         MOCK_METHOD(bool, getBinaryShader, (DeviceResourceHandle, std::vector<std::byte>&, BinaryShaderFormatID&), (override));
         MOCK_METHOD(void, deleteShader, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, activateShader, (DeviceResourceHandle), (override));
+        MOCK_METHOD(bool, activateInstancedShader, (DeviceResourceHandle), (override));
+        MOCK_METHOD(void, uploadInstanceData, (const std::byte*, uint32_t), (override));
 
         MOCK_METHOD(DeviceResourceHandle, allocateTexture2D, (uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateTexture3D, (uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes), (override));
@@ -111,6 +113,7 @@ namespace ramses::internal
 
         MOCK_METHOD(uint32_t, getTotalGpuMemoryUsageInKB, (), (const, override));
         MOCK_METHOD(uint32_t, getAndResetDrawCallCount, (), (override));
+        MOCK_METHOD(void, getAndResetUniformUpdateCount, (uint32_t& numIssued, uint32_t& numSkipped), (override));
 
         MOCK_METHOD(void, validateDeviceStatusHealthy, (), (const, override));
         MOCK_METHOD(bool, isDeviceStatusHealthy, (), (const, override));
@@ -17,6 +17,7 @@ namespace ramses::internal
     {
     public:
         MOCK_METHOD(DeviceResourceHandle, getResourceDeviceHandle, (const ResourceContentHash& resourceHash), (const, override));
+        MOCK_METHOD(std::optional<BoundingSphere>, getResourceBoundingSphere, (const ResourceContentHash& resourceHash), (const, override));
         MOCK_METHOD(DeviceResourceHandle, getRenderTargetDeviceHandle, (RenderTargetHandle targetHandle, SceneId sceneId), (const, override));
         MOCK_METHOD(DeviceResourceHandle, getRenderTargetBufferDeviceHandle, (RenderBufferHandle bufferHandle, SceneId sceneId), (const, override));
         MOCK_METHOD(void, getBlitPassRenderTargetsDeviceHandle, (BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle&, DeviceResourceHandle&), (const, override));